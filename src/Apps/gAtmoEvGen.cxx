@@ -411,8 +411,8 @@ int main(int argc, char** argv)
     ntpw.AddEventRecord(iev, event);
     mcjmonitor.Update(iev,event);
 
-    // clean-up
-    delete event;
+    // clean-up (the record is re-used for a later event)
+    mcj_driver->RecycleEvent(event);
 
     if (gOptSecExposure > 0 && mcj_driver->NFluxNeutrinos()/mcj_driver->GlobProbScale() > expected_neutrinos) {
       break;
@@ -9,20 +9,28 @@
          sample is specified)
 
          Syntax :
-           gevcomp -f sample [-r reference_sample]
+           gevcomp -f sample [-r reference_sample] [-n nev] [-j n_workers]
 
          Options:
            [] Denotes an optional argument
            -f Specifies the GENIE/ROOT file with the generated event sample
 	   -r Specifies another GENIE/ROOT event sample file for comparison 
            -n Specifies how many events to analyze [default: all]
+           -j Specifies the number of worker processes [default: 1]
 
          Notes:
            The input ROOT files are the gst summary ntuples generated by 
-           GENIE's gntpc utility
+           GENIE's gntpc utility (or written directly by the event generation
+           job with `--ntp-outputs gst').
+           All plots are booked first and then filled in two passes over each
+           sample (one to find the plot ranges, one to fill the histograms),
+           reading only the gst columns used by the plots. Each pass splits the
+           sample in contiguous entry ranges processed by forked worker processes
+           whose histograms are summed, so the output does not depend on -j.
+           Both samples are shown with the same binning.
            	      
          Example:
-           gevcomp -f /path/gntp.1.gst.root -r /path/gntp.2.gst.root
+           gevcomp -f /path/gntp.1.gst.root -r /path/gntp.2.gst.root -j 8
 		      
 \author  Costas Andreopoulos <constantinos.andreopoulos \at cern.ch>
  University of Liverpool & STFC Rutherford Appleton Laboratory
@@ -36,13 +44,25 @@
 //____________________________________________________________________________
 
 #include <cassert>
+#include <cstdio>
 #include <sstream>
 #include <string>
+#include <vector>
+#include <map>
+#include <set>
+#include <iomanip>
+
+#include <unistd.h>
+#include <sys/wait.h>
 
 #include <TSystem.h>
 #include <TFile.h>
 #include <TDirectory.h>
 #include <TTree.h>
+#include <TBranch.h>
+#include <TLeaf.h>
+#include <TTreeFormula.h>
+#include <TTreeFormulaManager.h>
 #include <TVector3.h>
 #include <TLorentzVector.h>
 #include <TPostScript.h>
@@ -55,6 +75,8 @@
 #include <TText.h>
 #include <TStyle.h>
 #include <TLegend.h>
+#include <TStopwatch.h>
+#include <THLimitsFinder.h>
 
 #include "Framework/Messenger/Messenger.h"
 #include "Framework/ParticleData/PDGUtils.h"
@@ -63,20 +85,81 @@
 #include "Framework/Utils/Style.h"
 
 using std::ostringstream;
+using std::istringstream;
+using std::ostream;
+using std::istream;
 using std::string;
+using std::vector;
+using std::map;
+using std::set;
+using std::pair;
+using std::make_pair;
+using std::setprecision;
 
 using namespace genie;
 
+// passes over the event samples
+typedef enum EScanPass {
+  kPassRange = 0,   ///< find the range of each plotted quantity
+  kPassFill         ///< fill the plots
+} ScanPass_t;
+
+// a comparison plot: quantity `var' for the events (or particles) passing `sel'
+typedef struct SPlot {
+  string           var;          ///< plotted gst quantity (TTree::Draw expression)
+  string           sel;          ///< selection (TTree::Draw expression)
+  Long64_t         nsel;         ///< number of selected values (both samples)
+  double           vmin;         ///< minimum selected value   (both samples)
+  double           vmax;         ///< maximum selected value   (both samples)
+  double           entries [2];  ///< number of fills, per sample
+  vector<double>   sumw    [2];  ///< bin contents (incl. under/overflow), per sample
+  vector<double>   sumw2   [2];  ///< sum of squared weights, per sample
+  TH1D *           hist    [2];  ///< the plot, per sample
+} Plot_t;
+
 // function prototypes
 void   GetCommandLineArgs   (int argc, char ** argv);
 void   PrintSyntax          (void);
 bool   CheckRootFilename    (string filename);
 string OutputFileName       (string input_file_name);
 void   CreatePlots          (string filename, string filename_ref);
+void   MakePages            (void);
+void   TextPage             (TPavesText & text);
+void   PlotPage             (const char * title, const char * var, const char * sel);
+void   PlotPage             (const char * title,
+                             const char * var1, const char * sel1,
+                             const char * var2, const char * sel2,
+                             const char * var3, const char * sel3,
+                             const char * var4, const char * sel4);
+void   DrawPlot             (const char * var, const char * sel);
+double NSelected            (int isample, const char * sel);
+int    BookPlot             (const char * var, const char * sel);
+void   SetBinning           (void);
+void   MakeHistograms       (void);
+void   ScanSample           (int isample, ScanPass_t pass);
+void   ScanEntries          (string filename, ScanPass_t pass,
+                             Long64_t first, Long64_t last, ostream & out);
+void   MergeScan            (int isample, ScanPass_t pass, istream & in);
 
 // command-line arguments
 string   gOptInpFile     = ""; // (-f) input GENIE event sample file
 string   gOptInpFileRef  = ""; // (-r) input GENIE event sample file (reference)
+Long64_t gOptNEvt        = -1; // (-n) number of events to analyze
+int      gOptNWorkers    =  1; // (-j) number of worker processes
+
+// plots
+vector<Plot_t>                   gPlots;         ///< all booked plots
+map<pair<string,string>, int>    gPlotIds;       ///< plot id for each {var, sel}
+bool                             gBooking = true;///< booking (rather than drawing) plots?
+string                           gSampleFile[2]; ///< test & reference sample files
+Long64_t                         gNEvents   [2]; ///< number of events analyzed per sample
+
+// graphics
+TCanvas *     gC  = 0;
+TLegend *     gLS = 0;
+TPostScript * gPS = 0;
+
+const int kNBins = 100; // as for the histograms booked by TTree::Draw
 
 //_________________________________________________________________________________
 int main(int argc, char ** argv)
@@ -91,42 +174,77 @@ int main(int argc, char ** argv)
 //_________________________________________________________________________________
 void CreatePlots(string inp_filename, string inp_filename_ref)
 {
-  TFile * fin_0 = 0;
-  TFile * fin_1 = 0;
-  TTree * gst_0 = 0;
-  TTree * gst_1 = 0;
-
   if(!CheckRootFilename(inp_filename)) {
     LOG("gevcomp", pERROR) << "Input file: " << inp_filename << " doesn't exist";
     return;
   }
-  fin_0 = new TFile(inp_filename.c_str(),"READ");
-  gst_0 = (TTree *) fin_0->Get("gst");
-  assert(gst_0);
-  
-  if(CheckRootFilename(inp_filename_ref)) {
-     fin_1 = new TFile(inp_filename_ref.c_str(),"READ");
-     gst_1 = (TTree *) fin_1->Get("gst");
-     assert(gst_1);
+  gSampleFile[0] = inp_filename;
+  gSampleFile[1] = (CheckRootFilename(inp_filename_ref)) ? inp_filename_ref : "";
+
+  // Book all plots, walking through the pages without drawing them
+  //
+  gBooking = true;
+  MakePages();
+
+  LOG("gevcomp", pNOTICE) << "Booked " << gPlots.size() << " plots";
+
+  // Fill all plots: first find the plot ranges, then fill the histograms
+  //
+  TStopwatch timer;
+  timer.Start();
+
+  for(int isample = 0; isample < 2; isample++) {
+    if(gSampleFile[isample].size() > 0) ScanSample(isample, kPassRange);
   }
-  
-  gst_0->SetLineColor(kBlack);
-  gst_0->SetLineWidth(3);
-  if(gst_1) {
-    gst_1->SetLineColor(kRed);
-    gst_1->SetMarkerColor(kRed);
-    gst_1->SetLineWidth(2);
-    gst_1->SetMarkerStyle(20);
-    gst_1->SetMarkerSize(1);
+  SetBinning();
+  for(int isample = 0; isample < 2; isample++) {
+    if(gSampleFile[isample].size() > 0) ScanSample(isample, kPassFill);
   }
-  
+  MakeHistograms();
+
+  timer.Stop();
+  double nev = 2 * (gNEvents[0] + ((gSampleFile[1].size() > 0) ? gNEvents[1] : 0));
+  LOG("gevcomp", pNOTICE)
+     << "Filled " << gPlots.size() << " plots in " << timer.RealTime() << " s ("
+     << nev / TMath::Max(timer.RealTime(), 1E-9) << " events/s, using "
+     << gOptNWorkers << " process(es))";
+
   // Set global plot style
   //
   gStyle->SetOptTitle(0);
   gStyle->SetOptStat(0);
   gStyle->SetHistTopMargin(0.33);
   gStyle->SetHistMinimumZero(true);
-  
+
+  gC = new TCanvas("c","",20,20,500,650);
+  gC->SetBorderMode(0);
+  gC->SetFillColor(0);
+  gC->SetGridx();
+  gC->SetGridy();
+
+  gLS = new TLegend(0.20,0.94,0.99,0.99);
+  gLS->SetFillColor(0);
+  gLS->SetBorderSize(0);
+
+  string ps_filename = OutputFileName(inp_filename);
+  gPS = new TPostScript(ps_filename.c_str(), 111);
+
+  // Draw all pages
+  //
+  gBooking = false;
+  MakePages();
+
+  gPS->Close();
+
+  for(unsigned int i = 0; i < gPlots.size(); i++) {
+    for(int isample = 0; isample < 2; isample++) {
+      if(gPlots[i].hist[isample]) delete gPlots[i].hist[isample];
+    }
+  }
+}
+//_________________________________________________________________________________
+void MakePages(void)
+{
   // Plotting options
   //
   bool monoenergetic_sample = true;
@@ -135,28 +253,12 @@ void CreatePlots(string inp_filename, string inp_filename_ref)
   bool show_mult_per_proc   = true;
   bool show_primary_hadsyst = true;
   
-  gst_0->Draw("1","tgt>1000010010","GOFF");
-  show_coh_plots = (gst_0->GetSelectedRows() > 0); 
-
-  TCanvas * c = new TCanvas("c","",20,20,500,650);
-  c->SetBorderMode(0);
-  c->SetFillColor(0);
-  c->SetGridx();
-  c->SetGridy();
+  show_coh_plots = (NSelected(0,"tgt>1000010010") > 0);
 
-  TLegend * ls = new TLegend(0.20,0.94,0.99,0.99);
-  ls->SetFillColor(0);
-  ls->SetBorderSize(0);
-
-  string ps_filename = OutputFileName(inp_filename);
-  TPostScript * ps = new TPostScript(ps_filename.c_str(), 111);
-  
   //
   // SECTION: PS File Header
   //
 
-  ps->NewPage();
-  c->Range(0,0,100,100);
   TPavesText hdr(10,40,90,70,3,"tr");
   hdr.AddText("GENIE Event Sample Comparisons");
   hdr.AddText(" ");
@@ -167,647 +269,241 @@ void CreatePlots(string inp_filename, string inp_filename_ref)
   hdr.AddText("Notes:");
   hdr.AddText(" ");
   hdr.AddText(" ");
-  hdr.Draw();
-  c->Update();
+  TextPage(hdr);
 
   //
   // SECTION: Event Numbers
   //
 
-  TH1F * h0num = new TH1F("h0num","", 2, 0., 2.);
-  TH1F * h1num = new TH1F("h1num","", 2, 0., 2.);
-  float n0=0, n1=0;
-  ps->NewPage();
-  c->Range(0,0,100,100);
   TPavesText evn(10,10,90,90,3,"tr");
   evn.AddText("Event Numbers:");
   evn.AddText("  ");
- 
-            gst_0->Draw("1>>h0num","1","goff");
-  if(gst_1) gst_1->Draw("1>>h1num","1","goff");
-  n0 =           h0num->GetEntries();
-  n1 = (gst_1) ? h1num->GetEntries() : 0;
-  evn.AddText( Form("ALL    : %7.0f [test sample], %7.0f [ref sample]", n0, n1) );
-
-            gst_0->Draw("1>>h0num","qel","goff");
-  if(gst_1) gst_1->Draw("1>>h1num","qel","goff");
-  n0 =           h0num->GetEntries();
-  n1 = (gst_1) ? h1num->GetEntries() : 0;
-  evn.AddText( Form("QEL    : %7.0f [test sample], %7.0f [ref sample]", n0, n1) );
-
-            gst_0->Draw("1>>h0num","qel&&cc","goff");
-  if(gst_1) gst_1->Draw("1>>h1num","qel&&cc","goff");
-  n0 =           h0num->GetEntries();
-  n1 = (gst_1) ? h1num->GetEntries() : 0;
-  evn.AddText( Form("QEL-CC : %7.0f [test sample], %7.0f [ref sample]", n0, n1) );
-
-            gst_0->Draw("1>>h0num","qel&&nc","goff");
-  if(gst_1) gst_1->Draw("1>>h1num","qel&&nc","goff");
-  n0 =           h0num->GetEntries();
-  n1 = (gst_1) ? h1num->GetEntries() : 0;
-  evn.AddText( Form("QEL-NC : %7.0f [test sample], %7.0f [ref sample]", n0, n1) );
-
-            gst_0->Draw("1>>h0num","res","goff");
-  if(gst_1) gst_1->Draw("1>>h1num","res","goff");
-  n0 =           h0num->GetEntries();
-  n1 = (gst_1) ? h1num->GetEntries() : 0;
-  evn.AddText( Form("RES    : %7.0f [test sample], %7.0f [ref sample]", n0, n1) );
-
-            gst_0->Draw("1>>h0num","res&&cc","goff");
-  if(gst_1) gst_1->Draw("1>>h1num","res&&cc","goff");
-  n0 =           h0num->GetEntries();
-  n1 = (gst_1) ? h1num->GetEntries() : 0;
-  evn.AddText( Form("RES-CC : %7.0f [test sample], %7.0f [ref sample]", n0, n1) );
-
-            gst_0->Draw("1>>h0num","res&&nc","goff");
-  if(gst_1) gst_1->Draw("1>>h1num","res&&nc","goff");
-  n0 =           h0num->GetEntries();
-  n1 = (gst_1) ? h1num->GetEntries() : 0;
-  evn.AddText( Form("RES-NC : %7.0f [test sample], %7.0f [ref sample]", n0, n1) );
-
-            gst_0->Draw("1>>h0num","dis","goff");
-  if(gst_1) gst_1->Draw("1>>h1num","dis","goff");
-  n0 =           h0num->GetEntries();
-  n1 = (gst_1) ? h1num->GetEntries() : 0;
-  evn.AddText( Form("DIS    : %7.0f [test sample], %7.0f [ref sample]", n0, n1) );
-
-            gst_0->Draw("1>>h0num","dis&&cc","goff");
-  if(gst_1) gst_1->Draw("1>>h1num","dis&&cc","goff");
-  n0 =           h0num->GetEntries();
-  n1 = (gst_1) ? h1num->GetEntries() : 0;
-  evn.AddText( Form("DIS-CC : %7.0f [test sample], %7.0f [ref sample]", n0, n1) );
-
-            gst_0->Draw("1>>h0num","dis&&nc","goff");
-  if(gst_1) gst_1->Draw("1>>h1num","dis&&nc","goff");
-  n0 =           h0num->GetEntries();
-  n1 = (gst_1) ? h1num->GetEntries() : 0;
-  evn.AddText( Form("DIS-NC : %7.0f [test sample], %7.0f [ref sample]", n0, n1) );
-
-            gst_0->Draw("1>>h0num","coh","goff");
-  if(gst_1) gst_1->Draw("1>>h1num","coh","goff");
-  n0 =           h0num->GetEntries();
-  n1 = (gst_1) ? h1num->GetEntries() : 0;
-  evn.AddText( Form("COH      : %7.0f [test sample], %7.0f [ref sample]", n0, n1) );
-
-            gst_0->Draw("1>>h0num","coh&&cc","goff");
-  if(gst_1) gst_1->Draw("1>>h1num","coh&&cc","goff");
-  n0 =           h0num->GetEntries();
-  n1 = (gst_1) ? h1num->GetEntries() : 0;
-  evn.AddText( Form("COH-CC   : %7.0f [test sample], %7.0f [ref sample]", n0, n1) );
-
-            gst_0->Draw("1>>h0num","coh&&nc","goff");
-  if(gst_1) gst_1->Draw("1>>h1num","coh&&nc","goff");
-  n0 =           h0num->GetEntries();
-  n1 = (gst_1) ? h1num->GetEntries() : 0;
-  evn.AddText( Form("COH-NC   : %7.0f [test sample], %7.0f [ref sample]", n0, n1) );
-
-            gst_0->Draw("1>>h0num","imd","goff");
-  if(gst_1) gst_1->Draw("1>>h1num","imd","goff");
-  n0 =           h0num->GetEntries();
-  n1 = (gst_1) ? h1num->GetEntries() : 0;
-  evn.AddText( Form("IMD    : %7.0f [test sample], %7.0f [ref sample]", n0, n1) );
-
-            gst_0->Draw("1>>h0num","nuel","goff");
-  if(gst_1) gst_1->Draw("1>>h1num","nuel","goff");
-  n0 =           h0num->GetEntries();
-  n1 = (gst_1) ? h1num->GetEntries() : 0;
-  evn.AddText( Form("NuE-EL : %7.0f [test sample], %7.0f [ref sample]", n0, n1) );
-
-            gst_0->Draw("1>>h0num","dis&&cc&&charm","goff");
-  if(gst_1) gst_1->Draw("1>>h1num","dis&&cc&&charm","goff");
-  n0 =           h0num->GetEntries();
-  n1 = (gst_1) ? h1num->GetEntries() : 0;
-  evn.AddText( Form("DIS-CHARM: %7.0f [test sample], %7.0f [ref sample]", n0, n1) );
-
-            gst_0->Draw("1>>h0num","qel&&cc&&charm","goff");
-  if(gst_1) gst_1->Draw("1>>h1num","qel&&cc&&charm","goff");
-  n0 =           h0num->GetEntries();
-  n1 = (gst_1) ? h1num->GetEntries() : 0;
-  evn.AddText( Form("QEL-CHARM: %7.0f [test sample], %7.0f [ref sample]", n0, n1) );
-
-  evn.Draw();
-  c->Update();
+
+  evn.AddText( Form("ALL    : %7.0f [test sample], %7.0f [ref sample]", NSelected(0,"1"), NSelected(1,"1")) );
+
+  evn.AddText( Form("QEL    : %7.0f [test sample], %7.0f [ref sample]", NSelected(0,"qel"), NSelected(1,"qel")) );
+
+  evn.AddText( Form("QEL-CC : %7.0f [test sample], %7.0f [ref sample]", NSelected(0,"qel&&cc"), NSelected(1,"qel&&cc")) );
+
+  evn.AddText( Form("QEL-NC : %7.0f [test sample], %7.0f [ref sample]", NSelected(0,"qel&&nc"), NSelected(1,"qel&&nc")) );
+
+  evn.AddText( Form("RES    : %7.0f [test sample], %7.0f [ref sample]", NSelected(0,"res"), NSelected(1,"res")) );
+
+  evn.AddText( Form("RES-CC : %7.0f [test sample], %7.0f [ref sample]", NSelected(0,"res&&cc"), NSelected(1,"res&&cc")) );
+
+  evn.AddText( Form("RES-NC : %7.0f [test sample], %7.0f [ref sample]", NSelected(0,"res&&nc"), NSelected(1,"res&&nc")) );
+
+  evn.AddText( Form("DIS    : %7.0f [test sample], %7.0f [ref sample]", NSelected(0,"dis"), NSelected(1,"dis")) );
+
+  evn.AddText( Form("DIS-CC : %7.0f [test sample], %7.0f [ref sample]", NSelected(0,"dis&&cc"), NSelected(1,"dis&&cc")) );
+
+  evn.AddText( Form("DIS-NC : %7.0f [test sample], %7.0f [ref sample]", NSelected(0,"dis&&nc"), NSelected(1,"dis&&nc")) );
+
+  evn.AddText( Form("COH      : %7.0f [test sample], %7.0f [ref sample]", NSelected(0,"coh"), NSelected(1,"coh")) );
+
+  evn.AddText( Form("COH-CC   : %7.0f [test sample], %7.0f [ref sample]", NSelected(0,"coh&&cc"), NSelected(1,"coh&&cc")) );
+
+  evn.AddText( Form("COH-NC   : %7.0f [test sample], %7.0f [ref sample]", NSelected(0,"coh&&nc"), NSelected(1,"coh&&nc")) );
+
+  evn.AddText( Form("IMD    : %7.0f [test sample], %7.0f [ref sample]", NSelected(0,"imd"), NSelected(1,"imd")) );
+
+  evn.AddText( Form("NuE-EL : %7.0f [test sample], %7.0f [ref sample]", NSelected(0,"nuel"), NSelected(1,"nuel")) );
+
+  evn.AddText( Form("DIS-CHARM: %7.0f [test sample], %7.0f [ref sample]", NSelected(0,"dis&&cc&&charm"), NSelected(1,"dis&&cc&&charm")) );
+
+  evn.AddText( Form("QEL-CHARM: %7.0f [test sample], %7.0f [ref sample]", NSelected(0,"qel&&cc&&charm"), NSelected(1,"qel&&cc&&charm")) );
+
+  TextPage(evn);
 
   if(!monoenergetic_sample) {
-              gst_0->Draw("Ev","","");
-    if(gst_1) gst_1->Draw("Ev","","perrsame");
-    ls->Clear();
-    ls->SetHeader("Neutrino Energy Spectrum");
-    ls->Draw();
-    c->Update();  
+    PlotPage("Neutrino Energy Spectrum", "Ev", "");
   }
 
   //
   // SECTION: Kinematics
   //
-  ps->NewPage();
-  c->Clear();
-  c->Range(0,0,100,100);
   TPavesText hdrk(10,40,90,70,3,"tr");
   hdrk.AddText("Selected Kinematical Quantities");
   hdrk.AddText(" ");
-  hdrk.Draw();
-  c->Update();
+  TextPage(hdrk);
 
   //------ selected Q2 for all events
-  ps->NewPage();
-  gst_0->Draw("Q2s","Q2s>0","");
-  if(gst_1) gst_1->Draw("Q2s","Q2s>0","perrsame");
-  ls->Clear();
-  ls->SetHeader("selected Q2 for all events");
-  ls->Draw();
-  c->Update();
+  PlotPage("selected Q2 for all events", "Q2s", "Q2s>0");
 
   //------ selected Q2 for QEL
-  ps->NewPage();
-  gst_0->Draw("Q2s","qel&&!charm","");
-  if(gst_1) gst_1->Draw("Q2s","qel&&!charm","perrsame");
-  ls->Clear();
-  ls->SetHeader("selected Q2 for QEL events");
-  ls->Draw();
-  c->Update();
+  PlotPage("selected Q2 for QEL events", "Q2s", "qel&&!charm");
 
   //------ selected Q2 for QEL CC
-  ps->NewPage();
-  gst_0->Draw("Q2s","qel&&cc&&!charm","");
-  if(gst_1) gst_1->Draw("Q2s","qel&&cc&&!charm","perrsame");
-  ls->Clear();
-  ls->SetHeader("selected Q2 for QEL CC events");
-  ls->Draw();
-  c->Update();
+  PlotPage("selected Q2 for QEL CC events", "Q2s", "qel&&cc&&!charm");
 
   //------ selected Q2 for QEL NC
-  ps->NewPage();
-  gst_0->Draw("Q2s","qel&&nc&&!charm","");
-  if(gst_1) gst_1->Draw("Q2s","qel&&nc&&!charm","perrsame");
-  ls->Clear();
-  ls->SetHeader("selected Q2 for QEL NC events");
-  ls->Draw();
-  c->Update();
+  PlotPage("selected Q2 for QEL NC events", "Q2s", "qel&&nc&&!charm");
 
   //------ selected Q2 for RES
-  ps->NewPage();
-  gst_0->Draw("Q2s","res","");
-  if(gst_1) gst_1->Draw("Q2s","res","perrsame");
-  ls->Clear();
-  ls->SetHeader("selected Q2 for RES events");
-  ls->Draw();
-  c->Update();
+  PlotPage("selected Q2 for RES events", "Q2s", "res");
 
   //------ selected Q2 for RES CC
-  ps->NewPage();
-  gst_0->Draw("Q2s","res&&cc","");
-  if(gst_1) gst_1->Draw("Q2s","res&&cc","perrsame");
-  ls->Clear();
-  ls->SetHeader("selected Q2 for RES CC events");
-  ls->Draw();
-  c->Update();
+  PlotPage("selected Q2 for RES CC events", "Q2s", "res&&cc");
 
   //------ selected Q2 for RES NC
-  ps->NewPage();
-  gst_0->Draw("Q2s","res&&nc","");
-  if(gst_1) gst_1->Draw("Q2s","res&&nc","perrsame");
-  ls->Clear();
-  ls->SetHeader("selected Q2 for RES NC events");
-  ls->Draw();
-  c->Update();
+  PlotPage("selected Q2 for RES NC events", "Q2s", "res&&nc");
 
   //------ selected Q2 for DIS
-  ps->NewPage();
-  gst_0->Draw("Q2s","dis","");
-  if(gst_1) gst_1->Draw("Q2s","dis","perrsame");
-  ls->Clear();
-  ls->SetHeader("selected Q2 for DIS events");
-  ls->Draw();
-  c->Update();
+  PlotPage("selected Q2 for DIS events", "Q2s", "dis");
 
   //------ selected Q2 for DIS CC
-  ps->NewPage();
-  gst_0->Draw("Q2s","dis&&cc","");
-  if(gst_1) gst_1->Draw("Q2s","dis&&cc","perrsame");
-  ls->Clear();
-  ls->SetHeader("selected Q2 for DIS CC events");
-  ls->Draw();
-  c->Update();
+  PlotPage("selected Q2 for DIS CC events", "Q2s", "dis&&cc");
 
   //------ selected Q2 for DIS NC
-  ps->NewPage();
-  gst_0->Draw("Q2s","dis&&nc","");
-  if(gst_1) gst_1->Draw("Q2s","dis&&nc","perrsame");
-  ls->Clear();
-  ls->SetHeader("selected Q2 for DIS NC events");
-  ls->Draw();
-  c->Update();
+  PlotPage("selected Q2 for DIS NC events", "Q2s", "dis&&nc");
 
   //------ selected Q2 for Charm/DIS
-  ps->NewPage();
-  gst_0->Draw("Q2s","dis&&charm","");
-  if(gst_1) gst_1->Draw("Q2s","dis&&charm","perrsame");
-  ls->Clear();
-  ls->SetHeader("selected Q2 for Charm/DIS events");
-  ls->Draw();
-  c->Update();
+  PlotPage("selected Q2 for Charm/DIS events", "Q2s", "dis&&charm");
 
   if(show_coh_plots) {
      //------ selected Q2 for COH
-     ps->NewPage();
-     gst_0->Draw("Q2s","coh","");
-     if(gst_1) gst_1->Draw("Q2s","coh","perrsame");
-     ls->Clear();
-     ls->SetHeader("selected Q2 for COH events");
-     ls->Draw();
-     c->Update();
+     PlotPage("selected Q2 for COH events", "Q2s", "coh");
 
      //------ selected Q2 for COH CC
-     ps->NewPage();
-     gst_0->Draw("Q2s","coh&&cc","");
-     if(gst_1) gst_1->Draw("Q2s","coh&&cc","perrsame");
-     ls->Clear();
-     ls->SetHeader("selected Q2 for COH CC events");
-     ls->Draw();
-     c->Update();
+     PlotPage("selected Q2 for COH CC events", "Q2s", "coh&&cc");
 
      //------ selected Q2 for COH NC
-     ps->NewPage();
-     gst_0->Draw("Q2s","coh&&nc","");
-     if(gst_1) gst_1->Draw("Q2s","coh&&nc","perrsame");
-     ls->Clear();
-     ls->SetHeader("selected Q2 for COH NC events");
-     ls->Draw();
-     c->Update();
+     PlotPage("selected Q2 for COH NC events", "Q2s", "coh&&nc");
   }
-  
+
   //------ selected W for all events
-  ps->NewPage();
-  gst_0->Draw("Ws","Ws>0","");
-  if(gst_1) gst_1->Draw("Ws","Ws>0","perrsame");
-  ls->Clear();
-  ls->SetHeader("selected W for all events");
-  ls->Draw();
-  c->Update();
+  PlotPage("selected W for all events", "Ws", "Ws>0");
 
   //------ selected W for QEL
-  ps->NewPage();
-  gst_0->Draw("Ws","qel&&!charm","");
-  if(gst_1) gst_1->Draw("Ws","qel&&!charm","perrsame");
-  ls->Clear();
-  ls->SetHeader("selected W for QEL events");
-  ls->Draw();
-  c->Update();
+  PlotPage("selected W for QEL events", "Ws", "qel&&!charm");
 
   //------ selected W for RES
-  ps->NewPage();
-  gst_0->Draw("Ws","res","");
-  if(gst_1) gst_1->Draw("Ws","res","perrsame");
-  ls->Clear();
-  ls->SetHeader("selected W for RES events");
-  ls->Draw();
-  c->Update();
+  PlotPage("selected W for RES events", "Ws", "res");
 
   //------ selected W for DIS
-  ps->NewPage();
-  gst_0->Draw("Ws","dis","");
-  if(gst_1) gst_1->Draw("Ws","dis","perrsame");
-  ls->Clear();
-  ls->SetHeader("selected W for DIS events");
-  ls->Draw();
-  c->Update();
+  PlotPage("selected W for DIS events", "Ws", "dis");
 
   //------ selected W for DIS CC
-  ps->NewPage();
-  gst_0->Draw("Ws","dis&&cc","");
-  if(gst_1) gst_1->Draw("Ws","dis&&cc","perrsame");
-  ls->Clear();
-  ls->SetHeader("selected W for DIS CC events");
-  ls->Draw();
-  c->Update();
+  PlotPage("selected W for DIS CC events", "Ws", "dis&&cc");
 
   //------ selected W for DIS NC
-  ps->NewPage();
-  gst_0->Draw("Ws","dis&&nc","");
-  if(gst_1) gst_1->Draw("Ws","dis&&nc","perrsame");
-  ls->Clear();
-  ls->SetHeader("selected W for DIS NC events");
-  ls->Draw();
-  c->Update();
+  PlotPage("selected W for DIS NC events", "Ws", "dis&&nc");
 
   //------ selected x for all events
-  ps->NewPage();
-  gst_0->Draw("xs","","");
-  if(gst_1) gst_1->Draw("xs","","perrsame");
-  ls->Clear();
-  ls->SetHeader("selected x for all events");
-  ls->Draw();
-  c->Update();
+  PlotPage("selected x for all events", "xs", "");
 
   //------ selected x for QEL
-  ps->NewPage();
-  gst_0->Draw("xs","qel&&!charm","");
-  if(gst_1) gst_1->Draw("xs","qel&&!charm","perrsame");
-  ls->Clear();
-  ls->SetHeader("selected x for QEL events");
-  ls->Draw();
-  c->Update();
+  PlotPage("selected x for QEL events", "xs", "qel&&!charm");
 
   //------ selected x for RES
-  ps->NewPage();
-  gst_0->Draw("xs","res","");
-  if(gst_1) gst_1->Draw("xs","res","perrsame");
-  ls->Clear();
-  ls->SetHeader("selected x for RES events");
-  ls->Draw();
-  c->Update();
+  PlotPage("selected x for RES events", "xs", "res");
 
   //------ selected x for DIS
-  ps->NewPage();
-  gst_0->Draw("xs","dis","");
-  if(gst_1) gst_1->Draw("xs","dis","perrsame");
-  ls->Clear();
-  ls->SetHeader("selected x for DIS events");
-  ls->Draw();
-  c->Update();
+  PlotPage("selected x for DIS events", "xs", "dis");
 
   //------ selected x for DIS CC
-  ps->NewPage();
-  gst_0->Draw("xs","dis&&cc","");
-  if(gst_1) gst_1->Draw("xs","dis&&cc","perrsame");
-  ls->Clear();
-  ls->SetHeader("selected x for DIS CC events");
-  ls->Draw();
-  c->Update();
+  PlotPage("selected x for DIS CC events", "xs", "dis&&cc");
 
   //------ selected x for DIS NC
-  ps->NewPage();
-  gst_0->Draw("xs","dis&&nc","");
-  if(gst_1) gst_1->Draw("xs","dis&&nc","perrsame");
-  ls->Clear();
-  ls->SetHeader("selected x for DIS NC events");
-  ls->Draw();
-  c->Update();
-
-  //------ selected x for Charm/DIS 
-  ps->NewPage();
-  gst_0->Draw("xs","dis&&charm","");
-  if(gst_1) gst_1->Draw("xs","dis&&charm","perrsame");
-  ls->Clear();
-  ls->SetHeader("selected x for Charm/DIS events");
-  ls->Draw();
-  c->Update();
+  PlotPage("selected x for DIS NC events", "xs", "dis&&nc");
+
+  //------ selected x for Charm/DIS
+  PlotPage("selected x for Charm/DIS events", "xs", "dis&&charm");
 
   if(show_coh_plots) {
      //------ selected x for COH
-     ps->NewPage();
-     gst_0->Draw("xs","coh","");
-     if(gst_1) gst_1->Draw("xs","coh","perrsame");
-     ls->Clear();
-     ls->SetHeader("selected x for COH events");
-     ls->Draw();
-     c->Update();
+     PlotPage("selected x for COH events", "xs", "coh");
 
      //------ selected x for COH CC
-     ps->NewPage();
-     gst_0->Draw("xs","coh&&cc","");
-     if(gst_1) gst_1->Draw("xs","coh&&cc","perrsame");
-     ls->Clear();
-     ls->SetHeader("selected x for COH CC events");
-     ls->Draw();
-     c->Update();
+     PlotPage("selected x for COH CC events", "xs", "coh&&cc");
 
      //------ selected x for COH NC
-     ps->NewPage();
-     gst_0->Draw("xs","coh&&nc","");
-     if(gst_1) gst_1->Draw("xs","coh&&nc","perrsame");
-     ls->Clear();
-     ls->SetHeader("selected x for COH NC events");
-     ls->Draw();
-     c->Update();
+     PlotPage("selected x for COH NC events", "xs", "coh&&nc");
   }
 
   //------ selected y for all events
-  ps->NewPage();
-  gst_0->Draw("ys","","");
-  if(gst_1) gst_1->Draw("ys","","perrsame");
-  ls->Clear();
-  ls->SetHeader("selected y for all events");
-  ls->Draw();
-  c->Update();
+  PlotPage("selected y for all events", "ys", "");
 
   //------ selected y for QEL
-  ps->NewPage();
-  gst_0->Draw("ys","qel&&!charm","");
-  if(gst_1) gst_1->Draw("ys","qel&&!charm","perrsame");
-  ls->Clear();
-  ls->SetHeader("selected y for QEL events");
-  ls->Draw();
-  c->Update();
+  PlotPage("selected y for QEL events", "ys", "qel&&!charm");
 
   //------ selected y for RES
-  ps->NewPage();
-  gst_0->Draw("ys","res","");
-  if(gst_1) gst_1->Draw("ys","res","perrsame");
-  ls->Clear();
-  ls->SetHeader("selected y for RES events");
-  ls->Draw();
-  c->Update();
+  PlotPage("selected y for RES events", "ys", "res");
 
   //------ selected y for DIS
-  ps->NewPage();
-  gst_0->Draw("ys","dis","");
-  if(gst_1) gst_1->Draw("ys","dis","perrsame");
-  ls->Clear();
-  ls->SetHeader("selected y for DIS events");
-  ls->Draw();
-  c->Update();
+  PlotPage("selected y for DIS events", "ys", "dis");
 
   //------ selected y for DIS CC
-  ps->NewPage();
-  gst_0->Draw("ys","dis&&cc","");
-  if(gst_1) gst_1->Draw("ys","dis&&cc","perrsame");
-  ls->Clear();
-  ls->SetHeader("selected y for DIS CC events");
-  ls->Draw();
-  c->Update();
+  PlotPage("selected y for DIS CC events", "ys", "dis&&cc");
 
   //------ selected y for DIS NC
-  ps->NewPage();
-  gst_0->Draw("ys","dis&&nc","");
-  if(gst_1) gst_1->Draw("ys","dis&&nc","perrsame");
-  ls->Clear();
-  ls->SetHeader("selected y for DIS NC events");
-  ls->Draw();
-  c->Update();
-
-  //------ selected y for Charm/DIS 
-  ps->NewPage();
-  gst_0->Draw("ys","dis&&charm","");
-  if(gst_1) gst_1->Draw("ys","dis&&charm","perrsame");
-  ls->Clear();
-  ls->SetHeader("selected y for Charm/DIS events");
-  ls->Draw();
-  c->Update();
+  PlotPage("selected y for DIS NC events", "ys", "dis&&nc");
+
+  //------ selected y for Charm/DIS
+  PlotPage("selected y for Charm/DIS events", "ys", "dis&&charm");
 
   if(show_coh_plots) {
      //------ selected y for COH
-     ps->NewPage();
-     gst_0->Draw("ys","coh","");
-     if(gst_1) gst_1->Draw("ys","coh","perrsame");
-     ls->Clear();
-     ls->SetHeader("selected y for COH events");
-     ls->Draw();
-     c->Update();
+     PlotPage("selected y for COH events", "ys", "coh");
 
      //------ selected y for COH CC
-     ps->NewPage();
-     gst_0->Draw("ys","coh&&cc","");
-     if(gst_1) gst_1->Draw("ys","coh&&cc","perrsame");
-     ls->Clear();
-     ls->SetHeader("selected y for COH CC events");
-     ls->Draw();
-     c->Update();
+     PlotPage("selected y for COH CC events", "ys", "coh&&cc");
 
      //------ selected y for COH NC
-     ps->NewPage();
-     gst_0->Draw("ys","coh&&nc","");
-     if(gst_1) gst_1->Draw("ys","coh&&nc","perrsame");
-     ls->Clear();
-     ls->SetHeader("selected y for COH NC events");
-     ls->Draw();
-     c->Update();
+     PlotPage("selected y for COH NC events", "ys", "coh&&nc");
 
      //------ selected t for COH
-     ps->NewPage();
-     gst_0->Draw("ts","coh","");
-     if(gst_1) gst_1->Draw("ts","coh","perrsame");
-     ls->Clear();
-     ls->SetHeader("selected t for COH events");
-     ls->Draw();
-     c->Update();
+     PlotPage("selected t for COH events", "ts", "coh");
   }
 
   if(show_calc_kinematics) {
 
      //
-     // SECTION: Computed Kinematics 
+     // SECTION: Computed Kinematics
      //
-     ps->NewPage();
-     c->Clear();
-     c->Range(0,0,100,100);
      TPavesText hdrck(10,40,90,70,3,"tr");
      hdrck.AddText("Kinematical Quantities");
      hdrck.AddText(" ");
      hdrck.AddText(" ");
      hdrck.AddText("Similar to the previous set of plots but");
      hdrck.AddText("showing 'computed' rather than 'selected' variables");
-     hdrck.Draw();
-     c->Update();
+     TextPage(hdrck);
 
      //------ Q2 for all events
-     ps->NewPage();
-               gst_0->Draw("Q2","","");
-     if(gst_1) gst_1->Draw("Q2","","perrsame");
-     ls->Clear();
-     ls->SetHeader("computed Q2 for all events");
-     ls->Draw();
-     c->Update();
+     PlotPage("computed Q2 for all events", "Q2", "");
 
      //------ Q2 for QEL
-     ps->NewPage();
-               gst_0->Draw("Q2","qel&&!charm","");
-     if(gst_1) gst_1->Draw("Q2","qel&&!charm","perrsame");
-     ls->Clear();
-     ls->SetHeader("computed Q2 for QEL events");
-     ls->Draw();
-     c->Update();
+     PlotPage("computed Q2 for QEL events", "Q2", "qel&&!charm");
 
      //------ Q2 for RES
-     ps->NewPage();
-               gst_0->Draw("Q2","res","");
-     if(gst_1) gst_1->Draw("Q2","res","perrsame");
-     ls->Clear();
-     ls->SetHeader("computed Q2 for RES events");
-     ls->Draw();
-     c->Update();
+     PlotPage("computed Q2 for RES events", "Q2", "res");
 
      //------ Q2 for DIS
-     ps->NewPage();
-               gst_0->Draw("Q2","dis","");
-     if(gst_1) gst_1->Draw("Q2","dis","perrsame");
-     ls->Clear();
-     ls->SetHeader("computed Q2 for DIS events");
-     ls->Draw();
-     c->Update();
+     PlotPage("computed Q2 for DIS events", "Q2", "dis");
 
      //------ x for all events
-     ps->NewPage();
-     gst_0->Draw("x","","");
-     if(gst_1) gst_1->Draw("x","","perrsame");
-     ls->Clear();
-     ls->SetHeader("computed x for all events");
-     ls->Draw();
-     c->Update();
+     PlotPage("computed x for all events", "x", "");
 
      //------ x for QEL
-     ps->NewPage();
-     gst_0->Draw("x","qel&&!charm","");
-     if(gst_1) gst_1->Draw("x","qel&&!charm","perrsame");
-     ls->Clear();
-     ls->SetHeader("computed x for QEL events");
-     ls->Draw();
-     c->Update();
+     PlotPage("computed x for QEL events", "x", "qel&&!charm");
 
      //------ x for RES
-     ps->NewPage();
-     gst_0->Draw("x","res","");
-     if(gst_1) gst_1->Draw("x","res","perrsame");
-     ls->Clear();
-     ls->SetHeader("computed x for RES events");
-     ls->Draw();
-     c->Update();
+     PlotPage("computed x for RES events", "x", "res");
 
      //------ x for DIS
-     ps->NewPage();
-     gst_0->Draw("x","dis","");
-     if(gst_1) gst_1->Draw("x","dis","perrsame");
-     ls->Clear();
-     ls->SetHeader("computed x for DIS events");
-     ls->Draw();
-     c->Update();
+     PlotPage("computed x for DIS events", "x", "dis");
 
      //------ y for all events
-     ps->NewPage();
-     gst_0->Draw("y","","");
-     if(gst_1) gst_1->Draw("y","","perrsame");
-     ls->Clear();
-     ls->SetHeader("computed y for all events");
-     ls->Draw();
-     c->Update();
+     PlotPage("computed y for all events", "y", "");
 
      //------ y for QEL
-     ps->NewPage();
-     gst_0->Draw("y","qel&&!charm","");
-     if(gst_1) gst_1->Draw("y","qel&&!charm","perrsame");
-     ls->Clear();
-     ls->SetHeader("computed y for QEL events");
-     ls->Draw();
-     c->Update();
+     PlotPage("computed y for QEL events", "y", "qel&&!charm");
 
      //------ y for RES
-     ps->NewPage();
-     gst_0->Draw("y","res","");
-     if(gst_1) gst_1->Draw("y","res","perrsame");
-     ls->Clear();
-     ls->SetHeader("computed y for RES events");
-     ls->Draw();
-     c->Update();
+     PlotPage("computed y for RES events", "y", "res");
 
      //------ y for DIS
-     ps->NewPage();
-     gst_0->Draw("y","dis","");
-     if(gst_1) gst_1->Draw("y","dis","perrsame");
-     ls->Clear();
-     ls->SetHeader("computed y for DIS events");
-     ls->Draw();
-     c->Update();
+     PlotPage("computed y for DIS events", "y", "dis");
 
   }//show?
 
@@ -815,204 +511,78 @@ void CreatePlots(string inp_filename, string inp_filename_ref)
   //
   // SECTION: Initial State nucleon
   //
-  ps->NewPage();
-  c->Clear();
-  c->Range(0,0,100,100);
   TPavesText hdrinuc(10,40,90,70,3,"tr");
   hdrinuc.AddText("Initial state nucleon 4-Momentum");
-  hdrinuc.Draw();
-  c->Update();
+  TextPage(hdrinuc);
 
   //------ selected hit nucleon px
-  ps->NewPage();
-  c->Clear();
-  c->Divide(2,2);
-  c->cd(1);
-  gst_0->Draw("pxn","","");
-  if(gst_1) gst_1->Draw("pxn","","perrsame");
-  c->cd(2);
-  gst_0->Draw("pyn","","");
-  if(gst_1) gst_1->Draw("pyn","","perrsame");
-  c->cd(3);
-  gst_0->Draw("pzn","","");
-  if(gst_1) gst_1->Draw("pzn","","perrsame");
-  c->cd(4);
-  gst_0->Draw("En","En>.2","");
-  if(gst_1) gst_1->Draw("En","En>.2","perrsame");
-  c->Update();
+  PlotPage("Initial state nucleon 4-momentum",
+           "pxn", "",
+           "pyn", "",
+           "pzn", "",
+           "En", "En>.2");
 
   //
   // SECTION: Final State Primary Lepton
   //
-  ps->NewPage();
-  c->Clear();
-  c->Range(0,0,100,100);
   TPavesText hdrfsl(10,40,90,70,3,"tr");
   hdrfsl.AddText("Final State Primary Lepton 4-Momentum");
-  hdrfsl.Draw();
-  c->Update();
+  TextPage(hdrfsl);
 
   //------ f/s primary lepton : all events
-  ps->NewPage();
-  c->Divide(2,2);
-  c->cd(1);
-  gst_0->Draw("pxl","","");
-  if(gst_1) gst_1->Draw("pxl","","perrsame");
-  c->cd(2);
-  gst_0->Draw("pyl","","");
-  if(gst_1) gst_1->Draw("pyl","","perrsame");
-  c->cd(3);
-  gst_0->Draw("pzl","","");
-  if(gst_1) gst_1->Draw("pzl","","perrsame");
-  c->cd(4);
-  gst_0->Draw("El","","");
-  if(gst_1) gst_1->Draw("El","","perrsame");
-  c->cd();
-  ls->Clear();
-  ls->SetHeader("Final state primary lepton 4-p: All events");
-  ls->Draw();
-  c->Update();
+  PlotPage("Final state primary lepton 4-p: All events",
+           "pxl", "",
+           "pyl", "",
+           "pzl", "",
+           "El", "");
 
   //------ f/s primary lepton : all CC events
-  ps->NewPage();
-  c->Clear();
-  c->Divide(2,2);
-  c->cd(1);
-  gst_0->Draw("pxl","cc","");
-  if(gst_1) gst_1->Draw("pxl","cc","perrsame");
-  c->cd(2);
-  gst_0->Draw("pyl","cc","");
-  if(gst_1) gst_1->Draw("pyl","cc","perrsame");
-  c->cd(3);
-  gst_0->Draw("pzl","cc","");
-  if(gst_1) gst_1->Draw("pzl","cc","perrsame");
-  c->cd(4);
-  gst_0->Draw("El","cc","");
-  if(gst_1) gst_1->Draw("El","cc","perrsame");
-  c->cd();
-  ls->Clear();
-  ls->SetHeader("Final state primary lepton 4-p: All CC events");
-  ls->Draw();
-  c->Update();
+  PlotPage("Final state primary lepton 4-p: All CC events",
+           "pxl", "cc",
+           "pyl", "cc",
+           "pzl", "cc",
+           "El", "cc");
 
   //------ f/s primary lepton : all NC events
-  ps->NewPage();
-  c->Clear();
-  c->Divide(2,2);
-  c->cd(1);
-  gst_0->Draw("pxl","nc","");
-  if(gst_1) gst_1->Draw("pxl","nc","perrsame");
-  c->cd(2);
-  gst_0->Draw("pyl","nc","");
-  if(gst_1) gst_1->Draw("pyl","nc","perrsame");
-  c->cd(3);
-  gst_0->Draw("pzl","nc","");
-  if(gst_1) gst_1->Draw("pzl","nc","perrsame");
-  c->cd(4);
-  gst_0->Draw("El","nc","");
-  if(gst_1) gst_1->Draw("El","nc","perrsame");
-  c->cd();
-  ls->Clear();
-  ls->SetHeader("Final state primary lepton 4-p: All NC events");
-  ls->Draw();
-  c->Update();
+  PlotPage("Final state primary lepton 4-p: All NC events",
+           "pxl", "nc",
+           "pyl", "nc",
+           "pzl", "nc",
+           "El", "nc");
 
   //------ f/s primary lepton : QEL events
-  ps->NewPage();
-  c->Clear();
-  c->Divide(2,2);
-  c->cd(1);
-  gst_0->Draw("pxl","qel&&!charm","");
-  if(gst_1) gst_1->Draw("pxl","qel&&!charm","perrsame");
-  c->cd(2);
-  gst_0->Draw("pyl","qel&&!charm","");
-  if(gst_1) gst_1->Draw("pyl","qel&&!charm","perrsame");
-  c->cd(3);
-  gst_0->Draw("pzl","qel&&!charm","");
-  if(gst_1) gst_1->Draw("pzl","qel&&!charm","perrsame");
-  c->cd(4);
-  gst_0->Draw("El","qel&&!charm","");
-  if(gst_1) gst_1->Draw("El","qel&&!charm","perrsame");
-  c->cd();
-  ls->Clear();
-  ls->SetHeader("Final state primary lepton 4-p: QEL events");
-  ls->Draw();
-  c->Update();
+  PlotPage("Final state primary lepton 4-p: QEL events",
+           "pxl", "qel&&!charm",
+           "pyl", "qel&&!charm",
+           "pzl", "qel&&!charm",
+           "El", "qel&&!charm");
 
   //------ f/s primary lepton : RES events
-  ps->NewPage();
-  c->Clear();
-  c->Divide(2,2);
-  c->cd(1);
-  gst_0->Draw("pxl","res","");
-  if(gst_1) gst_1->Draw("pxl","res","perrsame");
-  c->cd(2);
-  gst_0->Draw("pyl","res","");
-  if(gst_1) gst_1->Draw("pyl","res","perrsame");
-  c->cd(3);
-  gst_0->Draw("pzl","res","");
-  if(gst_1) gst_1->Draw("pzl","res","perrsame");
-  c->cd(4);
-  gst_0->Draw("El","res","");
-  if(gst_1) gst_1->Draw("El","res","perrsame");
-  c->cd();
-  ls->Clear();
-  ls->SetHeader("Final state primary lepton 4-p: RES events");
-  ls->Draw();
-  c->Update();
+  PlotPage("Final state primary lepton 4-p: RES events",
+           "pxl", "res",
+           "pyl", "res",
+           "pzl", "res",
+           "El", "res");
 
   //------ f/s primary lepton : DIS events
-  ps->NewPage();
-  c->Clear();
-  c->Divide(2,2);
-  c->cd(1);
-  gst_0->Draw("pxl","dis","");
-  if(gst_1) gst_1->Draw("pxl","dis","perrsame");
-  c->cd(2);
-  gst_0->Draw("pyl","dis","");
-  if(gst_1) gst_1->Draw("pyl","dis","perrsame");
-  c->cd(3);
-  gst_0->Draw("pzl","dis","");
-  if(gst_1) gst_1->Draw("pzl","dis","perrsame");
-  c->cd(4);
-  gst_0->Draw("El","dis","");
-  if(gst_1) gst_1->Draw("El","dis","perrsame");
-  c->cd();
-  ls->Clear();
-  ls->SetHeader("Final state primary lepton 4-p: All DIS events");
-  ls->Draw();
-  c->Update();
+  PlotPage("Final state primary lepton 4-p: All DIS events",
+           "pxl", "dis",
+           "pyl", "dis",
+           "pzl", "dis",
+           "El", "dis");
 
   if(show_coh_plots) {
      //------ f/s primary lepton : COH events
-     ps->NewPage();
-     c->Clear();
-     c->Divide(2,2);
-     c->cd(1);
-     gst_0->Draw("pxl","coh","");
-     if(gst_1) gst_1->Draw("pxl","coh","perrsame");
-     c->cd(2);
-     gst_0->Draw("pyl","coh","");
-     if(gst_1) gst_1->Draw("pyl","coh","perrsame");
-     c->cd(3);
-     gst_0->Draw("pzl","coh","");
-     if(gst_1) gst_1->Draw("pzl","coh","perrsame");
-     c->cd(4);
-     gst_0->Draw("El","coh","");
-     if(gst_1) gst_1->Draw("El","coh","perrsame");
-     c->cd();
-     ls->Clear();
-     ls->SetHeader("Final state primary lepton 4-p: COH events");
-     ls->Draw();
-     c->Update();
+     PlotPage("Final state primary lepton 4-p: COH events",
+              "pxl", "coh",
+              "pyl", "coh",
+              "pzl", "coh",
+              "El", "coh");
   }
 
   //
   // SECTION: Final State Hadronic System Multiplicities & 4P
   //
-  ps->NewPage();
-  c->Clear();
-  c->Range(0,0,100,100);
   TPavesText hdrfhad(10,40,90,70,3,"tr");
   hdrfhad.AddText("Final State Hadronic System");
   hdrfhad.AddText("Multiplicities and 4-Momenta");
@@ -1023,189 +593,66 @@ void CreatePlots(string inp_filename, string inp_filename_ref)
   hdrfhad.AddText("Note:");
   hdrfhad.AddText("For nuclear targets these plots include the effect");
   hdrfhad.AddText("of intranuclear hadron transport / rescattering");
-  hdrfhad.Draw();
-  c->Update();
+  TextPage(hdrfhad);
 
   //------ number of final state p
-  ps->NewPage();
-  gst_0->Draw("nfp","","");
-  if(gst_1) gst_1->Draw("nfp","","perrsame");
-  ls->Clear();
-  ls->SetHeader("Number of final state protons");
-  ls->Draw();
-  c->Update();
+  PlotPage("Number of final state protons", "nfp", "");
 
   //------ number of final state n
-  ps->NewPage();
-  gst_0->Draw("nfn","","");
-  if(gst_1) gst_1->Draw("nfn","","perrsame");
-  ls->Clear();
-  ls->SetHeader("Number of final state neutrons");
-  ls->Draw();
-  c->Update();
+  PlotPage("Number of final state neutrons", "nfn", "");
 
   //------ number of final state pi+
-  ps->NewPage();
-  gst_0->Draw("nfpip","","");
-  if(gst_1) gst_1->Draw("nfpip","","perrsame");
-  ls->Clear();
-  ls->SetHeader("Number of final state pi+");
-  ls->Draw();
-  c->Update();
+  PlotPage("Number of final state pi+", "nfpip", "");
 
   //------ number of final state pi-
-  ps->NewPage();
-  gst_0->Draw("nfpim","","");
-  if(gst_1) gst_1->Draw("nfpim","","perrsame");
-  ls->Clear();
-  ls->SetHeader("Number of final state pi-");
-  ls->Draw();
-  c->Update();
+  PlotPage("Number of final state pi-", "nfpim", "");
 
   //------ number of final state pi0
-  ps->NewPage();
-  gst_0->Draw("nfpi0","","");
-  if(gst_1) gst_1->Draw("nfpi0","","perrsame");
-  ls->Clear();
-  ls->SetHeader("Number of final state pi0");
-  ls->Draw();
-  c->Update();
+  PlotPage("Number of final state pi0", "nfpi0", "");
 
   //------ number of final state K+
-  ps->NewPage();
-  gst_0->Draw("nfkp","","");
-  if(gst_1) gst_1->Draw("nfkp","","perrsame");
-  ls->Clear();
-  ls->SetHeader("Number of final state K+");
-  ls->Draw();
-  c->Update();
+  PlotPage("Number of final state K+", "nfkp", "");
 
   //------ number of final state K-
-  ps->NewPage();
-  gst_0->Draw("nfkm","","");
-  if(gst_1) gst_1->Draw("nfkm","","perrsame");
-  ls->Clear();
-  ls->SetHeader("Number of final state K-");
-  ls->Draw();
-  c->Update();
+  PlotPage("Number of final state K-", "nfkm", "");
 
   //------ number of final state K0
-  ps->NewPage();
-  gst_0->Draw("nfk0","","");
-  if(gst_1) gst_1->Draw("nfk0","","perrsame");
-  ls->Clear();
-  ls->SetHeader("Number of final state K0");
-  ls->Draw();
-  c->Update();
+  PlotPage("Number of final state K0", "nfk0", "");
 
   //------ momentum of final state p
-  ps->NewPage();
-  c->Divide(2,2);
-  c->cd(1);
-  gst_0->Draw("pxf","pdgf==2212","");
-  if(gst_1) gst_1->Draw("pxf","pdgf==2212","perrsame");
-  c->cd(2);
-  gst_0->Draw("pyf","pdgf==2212","");
-  if(gst_1) gst_1->Draw("pyf","pdgf==2212","perrsame");
-  c->cd(3);
-  gst_0->Draw("pzf","pdgf==2212","");
-  if(gst_1) gst_1->Draw("pzf","pdgf==2212","perrsame"); 
-  c->cd(4);
-  gst_0->Draw("Ef","pdgf==2212","");
-  if(gst_1) gst_1->Draw("Ef","pdgf==2212","perrsame");
-  c->cd();
-  ls->Clear();
-  ls->SetHeader("Final state protons 4-momentum");
-  ls->Draw();
-  c->Update();
+  PlotPage("Final state protons 4-momentum",
+           "pxf", "pdgf==2212",
+           "pyf", "pdgf==2212",
+           "pzf", "pdgf==2212",
+           "Ef", "pdgf==2212");
 
   //------ momentum of final state n
-  ps->NewPage();
-  c->Clear();
-  c->Divide(2,2);
-  c->cd(1);
-  gst_0->Draw("pxf","pdgf==2112","");
-  if(gst_1) gst_1->Draw("pxf","pdgf==2112","perrsame");
-  c->cd(2);
-  gst_0->Draw("pyf","pdgf==2112","");
-  if(gst_1) gst_1->Draw("pyf","pdgf==2112","perrsame");
-  c->cd(3);
-  gst_0->Draw("pzf","pdgf==2112","");
-  if(gst_1) gst_1->Draw("pzf","pdgf==2112","perrsame");
-  c->cd(4);
-  gst_0->Draw("Ef","pdgf==2112","");
-  if(gst_1) gst_1->Draw("Ef","pdgf==2112","perrsame");
-  c->cd();
-  ls->Clear();
-  ls->SetHeader("Final state neutrons 4-momentum");
-  ls->Draw();
-  c->Update();
+  PlotPage("Final state neutrons 4-momentum",
+           "pxf", "pdgf==2112",
+           "pyf", "pdgf==2112",
+           "pzf", "pdgf==2112",
+           "Ef", "pdgf==2112");
 
   //------ momentum of final state pi0
-  ps->NewPage();
-  c->Clear();
-  c->Divide(2,2);
-  c->cd(1);
-  gst_0->Draw("pxf","pdgf==111","");
-  if(gst_1) gst_1->Draw("pxf","pdgf==111","perrsame");
-  c->cd(2);
-  gst_0->Draw("pyf","pdgf==111","");
-  if(gst_1) gst_1->Draw("pyf","pdgf==111","perrsame");
-  c->cd(3);
-  gst_0->Draw("pzf","pdgf==111","");
-  if(gst_1) gst_1->Draw("pzf","pdgf==111","perrsame");
-  c->cd(4);
-  gst_0->Draw("Ef","pdgf==111","");
-  if(gst_1) gst_1->Draw("Ef","pdgf==111","perrsame");
-  c->cd();
-  ls->Clear();
-  ls->SetHeader("Final state pi0's 4-momentum");
-  ls->Draw();
-  c->Update();
+  PlotPage("Final state pi0's 4-momentum",
+           "pxf", "pdgf==111",
+           "pyf", "pdgf==111",
+           "pzf", "pdgf==111",
+           "Ef", "pdgf==111");
 
   //------ momentum of final state pi+
-  ps->NewPage();
-  c->Clear();
-  c->Divide(2,2);
-  c->cd(1);
-  gst_0->Draw("pxf","pdgf==211","");
-  if(gst_1) gst_1->Draw("pxf","pdgf==211","perrsame");
-  c->cd(2);
-  gst_0->Draw("pyf","pdgf==211","");
-  if(gst_1) gst_1->Draw("pyf","pdgf==211","perrsame");
-  c->cd(3);
-  gst_0->Draw("pzf","pdgf==211","");
-  if(gst_1) gst_1->Draw("pzf","pdgf==211","perrsame");
-  c->cd(4);
-  gst_0->Draw("Ef","pdgf==211","");
-  if(gst_1) gst_1->Draw("Ef","pdgf==211","perrsame");
-  c->cd();
-  ls->Clear();
-  ls->SetHeader("Final state pi+'s 4-momentum");
-  ls->Draw();
-  c->Update();
+  PlotPage("Final state pi+'s 4-momentum",
+           "pxf", "pdgf==211",
+           "pyf", "pdgf==211",
+           "pzf", "pdgf==211",
+           "Ef", "pdgf==211");
 
   //------ momentum of final state pi+
-  ps->NewPage();
-  c->Clear();
-  c->Divide(2,2);
-  c->cd(1);
-  gst_0->Draw("pxf","pdgf==-211","");
-  if(gst_1) gst_1->Draw("pxf","pdgf==-211","perrsame");
-  c->cd(2);
-  gst_0->Draw("pyf","pdgf==-211","");
-  if(gst_1) gst_1->Draw("pyf","pdgf==-211","perrsame");
-  c->cd(3);
-  gst_0->Draw("pzf","pdgf==-211","");
-  if(gst_1) gst_1->Draw("pzf","pdgf==-211","perrsame");
-  c->cd(4);
-  gst_0->Draw("Ef","pdgf==-211","");
-  if(gst_1) gst_1->Draw("Ef","pdgf==-211","perrsame");
-  c->cd();
-  ls->Clear();
-  ls->SetHeader("Final state pi-'s 4-momentum");
-  ls->Draw();
-  c->Update();
+  PlotPage("Final state pi-'s 4-momentum",
+           "pxf", "pdgf==-211",
+           "pyf", "pdgf==-211",
+           "pzf", "pdgf==-211",
+           "Ef", "pdgf==-211");
 
   if(show_mult_per_proc) {
 
@@ -1214,566 +661,197 @@ void CreatePlots(string inp_filename, string inp_filename_ref)
      //
 
      //------ number of final state p /QEL
-     ps->NewPage();
-     if(gst_1) gst_1->Draw("nfp","qel&&!charm","");
-     gst_0->Draw("nfp","qel&&!charm","perrsame");
-     ls->Clear();
-     ls->SetHeader("Number of final state protons / QEL only");
-     ls->Draw();
-     c->Update();
+     PlotPage("Number of final state protons / QEL only", "nfp", "qel&&!charm");
 
      //------ number of final state n /QEL
-     ps->NewPage();
-     if(gst_1) gst_1->Draw("nfn","qel&&!charm","");
-     gst_0->Draw("nfn","qel&&!charm","perrsame");
-     ls->Clear();
-     ls->SetHeader("Number of final state neutrons / QEL only");
-     ls->Draw();
-     c->Update();
+     PlotPage("Number of final state neutrons / QEL only", "nfn", "qel&&!charm");
 
      //------ number of final state pi+ /QEL
-     ps->NewPage();
-     gst_0->Draw("nfpip","qel&&!charm","");
-     if(gst_1) gst_1->Draw("nfpip","qel&&!charm","perrsame");
-     ls->Clear();
-     ls->SetHeader("Number of final state pi+ / QEL only");
-     ls->Draw();
-     c->Update();
+     PlotPage("Number of final state pi+ / QEL only", "nfpip", "qel&&!charm");
 
      //------ number of final state pi- /QEL
-     ps->NewPage();
-     gst_0->Draw("nfpim","qel&&!charm","");
-     if(gst_1) gst_1->Draw("nfpim","qel&&!charm","perrsame");
-     ls->Clear();
-     ls->SetHeader("Number of final state pi- / QEL only");
-     ls->Draw();
-     c->Update();
+     PlotPage("Number of final state pi- / QEL only", "nfpim", "qel&&!charm");
 
      //------ number of final state pi0 /QEL
-     ps->NewPage();
-     gst_0->Draw("nfpi0","qel&&!charm","");
-     if(gst_1) gst_1->Draw("nfpi0","qel&&!charm","perrsame");
-     ls->Clear();
-     ls->SetHeader("Number of final state pi0 / QEL only");
-     ls->Draw();
-     c->Update();
+     PlotPage("Number of final state pi0 / QEL only", "nfpi0", "qel&&!charm");
 
      //------ number of final state K+ /QEL
-     ps->NewPage();
-     gst_0->Draw("nfkp","qel&&!charm","");
-     if(gst_1) gst_1->Draw("nfkp","qel&&!charm","perrsame");
-     ls->Clear();
-     ls->SetHeader("Number of final state K+ / QEL only");
-     ls->Draw();
-     c->Update();
+     PlotPage("Number of final state K+ / QEL only", "nfkp", "qel&&!charm");
 
      //------ number of final state K- /QEL
-     ps->NewPage();
-     gst_0->Draw("nfkm","qel&&!charm","");
-     if(gst_1) gst_1->Draw("nfkm","qel&&!charm","perrsame");
-     ls->Clear();
-     ls->SetHeader("Number of final state K- / QEL only");
-     ls->Draw();
-     c->Update();
+     PlotPage("Number of final state K- / QEL only", "nfkm", "qel&&!charm");
 
      //------ number of final state K0 /QEL
-     ps->NewPage();
-     gst_0->Draw("nfk0","qel&&!charm","");
-     if(gst_1) gst_1->Draw("nfk0","qel&&!charm","perrsame");
-     ls->Clear();
-     ls->SetHeader("Number of final state K0 / QEL only");
-     ls->Draw();
-     c->Update();
+     PlotPage("Number of final state K0 / QEL only", "nfk0", "qel&&!charm");
 
      //------ momentum of final state p /QEL
-     ps->NewPage();
-     c->Divide(2,2);
-     c->cd(1);
-     gst_0->Draw("pxf","qel&&!charm&&pdgf==2212","");
-     if(gst_1) gst_1->Draw("pxf","qel&&!charm&&pdgf==2212","perrsame");
-     c->cd(2);
-     gst_0->Draw("pyf","qel&&!charm&&pdgf==2212","");
-     if(gst_1) gst_1->Draw("pyf","qel&&!charm&&pdgf==2212","perrsame");
-     c->cd(3);
-     gst_0->Draw("pzf","qel&&!charm&&pdgf==2212","");
-     if(gst_1) gst_1->Draw("pzf","qel&&!charm&&pdgf==2212","perrsame");
-     c->cd(4);
-     gst_0->Draw("Ef","qel&&!charm&&pdgf==2212","");
-     if(gst_1) gst_1->Draw("Ef","qel&&!charm&&pdgf==2212","perrsame");
-     c->cd();
-     ls->Clear();
-     ls->SetHeader("Final state protons 4-momentum / QEL only");
-     ls->Draw();
-     c->Update();
+     PlotPage("Final state protons 4-momentum / QEL only",
+              "pxf", "qel&&!charm&&pdgf==2212",
+              "pyf", "qel&&!charm&&pdgf==2212",
+              "pzf", "qel&&!charm&&pdgf==2212",
+              "Ef", "qel&&!charm&&pdgf==2212");
 
      //------ momentum of final state n /QEL
-     ps->NewPage();
-     c->Clear();
-     c->Divide(2,2);
-     c->cd(1);
-     gst_0->Draw("pxf","qel&&!charm&&pdgf==2112","");
-     if(gst_1) gst_1->Draw("pxf","qel&&!charm&&pdgf==2112","perrsame");
-     c->cd(2);
-     gst_0->Draw("pyf","qel&&!charm&&pdgf==2112","");
-     if(gst_1) gst_1->Draw("pyf","qel&&!charm&&pdgf==2112","perrsame");
-     c->cd(3);
-     gst_0->Draw("pzf","qel&&!charm&&pdgf==2112","");
-     if(gst_1) gst_1->Draw("pzf","qel&&!charm&&pdgf==2112","perrsame");
-     c->cd(4);
-     gst_0->Draw("Ef","qel&&!charm&&pdgf==2112","");
-     if(gst_1) gst_1->Draw("Ef","qel&&!charm&&pdgf==2112","perrsame");
-     c->cd();
-     ls->Clear();
-     ls->SetHeader("Final state neutrons 4-momentum / QEL only");
-     ls->Draw();
-     c->Update();
+     PlotPage("Final state neutrons 4-momentum / QEL only",
+              "pxf", "qel&&!charm&&pdgf==2112",
+              "pyf", "qel&&!charm&&pdgf==2112",
+              "pzf", "qel&&!charm&&pdgf==2112",
+              "Ef", "qel&&!charm&&pdgf==2112");
 
      //------ momentum of final state pi0 /QEL
-     ps->NewPage();
-     c->Clear();
-     c->Divide(2,2);
-     c->cd(1);
-     gst_0->Draw("pxf","qel&&!charm&&pdgf==111","");
-     if(gst_1) gst_1->Draw("pxf","qel&&!charm&&pdgf==111","perrsame");
-     c->cd(2);
-     gst_0->Draw("pyf","qel&&!charm&&pdgf==111","");
-     if(gst_1) gst_1->Draw("pyf","qel&&!charm&&pdgf==111","perrsame");
-     c->cd(3);
-     gst_0->Draw("pzf","qel&&!charm&&pdgf==111","");
-     if(gst_1) gst_1->Draw("pzf","qel&&!charm&&pdgf==111","perrsame");
-     c->cd(4);
-     gst_0->Draw("Ef","qel&&!charm&&pdgf==111","");
-     if(gst_1) gst_1->Draw("Ef","qel&&!charm&&pdgf==111","perrsame");
-     c->cd();
-     ls->Clear();
-     ls->SetHeader("Final state pi0's 4-momentum / QEL only");
-     ls->Draw();
-     c->Update();
+     PlotPage("Final state pi0's 4-momentum / QEL only",
+              "pxf", "qel&&!charm&&pdgf==111",
+              "pyf", "qel&&!charm&&pdgf==111",
+              "pzf", "qel&&!charm&&pdgf==111",
+              "Ef", "qel&&!charm&&pdgf==111");
 
      //------ momentum of final state pi+ /QEL
-     ps->NewPage();
-     c->Clear();
-     c->Divide(2,2);
-     c->cd(1);
-     gst_0->Draw("pxf","qel&&!charm&&pdgf==211","");
-     if(gst_1) gst_1->Draw("pxf","qel&&!charm&&pdgf==211","perrsame");
-     c->cd(2);
-     gst_0->Draw("pyf","qel&&!charm&&pdgf==211","");
-     if(gst_1) gst_1->Draw("pyf","qel&&!charm&&pdgf==211","perrsame");
-     c->cd(3);
-     gst_0->Draw("pzf","qel&&!charm&&pdgf==211","");
-     if(gst_1) gst_1->Draw("pzf","qel&&!charm&&pdgf==211","perrsame");
-     c->cd(4);
-     gst_0->Draw("Ef","qel&&!charm&&pdgf==211","");
-     if(gst_1) gst_1->Draw("Ef","qel&&!charm&&pdgf==211","perrsame");
-     c->cd();
-     ls->Clear();
-     ls->SetHeader("Final state pi+'s 4-momentum / QEL only");
-     ls->Draw();
-     c->Update();
-     
+     PlotPage("Final state pi+'s 4-momentum / QEL only",
+              "pxf", "qel&&!charm&&pdgf==211",
+              "pyf", "qel&&!charm&&pdgf==211",
+              "pzf", "qel&&!charm&&pdgf==211",
+              "Ef", "qel&&!charm&&pdgf==211");
+
      //------ momentum of final state pi+ /QEL
-     ps->NewPage();
-     c->Clear();
-     c->Divide(2,2);
-     c->cd(1);
-     gst_0->Draw("pxf","qel&&!charm&&pdgf==-211","");
-     if(gst_1) gst_1->Draw("pxf","qel&&!charm&&pdgf==-211","perrsame");
-     c->cd(2);
-     gst_0->Draw("pyf","qel&&!charm&&pdgf==-211","");
-     if(gst_1) gst_1->Draw("pyf","qel&&!charm&&pdgf==-211","perrsame");
-     c->cd(3);
-     gst_0->Draw("pzf","qel&&!charm&&pdgf==-211","");
-     if(gst_1) gst_1->Draw("pzf","qel&&!charm&&pdgf==-211","perrsame");
-     c->cd(4);
-     gst_0->Draw("Ef","qel&&!charm&&pdgf==-211","");
-     if(gst_1) gst_1->Draw("Ef","qel&&!charm&&pdgf==-211","perrsame");
-     c->cd();
-     ls->Clear();
-     ls->SetHeader("Final state pi-'s 4-momentum/ QEL only");
-     ls->Draw();
-     c->Update();
-          
+     PlotPage("Final state pi-'s 4-momentum/ QEL only",
+              "pxf", "qel&&!charm&&pdgf==-211",
+              "pyf", "qel&&!charm&&pdgf==-211",
+              "pzf", "qel&&!charm&&pdgf==-211",
+              "Ef", "qel&&!charm&&pdgf==-211");
+
      //
      // similarly but for RES events only
      //
-     
+
      //------ number of final state p /RES
-     ps->NewPage();
-               gst_0->Draw("nfp","res","");
-     if(gst_1) gst_1->Draw("nfp","res","perrsame");
-     ls->Clear();
-     ls->SetHeader("Number of final state protons / RES only");
-     ls->Draw();
-     c->Update();
-     
+     PlotPage("Number of final state protons / RES only", "nfp", "res");
+
      //------ number of final state n /RES
-     ps->NewPage();
-               gst_0->Draw("nfn","res","");
-     if(gst_1) gst_1->Draw("nfn","res","perrsame");
-     ls->Clear();
-     ls->SetHeader("Number of final state neutrons / RES only");
-     ls->Draw();
-     c->Update();
-     
+     PlotPage("Number of final state neutrons / RES only", "nfn", "res");
+
      //------ number of final state pi+ /RES
-     ps->NewPage();
-               gst_0->Draw("nfpip","res","");
-     if(gst_1) gst_1->Draw("nfpip","res","perrsame");
-     ls->Clear();
-     ls->SetHeader("Number of final state pi+ / RES only");
-     ls->Draw();
-     c->Update();
-     
+     PlotPage("Number of final state pi+ / RES only", "nfpip", "res");
+
      //------ number of final state pi- /RES
-     ps->NewPage();
-               gst_0->Draw("nfpim","res","");
-     if(gst_1) gst_1->Draw("nfpim","res","perrsame");
-     ls->Clear();
-     ls->SetHeader("Number of final state pi- / RES only");
-     ls->Draw();
-     c->Update();
+     PlotPage("Number of final state pi- / RES only", "nfpim", "res");
 
      //------ number of final state pi0 /RES
-     ps->NewPage();
-               gst_0->Draw("nfpi0","res","");
-     if(gst_1) gst_1->Draw("nfpi0","res","perrsame");
-     ls->Clear();
-     ls->SetHeader("Number of final state pi0 / RES only");
-     ls->Draw();
-     c->Update();
-     
+     PlotPage("Number of final state pi0 / RES only", "nfpi0", "res");
+
      //------ number of final state K+ /RES
-     ps->NewPage();
-     gst_0->Draw("nfkp","res","");
-     if(gst_1) gst_1->Draw("nfkp","res","perrsame");
-     ls->Clear();
-     ls->SetHeader("Number of final state K+ / RES only");
-     ls->Draw();
-     c->Update();
-     
+     PlotPage("Number of final state K+ / RES only", "nfkp", "res");
+
      //------ number of final state K- /RES
-     ps->NewPage();
-     gst_0->Draw("nfkm","res","");
-     if(gst_1) gst_1->Draw("nfkm","res","perrsame");
-     ls->Clear();
-     ls->SetHeader("Number of final state K- / RES only");
-     ls->Draw();
-     c->Update();
-     
+     PlotPage("Number of final state K- / RES only", "nfkm", "res");
+
      //------ number of final state K0 /RES
-     ps->NewPage();
-     gst_0->Draw("nfk0","res","");
-     if(gst_1) gst_1->Draw("nfk0","res","perrsame");
-     ls->Clear();
-     ls->SetHeader("Number of final state K0 / RES only");
-     ls->Draw();
-     c->Update();
-     
+     PlotPage("Number of final state K0 / RES only", "nfk0", "res");
+
      //------ momentum of final state p /RES
-     ps->NewPage();
-     c->Divide(2,2);
-     c->cd(1);
-     gst_0->Draw("pxf","res&&pdgf==2212","");
-     if(gst_1) gst_1->Draw("pxf","res&&pdgf==2212","perrsame");
-     c->cd(2);
-     gst_0->Draw("pyf","res&&pdgf==2212","");
-     if(gst_1) gst_1->Draw("pyf","res&&pdgf==2212","perrsame");
-     c->cd(3);
-     gst_0->Draw("pzf","res&&pdgf==2212","");
-     if(gst_1) gst_1->Draw("pzf","res&&pdgf==2212","perrsame");
-     c->cd(4);
-     gst_0->Draw("Ef","res&&pdgf==2212","");
-     if(gst_1) gst_1->Draw("Ef","res&&pdgf==2212","perrsame");
-     c->cd();
-     ls->Clear();
-     ls->SetHeader("Final state protons 4-momentum / RES only");
-     ls->Draw();
-     c->Update();
-     
+     PlotPage("Final state protons 4-momentum / RES only",
+              "pxf", "res&&pdgf==2212",
+              "pyf", "res&&pdgf==2212",
+              "pzf", "res&&pdgf==2212",
+              "Ef", "res&&pdgf==2212");
+
      //------ momentum of final state n /RES
-     ps->NewPage();
-     c->Clear();
-     c->Divide(2,2);
-     c->cd(1);
-     gst_0->Draw("pxf","res&&pdgf==2112","");
-     if(gst_1) gst_1->Draw("pxf","res&&pdgf==2112","perrsame");
-     c->cd(2);
-     gst_0->Draw("pyf","res&&pdgf==2112","");
-     if(gst_1) gst_1->Draw("pyf","res&&pdgf==2112","perrsame");
-     c->cd(3);
-     gst_0->Draw("pzf","res&&pdgf==2112","");
-     if(gst_1) gst_1->Draw("pzf","res&&pdgf==2112","perrsame");
-     c->cd(4);
-     gst_0->Draw("Ef","res&&pdgf==2112","");
-     if(gst_1) gst_1->Draw("Ef","res&&pdgf==2112","perrsame");
-     c->cd();
-     ls->Clear();
-     ls->SetHeader("Final state neutrons 4-momentum / RES only");
-     ls->Draw();
-     c->Update();
-     
+     PlotPage("Final state neutrons 4-momentum / RES only",
+              "pxf", "res&&pdgf==2112",
+              "pyf", "res&&pdgf==2112",
+              "pzf", "res&&pdgf==2112",
+              "Ef", "res&&pdgf==2112");
+
      //------ momentum of final state pi0 /RES
-     ps->NewPage();
-     c->Clear();
-     c->Divide(2,2);
-     c->cd(1);
-     gst_0->Draw("pxf","res&&pdgf==111","");
-     if(gst_1) gst_1->Draw("pxf","res&&pdgf==111","perrsame");
-     c->cd(2);
-     gst_0->Draw("pyf","res&&pdgf==111","");
-     if(gst_1) gst_1->Draw("pyf","res&&pdgf==111","perrsame");
-     c->cd(3);
-     gst_0->Draw("pzf","res&&pdgf==111","");
-     if(gst_1) gst_1->Draw("pzf","res&&pdgf==111","perrsame");
-     c->cd(4);
-     gst_0->Draw("Ef","res&&pdgf==111","");
-     if(gst_1) gst_1->Draw("Ef","res&&pdgf==111","perrsame");
-     c->cd();
-     ls->Clear();
-     ls->SetHeader("Final state pi0's 4-momentum / RES only");
-     ls->Draw();
-     c->Update();
-     
+     PlotPage("Final state pi0's 4-momentum / RES only",
+              "pxf", "res&&pdgf==111",
+              "pyf", "res&&pdgf==111",
+              "pzf", "res&&pdgf==111",
+              "Ef", "res&&pdgf==111");
+
      //------ momentum of final state pi+ /RES
-     ps->NewPage();
-     c->Clear();
-     c->Divide(2,2);
-     c->cd(1);
-     gst_0->Draw("pxf","res&&pdgf==211","");
-     if(gst_1) gst_1->Draw("pxf","res&&pdgf==211","perrsame");
-     c->cd(2);
-     gst_0->Draw("pyf","res&&pdgf==211","");
-     if(gst_1) gst_1->Draw("pyf","res&&pdgf==211","perrsame");
-     c->cd(3);
-     gst_0->Draw("pzf","res&&pdgf==211","");
-     if(gst_1) gst_1->Draw("pzf","res&&pdgf==211","perrsame");
-     c->cd(4);
-     gst_0->Draw("Ef","res&&pdgf==211","");
-     if(gst_1) gst_1->Draw("Ef","res&&pdgf==211","perrsame");
-     c->cd();
-     ls->Clear();
-     ls->SetHeader("Final state pi+'s 4-momentum / RES only");
-     ls->Draw();
-     c->Update();
+     PlotPage("Final state pi+'s 4-momentum / RES only",
+              "pxf", "res&&pdgf==211",
+              "pyf", "res&&pdgf==211",
+              "pzf", "res&&pdgf==211",
+              "Ef", "res&&pdgf==211");
 
      //------ momentum of final state pi+ /RES
-     ps->NewPage();
-     c->Clear();
-     c->Divide(2,2);
-     c->cd(1);
-     gst_0->Draw("pxf","res&&pdgf==-211","");
-     if(gst_1) gst_1->Draw("pxf","res&&pdgf==-211","perrsame");
-     c->cd(2);
-     gst_0->Draw("pyf","res&&pdgf==-211","");
-     if(gst_1) gst_1->Draw("pyf","res&&pdgf==-211","perrsame");
-     c->cd(3);
-     gst_0->Draw("pzf","res&&pdgf==-211","");
-     if(gst_1) gst_1->Draw("pzf","res&&pdgf==-211","perrsame");
-     c->cd(4);
-     gst_0->Draw("Ef","res&&pdgf==-211","");
-     if(gst_1) gst_1->Draw("Ef","res&&pdgf==-211","perrsame");
-     c->cd();
-     ls->Clear();
-     ls->SetHeader("Final state pi-'s 4-momentum/ RES only");
-     ls->Draw();
-     c->Update();
-     
+     PlotPage("Final state pi-'s 4-momentum/ RES only",
+              "pxf", "res&&pdgf==-211",
+              "pyf", "res&&pdgf==-211",
+              "pzf", "res&&pdgf==-211",
+              "Ef", "res&&pdgf==-211");
+
      //
      // similarly but for DIS events only
      //
-     
+
      //------ number of final state p /DIS
-     ps->NewPage();
-     gst_0->Draw("nfp","dis","");
-     if(gst_1) gst_1->Draw("nfp","dis","perrsame");
-     ls->Clear();
-     ls->SetHeader("Number of final state protons / DIS only");
-     ls->Draw();
-     c->Update();
-     
+     PlotPage("Number of final state protons / DIS only", "nfp", "dis");
+
      //------ number of final state n /DIS
-     ps->NewPage();
-     gst_0->Draw("nfn","dis","");
-     if(gst_1) gst_1->Draw("nfn","dis","perrsame");
-     ls->Clear();
-     ls->SetHeader("Number of final state neutrons / DIS only");
-     ls->Draw();
-     c->Update();
-     
+     PlotPage("Number of final state neutrons / DIS only", "nfn", "dis");
+
      //------ number of final state pi+ /DIS
-     ps->NewPage();
-     gst_0->Draw("nfpip","dis","");
-     if(gst_1) gst_1->Draw("nfpip","dis","perrsame");
-     ls->Clear();
-     ls->SetHeader("Number of final state pi+ / DIS only");
-     ls->Draw();
-     c->Update();
-     
+     PlotPage("Number of final state pi+ / DIS only", "nfpip", "dis");
+
      //------ number of final state pi- /DIS
-     ps->NewPage();
-     gst_0->Draw("nfpim","dis","");
-     if(gst_1) gst_1->Draw("nfpim","dis","perrsame");
-     ls->Clear();
-     ls->SetHeader("Number of final state pi- / DIS only");
-     ls->Draw();
-     c->Update();
-     
+     PlotPage("Number of final state pi- / DIS only", "nfpim", "dis");
+
      //------ number of final state pi0 /DIS
-     ps->NewPage();
-     gst_0->Draw("nfpi0","dis","");
-     if(gst_1) gst_1->Draw("nfpi0","dis","perrsame");
-     ls->Clear();
-     ls->SetHeader("Number of final state pi0 / DIS only");
-     ls->Draw();
-     c->Update();
-     
+     PlotPage("Number of final state pi0 / DIS only", "nfpi0", "dis");
+
      //------ number of final state K+ /DIS
-     ps->NewPage();
-     gst_0->Draw("nfkp","dis","");
-     if(gst_1) gst_1->Draw("nfkp","dis","perrsame");
-     ls->Clear();
-     ls->SetHeader("Number of final state K+ / DIS only");
-     ls->Draw();
-     c->Update();
-     
+     PlotPage("Number of final state K+ / DIS only", "nfkp", "dis");
+
      //------ number of final state K- /DIS
-     ps->NewPage();
-     gst_0->Draw("nfkm","dis","");
-     if(gst_1) gst_1->Draw("nfkm","dis","perrsame");
-     ls->Clear();
-     ls->SetHeader("Number of final state K- / DIS only");
-     ls->Draw();
-     c->Update();
-     
+     PlotPage("Number of final state K- / DIS only", "nfkm", "dis");
+
      //------ number of final state K0 /DIS
-     ps->NewPage();
-     gst_0->Draw("nfk0","dis","");
-     if(gst_1) gst_1->Draw("nfk0","dis","perrsame");
-     ls->Clear();
-     ls->SetHeader("Number of final state K0 / DIS only");
-     ls->Draw();
-     c->Update();
-     
+     PlotPage("Number of final state K0 / DIS only", "nfk0", "dis");
+
      //------ momentum of final state p /DIS
-     ps->NewPage();
-     c->Divide(2,2);
-     c->cd(1);
-     gst_0->Draw("pxf","dis&&pdgf==2212","");
-     if(gst_1) gst_1->Draw("pxf","dis&&pdgf==2212","perrsame");
-     c->cd(2);
-     gst_0->Draw("pyf","dis&&pdgf==2212","");
-     if(gst_1) gst_1->Draw("pyf","dis&&pdgf==2212","perrsame");
-     c->cd(3);
-     gst_0->Draw("pzf","dis&&pdgf==2212","");
-     if(gst_1) gst_1->Draw("pzf","dis&&pdgf==2212","perrsame");
-     c->cd(4);
-     gst_0->Draw("Ef","dis&&pdgf==2212","");
-     if(gst_1) gst_1->Draw("Ef","dis&&pdgf==2212","perrsame");
-     c->cd();
-     ls->Clear();
-     ls->SetHeader("Final state protons 4-momentum / DIS only");
-     ls->Draw();
-     c->Update();
-     
+     PlotPage("Final state protons 4-momentum / DIS only",
+              "pxf", "dis&&pdgf==2212",
+              "pyf", "dis&&pdgf==2212",
+              "pzf", "dis&&pdgf==2212",
+              "Ef", "dis&&pdgf==2212");
+
      //------ momentum of final state n /DIS
-     ps->NewPage();
-     c->Clear();
-     c->Divide(2,2);
-     c->cd(1);
-     gst_0->Draw("pxf","dis&&pdgf==2112","");
-     if(gst_1) gst_1->Draw("pxf","dis&&pdgf==2112","perrsame");
-     c->cd(2);
-     gst_0->Draw("pyf","dis&&pdgf==2112","");
-     if(gst_1) gst_1->Draw("pyf","dis&&pdgf==2112","perrsame");
-     c->cd(3);
-     gst_0->Draw("pzf","dis&&pdgf==2112","");
-     if(gst_1) gst_1->Draw("pzf","dis&&pdgf==2112","perrsame");
-     c->cd(4);
-     gst_0->Draw("Ef","dis&&pdgf==2112","");
-     if(gst_1) gst_1->Draw("Ef","dis&&pdgf==2112","perrsame");
-     c->cd();
-     ls->Clear();
-     ls->SetHeader("Final state neutrons 4-momentum / DIS only");
-     ls->Draw();
-     c->Update();
-     
+     PlotPage("Final state neutrons 4-momentum / DIS only",
+              "pxf", "dis&&pdgf==2112",
+              "pyf", "dis&&pdgf==2112",
+              "pzf", "dis&&pdgf==2112",
+              "Ef", "dis&&pdgf==2112");
+
      //------ momentum of final state pi0 /DIS
-     ps->NewPage();
-     c->Clear();
-     c->Divide(2,2);
-     c->cd(1);
-     gst_0->Draw("pxf","dis&&pdgf==111","");
-     if(gst_1) gst_1->Draw("pxf","dis&&pdgf==111","perrsame");
-     c->cd(2);
-     gst_0->Draw("pyf","dis&&pdgf==111","");
-     if(gst_1) gst_1->Draw("pyf","dis&&pdgf==111","perrsame");
-     c->cd(3);
-     gst_0->Draw("pzf","dis&&pdgf==111","");
-     if(gst_1) gst_1->Draw("pzf","dis&&pdgf==111","perrsame");
-     c->cd(4);
-     gst_0->Draw("Ef","dis&&pdgf==111","");
-     if(gst_1) gst_1->Draw("Ef","dis&&pdgf==111","perrsame");
-     c->cd();
-     ls->Clear();
-     ls->SetHeader("Final state pi0's 4-momentum / DIS only");
-     ls->Draw();
-     c->Update();
+     PlotPage("Final state pi0's 4-momentum / DIS only",
+              "pxf", "dis&&pdgf==111",
+              "pyf", "dis&&pdgf==111",
+              "pzf", "dis&&pdgf==111",
+              "Ef", "dis&&pdgf==111");
 
      //------ momentum of final state pi+ /DIS
-     ps->NewPage();
-     c->Clear();
-     c->Divide(2,2);
-     c->cd(1);
-     gst_0->Draw("pxf","dis&&pdgf==211","");
-     if(gst_1) gst_1->Draw("pxf","dis&&pdgf==211","perrsame");
-     c->cd(2);
-     gst_0->Draw("pyf","dis&&pdgf==211","");
-     if(gst_1) gst_1->Draw("pyf","dis&&pdgf==211","perrsame");
-     c->cd(3);
-     gst_0->Draw("pzf","dis&&pdgf==211","");
-     if(gst_1) gst_1->Draw("pzf","dis&&pdgf==211","perrsame");
-     c->cd(4);
-     gst_0->Draw("Ef","dis&&pdgf==211","");
-     if(gst_1) gst_1->Draw("Ef","dis&&pdgf==211","perrsame");
-     c->cd();
-     ls->Clear();
-     ls->SetHeader("Final state pi+'s 4-momentum / DIS only");
-     ls->Draw();
-     c->Update();
-     
+     PlotPage("Final state pi+'s 4-momentum / DIS only",
+              "pxf", "dis&&pdgf==211",
+              "pyf", "dis&&pdgf==211",
+              "pzf", "dis&&pdgf==211",
+              "Ef", "dis&&pdgf==211");
+
      //------ momentum of final state pi+ /DIS
-     ps->NewPage();
-     c->Clear();
-     c->Divide(2,2);
-     c->cd(1);
-     gst_0->Draw("pxf","dis&&pdgf==-211","");
-     if(gst_1) gst_1->Draw("pxf","dis&&pdgf==-211","perrsame");
-     c->cd(2);
-     gst_0->Draw("pyf","dis&&pdgf==-211","");
-     if(gst_1) gst_1->Draw("pyf","dis&&pdgf==-211","perrsame");
-     c->cd(3);
-     gst_0->Draw("pzf","dis&&pdgf==-211","");
-     if(gst_1) gst_1->Draw("pzf","dis&&pdgf==-211","perrsame");
-     c->cd(4);
-     gst_0->Draw("Ef","dis&&pdgf==-211","");
-     if(gst_1) gst_1->Draw("Ef","dis&&pdgf==-211","perrsame");
-     c->cd();
-     ls->Clear();
-     ls->SetHeader("Final state pi-'s 4-momentum/ DIS only");
-     ls->Draw();
-     c->Update();
-     
+     PlotPage("Final state pi-'s 4-momentum/ DIS only",
+              "pxf", "dis&&pdgf==-211",
+              "pyf", "dis&&pdgf==-211",
+              "pzf", "dis&&pdgf==-211",
+              "Ef", "dis&&pdgf==-211");
+
   } // per-proc
 
   //
   // SECTION: Primary Hadronic System Multiplicities & 4P
   //
   if(show_primary_hadsyst) {
-     
-     ps->NewPage();
-     c->Clear();
-     c->Range(0,0,100,100);
+
      TPavesText hdrihad(10,40,90,70,3,"tr");
      hdrihad.AddText("Parimary Hadronic System");
      hdrihad.AddText("Multiplicities and 4-Momenta");
@@ -1784,198 +862,489 @@ void CreatePlots(string inp_filename, string inp_filename_ref)
      hdrihad.AddText("Note:");
      hdrihad.AddText("For nuclear targets these plots show the hadronic system");
      hdrihad.AddText("BEFORE any intranuclear hadron transport / rescattering");
-     hdrihad.Draw();
-     c->Update();
-     
+     TextPage(hdrihad);
+
      //------ number of prim p
-     ps->NewPage();
-     gst_0->Draw("nip","","");
-     if(gst_1) gst_1->Draw("nip","","perrsame");
-     ls->Clear();
-     ls->SetHeader("Primary Hadronic System: Number of protons");
-     ls->Draw();
-     c->Update();
-     
+     PlotPage("Primary Hadronic System: Number of protons", "nip", "");
+
      //------ number of prim n
-     ps->NewPage();
-     gst_0->Draw("nin","","");
-     if(gst_1) gst_1->Draw("nin","","perrsame");
-     ls->Clear();
-     ls->SetHeader("Primary Hadronic System: Number of neutrons");
-     ls->Draw();
-     c->Update();
-     
+     PlotPage("Primary Hadronic System: Number of neutrons", "nin", "");
+
      //------ number of prim pi+
-     ps->NewPage();
-     gst_0->Draw("nipip","","");
-     if(gst_1) gst_1->Draw("nipip","","perrsame");
-     ls->Clear();
-     ls->SetHeader("Primary Hadronic System: Number of pi+");
-     ls->Draw();
-     c->Update();
-     
+     PlotPage("Primary Hadronic System: Number of pi+", "nipip", "");
+
      //------ number of prim pi-
-     ps->NewPage();
-     gst_0->Draw("nipim","","");
-     if(gst_1) gst_1->Draw("nipim","","perrsame");
-     ls->Clear();
-     ls->SetHeader("Primary Hadronic System: Number of pi-");
-     ls->Draw();
-     c->Update();
-     
+     PlotPage("Primary Hadronic System: Number of pi-", "nipim", "");
+
      //------ number of prim pi0
-     ps->NewPage();
-     gst_0->Draw("nipi0","","");
-     if(gst_1) gst_1->Draw("nipi0","","perrsame");
-     ls->Clear();
-     ls->SetHeader("Primary Hadronic System: Number of pi0");
-     ls->Draw();
-     c->Update();
-     
+     PlotPage("Primary Hadronic System: Number of pi0", "nipi0", "");
+
      //------ number of prim K+
-     ps->NewPage();
-     gst_0->Draw("nikp","","");
-     if(gst_1) gst_1->Draw("nikp","","perrsame");
-     ls->Clear();
-     ls->SetHeader("Primary Hadronic System: Number of K+");
-     ls->Draw();
-     c->Update();
-     
+     PlotPage("Primary Hadronic System: Number of K+", "nikp", "");
+
      //------ number of prim K-
-     ps->NewPage();
-     gst_0->Draw("nikm","","");
-     if(gst_1) gst_1->Draw("nikm","","perrsame");
-     ls->Clear();
-     ls->SetHeader("Primary Hadronic System: Number of K-");
-     ls->Draw();
-     c->Update();
-     
+     PlotPage("Primary Hadronic System: Number of K-", "nikm", "");
+
      //------ number of prim K0
-     ps->NewPage();
-     gst_0->Draw("nik0","","");
-     if(gst_1) gst_1->Draw("nik0","","perrsame");
-     ls->Clear();
-     ls->SetHeader("Primary Hadronic System: Number of K0");
-     ls->Draw();
-     c->Update();
-     
+     PlotPage("Primary Hadronic System: Number of K0", "nik0", "");
+
      //------ momentum of prim, p
-     ps->NewPage();
-     c->Divide(2,2);
-     c->cd(1);
-     gst_0->Draw("pxi","pdgi==2212","");
-     if(gst_1) gst_1->Draw("pxi","pdgi==2212","perrsame");
-     c->cd(2);
-     gst_0->Draw("pyi","pdgi==2212","");
-     if(gst_1) gst_1->Draw("pyi","pdgi==2212","perrsame");
-     c->cd(3);
-     gst_0->Draw("pzi","pdgi==2212","");
-     if(gst_1) gst_1->Draw("pzi","pdgi==2212","perrsame");
-     c->cd(4);
-     gst_0->Draw("Ei","pdgi==2212","");
-     if(gst_1) gst_1->Draw("Ei","pdgi==2212","perrsame");
-     c->cd();
-     ls->Clear();
-     ls->SetHeader("Primary Hadronic System: proton 4-momentum");
-     ls->Draw();
-     c->Update();
-     
+     PlotPage("Primary Hadronic System: proton 4-momentum",
+              "pxi", "pdgi==2212",
+              "pyi", "pdgi==2212",
+              "pzi", "pdgi==2212",
+              "Ei", "pdgi==2212");
+
      //------ momentum of prim. n
-     ps->NewPage();
-     c->Clear();
-     c->Divide(2,2);
-     c->cd(1);
-     gst_0->Draw("pxi","pdgi==2112","");
-     if(gst_1) gst_1->Draw("pxi","pdgi==2112","perrsame");
-     c->cd(2);
-     gst_0->Draw("pyi","pdgi==2112","");
-     if(gst_1) gst_1->Draw("pyi","pdgi==2112","perrsame");
-     c->cd(3);
-     gst_0->Draw("pzi","pdgi==2112","");
-     if(gst_1) gst_1->Draw("pzi","pdgi==2112","perrsame");
-     c->cd(4);
-     gst_0->Draw("Ei","pdgi==2112","");
-     if(gst_1) gst_1->Draw("Ei","pdgi==2112","perrsame");
-     c->cd();
-     ls->Clear();
-     ls->SetHeader("Primary Hadronic System: neutron 4-momentum");
-     ls->Draw();
-     c->Update();
-     
+     PlotPage("Primary Hadronic System: neutron 4-momentum",
+              "pxi", "pdgi==2112",
+              "pyi", "pdgi==2112",
+              "pzi", "pdgi==2112",
+              "Ei", "pdgi==2112");
+
      //------ momentum of prim. pi0
-     ps->NewPage();
-     c->Clear();
-     c->Divide(2,2);
-     c->cd(1);
-     gst_0->Draw("pxi","pdgi==111","");
-     if(gst_1) gst_1->Draw("pxi","pdgi==111","perrsame");
-     c->cd(2);
-     gst_0->Draw("pyi","pdgi==111","");
-     if(gst_1) gst_1->Draw("pyi","pdgi==111","perrsame");
-     c->cd(3);
-     gst_0->Draw("pzi","pdgi==111","");
-     if(gst_1) gst_1->Draw("pzi","pdgi==111","perrsame");
-     c->cd(4);
-     gst_0->Draw("Ei","pdgi==111","");
-     if(gst_1) gst_1->Draw("Ei","pdgi==111","perrsame");
-     c->cd();
-     ls->Clear();
-     ls->SetHeader("Primary Hadronic System: pi0's 4-momentum");
-     ls->Draw();
-     c->Update();
+     PlotPage("Primary Hadronic System: pi0's 4-momentum",
+              "pxi", "pdgi==111",
+              "pyi", "pdgi==111",
+              "pzi", "pdgi==111",
+              "Ei", "pdgi==111");
 
      //------ momentum of prim pi+
-     ps->NewPage();
-     c->Clear();
-     c->Divide(2,2);
-     c->cd(1);
-     gst_0->Draw("pxi","pdgi==211","");
-     if(gst_1) gst_1->Draw("pxi","pdgi==211","perrsame");
-     c->cd(2);
-     gst_0->Draw("pyi","pdgi==211","");
-     if(gst_1) gst_1->Draw("pyi","pdgi==211","perrsame");
-     c->cd(3);
-     gst_0->Draw("pzi","pdgi==211","");
-     if(gst_1) gst_1->Draw("pzi","pdgi==211","perrsame");
-     c->cd(4);
-     gst_0->Draw("Ei","pdgi==211","");
-     if(gst_1) gst_1->Draw("Ei","pdgi==211","perrsame");
-     c->cd();
-     ls->Clear();
-     ls->SetHeader("Primary Hadronic System:pi+'s 4-momentum");
-     ls->Draw();
-     c->Update();
-     
+     PlotPage("Primary Hadronic System:pi+'s 4-momentum",
+              "pxi", "pdgi==211",
+              "pyi", "pdgi==211",
+              "pzi", "pdgi==211",
+              "Ei", "pdgi==211");
+
      //------ momentum of prim. pi+
-     ps->NewPage();
-     c->Clear();
-     c->Divide(2,2);
-     c->cd(1);
-     gst_0->Draw("pxi","pdgi==-211","");
-     if(gst_1) gst_1->Draw("pxi","pdgi==-211","perrsame");
-     c->cd(2);
-     gst_0->Draw("pyi","pdgi==-211","");
-     if(gst_1) gst_1->Draw("pyi","pdgi==-211","perrsame");
-     c->cd(3);
-     gst_0->Draw("pzi","pdgi==-211","");
-     if(gst_1) gst_1->Draw("pzi","pdgi==-211","perrsame");
-     c->cd(4);
-     gst_0->Draw("Ei","pdgi==-211","");
-     if(gst_1) gst_1->Draw("Ei","pdgi==-211","perrsame");
-     c->cd();
-     ls->Clear();
-     ls->SetHeader("Primary Hadronic System:  pi-'s 4-momentum");
-     ls->Draw();
-     c->Update();
+     PlotPage("Primary Hadronic System:  pi-'s 4-momentum",
+              "pxi", "pdgi==-211",
+              "pyi", "pdgi==-211",
+              "pzi", "pdgi==-211",
+              "Ei", "pdgi==-211");
   }//show?
-       
-  ps->Close();
-
-  fin_0->Close();
-  delete fin_0;
-  if(fin_1) {
-     fin_1->Close();
-     delete fin_1;
+
+}
+//_________________________________________________________________________________
+void TextPage(TPavesText & text)
+{
+  if(gBooking) return;
+
+  gPS->NewPage();
+  gC->Clear();
+  gC->Range(0,0,100,100);
+  text.Draw();
+  gC->Update();
+}
+//_________________________________________________________________________________
+void PlotPage(const char * title, const char * var, const char * sel)
+{
+  if(gBooking) {
+    BookPlot(var, sel);
+    return;
+  }
+
+  gPS->NewPage();
+  gC->Clear();
+  gC->cd();
+  DrawPlot(var, sel);
+  gLS->Clear();
+  gLS->SetHeader(title);
+  gLS->Draw();
+  gC->Update();
+}
+//_________________________________________________________________________________
+void PlotPage(const char * title,
+              const char * var1, const char * sel1,
+              const char * var2, const char * sel2,
+              const char * var3, const char * sel3,
+              const char * var4, const char * sel4)
+{
+  const char * var[4] = { var1, var2, var3, var4 };
+  const char * sel[4] = { sel1, sel2, sel3, sel4 };
+
+  if(gBooking) {
+    for(int i = 0; i < 4; i++) BookPlot(var[i], sel[i]);
+    return;
+  }
+
+  gPS->NewPage();
+  gC->Clear();
+  gC->Divide(2,2);
+  for(int i = 0; i < 4; i++) {
+    gC->cd(i+1);
+    DrawPlot(var[i], sel[i]);
+  }
+  gC->cd();
+  gLS->Clear();
+  gLS->SetHeader(title);
+  gLS->Draw();
+  gC->Update();
+}
+//_________________________________________________________________________________
+void DrawPlot(const char * var, const char * sel)
+{
+// Draws the test sample (line) and the reference sample (points), as
+// TTree::Draw(var,sel,"") and TTree::Draw(var,sel,"perrsame") would do
+
+  int id = BookPlot(var, sel);
+  TH1D * h0 = gPlots[id].hist[0];
+  TH1D * h1 = gPlots[id].hist[1];
+
+  if(h1) {
+    // make sure that neither sample is clipped
+    double hmax = TMath::Max(h0->GetBinContent(h0->GetMaximumBin()),
+                             h1->GetBinContent(h1->GetMaximumBin()));
+    h0->SetMaximum( (1+gStyle->GetHistTopMargin()) * hmax );
+  }
+  h0->Draw();
+  if(h1) h1->Draw("perrsame");
+}
+//_________________________________________________________________________________
+double NSelected(int isample, const char * sel)
+{
+// Number of events in the sample passing the selection
+
+  int id = BookPlot("1", sel);
+  if(gBooking) return 1; // book any plots depending on it
+
+  TH1D * h = gPlots[id].hist[isample];
+  return (h) ? h->GetEntries() : 0;
+}
+//_________________________________________________________________________________
+int BookPlot(const char * var, const char * sel)
+{
+  pair<string,string> key = make_pair(string(var), string(sel));
+  map<pair<string,string>, int>::const_iterator it = gPlotIds.find(key);
+  if(it != gPlotIds.end()) return it->second;
+
+  Plot_t plot;
+  plot.var  = var;
+  plot.sel  = sel;
+  plot.nsel = 0;
+  plot.vmin = 0;
+  plot.vmax = 0;
+  for(int isample = 0; isample < 2; isample++) {
+    plot.entries[isample] = 0;
+    plot.sumw   [isample].assign(kNBins+2, 0.);
+    plot.sumw2  [isample].assign(kNBins+2, 0.);
+    plot.hist   [isample] = 0;
+  }
+  gPlots.push_back(plot);
+
+  int id = gPlots.size() - 1;
+  gPlotIds[key] = id;
+  return id;
+}
+//_________________________________________________________________________________
+void SetBinning(void)
+{
+// Finds `good' limits for the range of values seen in both samples, as
+// TTree::Draw does for the histograms it books
+
+  for(unsigned int i = 0; i < gPlots.size(); i++) {
+    Plot_t & plot = gPlots[i];
+    double xmin = (plot.nsel > 0) ? plot.vmin : 0.;
+    double xmax = (plot.nsel > 0) ? plot.vmax : 1.;
+    // keep the largest value within the histogram
+    xmax += 1E-6 * TMath::Max(xmax-xmin, 1.);
+
+    TH1D h("htemp","",kNBins,xmin,xmax);
+    h.SetDirectory(0);
+    THLimitsFinder::GetLimitsFinder()->FindGoodLimits(&h, xmin, xmax);
+
+    for(int isample = 0; isample < 2; isample++) {
+      if(gSampleFile[isample].size() == 0) continue;
+      ostringstream name;
+      name << "h" << isample << "_" << i;
+      TH1D * hist = new TH1D(name.str().c_str(), plot.var.c_str(),
+          h.GetNbinsX(), h.GetXaxis()->GetXmin(), h.GetXaxis()->GetXmax());
+      hist->SetDirectory(0);
+      hist->Sumw2();
+      hist->GetXaxis()->SetTitle(plot.var.c_str());
+      if(isample == 0) {
+        hist->SetLineColor(kBlack);
+        hist->SetLineWidth(3);
+      } else {
+        hist->SetLineColor(kRed);
+        hist->SetMarkerColor(kRed);
+        hist->SetLineWidth(2);
+        hist->SetMarkerStyle(20);
+        hist->SetMarkerSize(1);
+      }
+      plot.hist[isample] = hist;
+      plot.sumw [isample].assign(hist->GetNbinsX()+2, 0.);
+      plot.sumw2[isample].assign(hist->GetNbinsX()+2, 0.);
+    }
+  }
+}
+//_________________________________________________________________________________
+void MakeHistograms(void)
+{
+  for(unsigned int i = 0; i < gPlots.size(); i++) {
+    Plot_t & plot = gPlots[i];
+    for(int isample = 0; isample < 2; isample++) {
+      TH1D * hist = plot.hist[isample];
+      if(!hist) continue;
+      for(int ibin = 0; ibin < hist->GetNbinsX()+2; ibin++) {
+        hist->SetBinContent (ibin, plot.sumw [isample][ibin]);
+        hist->SetBinError   (ibin, TMath::Sqrt(plot.sumw2[isample][ibin]));
+      }
+      hist->SetEntries(plot.entries[isample]);
+    }
+  }
+}
+//_________________________________________________________________________________
+void ScanSample(int isample, ScanPass_t pass)
+{
+// Runs a pass over the sample. The entries are split in contiguous ranges,
+// each scanned by a forked worker process (the GENIE / ROOT singletons are
+// not thread-safe); the results are sent back through a pipe and summed.
+
+  string filename = gSampleFile[isample];
+
+  TFile file(filename.c_str(), "READ");
+  TTree * gst = dynamic_cast <TTree *> (file.Get("gst"));
+  if(!gst) {
+    LOG("gevcomp", pFATAL) << "No gst tree in: " << filename;
+    exit(1);
+  }
+  Long64_t nev = (gOptNEvt < 0) ?
+     gst->GetEntries() : TMath::Min(gst->GetEntries(), gOptNEvt);
+  file.Close();
+
+  gNEvents[isample] = nev;
+
+  LOG("gevcomp", pNOTICE)
+     << ((pass == kPassRange) ? "Finding plot ranges" : "Filling plots")
+     << " for " << nev << " events in: " << filename;
+
+  int nworkers = (int) TMath::Max((Long64_t)1,
+                                  TMath::Min((Long64_t)gOptNWorkers, nev));
+  if(nworkers == 1) {
+    ostringstream out;
+    ScanEntries(filename, pass, 0, nev, out);
+    istringstream in(out.str());
+    MergeScan(isample, pass, in);
+    return;
+  }
+
+  std::cout.flush();
+  std::cerr.flush();
+  fflush(NULL);
+
+  vector<pid_t> pids(nworkers, -1);
+  vector<int>   fds (nworkers, -1);
+
+  for(int w = 0; w < nworkers; w++) {
+    int fd[2];
+    if(pipe(fd) != 0) {
+      LOG("gevcomp", pFATAL) << "Cannot create pipe for worker process " << w;
+      exit(1);
+    }
+    pid_t pid = fork();
+    if(pid == 0) {
+      close(fd[0]);
+      Long64_t first = (nev *  w   ) / nworkers;
+      Long64_t last  = (nev * (w+1)) / nworkers;
+      ostringstream out;
+      ScanEntries(filename, pass, first, last, out);
+      string buf = out.str();
+      const char * ptr = buf.c_str();
+      size_t left = buf.size();
+      while(left > 0) {
+        ssize_t n = write(fd[1], ptr, left);
+        if(n <= 0) _exit(1);
+        ptr  += n;
+        left -= n;
+      }
+      close(fd[1]);
+      std::cout.flush();
+      std::cerr.flush();
+      fflush(NULL);
+      _exit(0);
+    }
+    close(fd[1]);
+    if(pid < 0) {
+      close(fd[0]);
+      LOG("gevcomp", pFATAL) << "Cannot fork worker process " << w;
+      exit(1);
+    }
+    pids[w] = pid;
+    fds [w] = fd[0];
+  }
+
+  bool ok = true;
+  for(int w = 0; w < nworkers; w++) {
+    string buf;
+    char chunk[65536];
+    ssize_t n = 0;
+    while( (n = read(fds[w], chunk, sizeof(chunk))) > 0 ) {
+      buf.append(chunk, n);
+    }
+    close(fds[w]);
+    int status = 0;
+    waitpid(pids[w], &status, 0);
+    if(!WIFEXITED(status) || WEXITSTATUS(status) != 0) {
+      LOG("gevcomp", pERROR) << "Worker process " << w << " failed";
+      ok = false;
+      continue;
+    }
+    istringstream in(buf);
+    MergeScan(isample, pass, in);
+  }
+  if(!ok) {
+    LOG("gevcomp", pFATAL) << "Failed to process: " << filename;
+    exit(1);
+  }
+}
+//_________________________________________________________________________________
+void ScanEntries(string filename, ScanPass_t pass,
+                 Long64_t first, Long64_t last, ostream & out)
+{
+// Evaluates all booked plots for the entries in [first, last) and writes
+// out either the range of the selected values or the histogram contents.
+// Only the gst branches used by the plots are read, through a tree cache.
+
+  TFile file(filename.c_str(), "READ");
+  TTree * gst = dynamic_cast <TTree *> (file.Get("gst"));
+
+  unsigned int nplots = gPlots.size();
+
+  vector<TTreeFormula *>        fvar (nplots, (TTreeFormula *) 0);
+  vector<TTreeFormula *>        fsel (nplots, (TTreeFormula *) 0);
+  vector<TTreeFormulaManager *> fmgr (nplots, (TTreeFormulaManager *) 0);
+  set<string> branches;
+
+  for(unsigned int i = 0; i < nplots; i++) {
+    ostringstream name;
+    name << "f" << i;
+    fvar[i] = new TTreeFormula((name.str()+"v").c_str(), gPlots[i].var.c_str(), gst);
+    if(gPlots[i].sel.size() > 0) {
+      fsel[i] = new TTreeFormula((name.str()+"s").c_str(), gPlots[i].sel.c_str(), gst);
+    }
+    fmgr[i] = new TTreeFormulaManager;
+    fmgr[i]->Add(fvar[i]);
+    if(fsel[i]) fmgr[i]->Add(fsel[i]);
+    fmgr[i]->Sync();
+
+    // note the branches used by the plot
+    TTreeFormula * f[2] = { fvar[i], fsel[i] };
+    for(int k = 0; k < 2; k++) {
+      if(!f[k]) continue;
+      if(f[k]->GetNdim() == 0) {
+        LOG("gevcomp", pFATAL)
+          << "Invalid gst expression: " << f[k]->GetTitle();
+        exit(1);
+      }
+      for(int icode = 0; icode < f[k]->GetNcodes(); icode++) {
+        TLeaf * leaf = f[k]->GetLeaf(icode);
+        if(!leaf) continue;
+        branches.insert(leaf->GetBranch()->GetName());
+        if(leaf->GetLeafCount()) {
+          branches.insert(leaf->GetLeafCount()->GetBranch()->GetName());
+        }
+      }
+    }
+  }
+
+  gst->SetCacheSize(30000000);
+  gst->SetCacheEntryRange(first, last);
+  set<string>::const_iterator bit = branches.begin();
+  for( ; bit != branches.end(); ++bit) {
+    gst->AddBranchToCache(bit->c_str(), true);
+  }
+  gst->StopCacheLearningPhase();
+
+  // per-plot accumulators
+  vector<Long64_t>         nsel    (nplots, 0);
+  vector<double>           vmin    (nplots, 0.);
+  vector<double>           vmax    (nplots, 0.);
+  vector<double>           entries (nplots, 0.);
+  vector< vector<double> > sumw    (nplots);
+  vector< vector<double> > sumw2   (nplots);
+  if(pass == kPassFill) {
+    for(unsigned int i = 0; i < nplots; i++) {
+      const TH1D * h = gPlots[i].hist[0];
+      sumw [i].assign(h->GetNbinsX()+2, 0.);
+      sumw2[i].assign(h->GetNbinsX()+2, 0.);
+    }
+  }
+
+  for(Long64_t iev = first; iev < last; iev++) {
+    gst->LoadTree(iev);
+    for(unsigned int i = 0; i < nplots; i++) {
+      int ndata = fmgr[i]->GetNdata();
+      for(int inst = 0; inst < ndata; inst++) {
+        double w = 1.;
+        if(fsel[i]) {
+          w = fsel[i]->EvalInstance(inst);
+          if(w == 0) continue;
+        }
+        double v = fvar[i]->EvalInstance(inst);
+        if(pass == kPassRange) {
+          if(nsel[i] == 0 || v < vmin[i]) vmin[i] = v;
+          if(nsel[i] == 0 || v > vmax[i]) vmax[i] = v;
+          nsel[i]++;
+        } else {
+          int ibin = gPlots[i].hist[0]->GetXaxis()->FindFixBin(v);
+          sumw [i][ibin] += w;
+          sumw2[i][ibin] += w*w;
+          entries[i]++;
+        }
+      }
+    }
+  }
+
+  // write out the results
+  out << setprecision(17);
+  for(unsigned int i = 0; i < nplots; i++) {
+    if(pass == kPassRange) {
+      out << nsel[i] << " " << vmin[i] << " " << vmax[i] << "\n";
+    } else {
+      out << entries[i];
+      for(unsigned int ibin = 0; ibin < sumw[i].size(); ibin++) {
+        out << " " << sumw[i][ibin] << " " << sumw2[i][ibin];
+      }
+      out << "\n";
+    }
+  }
+
+  // (the formula manager is deleted along with the last of its formulas)
+  for(unsigned int i = 0; i < nplots; i++) {
+    delete fvar[i];
+    if(fsel[i]) delete fsel[i];
+  }
+  file.Close();
+}
+//_________________________________________________________________________________
+void MergeScan(int isample, ScanPass_t pass, istream & in)
+{
+  for(unsigned int i = 0; i < gPlots.size(); i++) {
+    Plot_t & plot = gPlots[i];
+    if(pass == kPassRange) {
+      Long64_t nsel = 0;
+      double   vmin = 0, vmax = 0;
+      in >> nsel >> vmin >> vmax;
+      if(nsel == 0) continue;
+      if(plot.nsel == 0 || vmin < plot.vmin) plot.vmin = vmin;
+      if(plot.nsel == 0 || vmax > plot.vmax) plot.vmax = vmax;
+      plot.nsel += nsel;
+    } else {
+      double entries = 0;
+      in >> entries;
+      plot.entries[isample] += entries;
+      for(unsigned int ibin = 0; ibin < plot.sumw[isample].size(); ibin++) {
+        double w = 0, w2 = 0;
+        in >> w >> w2;
+        plot.sumw [isample][ibin] += w;
+        plot.sumw2[isample][ibin] += w2;
+      }
+    }
+  }
+  if(in.fail()) {
+    LOG("gevcomp", pFATAL) << "Failed to read the results of an event scan";
+    exit(1);
   }
 }
 //_________________________________________________________________________________
@@ -2021,13 +1390,35 @@ void GetCommandLineArgs(int argc, char ** argv)
   } else {
     LOG("gevcomp", pNOTICE) << "Unspecified 'reference' event sample";
   }
+
+  // number of events to analyze
+  if( parser.OptionExists('n') ) {
+    LOG("gevcomp", pINFO) << "Reading number of events to analyze";
+    gOptNEvt = parser.ArgAsLong('n');
+  } else {
+    LOG("gevcomp", pINFO) << "Unspecified number of events to analyze - Use all";
+    gOptNEvt = -1;
+  }
+
+  // number of worker processes
+  if( parser.OptionExists('j') ) {
+    LOG("gevcomp", pINFO) << "Reading number of worker processes";
+    gOptNWorkers = parser.ArgAsInt('j');
+    if(gOptNWorkers < 1) {
+      LOG("gevcomp", pFATAL) << "Invalid number of worker processes: " << gOptNWorkers;
+      PrintSyntax();
+      exit(1);
+    }
+  } else {
+    gOptNWorkers = 1;
+  }
 }
 //_________________________________________________________________________________
 void PrintSyntax(void)
 {
   LOG("gevcomp", pNOTICE)
     << "\n\n" << "Syntax:" << "\n"
-    << " gevcomp -f sample.root [-n nev] [-r reference_sample.root]\n";
+    << " gevcomp -f sample.root [-n nev] [-r reference_sample.root] [-j n_workers]\n";
 }
 //_________________________________________________________________________________
 bool CheckRootFilename(string filename)
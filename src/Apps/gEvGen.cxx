@@ -352,7 +352,7 @@ void GenerateEventsAtFixedInitState(void)
      ntpw.AddEventRecord(ievent, event);
      mcjmonitor.Update(ievent,event);
      ievent++;
-     delete event;
+     evg_driver.RecycleEvent(event);
   }
 
   // Save the generated MC events
@@ -416,7 +416,7 @@ void GenerateEventsUsingFluxOrTgtMix(void)
      ntpw.AddEventRecord(ievent, event);
      mcjmonitor.Update(ievent,event);
      ievent++;
-     delete event;
+     mcj_driver->RecycleEvent(event);
   }
 
   // Save the generated MC events
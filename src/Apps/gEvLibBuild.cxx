@@ -0,0 +1,789 @@
+//____________________________________________________________________________
+/*!
+
+\program gevlib_build
+
+\brief   Builds a binary event library (see EventLibraryInterface) from
+         large samples of events produced by GENIE or an external generator.
+
+         The input events are streamed: they are buffered per library key
+         (target, neutrino, CC/NC) up to a configurable memory budget, then
+         sorted by neutrino energy and spilled to temporary run files. Once
+         all inputs are read, the runs of each key are combined with a k-way
+         merge (external-memory merge sort), so that libraries much larger
+         than the available memory can be built. The sorted records are
+         written in the memory-mapped binary library format, split into
+         shards covering consecutive energy ranges, and a text index listing
+         all shards is written. The index can be used directly as the
+         EventLibraryPath of EventLibraryInterface and EvtLibPXSec.
+
+\syntax  gevlib_build -f input_file_list -o output_index_file
+                      [--input-format format]
+                      [--xsec-file root_file]
+                      [--records-per-shard n]
+                      [--max-memory megabytes]
+                      [--tmp-dir directory]
+                      [--report-every n]
+                      [--message-thresholds xml_file]
+
+         Options :
+           [] Denotes an optional argument.
+           -f
+              Input files. Wildcards are accepted (in quotes), eg
+              -f '/data/lib/*.root'
+           -o
+              Name of the output shard index. The shard files are written
+              next to it, as <name>.<target>_<neutrino>_<cc|nc>.<shard>.gevtlib
+              (a trailing `.idx' is stripped from <name>).
+           --input-format
+              Format of the input files:
+               - evtlib : ROOT event library, with the records of each key in
+                          a <target>/<cc|nc>/<neutrino>/records tree and its
+                          cross section in a <target>/<cc|nc>/<neutrino>/xsec
+                          graph (the format read by EventLibraryInterface)
+               - ghep   : GENIE GHEP event files. The record energy is the
+                          probe energy and the record particles are the
+                          stable final state particles of each event. The
+                          record prod_id is the generator mode code, as for
+                          external generators: the NEUT-like reaction code
+                          (the neut_code branch of gst trees).
+               - auto   : decided file by file [default]
+           --xsec-file
+              ROOT event library file to take cross sections from, for keys
+              without cross section graphs in the inputs (eg for GHEP inputs).
+           --records-per-shard
+              Maximum number of records per shard file. If 0, each key is
+              written in a single shard [default: 0].
+           --max-memory
+              Memory budget (in MB) for buffering input records before they
+              are sorted and spilled to disk [default: 1024].
+           --tmp-dir
+              Directory for the temporary sorted runs [default: the directory
+              of the output index].
+           --report-every
+              Report progress and throughput every n records
+              [default: 1000000].
+           --message-thresholds
+              Specify the GENIE verbosity level.
+
+         Examples:
+           gevlib_build -f 'nuwro_*.evtlib.root' -o nuwro.idx \
+                        --records-per-shard 10000000 --max-memory 4096
+
+           gevlib_build -f 'gntp.*.ghep.root' -o genie_lib.idx \
+                        --xsec-file genie_lib_xsec.root
+
+\author  The GENIE Collaboration
+
+\created October 16, 2026
+
+\cpright Copyright (c) 2003-2023, The GENIE Collaboration
+         For the full text of the license visit http://copyright.genie-mc.org
+
+*/
+//____________________________________________________________________________
+
+#include <cstdio>
+#include <cstdlib>
+#include <algorithm>
+#include <functional>
+#include <map>
+#include <queue>
+#include <sstream>
+#include <string>
+#include <vector>
+
+#include <unistd.h>
+
+#include <TFile.h>
+#include <TTree.h>
+#include <TGraph.h>
+#include <TChain.h>
+#include <TChainElement.h>
+#include <TStopwatch.h>
+#include <TMath.h>
+
+#include "Framework/EventGen/EventRecord.h"
+#include "Framework/GHEP/GHepStatus.h"
+#include "Framework/GHEP/GHepParticle.h"
+#include "Framework/GHEP/GHepUtils.h"
+#include "Framework/Interaction/Interaction.h"
+#include "Framework/Messenger/Messenger.h"
+#include "Framework/Ntuple/NtpMCEventRecord.h"
+#include "Framework/ParticleData/PDGCodes.h"
+#include "Framework/ParticleData/PDGUtils.h"
+#include "Framework/ParticleData/PDGLibrary.h"
+#include "Framework/Utils/AppInit.h"
+#include "Framework/Utils/CmdLnArgParser.h"
+#include "Framework/Utils/RunOpt.h"
+#include "Tools/EvtLib/Key.h"
+#include "Tools/EvtLib/EvtLibRecordList.h"
+#include "Tools/EvtLib/EvtLibBinaryFile.h"
+
+using std::string;
+using std::vector;
+using std::map;
+using std::pair;
+using std::ostringstream;
+
+using namespace genie;
+using namespace genie::evtlib;
+
+typedef vector< pair<double, double> > XSecTable_t;
+
+// Records of one library key, waiting to be sorted and written out
+struct KeyBuffer {
+  KeyBuffer() : nrecs(0) {}
+  vector<EvtLibRecord> recs;  // records read since the last spill
+  vector<string>       runs;  // energy-sorted runs spilled to disk
+  Long64_t             nrecs; // total number of records read
+};
+
+// Progress and throughput reporting for one processing phase
+struct Progress {
+  Progress(string phase) : fPhase(phase), fNRecs(0), fNBytes(0) { fTimer.Start(); }
+  void     Add    (const EvtLibRecord & rec);
+  void     Report (bool final = false);
+  string     fPhase;
+  Long64_t   fNRecs;
+  Long64_t   fNBytes;
+  TStopwatch fTimer;
+};
+
+// func prototypes
+void     GetCommandLineArgs  (int argc, char ** argv);
+void     PrintSyntax         (void);
+void     ReadInputs          (void);
+void     ReadEvtLibFile      (TFile & fin, Progress & progress);
+void     ReadGHepFile        (TFile & fin, Progress & progress);
+void     ReadXSecs           (TFile & fin);
+void     AddRecord           (const Key & key, const EvtLibRecord & rec, Progress & progress);
+void     SpillRuns           (void);
+string   WriteRun            (vector<EvtLibRecord> & recs);
+FILE *   CreateRun           (string & fname);
+void     CloseRun            (FILE * f, const string & fname);
+bool     ReadRunRecord       (FILE * f, EvtLibRecord & rec);
+void     WriteRunRecord      (FILE * f, const EvtLibRecord & rec);
+void     MergeRuns           (const vector<string> & runs,
+                              std::function<void (const EvtLibRecord &)> sink);
+void     WriteLibrary        (void);
+void     WriteKey            (const Key & key, KeyBuffer & buf, Progress & progress);
+string   ShardFileName       (const Key & key, int ishard);
+Long64_t RecordBytes         (const EvtLibRecord & rec);
+
+// consts
+const int      kMaxMergeFanIn  = 64;      // max number of runs merged at once
+const size_t   kRunBufferSize  = 1 << 20; // stdio buffer of each run file
+const Long64_t kMB             = 1 << 20;
+
+// input options (from command line arguments):
+string   gOptInpFileNames;    ///< input file names (may contain wildcards)
+string   gOptOutFileName;     ///< output shard index file name
+string   gOptInpFormat;       ///< input format: evtlib, ghep or auto
+string   gOptXSecFileName;    ///< extra cross section file
+Long64_t gOptRecsPerShard;    ///< max number of records per shard (0: no limit)
+Long64_t gOptMaxMemory;       ///< record buffer budget (bytes)
+string   gOptTmpDir;          ///< directory for the temporary runs
+Long64_t gOptReportEvery;     ///< progress report period (records)
+
+// global state
+map<Key, KeyBuffer>   gKeys;        ///< records, per library key
+map<Key, XSecTable_t> gXSecs;       ///< cross sections, per library key
+Long64_t              gBufferBytes = 0; ///< approx. memory held by the buffers
+Long64_t              gNRuns       = 0; ///< number of runs spilled
+Long64_t              gRunBytes    = 0; ///< bytes written to runs
+Long64_t              gOutBytes    = 0; ///< bytes written to shard files
+vector<BinaryLibrary::ShardInfo> gShards;
+
+//____________________________________________________________________________
+int main(int argc, char ** argv)
+{
+  GetCommandLineArgs(argc, argv);
+
+  utils::app_init::MesgThresholds(RunOpt::Instance()->MesgThresholdFiles());
+
+  TStopwatch timer;
+  timer.Start();
+
+  ReadInputs();
+  WriteLibrary();
+
+  timer.Stop();
+  LOG("gevlib_build", pNOTICE)
+     << "Wrote " << gShards.size() << " shards (" << gOutBytes/double(kMB)
+     << " MB) for " << gKeys.size() << " keys in " << timer.RealTime()
+     << " s, using " << gNRuns << " temporary runs (" << gRunBytes/double(kMB)
+     << " MB)";
+  LOG("gevlib_build", pNOTICE) << "Done! Library index: " << gOptOutFileName;
+
+  return 0;
+}
+//____________________________________________________________________________
+void ReadInputs(void)
+{
+  // Expand the input file list (wildcards are resolved by TChain)
+  TChain chain;
+  chain.Add(gOptInpFileNames.c_str());
+
+  TObjArray * file_array = chain.GetListOfFiles();
+  int nfiles = file_array->GetEntries();
+  if(nfiles == 0) {
+    LOG("gevlib_build", pFATAL) << "No input files match: " << gOptInpFileNames;
+    exit(1);
+  }
+  LOG("gevlib_build", pNOTICE)
+     << "Reading " << nfiles << (nfiles==1 ? " file" : " files");
+
+  Progress progress("Read");
+
+  TIter next_file(file_array);
+  TChainElement * chEl = 0;
+  while (( chEl = (TChainElement*)next_file() )) {
+    TFile fin(chEl->GetTitle(), "read");
+    if(fin.IsZombie()) {
+      LOG("gevlib_build", pFATAL) << "Can not read: " << chEl->GetTitle();
+      exit(1);
+    }
+
+    bool isghep = (gOptInpFormat == "ghep");
+    if(gOptInpFormat == "auto") {
+      isghep = (fin.Get("gtree") != 0);
+    }
+
+    LOG("gevlib_build", pNOTICE)
+       << "* Reading " << (isghep ? "GHEP" : "event library")
+       << " file: " << chEl->GetTitle();
+
+    if(isghep) ReadGHepFile  (fin, progress);
+    else       ReadEvtLibFile(fin, progress);
+  }
+  progress.Report(true);
+
+  // Cross sections for keys without graphs in the inputs
+  if(gOptXSecFileName.size() > 0) {
+    TFile fxsec(gOptXSecFileName.c_str(), "read");
+    if(fxsec.IsZombie()) {
+      LOG("gevlib_build", pFATAL) << "Can not read: " << gOptXSecFileName;
+      exit(1);
+    }
+    ReadXSecs(fxsec);
+  }
+}
+//____________________________________________________________________________
+void ReadEvtLibFile(TFile & fin, Progress & progress)
+{
+  // Same layout as read by EventLibraryInterface
+  PDGLibrary * pdglib = PDGLibrary::Instance();
+
+  TIter next(fin.GetListOfKeys());
+  while(TObject * dir = next()) {
+    const string tgtName = dir->GetName();
+    const TParticlePDG * tgtPart = pdglib->DBase()->GetParticle(tgtName.c_str());
+    if(!tgtPart) continue;
+
+    for(int pdg: {kPdgNuE,   kPdgAntiNuE,
+                  kPdgNuMu,  kPdgAntiNuMu,
+                  kPdgNuTau, kPdgAntiNuTau}) {
+      for(bool iscc: {true, false}) {
+        // NCs are indexed by nu_mu, as in EventLibraryInterface
+        if(!iscc && abs(pdg) != kPdgNuMu) continue;
+
+        string nuName = pdglib->Find(pdg)->GetName();
+        if(!iscc) nuName = pdg::IsAntiNeutrino(pdg) ? "nu_bar" : "nu";
+
+        const string treeName =
+          TString::Format("%s/%s/%s/records",
+                          tgtName.c_str(), iscc ? "cc" : "nc",
+                          nuName.c_str()).Data();
+
+        TTree * tr = dynamic_cast<TTree *> (fin.Get(treeName.c_str()));
+        if(!tr) continue;
+
+        const Key key(tgtPart->PdgCode(), pdg, iscc);
+
+        RecordLoader loader(tr);
+        const long nrecs = loader.NRecords();
+        LOG("gevlib_build", pINFO) << "Reading " << nrecs << " records for " << key;
+        for(long i = 0; i < nrecs; i++) {
+          AddRecord(key, loader.GetRecord(i), progress);
+        }
+      } // iscc
+    } // pdg
+  } // dir
+
+  ReadXSecs(fin);
+}
+//____________________________________________________________________________
+void ReadGHepFile(TFile & fin, Progress & progress)
+{
+  TTree * tree = dynamic_cast<TTree *> (fin.Get("gtree"));
+  if(!tree) {
+    LOG("gevlib_build", pFATAL) << "No GHEP tree found in " << fin.GetName();
+    exit(1);
+  }
+
+  NtpMCEventRecord * mcrec = 0;
+  tree->SetBranchAddress("gmcrec", &mcrec);
+
+  Long64_t nskipped = 0;
+  const Long64_t nev = tree->GetEntries();
+  for(Long64_t iev = 0; iev < nev; iev++) {
+    tree->GetEntry(iev);
+    const EventRecord & event = *(mcrec->event);
+    const Interaction & in    = *(event.Summary());
+    const InitialState & init_state = in.InitState();
+    const ProcessInfo  & proc_info  = in.ProcInfo();
+
+    if(!proc_info.IsWeakCC() && !proc_info.IsWeakNC()) {
+      nskipped++;
+      mcrec->Clear();
+      continue;
+    }
+
+    // NCs are indexed by nu_mu, as in EventLibraryInterface
+    int probe = init_state.ProbePdg();
+    if(proc_info.IsWeakNC()) {
+      probe = pdg::IsAntiNeutrino(probe) ? kPdgAntiNuMu : kPdgNuMu;
+    }
+    const Key key(init_state.TgtPdg(), probe, proc_info.IsWeakCC());
+
+    EvtLibRecord rec;
+    rec.E       = init_state.ProbeE(kRfLab);
+    // generator mode code, as the external generator codes (eg the GiBUU
+    // evType) stored in ROOT libraries: the NEUT-like GENIE reaction code
+    rec.prod_id = utils::ghep::NeutReactionCode(&event);
+
+    GHepParticle * p = 0;
+    TIter piter(&event);
+    while( (p = dynamic_cast<GHepParticle *>(piter.Next())) ) {
+      if(p->Status() != kIStStableFinalState) continue;
+      EvtLibParticle part;
+      part.pdg = p->Pdg();
+      part.E   = p->E();
+      part.px  = p->Px();
+      part.py  = p->Py();
+      part.pz  = p->Pz();
+      rec.parts.push_back(part);
+    }
+    mcrec->Clear();
+
+    AddRecord(key, rec, progress);
+  }
+
+  if(nskipped > 0) {
+    LOG("gevlib_build", pWARN)
+       << "Skipped " << nskipped << " events which are neither CC nor NC";
+  }
+}
+//____________________________________________________________________________
+void ReadXSecs(TFile & fin)
+{
+// Reads the cross sections of the keys which do not have one yet
+
+  PDGLibrary * pdglib = PDGLibrary::Instance();
+
+  for(const auto & it: gKeys) {
+    const Key & key = it.first;
+    if(gXSecs.count(key)) continue;
+
+    const TParticlePDG * tgtPart = pdglib->Find(key.nucl_pdg);
+    if(!tgtPart) continue;
+    string nuName = pdglib->Find(key.nu_pdg)->GetName();
+    if(!key.iscc) nuName = pdg::IsAntiNeutrino(key.nu_pdg) ? "nu_bar" : "nu";
+
+    const string graphName =
+      TString::Format("%s/%s/%s/xsec",
+                      tgtPart->GetName(), key.iscc ? "cc" : "nc",
+                      nuName.c_str()).Data();
+
+    TGraph * g = dynamic_cast<TGraph *> (fin.Get(graphName.c_str()));
+    if(!g) continue;
+
+    XSecTable_t & xsec = gXSecs[key];
+    for(int i = 0; i < g->GetN(); i++) {
+      xsec.push_back(std::make_pair(g->GetX()[i], g->GetY()[i]));
+    }
+    LOG("gevlib_build", pINFO)
+       << "Read " << g->GetN() << " cross section points for " << key
+       << " from " << fin.GetName();
+  }
+}
+//____________________________________________________________________________
+void AddRecord(const Key & key, const EvtLibRecord & rec, Progress & progress)
+{
+  KeyBuffer & buf = gKeys[key];
+  buf.recs.push_back(rec);
+  buf.nrecs++;
+
+  gBufferBytes += sizeof(EvtLibRecord) + rec.parts.size() * sizeof(EvtLibParticle);
+  progress.Add(rec);
+
+  if(gBufferBytes > gOptMaxMemory) SpillRuns();
+}
+//____________________________________________________________________________
+void SpillRuns(void)
+{
+// Sorts the buffered records of each key and writes them to temporary runs
+
+  Long64_t nrecs = 0;
+  int      nruns = 0;
+  for(auto & it: gKeys) {
+    KeyBuffer & buf = it.second;
+    if(buf.recs.empty()) continue;
+    nrecs += buf.recs.size();
+    nruns++;
+    buf.runs.push_back(WriteRun(buf.recs));
+  }
+  gBufferBytes = 0;
+
+  LOG("gevlib_build", pNOTICE)
+     << "Memory budget reached: spilled " << nrecs << " sorted records to "
+     << nruns << " runs";
+}
+//____________________________________________________________________________
+string WriteRun(vector<EvtLibRecord> & recs)
+{
+  std::stable_sort(recs.begin(), recs.end());
+
+  string fname;
+  FILE * f = CreateRun(fname);
+  for(const EvtLibRecord & rec: recs) WriteRunRecord(f, rec);
+  CloseRun(f, fname);
+
+  // release the memory, not only the records
+  vector<EvtLibRecord>().swap(recs);
+
+  return fname;
+}
+//____________________________________________________________________________
+FILE * CreateRun(string & fname)
+{
+  fname = gOptTmpDir + "/gevlib_build.run.XXXXXX";
+  vector<char> templ(fname.begin(), fname.end());
+  templ.push_back('\0');
+  int fd = mkstemp(templ.data());
+  FILE * f = (fd < 0) ? 0 : fdopen(fd, "wb");
+  if(!f) {
+    LOG("gevlib_build", pFATAL)
+       << "Can not create a temporary file in " << gOptTmpDir;
+    exit(1);
+  }
+  fname = templ.data();
+  setvbuf(f, 0, _IOFBF, kRunBufferSize);
+  return f;
+}
+//____________________________________________________________________________
+void CloseRun(FILE * f, const string & fname)
+{
+  if(fclose(f) != 0) {
+    LOG("gevlib_build", pFATAL) << "Failed writing temporary file " << fname;
+    exit(1);
+  }
+  gNRuns++;
+}
+//____________________________________________________________________________
+Long64_t RecordBytes(const EvtLibRecord & rec)
+{
+  return sizeof(float) + 2*sizeof(int) + rec.parts.size() * sizeof(EvtLibParticle);
+}
+//____________________________________________________________________________
+void WriteRunRecord(FILE * f, const EvtLibRecord & rec)
+{
+// Run record: E, prod_id, nparts, then the particles as EvtLibParticle
+
+  const int nparts = rec.parts.size();
+  bool ok = fwrite(&rec.E,       sizeof(float), 1, f) == 1 &&
+            fwrite(&rec.prod_id, sizeof(int),   1, f) == 1 &&
+            fwrite(&nparts,      sizeof(int),   1, f) == 1;
+  if(ok && nparts > 0) {
+    ok = fwrite(rec.parts.data(), sizeof(EvtLibParticle), nparts, f) == size_t(nparts);
+  }
+  if(!ok) {
+    LOG("gevlib_build", pFATAL) << "Failed writing temporary run";
+    exit(1);
+  }
+  gRunBytes += RecordBytes(rec);
+}
+//____________________________________________________________________________
+bool ReadRunRecord(FILE * f, EvtLibRecord & rec)
+{
+  int nparts = 0;
+  if(fread(&rec.E, sizeof(float), 1, f) != 1) return false; // end of run
+
+  bool ok = fread(&rec.prod_id, sizeof(int), 1, f) == 1 &&
+            fread(&nparts,      sizeof(int), 1, f) == 1 &&
+            nparts >= 0;
+  if(ok) {
+    rec.parts.resize(nparts);
+    ok = nparts == 0 ||
+         fread(rec.parts.data(), sizeof(EvtLibParticle), nparts, f) == size_t(nparts);
+  }
+  if(!ok) {
+    LOG("gevlib_build", pFATAL) << "Truncated temporary run";
+    exit(1);
+  }
+  return true;
+}
+//____________________________________________________________________________
+void MergeRuns(const vector<string> & runs,
+               std::function<void (const EvtLibRecord &)> sink)
+{
+// k-way merge of energy-sorted runs. Ties are resolved in run order so that
+// the merge is stable. The runs are deleted once merged.
+
+  const int nruns = runs.size();
+  vector<FILE *>       files(nruns);
+  vector<EvtLibRecord> heads(nruns);
+
+  typedef pair<float, int> Entry_t; // (energy, run)
+  std::priority_queue<Entry_t, vector<Entry_t>, std::greater<Entry_t> > queue;
+
+  for(int i = 0; i < nruns; i++) {
+    files[i] = fopen(runs[i].c_str(), "rb");
+    if(!files[i]) {
+      LOG("gevlib_build", pFATAL) << "Can not read temporary run " << runs[i];
+      exit(1);
+    }
+    setvbuf(files[i], 0, _IOFBF, kRunBufferSize);
+    if(ReadRunRecord(files[i], heads[i])) queue.push(Entry_t(heads[i].E, i));
+  }
+
+  while(!queue.empty()) {
+    const int i = queue.top().second;
+    queue.pop();
+    sink(heads[i]);
+    if(ReadRunRecord(files[i], heads[i])) queue.push(Entry_t(heads[i].E, i));
+  }
+
+  for(int i = 0; i < nruns; i++) {
+    fclose(files[i]);
+    unlink(runs[i].c_str());
+  }
+}
+//____________________________________________________________________________
+void WriteLibrary(void)
+{
+  Progress progress("Write");
+
+  for(auto & it: gKeys) {
+    WriteKey(it.first, it.second, progress);
+  }
+  progress.Report(true);
+
+  BinaryLibrary::WriteIndex(gOptOutFileName, gShards);
+}
+//____________________________________________________________________________
+void WriteKey(const Key & key, KeyBuffer & buf, Progress & progress)
+{
+  auto xsec_it = gXSecs.find(key);
+  if(xsec_it == gXSecs.end()) {
+    LOG("gevlib_build", pWARN) << "No cross section available for " << key;
+  }
+
+  LOG("gevlib_build", pNOTICE)
+     << "Writing " << buf.nrecs << " records for " << key;
+
+  // Shard writer state
+  BinaryRecordWriter * writer = 0;
+  int      ishard = 0;
+  Long64_t nshard = 0;
+  float    Emin   = 0;
+  float    Emax   = 0;
+  string   fname;
+
+  auto close_shard = [&]() {
+    if(!writer) return;
+    if(xsec_it != gXSecs.end()) writer->SetXSec(xsec_it->second);
+    writer->Close();
+    gOutBytes += writer->NBytes();
+    delete writer;
+    writer = 0;
+    // shard files are listed relative to the index
+    const string base = fname.substr(fname.rfind('/') + 1);
+    gShards.push_back(BinaryLibrary::ShardInfo(key, nshard, Emin, Emax, base));
+    ishard++;
+  };
+
+  auto sink = [&](const EvtLibRecord & rec) {
+    if(writer && gOptRecsPerShard > 0 && nshard >= gOptRecsPerShard) {
+      close_shard();
+    }
+    if(!writer) {
+      fname  = ShardFileName(key, ishard);
+      writer = new BinaryRecordWriter(fname);
+      writer->BeginKey(key);
+      nshard = 0;
+      Emin   = rec.E;
+    }
+    writer->AddRecord(rec);
+    nshard++;
+    Emax = rec.E;
+    progress.Add(rec);
+  };
+
+  if(buf.runs.empty()) {
+    // everything fitted in memory
+    std::stable_sort(buf.recs.begin(), buf.recs.end());
+    for(const EvtLibRecord & rec: buf.recs) sink(rec);
+    vector<EvtLibRecord>().swap(buf.recs);
+  }
+  else {
+    if(!buf.recs.empty()) buf.runs.push_back(WriteRun(buf.recs));
+
+    // Merge in several passes if there are too many runs to open at once
+    while(buf.runs.size() > (size_t)kMaxMergeFanIn) {
+      // Each pass merges consecutive groups of runs and puts every merged
+      // run where its group was, so that the run order (and therefore the
+      // order of records with equal energies) is preserved
+      vector<string> merged_runs;
+      for(size_t first = 0; first < buf.runs.size(); first += kMaxMergeFanIn) {
+        size_t last = std::min(first + kMaxMergeFanIn, buf.runs.size());
+        if(last - first == 1) {
+          merged_runs.push_back(buf.runs[first]);
+          continue;
+        }
+        vector<string> group(buf.runs.begin() + first, buf.runs.begin() + last);
+
+        string merged;
+        FILE * f = CreateRun(merged);
+        MergeRuns(group, [f](const EvtLibRecord & rec) { WriteRunRecord(f, rec); });
+        CloseRun(f, merged);
+        merged_runs.push_back(merged);
+        LOG("gevlib_build", pINFO)
+           << "Merged " << group.size() << " runs for " << key << " into " << merged;
+      }
+      buf.runs.swap(merged_runs);
+    }
+    MergeRuns(buf.runs, sink);
+    buf.runs.clear();
+  }
+
+  close_shard();
+}
+//____________________________________________________________________________
+string ShardFileName(const Key & key, int ishard)
+{
+  string base = gOptOutFileName;
+  const string ext = ".idx";
+  if(base.size() > ext.size() &&
+     base.compare(base.size() - ext.size(), ext.size(), ext) == 0) {
+    base.erase(base.size() - ext.size());
+  }
+
+  ostringstream name;
+  name << base << "." << key.nucl_pdg << "_" << key.nu_pdg << "_"
+       << (key.iscc ? "cc" : "nc") << "." << ishard << ".gevtlib";
+  return name.str();
+}
+//____________________________________________________________________________
+void Progress::Add(const EvtLibRecord & rec)
+{
+  fNRecs++;
+  fNBytes += RecordBytes(rec);
+  if(gOptReportEvery > 0 && fNRecs % gOptReportEvery == 0) this->Report();
+}
+//____________________________________________________________________________
+void Progress::Report(bool final)
+{
+  fTimer.Stop();
+  const double t = TMath::Max(fTimer.RealTime(), 1E-9);
+  LOG("gevlib_build", pNOTICE)
+     << fPhase << (final ? " done: " : ": ") << fNRecs << " records ("
+     << fNBytes/double(kMB) << " MB) in " << t << " s -- "
+     << fNRecs/t << " records/s, " << fNBytes/double(kMB)/t << " MB/s";
+  if(!final) fTimer.Continue();
+}
+//____________________________________________________________________________
+void GetCommandLineArgs(int argc, char ** argv)
+{
+  // Common run options. Set defaults and read.
+  RunOpt::Instance()->ReadFromCommandLine(argc,argv);
+
+  // Parse run options for this app
+
+  CmdLnArgParser parser(argc,argv);
+
+  if( parser.OptionExists('h') ) {
+    PrintSyntax();
+    exit(0);
+  }
+
+  // input files
+  if( parser.OptionExists('f') ) {
+    gOptInpFileNames = parser.ArgAsString('f');
+  } else {
+    LOG("gevlib_build", pFATAL) << "Unspecified input files - Exiting";
+    PrintSyntax();
+    exit(1);
+  }
+
+  // output index
+  if( parser.OptionExists('o') ) {
+    gOptOutFileName = parser.ArgAsString('o');
+  } else {
+    LOG("gevlib_build", pFATAL) << "Unspecified output file - Exiting";
+    PrintSyntax();
+    exit(1);
+  }
+
+  gOptInpFormat = "auto";
+  if( parser.OptionExists("input-format") ) {
+    gOptInpFormat = parser.ArgAsString("input-format");
+  }
+  if(gOptInpFormat != "auto" && gOptInpFormat != "evtlib" && gOptInpFormat != "ghep") {
+    LOG("gevlib_build", pFATAL) << "Unknown input format: " << gOptInpFormat;
+    PrintSyntax();
+    exit(1);
+  }
+
+  gOptXSecFileName = "";
+  if( parser.OptionExists("xsec-file") ) {
+    gOptXSecFileName = parser.ArgAsString("xsec-file");
+  }
+
+  gOptRecsPerShard = 0;
+  if( parser.OptionExists("records-per-shard") ) {
+    gOptRecsPerShard = parser.ArgAsLong("records-per-shard");
+  }
+
+  gOptMaxMemory = 1024 * kMB;
+  if( parser.OptionExists("max-memory") ) {
+    gOptMaxMemory = parser.ArgAsLong("max-memory") * kMB;
+  }
+  if(gOptMaxMemory <= 0) {
+    LOG("gevlib_build", pFATAL) << "The memory budget must be positive";
+    exit(1);
+  }
+
+  const size_t slash = gOptOutFileName.rfind('/');
+  gOptTmpDir = (slash == string::npos) ? "." : gOptOutFileName.substr(0, slash);
+  if( parser.OptionExists("tmp-dir") ) {
+    gOptTmpDir = parser.ArgAsString("tmp-dir");
+  }
+
+  gOptReportEvery = 1000000;
+  if( parser.OptionExists("report-every") ) {
+    gOptReportEvery = parser.ArgAsLong("report-every");
+  }
+
+  LOG("gevlib_build", pNOTICE)
+     << "\n Input files       : " << gOptInpFileNames
+     << "\n Input format      : " << gOptInpFormat
+     << "\n Output index      : " << gOptOutFileName
+     << "\n Records per shard : " << (gOptRecsPerShard > 0 ?
+                                      std::to_string(gOptRecsPerShard) : "unlimited")
+     << "\n Memory budget     : " << gOptMaxMemory/kMB << " MB"
+     << "\n Temporary runs in : " << gOptTmpDir;
+}
+//____________________________________________________________________________
+void PrintSyntax(void)
+{
+  LOG("gevlib_build", pNOTICE)
+    << "\n\n" << "Syntax:" << "\n"
+    << "   gevlib_build -f input_file_list -o output_index_file\n"
+    << "                [--input-format auto|evtlib|ghep] [--xsec-file root_file]\n"
+    << "                [--records-per-shard n] [--max-memory megabytes]\n"
+    << "                [--tmp-dir directory] [--report-every n]\n"
+    << "                [--message-thresholds xml_file]\n";
+}
+//____________________________________________________________________________
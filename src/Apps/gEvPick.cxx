@@ -38,6 +38,7 @@
            gevpick -i list_of_input_files 
                    -t type
                   [-o output_file]
+                  [--no-index]
                   [--message-thresholds xmfile]
                   [--event-record-print-level level]
 
@@ -112,6 +113,9 @@
            -o 
               Specify output filename.
               (optional, default: gntp.<topology>.ghep.root)
+          --no-index
+              Do not use the event topology index (see below), even if it is 
+              available: unpack and examine every input event.
           --message-thresholds
               Allows users to customize the message stream thresholds.
               The thresholds are specified using an XML file.
@@ -120,6 +124,18 @@
               Allows users to set the level of information shown when the event
               record is printed in the screen. See GHepRecord::Print().
 
+         Event topology index:
+
+           If an event topology index ("gidx" tree, see NtpTopoSummary) is available 
+           for an input file, the selection is made using the index and only the 
+           cherry-picked events are read from the GHEP event tree. The index is looked 
+           up first in the input file itself (written by the event generation job when 
+           run with `--ntp-outputs ghep,gidx') and then in a stand-alone index file 
+           sitting next to the input file (eg gntp.0.gidx.root for gntp.0.ghep.root, 
+           as written by `gntpc -i gntp.0.ghep.root -f gidx').
+           Analysts picking several topologies from the same production only need 
+           to build the index once.
+
          Examples:
 
            (1)  % gevpick -i "*.ghep.root" -t numu_nc_1pi0
@@ -158,6 +174,7 @@
 #include "Framework/Ntuple/NtpMCTreeHeader.h"
 #include "Framework/Ntuple/NtpMCEventRecord.h"
 #include "Framework/Ntuple/NtpWriter.h"
+#include "Framework/Ntuple/NtpTopoSummary.h"
 #include "Framework/Messenger/Messenger.h"
 #include "Framework/ParticleData/PDGCodes.h"
 #include "Framework/ParticleData/PDGUtils.h"
@@ -175,7 +192,8 @@ using namespace genie;
 // func prototypes
 void   GetCommandLineArgs (int argc, char ** argv);
 void   RunCherryPicker    (void);
-bool   AcceptEvent        (const EventRecord & event);
+bool   AcceptEvent        (const NtpTopoSummary & topo);
+TTree* GetIndexTree       (TFile & fin, string filename, TFile ** fidx);
 void   PrintSyntax        (void);
 string DefaultOutputFile  (void);
 
@@ -216,6 +234,7 @@ string      gOptInpFileNames;  ///< input file name
 string      gOptOutFileName;   ///< output file name
 string      gPickedTypeStr;    ///< output file name
 GPickType_t gPickedType;       ///< output file format id
+bool        gOptUseIndex;      ///< use the event topology index, if available
 
 //____________________________________________________________________________________
 int main(int argc, char ** argv)
@@ -298,27 +317,68 @@ void RunCherryPicker(void)
      LOG("gevpick", pNOTICE) 
           << "Input tree header: " << *thdr;
 
+     //
+     // Select events using the event topology index, if available
+     //
+
+     TFile * fidx = 0;
+     TTree * idx_tree = 0;
+     NtpTopoSummary topo;
+     if(gOptUseIndex && gPickedType != kPtAll) {
+       idx_tree = GetIndexTree(fin, chEl->GetTitle(), &fidx);
+       if(idx_tree && idx_tree->GetEntries() != nmax) {
+         LOG("gevpick", pWARN)
+            << "The event topology index has " << idx_tree->GetEntries()
+            << " entries but the GHEP tree has " << nmax << " - Not using it";
+         idx_tree = 0;
+       }
+       if(idx_tree && !topo.Connect(idx_tree)) {
+         idx_tree = 0;
+       }
+     }
+
      //
      // Loop over events in current file
      //
 
+     unsigned int file_picked_events = 0;
      for(Long64_t iev = 0; iev < nmax; iev++) {
        total_events++;
-       ghep_tree->GetEntry(iev);
+       if(idx_tree) {
+         // select using the index and read the selected events only
+         idx_tree->GetEntry(iev);
+         if(!AcceptEvent(topo)) continue;
+         ghep_tree->GetEntry(iev);
+       } else {
+         ghep_tree->GetEntry(iev);
+         topo.Fill(iev, *(mcrec->event));
+         if(!AcceptEvent(topo)) {
+           mcrec->Clear();
+           continue;
+         }
+       }
        NtpMCRecHeader rec_header = mcrec->hdr;
        EventRecord &  event      = *(mcrec->event);
        LOG("gevpick", pDEBUG) << rec_header;
        LOG("gevpick", pDEBUG) << event;
-       if(AcceptEvent(event)) {
-         picked_events++;
-          brOrigFilename->SetString(chEl->GetTitle());
-          brOrigEvtNum = iev;
-          ntpw.AddEventRecord( iev_glob, &event );
-          iev_glob++;
-       }
+       picked_events++;
+       file_picked_events++;
+       brOrigFilename->SetString(chEl->GetTitle());
+       brOrigEvtNum = iev;
+       ntpw.AddEventRecord( iev_glob, &event );
+       iev_glob++;
        mcrec->Clear();
 
     } // event loop (current file)
+
+    LOG("gevpick", pNOTICE)
+       << "* Picked " << file_picked_events << " events"
+       << (idx_tree ? " using the event topology index" : "");
+
+    if(fidx) {
+      fidx->Close();
+      delete fidx;
+    }
   }// file loop
 
   // save the cherry-picked MC events
@@ -328,77 +388,31 @@ void RunCherryPicker(void)
   LOG("gevpick", pNOTICE) << "Done!";
 }
 //____________________________________________________________________________________
-bool AcceptEvent(const EventRecord & event)
+bool AcceptEvent(const NtpTopoSummary & topo)
 {
   if ( gPickedType == kPtAll       ) return true;
   if ( gPickedType == kPtUndefined ) return false;
 
-  const Interaction * interaction = event.Summary();
-
-  int  nupdg     = event.Probe()->Pdg();
-  bool isnumu    = (nupdg == kPdgNuMu);
-  bool isnumubar = (nupdg == kPdgAntiNuMu);
-  bool iscc      = interaction->ProcInfo().IsWeakCC();
-  bool isnc      = interaction->ProcInfo().IsWeakNC();
-  bool isqe      = interaction->ProcInfo().IsQuasiElastic();
-  bool ismec     = interaction->ProcInfo().IsMEC();
-  bool isstr     = interaction->ExclTag().IsStrangeEvent();
-  bool ischm     = interaction->ExclTag().IsCharmEvent();
-
-  int NfP        = 0; // number of protons         in final state
-  int NfPbar     = 0; // number of anti-protons    in final state
-  int NfN        = 0; // number of neutrons        in final state
-  int NfNbar     = 0; // number of anti-neutrons   in final state
-  int NfPip      = 0; // number of \pi^+'s         in final state
-  int NfPim      = 0; // number of \pi^-'s         in final state
-  int NfPi0      = 0; // number of \pi^0's         in final state
-  int NfKp       = 0; // number of \K^+'s          in final state
-  int NfKm       = 0; // number of \K^-'s          in final state
-  int NfK0       = 0; // number of \K^0's          in final state
-  int NfK0bar    = 0; // number of \bar{\K^0}'s    in final state
-  int NfSigmap   = 0; // number of \Sigma^+'s      in final state
-  int NfSigma0   = 0; // number of \Sigma^0's      in final state
-  int NfSigmam   = 0; // number of \Sigma^-'s      in final state
-  int NfLambda0  = 0; // number of \Lambda^0's     in final state
-  int NfXi0      = 0; // number of \Xi^0's         in final state
-  int NfXim      = 0; // number of \Xi^-'s         in final state
-  int NfOmegam   = 0; // number of \Omega^-'s      in final state
-  int NfOther    = 0; // number of other particles in final state
-
-  TObjArrayIter piter(&event);
-  GHepParticle * p = 0;
-  int ip=-1;
-  while( (p = (GHepParticle *) piter.Next())) {
-    ip++;
-    int pdgc = p->Pdg();
-    int ist  = p->Status();
-    // only final state particles
-    if(ist!=kIStStableFinalState) continue;
-    // don't count final state lepton as part of the hadronic system
-    if(event.Particle(ip)->FirstMother()==0) continue;
-    // skip pseudo-particles
-    if(pdg::IsPseudoParticle(pdgc)) continue;
-    // count ...
-    if      (pdgc == kPdgProton     ) NfP++;
-    else if (pdgc == kPdgAntiProton ) NfPbar++;
-    else if (pdgc == kPdgNeutron    ) NfN++;
-    else if (pdgc == kPdgAntiNeutron) NfNbar++;
-    else if (pdgc == kPdgPiP        ) NfPip++;
-    else if (pdgc == kPdgPiM        ) NfPim++;
-    else if (pdgc == kPdgPi0        ) NfPi0++;
-    else if (pdgc == kPdgKP         ) NfKp++;
-    else if (pdgc == kPdgKM         ) NfKm++;
-    else if (pdgc == kPdgK0         ) NfK0++;
-    else if (pdgc == kPdgAntiK0     ) NfK0bar++;
-    else if (pdgc == kPdgSigmaP     ) NfSigmap++;
-    else if (pdgc == kPdgSigma0     ) NfSigma0++;
-    else if (pdgc == kPdgSigmaM     ) NfSigmam++;
-    else if (pdgc == kPdgLambda     ) NfLambda0++;
-    else if (pdgc == kPdgXi0        ) NfXi0++;
-    else if (pdgc == kPdgXiM        ) NfXim++;
-    else if (pdgc == kPdgOmegaM     ) NfOmegam++;
-    else                              NfOther++;
-  }
+  bool isnumu    = (topo.neu == kPdgNuMu);
+  bool isnumubar = (topo.neu == kPdgAntiNuMu);
+  bool iscc      = topo.cc;
+  bool isnc      = topo.nc;
+  bool isqe      = topo.qel;
+  bool ismec     = topo.mec;
+  bool isstr     = topo.strange;
+  bool ischm     = topo.charm;
+
+  // final state hadron counts (not including the primary lepton)
+  int NfPip      = topo.nfpip;
+  int NfPim      = topo.nfpim;
+  int NfPi0      = topo.nfpi0;
+  int NfSigmap   = topo.nfsigp;
+  int NfSigma0   = topo.nfsig0;
+  int NfSigmam   = topo.nfsigm;
+  int NfLambda0  = topo.nflam;
+  int NfXi0      = topo.nfxi0;
+  int NfXim      = topo.nfxim;
+  int NfOmegam   = topo.nfomm;
 
   bool is1pipX  = (NfPip==1 && NfPi0==0 && NfPim==0);
   bool is1pi0X  = (NfPip==0 && NfPi0==1 && NfPim==0);
@@ -556,6 +570,9 @@ void GetCommandLineArgs(int argc, char ** argv)
     exit(1);
   }
 
+  // use the event topology index?
+  gOptUseIndex = !parser.OptionExists("no-index");
+
   // get output file name 
   if( parser.OptionExists('o') ) {
     gOptOutFileName = parser.ArgAsString('o');
@@ -571,9 +588,45 @@ void GetCommandLineArgs(int argc, char ** argv)
     << "\n - input file(s)          : " << gOptInpFileNames
     << "\n - output file            : " << gOptOutFileName
     << "\n - cherry-picked topology : " << evtype
+    << "\n - use topology index     : " << (gOptUseIndex ? "yes (if available)" : "no")
     << "\n";
 }
 //____________________________________________________________________________________
+TTree * GetIndexTree(TFile & fin, string filename, TFile ** fidx)
+{
+// Looks for the event topology index in the input file and then in the
+// stand-alone index file next to it. If the latter is used, it is returned
+// in fidx and the caller should close it.
+
+  *fidx = 0;
+
+  string tree_name = NtpTopoSummary::TreeName();
+
+  TTree * idx_tree = dynamic_cast <TTree *> ( fin.Get(tree_name.c_str()) );
+  if(idx_tree) {
+    LOG("gevpick", pNOTICE) << "Using the event topology index in " << filename;
+    return idx_tree;
+  }
+
+  string idx_filename = NtpTopoSummary::IndexFilename(filename);
+  if(gSystem->AccessPathName(idx_filename.c_str())) {
+    LOG("gevpick", pINFO) << "No event topology index for " << filename;
+    return 0;
+  }
+
+  *fidx = new TFile(idx_filename.c_str(),"read");
+  idx_tree = dynamic_cast <TTree *> ( (*fidx)->Get(tree_name.c_str()) );
+  if(!idx_tree) {
+    LOG("gevpick", pWARN) << "No event topology index tree in " << idx_filename;
+    (*fidx)->Close();
+    delete *fidx;
+    *fidx = 0;
+    return 0;
+  }
+  LOG("gevpick", pNOTICE) << "Using the event topology index in " << idx_filename;
+  return idx_tree;
+}
+//____________________________________________________________________________________
 string DefaultOutputFile(void)
 {
   string tp = "";
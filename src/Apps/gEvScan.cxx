@@ -10,6 +10,7 @@
              -f ghep_event_file 
             [-o output_error_log_file]
             [-n nev1[,nev2]]
+            [-j n_workers]
             [--add-event-printout-in-error-log]
             [--max-num-of-errors-shown n]
             [--event-record-print-level level]
@@ -22,6 +23,12 @@
             [--check-decayer-consistency]
             [--all]
 
+         All requested checks run in a single pass over the event tree, so each
+         event is read and unpacked once. With -j n the event range is split in
+         n contiguous chunks scanned by forked worker processes; their results
+         are merged in event order, so the error log does not depend on n.
+         The scan throughput (events/s, MB/s) is reported at the end.
+
 \author  Costas Andreopoulos <constantinos.andreopoulos \at cern.ch>
  University of Liverpool & STFC Rutherford Appleton Laboratory
 
@@ -35,16 +42,23 @@
 
 //#define __debug__
 
+#include <cstdio>
 #include <string>
 #include <vector>
+#include <map>
+#include <set>
 #include <iomanip>
 #include <sstream>
 #include <fstream>
 
+#include <unistd.h>
+#include <sys/wait.h>
+
 #include <TSystem.h>
 #include <TFile.h>
 #include <TTree.h>
 #include <TH1D.h>
+#include <TStopwatch.h>
 #include <TLorentzVector.h>
 
 #include "Framework/Conventions/Constants.h"
@@ -63,9 +77,14 @@
 #include "Framework/Utils/RunOpt.h"
 
 using std::ostringstream;
+using std::istringstream;
 using std::ofstream;
+using std::ostream;
+using std::istream;
 using std::string;
 using std::vector;
+using std::map;
+using std::set;
 using std::setw;
 using std::setprecision;
 using std::setfill;
@@ -75,31 +94,69 @@ using std::endl;
 using namespace genie;
 using namespace genie::constants;
 
+// per-event checks
+typedef enum EScanCheck {
+  kChkEnergyMomentumConservation = 0,
+  kChkChargeConservation,
+  kChkPseudoParticlesInFinState,
+  kChkOffMassShellParticlesInFinState,
+  kChkNumFinStateNucleonsInconsistentWithTarget,
+  kNChecks
+} ScanCheck_t;
+
+// binning of the intranuclear vertex distribution (fm)
+const int    kNRBins = 150;
+const double kRMax   = 30.;
+
+// results of scanning a range of events
+struct ScanResults_t {
+  Long64_t nev;                           ///< number of events scanned
+  Long64_t nbytes;                        ///< number of bytes read
+  vector<Long64_t> failed[kNChecks];      ///< events failing each per-event check
+  map<int, vector<Long64_t> > r_distr;    ///< vertex r distribution per target (incl. under/overflow)
+  map<int, Long64_t> r_first;             ///< first event seen for each target
+  vector<int>      fs_pdg;                ///< particles seen in the final state
+  vector<Long64_t> fs_first;              ///< first event they were seen in
+  vector<int>      dec_pdg;               ///< particles seen to have decayed
+  vector<Long64_t> dec_first;             ///< first event they were seen in
+};
+
 void GetCommandLineArgs (int argc, char ** argv);
 void PrintSyntax        (void);
 bool CheckRootFilename  (string filename);
 
+// single-pass scan
+void ScanEvents       (Long64_t first, Long64_t last, ScanResults_t & res);
+void ScanInParallel   (ScanResults_t & res);
+void MergeResults     (const ScanResults_t & res, ScanResults_t & total);
+void WriteResults     (ostream & stream, const ScanResults_t & res);
+bool ReadResults      (istream & stream, ScanResults_t & res);
+void ClearResults     (ScanResults_t & res);
+void AddFirstSeen     (vector<int> & pdg, vector<Long64_t> & first, set<int> & seen,
+                       int pdgc, Long64_t iev);
+
 // checks
-void CheckEnergyMomentumConservation (void);
-void CheckChargeConservation (void);
-void CheckForPseudoParticlesInFinState (void);
-void CheckForOffMassShellParticlesInFinState (void);
-void CheckForNumFinStateNucleonsInconsistentWithTarget (void);
-void CheckVertexDistribution (void);
-void CheckDecayerConsistency (void);
+bool CheckEnergyMomentumConservation (const EventRecord & event);
+bool CheckChargeConservation (const EventRecord & event);
+bool CheckForPseudoParticlesInFinState (const EventRecord & event);
+bool CheckForOffMassShellParticlesInFinState (const EventRecord & event);
+bool CheckForNumFinStateNucleonsInconsistentWithTarget (const EventRecord & event);
+
+// reports
+void ReportEventCheck (ScanCheck_t check, const ScanResults_t & res);
+void ReportVertexDistribution (const ScanResults_t & res);
+void ReportDecayerConsistency (const ScanResults_t & res);
+void PrintEventInErrLog (Long64_t iev);
 
 // options
 string   gOptInpFilename = "";
 string   gOptOutFilename = "";
 Long64_t gOptNEvtL = -1;
 Long64_t gOptNEvtH = -1;
-int      gOptMaxNumErrs = -1; 
+int      gOptMaxNumErrs = -1;
+int      gOptNWorkers = 1;
 bool     gOptAddEventPrintoutInErrLog = false;
-bool     gOptCheckEnergyMomentumConservation = false;
-bool     gOptCheckChargeConservation = false;
-bool     gOptCheckForPseudoParticlesInFinState = false;
-bool     gOptCheckForOffMassShellParticlesInFinState = false;
-bool     gOptCheckForNumFinStateNucleonsInconsistentWithTarget = false;
+bool     gOptCheck[kNChecks] = { false, false, false, false, false };
 bool     gOptCheckVertexDistribution = false;
 bool     gOptCheckDecayerConsistency = false;
 
@@ -124,7 +181,7 @@ int main(int argc, char ** argv)
   LOG("gevscan", pINFO) << "Input tree header: " << *thdr;
   NtpMCFormat_t format = thdr->format;
   if(format != kNFGHEP) {
-      LOG("gevscan", pERROR) 
+      LOG("gevscan", pERROR)
         << "*** Unsupported event-tree format : "
         << NtpMCFormat::AsString(format);
       file.Close();
@@ -152,7 +209,7 @@ int main(int argc, char ** argv)
     }
   }
 
-  
+
   if(gOptOutFilename.size() == 0) {
      ostringstream logfile;
      logfile << gOptInpFilename << ".errlog";
@@ -166,29 +223,36 @@ int main(int argc, char ** argv)
      gErrLog << "# " << endl;
   }
 
-  if (gOptCheckEnergyMomentumConservation) {
-	  CheckEnergyMomentumConservation();
-  }
-  if (gOptCheckChargeConservation) {
-          CheckChargeConservation();
-  }
-  if (gOptCheckForPseudoParticlesInFinState) {
-          CheckForPseudoParticlesInFinState();
-  }
-  if (gOptCheckForOffMassShellParticlesInFinState) {
-          CheckForOffMassShellParticlesInFinState();
+  // scan all events once, running all enabled checks
+  TStopwatch timer;
+  timer.Start();
+
+  ScanResults_t results;
+  ClearResults(results);
+  if(gOptNWorkers > 1) {
+    ScanInParallel(results);
+  } else {
+    ScanEvents(gFirstEventNum, gLastEventNum+1, results);
   }
-  if (gOptCheckForNumFinStateNucleonsInconsistentWithTarget) {
-          CheckForNumFinStateNucleonsInconsistentWithTarget();
+
+  timer.Stop();
+  double t = TMath::Max(timer.RealTime(), 1E-9);
+  LOG("gevscan", pNOTICE)
+     << "Scanned " << results.nev << " events in " << t << " s using "
+     << gOptNWorkers << " process(es): " << results.nev/t << " events/s, "
+     << results.nbytes/t/(1024.*1024.) << " MB/s";
+
+  // write the reports
+  for(int ichk = 0; ichk < kNChecks; ichk++) {
+    if(gOptCheck[ichk]) ReportEventCheck(ScanCheck_t(ichk), results);
   }
   if (gOptCheckVertexDistribution) {
-          CheckVertexDistribution();
+    ReportVertexDistribution(results);
   }
   if (gOptCheckDecayerConsistency) {
-          CheckDecayerConsistency();
+    ReportDecayerConsistency(results);
   }
 
-
   if(gOptOutFilename != "none") {
      gErrLog.close();
   }
@@ -196,422 +260,525 @@ int main(int argc, char ** argv)
   return 0;
 }
 //____________________________________________________________________________
-void CheckEnergyMomentumConservation (void)
+void ScanEvents(Long64_t first, Long64_t last, ScanResults_t & res)
 {
-  LOG("gevscan", pNOTICE) << "Checking energy/momentum conservation...";
+// Reads each event in [first, last) once and runs all enabled checks.
+// The input file is opened here so that forked workers do not share the
+// file descriptor of the parent process.
 
-  if(gErrLog.is_open()) {
-    gErrLog << "# Events failing the energy-momentum conservation test:" << endl;
-    gErrLog << "# " << endl;
-  }
-
-  int nerr = 0;
-
-  for(Long64_t i = gFirstEventNum; i <= gLastEventNum; i++) 
+  TFile file(gOptInpFilename.c_str(),"READ");
+  TTree * tree = dynamic_cast <TTree *> (file.Get("gtree"));
+  NtpMCEventRecord * mcrec = 0;
+  tree->SetBranchAddress("gmcrec", &mcrec);
+  tree->SetCacheSize(30000000);
+  tree->SetCacheEntryRange(first, last);
+  tree->AddBranchToCache("gmcrec", true);
+
+  set<int> fs_seen;
+  set<int> dec_seen;
+
+  const char * failure[kNChecks] = {
+    "Energy-momentum non-conservation in event",
+    "Charge non-conservation in event",
+    "Pseudo-particle final state particle in event",
+    "Off-mass-shell final state particle in event",
+    "Number of final state nucleons inconsistent with target in event"
+  };
+
+  for(Long64_t i = first; i < last; i++)
   {
-    if(gOptMaxNumErrs != -1 && nerr >= gOptMaxNumErrs) break;
+    tree->GetEntry(i);
+    res.nev++;
 
-    gEventTree->GetEntry(i);
-
-    NtpMCRecHeader rec_header = gMCRec->hdr;
-    EventRecord &  event      = *(gMCRec->event);
+    const EventRecord & event = *(mcrec->event);
 
     LOG("gevscan", pINFO) << "Checking event.... " << i;
 
-    double E_init  = 0, E_fin  = 0; // E
-    double px_init = 0, px_fin = 0; // px
-    double py_init = 0, py_fin = 0; // py
-    double pz_init = 0, pz_fin = 0; // pz
-
-    GHepParticle * p = 0;
-    TIter event_iter(&event);
-    while ( (p = dynamic_cast<GHepParticle *>(event_iter.Next())) ) {
+    // per-event checks
+    for(int ichk = 0; ichk < kNChecks; ichk++) {
+      if(!gOptCheck[ichk]) continue;
+      if(gOptMaxNumErrs != -1 &&
+         (int)res.failed[ichk].size() >= gOptMaxNumErrs) continue;
+
+      bool ok = true;
+      switch(ichk) {
+        case kChkEnergyMomentumConservation:
+          ok = CheckEnergyMomentumConservation(event); break;
+        case kChkChargeConservation:
+          ok = CheckChargeConservation(event); break;
+        case kChkPseudoParticlesInFinState:
+          ok = CheckForPseudoParticlesInFinState(event); break;
+        case kChkOffMassShellParticlesInFinState:
+          ok = CheckForOffMassShellParticlesInFinState(event); break;
+        case kChkNumFinStateNucleonsInconsistentWithTarget:
+          ok = CheckForNumFinStateNucleonsInconsistentWithTarget(event); break;
+        default:
+          break;
+      }
+      if(!ok) {
+        LOG("gevscan", pERROR)
+          << " ** " << failure[ichk] << ": " << i << "\n" << event;
+        res.failed[ichk].push_back(i);
+      }
+    }
 
-      GHepStatus_t ist  = p->Status();
+    // intranuclear vertex distribution, per nuclear target
+    if(gOptCheckVertexDistribution) {
+      GHepParticle * nucltgt = event.TargetNucleus();
+      if(nucltgt) {
+        int key = 1000*nucltgt->Z() + nucltgt->A();
+        vector<Long64_t> & r_distr = res.r_distr[key];
+        if(r_distr.size() == 0) {
+          r_distr.assign(kNRBins+2, 0);
+          res.r_first[key] = i;
+        }
+        double r = event.Particle(0)->X4()->Vect().Mag();
+        int ir = 0;
+        if      (r >= kRMax) ir = kNRBins+1;
+        else if (r >= 0    ) ir = 1 + int(kNRBins*r/kRMax);
+        r_distr[ir]++;
+      }
+    }
 
-      if(ist == kIStInitialState) 
-      {
-         E_init  += p->E();
-         px_init += p->Px();
-         py_init += p->Py();
-         pz_init += p->Pz();
-       }
-       if(ist == kIStStableFinalState || 
-          ist == kIStFinalStateNuclearRemnant) 
-       {
-         E_fin   += p->E();
-         px_fin  += p->Px();
-         py_fin  += p->Py();
-         pz_fin  += p->Pz();
-       }
-    }//p
-
-    double epsilon = 1E-3; 
-
-    bool E_conserved  = TMath::Abs(E_init  - E_fin)  < epsilon;
-    bool px_conserved = TMath::Abs(px_init - px_fin) < epsilon;
-    bool py_conserved = TMath::Abs(py_init - py_fin) < epsilon;
-    bool pz_conserved = TMath::Abs(pz_init - pz_fin) < epsilon;
-
-    bool ok = E_conserved  && 
-              px_conserved &&
-              py_conserved &&
-              pz_conserved;
-
-    if(!ok) {
-       LOG("gevscan", pERROR) 
-         << " ** Energy-momentum non-conservation in event: " << i 
-         << "\n"
-         << event;
-       if(gErrLog.is_open()) {
-           gErrLog << i;
-           if(gOptAddEventPrintoutInErrLog) {
-               gErrLog << event;
-           }
-       }
-       nerr++;
+    // particles seen in the final state / decayed
+    if(gOptCheckDecayerConsistency) {
+      int np = event.GetEntries();
+      for(int ip = 0; ip < np; ip++) {
+        GHepParticle * p = event.Particle(ip);
+        GHepStatus_t ist = p->Status();
+        if(ist == kIStStableFinalState) {
+          AddFirstSeen(res.fs_pdg,  res.fs_first,  fs_seen,  p->Pdg(), i);
+        }
+        if(ist == kIStDecayedState) {
+          AddFirstSeen(res.dec_pdg, res.dec_first, dec_seen, p->Pdg(), i);
+        }
+      }
     }
-    
-    gMCRec->Clear(); // clear out explicitly to prevent memory leak w/Root6
 
-  }//i
+    mcrec->Clear(); // clear out explicitly to prevent memory leak w/Root6
 
-  if(gErrLog.is_open()) {
-     if(nerr == 0) {
-         gErrLog << "none" << endl;    
-     }
-  }
+  }//i
 
-  LOG("gevscan", pNOTICE) 
-     << "Found " << nerr 
-     << " events failing the energy/momentum conservation test";
+  res.nbytes = file.GetBytesRead();
+  file.Close();
 }
 //____________________________________________________________________________
-void CheckChargeConservation(void)
+void AddFirstSeen(vector<int> & pdg, vector<Long64_t> & first,
+                  set<int> & seen, int pdgc, Long64_t iev)
 {
-  LOG("gevscan", pNOTICE) << "Checking charge conservation...";
-
-  if(gErrLog.is_open()) {
-     gErrLog << "# Events failing the charge conservation test:" << endl;
-     gErrLog << "# " << endl;
-  }
-
-  int nerr = 0;
-
-  for(Long64_t i = gFirstEventNum; i <= gLastEventNum; i++) 
-  {
-    if(gOptMaxNumErrs != -1 && nerr >= gOptMaxNumErrs) break;
+  if(seen.count(pdgc) > 0) return;
+  seen.insert(pdgc);
+  pdg.push_back(pdgc);
+  first.push_back(iev);
+}
+//____________________________________________________________________________
+void ScanInParallel(ScanResults_t & res)
+{
+// Splits the event range in contiguous chunks scanned by forked worker
+// processes (GENIE singletons are not thread-safe). Each worker sends its
+// results back through a pipe; results are merged in event order.
 
-    gEventTree->GetEntry(i);
+  Long64_t nev = gLastEventNum - gFirstEventNum + 1;
+  int nworkers = (int) TMath::Min((Long64_t) gOptNWorkers, nev);
 
-    NtpMCRecHeader rec_header = gMCRec->hdr;
-    EventRecord &  event      = *(gMCRec->event);
+  std::cout.flush();
+  std::cerr.flush();
+  fflush(NULL);
 
-    LOG("gevscan", pINFO) << "Checking event.... " << i;
+  vector<pid_t> pids(nworkers, -1);
+  vector<int>   fds (nworkers, -1);
 
-    // Can't run the test for neutrinos scattered off nuclear targets
-    // because of intranuclear rescattering effects and the presence, in the event
-    // record, of a charged nuclear remnant pseudo-particle whose charge is not stored.
-    // To check charge conservation in the primary interaction, use a sample generated
-    // for a free nucleon targets.
-    GHepParticle * nucltgt = event.TargetNucleus();
-    if (nucltgt) {
-      LOG("gevscan", pINFO)
-           << "Event in nuclear target - Skipping test...";
+  for(int w = 0; w < nworkers; w++) {
+    int fd[2];
+    if(pipe(fd) != 0) {
+      LOG("gevscan", pFATAL) << "Cannot create pipe for worker process " << w;
+      gAbortingInErr = true;
+      exit(1);
     }
-    else {
-      double Q_init  = 0;
-      double Q_fin   = 0; 
-
-      GHepParticle * p = 0;
-      TIter event_iter(&event);
-      while ( (p = dynamic_cast<GHepParticle *>(event_iter.Next())) ) {
-
-        GHepStatus_t ist  = p->Status();
-
-        if(ist == kIStInitialState) 
-        {
-           Q_init  += p->Charge();
-         }
-         if(ist == kIStStableFinalState)
-         {
-           Q_fin  += p->Charge();
-         }
-      }//p
-
-      double epsilon = 1E-3; 
-      bool ok = TMath::Abs(Q_init - Q_fin)  < epsilon;
-      if(!ok) {
-         LOG("gevscan", pERROR) 
-           << " ** Charge non-conservation in event: " << i 
-           << "\n"
-           << event;
-         if(gErrLog.is_open()) {
-            gErrLog << i << endl;    
-            if(gOptAddEventPrintoutInErrLog) {
-                 gErrLog << event;
-            }
-         }
-         nerr++;
+    pid_t pid = fork();
+    if(pid == 0) {
+      close(fd[0]);
+      Long64_t first = gFirstEventNum + (nev *  w   ) / nworkers;
+      Long64_t last  = gFirstEventNum + (nev * (w+1)) / nworkers;
+      ScanResults_t wres;
+      ClearResults(wres);
+      ScanEvents(first, last, wres);
+      ostringstream out;
+      WriteResults(out, wres);
+      string buf = out.str();
+      const char * ptr = buf.c_str();
+      size_t left = buf.size();
+      while(left > 0) {
+        ssize_t n = write(fd[1], ptr, left);
+        if(n <= 0) _exit(1);
+        ptr  += n;
+        left -= n;
       }
-      
+      close(fd[1]);
+      std::cout.flush();
+      std::cerr.flush();
+      fflush(NULL);
+      _exit(0);
     }
-    gMCRec->Clear(); // clear out explicitly to prevent memory leak w/Root6
-  }//i
-
-  if(gErrLog.is_open()) {
-     if(nerr == 0) {
-        gErrLog << "none" << endl;    
-     }
+    close(fd[1]);
+    if(pid < 0) {
+      close(fd[0]);
+      LOG("gevscan", pFATAL) << "Cannot fork worker process " << w;
+      gAbortingInErr = true;
+      exit(1);
+    }
+    pids[w] = pid;
+    fds [w] = fd[0];
   }
 
-  LOG("gevscan", pNOTICE) 
-     << "Found " << nerr 
-     << " events failing the charge conservation test";
+  bool ok = true;
+  for(int w = 0; w < nworkers; w++) {
+    string buf;
+    char chunk[65536];
+    ssize_t n = 0;
+    while( (n = read(fds[w], chunk, sizeof(chunk))) > 0 ) {
+      buf.append(chunk, n);
+    }
+    close(fds[w]);
+    int status = 0;
+    waitpid(pids[w], &status, 0);
+
+    ScanResults_t wres;
+    ClearResults(wres);
+    istringstream in(buf);
+    if(!WIFEXITED(status) || WEXITSTATUS(status) != 0 || !ReadResults(in, wres)) {
+      LOG("gevscan", pERROR) << "Worker process " << w << " failed";
+      ok = false;
+      continue;
+    }
+    MergeResults(wres, res);
+  }
+  if(!ok) {
+    LOG("gevscan", pFATAL) << "Event scan failed";
+    gAbortingInErr = true;
+    exit(1);
+  }
 }
 //____________________________________________________________________________
-void CheckForPseudoParticlesInFinState(void)
+void MergeResults(const ScanResults_t & res, ScanResults_t & total)
 {
-  LOG("gevscan", pNOTICE) 
-      << "Checking for pseudo-particles appearing in final state...";
-
-  if(gErrLog.is_open()) {
-     gErrLog << "# Events with pseudo-particles in final state:" << endl;
-     gErrLog << "# " << endl;
-  }
+// Adds the results of a later event range to the total
 
-  int nerr = 0;
-
-  for(Long64_t i = gFirstEventNum; i <= gLastEventNum; i++) 
-  {
-    if(gOptMaxNumErrs != -1 && nerr >= gOptMaxNumErrs) break;
-
-    gEventTree->GetEntry(i);
-
-    NtpMCRecHeader rec_header = gMCRec->hdr;
-    EventRecord &  event      = *(gMCRec->event);
-
-    LOG("gevscan", pINFO) << "Checking event.... " << i;
+  total.nev    += res.nev;
+  total.nbytes += res.nbytes;
 
-    GHepParticle * p = 0;
-    TIter event_iter(&event);
-    bool ok = true;
-    while ( (p = dynamic_cast<GHepParticle *>(event_iter.Next())) ) {
-
-      GHepStatus_t ist = p->Status();
-      if(ist != kIStStableFinalState) continue;
-      int pdgc = p->Pdg();      
-      if(pdg::IsPseudoParticle(pdgc))
-      {
-        ok = false;
-        break;
-      }      
-    }//p
-
-    if(!ok) {
-       LOG("gevscan", pERROR) 
-         << " ** Pseudo-particle final state particle in event: " << i 
-         << "\n"
-         << event;
-       if(gErrLog.is_open()) {
-          gErrLog << i << endl;    
-          if(gOptAddEventPrintoutInErrLog) {
-               gErrLog << event;
-          }
-       }
-       nerr++;
+  for(int ichk = 0; ichk < kNChecks; ichk++) {
+    vector<Long64_t>::const_iterator it = res.failed[ichk].begin();
+    for( ; it != res.failed[ichk].end(); ++it) {
+      if(gOptMaxNumErrs != -1 &&
+         (int)total.failed[ichk].size() >= gOptMaxNumErrs) break;
+      total.failed[ichk].push_back(*it);
     }
+  }
 
-    gMCRec->Clear(); // clear out explicitly to prevent memory leak w/Root6
-
-  }//i
-
-  if(gErrLog.is_open()) {
-     if(nerr == 0) {
-        gErrLog << "none" << endl;    
-     }
+  map<int, vector<Long64_t> >::const_iterator rit = res.r_distr.begin();
+  for( ; rit != res.r_distr.end(); ++rit) {
+    int key = rit->first;
+    vector<Long64_t> & r_distr = total.r_distr[key];
+    if(r_distr.size() == 0) {
+      r_distr.assign(kNRBins+2, 0);
+      total.r_first[key] = res.r_first.find(key)->second;
+    }
+    for(int ir = 0; ir < kNRBins+2; ir++) r_distr[ir] += rit->second[ir];
   }
 
-  LOG("gevscan", pNOTICE) 
-     << "Found " << nerr 
-     << " events with pseudo-particles in  final state";
+  set<int> fs_seen (total.fs_pdg.begin(),  total.fs_pdg.end());
+  set<int> dec_seen(total.dec_pdg.begin(), total.dec_pdg.end());
+  for(unsigned int i = 0; i < res.fs_pdg.size(); i++) {
+    AddFirstSeen(total.fs_pdg, total.fs_first, fs_seen,
+                 res.fs_pdg[i], res.fs_first[i]);
+  }
+  for(unsigned int i = 0; i < res.dec_pdg.size(); i++) {
+    AddFirstSeen(total.dec_pdg, total.dec_first, dec_seen,
+                 res.dec_pdg[i], res.dec_first[i]);
+  }
 }
 //____________________________________________________________________________
-void CheckForOffMassShellParticlesInFinState(void)
+void WriteResults(ostream & stream, const ScanResults_t & res)
 {
-  LOG("gevscan", pNOTICE) 
-      << "Checking for off-mass-shell particles appearing in the final state...";
-
-  if(gErrLog.is_open()) {
-     gErrLog << "# Events with off-mass-shell particles in final state:" << endl;
-     gErrLog << "# " << endl;
+  stream << res.nev << " " << res.nbytes << "\n";
+  for(int ichk = 0; ichk < kNChecks; ichk++) {
+    stream << res.failed[ichk].size();
+    for(unsigned int i = 0; i < res.failed[ichk].size(); i++) {
+      stream << " " << res.failed[ichk][i];
+    }
+    stream << "\n";
   }
+  stream << res.r_distr.size() << "\n";
+  map<int, vector<Long64_t> >::const_iterator rit = res.r_distr.begin();
+  for( ; rit != res.r_distr.end(); ++rit) {
+    stream << rit->first << " " << res.r_first.find(rit->first)->second;
+    for(int ir = 0; ir < kNRBins+2; ir++) stream << " " << rit->second[ir];
+    stream << "\n";
+  }
+  stream << res.fs_pdg.size();
+  for(unsigned int i = 0; i < res.fs_pdg.size(); i++) {
+    stream << " " << res.fs_pdg[i] << " " << res.fs_first[i];
+  }
+  stream << "\n" << res.dec_pdg.size();
+  for(unsigned int i = 0; i < res.dec_pdg.size(); i++) {
+    stream << " " << res.dec_pdg[i] << " " << res.dec_first[i];
+  }
+  stream << "\n";
+}
+//____________________________________________________________________________
+bool ReadResults(istream & stream, ScanResults_t & res)
+{
+  unsigned int n = 0;
+  Long64_t iev = 0;
+  int pdgc = 0;
+
+  stream >> res.nev >> res.nbytes;
+  for(int ichk = 0; ichk < kNChecks; ichk++) {
+    stream >> n;
+    for(unsigned int i = 0; i < n && stream; i++) {
+      stream >> iev;
+      res.failed[ichk].push_back(iev);
+    }
+  }
+  stream >> n;
+  for(unsigned int i = 0; i < n && stream; i++) {
+    int key = 0;
+    stream >> key >> iev;
+    res.r_first[key] = iev;
+    vector<Long64_t> & r_distr = res.r_distr[key];
+    r_distr.assign(kNRBins+2, 0);
+    for(int ir = 0; ir < kNRBins+2; ir++) stream >> r_distr[ir];
+  }
+  stream >> n;
+  for(unsigned int i = 0; i < n && stream; i++) {
+    stream >> pdgc >> iev;
+    res.fs_pdg.push_back(pdgc);
+    res.fs_first.push_back(iev);
+  }
+  stream >> n;
+  for(unsigned int i = 0; i < n && stream; i++) {
+    stream >> pdgc >> iev;
+    res.dec_pdg.push_back(pdgc);
+    res.dec_first.push_back(iev);
+  }
+  return !stream.fail();
+}
+//____________________________________________________________________________
+void ClearResults(ScanResults_t & res)
+{
+  res.nev    = 0;
+  res.nbytes = 0;
+  for(int ichk = 0; ichk < kNChecks; ichk++) res.failed[ichk].clear();
+  res.r_distr.clear();
+  res.r_first.clear();
+  res.fs_pdg.clear();
+  res.fs_first.clear();
+  res.dec_pdg.clear();
+  res.dec_first.clear();
+}
+//____________________________________________________________________________
+bool CheckEnergyMomentumConservation(const EventRecord & event)
+{
+  double E_init  = 0, E_fin  = 0; // E
+  double px_init = 0, px_fin = 0; // px
+  double py_init = 0, py_fin = 0; // py
+  double pz_init = 0, pz_fin = 0; // pz
+
+  int np = event.GetEntries();
+  for(int ip = 0; ip < np; ip++) {
+    GHepParticle * p = event.Particle(ip);
+
+    GHepStatus_t ist  = p->Status();
+
+    if(ist == kIStInitialState)
+    {
+       E_init  += p->E();
+       px_init += p->Px();
+       py_init += p->Py();
+       pz_init += p->Pz();
+    }
+    if(ist == kIStStableFinalState ||
+       ist == kIStFinalStateNuclearRemnant)
+    {
+       E_fin   += p->E();
+       px_fin  += p->Px();
+       py_fin  += p->Py();
+       pz_fin  += p->Pz();
+    }
+  }//p
 
-  int nerr = 0;
-
-  for(Long64_t i = gFirstEventNum; i <= gLastEventNum; i++) 
-  {
-    if(gOptMaxNumErrs != -1 && nerr >= gOptMaxNumErrs) break;
+  double epsilon = 1E-3;
 
-    gEventTree->GetEntry(i);
+  bool E_conserved  = TMath::Abs(E_init  - E_fin)  < epsilon;
+  bool px_conserved = TMath::Abs(px_init - px_fin) < epsilon;
+  bool py_conserved = TMath::Abs(py_init - py_fin) < epsilon;
+  bool pz_conserved = TMath::Abs(pz_init - pz_fin) < epsilon;
 
-    NtpMCRecHeader rec_header = gMCRec->hdr;
-    EventRecord &  event      = *(gMCRec->event);
+  return (E_conserved  &&
+          px_conserved &&
+          py_conserved &&
+          pz_conserved);
+}
+//____________________________________________________________________________
+bool CheckChargeConservation(const EventRecord & event)
+{
+  // Can't run the test for neutrinos scattered off nuclear targets
+  // because of intranuclear rescattering effects and the presence, in the event
+  // record, of a charged nuclear remnant pseudo-particle whose charge is not stored.
+  // To check charge conservation in the primary interaction, use a sample generated
+  // for a free nucleon targets.
+  GHepParticle * nucltgt = event.TargetNucleus();
+  if (nucltgt) {
+    LOG("gevscan", pINFO)
+         << "Event in nuclear target - Skipping test...";
+    return true;
+  }
 
-    LOG("gevscan", pINFO) << "Checking event.... " << i;
+  double Q_init  = 0;
+  double Q_fin   = 0;
 
-    GHepParticle * p = 0;
-    TIter event_iter(&event);
-    bool ok = true;
-    while ( (p = dynamic_cast<GHepParticle *>(event_iter.Next())) ) {
-
-      GHepStatus_t ist = p->Status();
-      if(ist != kIStStableFinalState) continue;
-      if(p->IsOffMassShell())
-      {
-        ok = false;
-        break;
-      }      
-    }//p
-
-    if(!ok) {
-       LOG("gevscan", pERROR) 
-         << " ** Off-mass-shell final state particle in event: " << i 
-         << "\n"
-         << event;
-       if(gErrLog.is_open()) {
-          gErrLog << i << endl;    
-          if(gOptAddEventPrintoutInErrLog) {
-               gErrLog << event;
-          }
-       }
-       nerr++;
-    }
+  int np = event.GetEntries();
+  for(int ip = 0; ip < np; ip++) {
+    GHepParticle * p = event.Particle(ip);
 
-    gMCRec->Clear(); // clear out explicitly to prevent memory leak w/Root6
+    GHepStatus_t ist  = p->Status();
 
-  }//i
+    if(ist == kIStInitialState)
+    {
+       Q_init  += p->Charge();
+    }
+    if(ist == kIStStableFinalState)
+    {
+       Q_fin  += p->Charge();
+    }
+  }//p
 
-  if(gErrLog.is_open()) {
-     if(nerr == 0) {
-        gErrLog << "none" << endl;    
-     }
-  }
+  double epsilon = 1E-3;
+  return (TMath::Abs(Q_init - Q_fin) < epsilon);
+}
+//____________________________________________________________________________
+bool CheckForPseudoParticlesInFinState(const EventRecord & event)
+{
+  int np = event.GetEntries();
+  for(int ip = 0; ip < np; ip++) {
+    GHepParticle * p = event.Particle(ip);
+    GHepStatus_t ist = p->Status();
+    if(ist != kIStStableFinalState) continue;
+    if(pdg::IsPseudoParticle(p->Pdg())) return false;
+  }//p
 
-  LOG("gevscan", pNOTICE) 
-     << "Found " << nerr 
-     << " events with off-mass-shell particles in final state";
+  return true;
 }
 //____________________________________________________________________________
-void CheckForNumFinStateNucleonsInconsistentWithTarget(void)
+bool CheckForOffMassShellParticlesInFinState(const EventRecord & event)
 {
-  LOG("gevscan", pNOTICE) 
-     << "Checking for number of final state nucleons inconsistent with target...";
+  int np = event.GetEntries();
+  for(int ip = 0; ip < np; ip++) {
+    GHepParticle * p = event.Particle(ip);
+    GHepStatus_t ist = p->Status();
+    if(ist != kIStStableFinalState) continue;
+    if(p->IsOffMassShell()) return false;
+  }//p
 
-  if(gErrLog.is_open()) {
-    gErrLog << "# Events with number of final state nucleons inconsistent with target:" << endl;
-    gErrLog << "# " << endl;
+  return true;
+}
+//____________________________________________________________________________
+bool CheckForNumFinStateNucleonsInconsistentWithTarget(const EventRecord & event)
+{
+  // get target nucleus
+  GHepParticle * nucltgt = event.TargetNucleus();
+  if (!nucltgt) {
+    LOG("gevscan", pINFO)
+         << "Event not in nuclear target - Skipping test...";
+    return true;
   }
 
-  int nerr = 0;
-
-  for(Long64_t i = gFirstEventNum; i <= gLastEventNum; i++) 
-  {
-    if(gOptMaxNumErrs != -1 && nerr >= gOptMaxNumErrs) break;
-
-    gEventTree->GetEntry(i);
-
-    NtpMCRecHeader rec_header = gMCRec->hdr;
-    EventRecord &  event      = *(gMCRec->event);
-
-    LOG("gevscan", pINFO) << "Checking event.... " << i;
-
-    // get target nucleus
-    GHepParticle * nucltgt = event.TargetNucleus();
-    if (!nucltgt) {
-      LOG("gevscan", pINFO)
-           << "Event not in nuclear target - Skipping test...";
+  GHepParticle * p = 0;
+
+  int Z = 0;
+  int N = 0;
+
+  // get number of spectator nucleons
+  int fd = nucltgt->FirstDaughter();
+  int ld = nucltgt->LastDaughter();
+  for(int d = fd; d <= ld; d++) {
+    p = event.Particle(d);
+    if(!p) continue;
+    int pdgc = p->Pdg();
+    if(pdg::IsIon(pdgc)) {
+      Z = p->Z();
+      N = p->A() - p->Z();
     }
-    else {
-      GHepParticle * p = 0;
-
-      int Z = 0;
-      int N = 0;
-
-      // get number of spectator nucleons 
-      int fd = nucltgt->FirstDaughter();
-      int ld = nucltgt->LastDaughter();
-      for(int d = fd; d <= ld; d++) {
-        p = event.Particle(d);
-        if(!p) continue;
-        int pdgc = p->Pdg();
-        if(pdg::IsIon(pdgc)) {
-          Z = p->Z();
-          N = p->A() - p->Z();
-        }
-      }
-      // add nucleons from the primary interaction
-      TIter event_iter(&event);
-      while ( (p = dynamic_cast<GHepParticle *>(event_iter.Next())) ) {
-        GHepStatus_t ist = p->Status();
-        if(ist != kIStHadronInTheNucleus) continue;
-        int pdgc = p->Pdg();
-        if(pdg::IsProton (pdgc)) { Z++; }
-        if(pdg::IsNeutron(pdgc)) { N++; }
-      }//p
-
-      LOG("gevscan", pINFO)
-         << "Before intranuclear hadron transport: Z = " << Z << ", N = " << N;
-
-      // count final state nucleons
-      int Zf = 0;
-      int Nf = 0;
-      event_iter.Reset();
-      while ( (p = dynamic_cast<GHepParticle *>(event_iter.Next())) ) {
-        GHepStatus_t ist = p->Status();
-        if(ist != kIStStableFinalState) continue;
-        int pdgc = p->Pdg();
-        if(pdg::IsProton (pdgc)) { Zf++; }
-        if(pdg::IsNeutron(pdgc)) { Nf++; }
-      }
-      LOG("gevscan", pINFO)
-         << "In the final state: Z = " << Zf << ", N = " << Nf;
-
-      bool ok = (Zf <= Z && Nf <= N);
-      if(!ok) {
-         LOG("gevscan", pERROR) 
-           << " ** Number of final state nucleons inconsistent with target in event: " << i 
-           << "\n"
-           << event;
-         if(gErrLog.is_open()) {
-             gErrLog << i << endl;    
-             if(gOptAddEventPrintoutInErrLog) {
-                 gErrLog << event;
-             }
-         }
-         nerr++;
-      }
-    } //nucltgt
+  }
 
-    gMCRec->Clear(); // clear out explicitly to prevent memory leak w/Root6
+  // add nucleons from the primary interaction and
+  // count final state nucleons
+  int Zf = 0;
+  int Nf = 0;
+  int np = event.GetEntries();
+  for(int ip = 0; ip < np; ip++) {
+    p = event.Particle(ip);
+    GHepStatus_t ist = p->Status();
+    int pdgc = p->Pdg();
+    if(ist == kIStHadronInTheNucleus) {
+      if(pdg::IsProton (pdgc)) { Z++; }
+      if(pdg::IsNeutron(pdgc)) { N++; }
+    }
+    if(ist == kIStStableFinalState) {
+      if(pdg::IsProton (pdgc)) { Zf++; }
+      if(pdg::IsNeutron(pdgc)) { Nf++; }
+    }
+  }//p
 
-  }//i
+  LOG("gevscan", pINFO)
+     << "Before intranuclear hadron transport: Z = " << Z << ", N = " << N;
+  LOG("gevscan", pINFO)
+     << "In the final state: Z = " << Zf << ", N = " << Nf;
 
+  return (Zf <= Z && Nf <= N);
+}
+//____________________________________________________________________________
+void ReportEventCheck(ScanCheck_t check, const ScanResults_t & res)
+{
+  const char * title[kNChecks] = {
+    "Events failing the energy-momentum conservation test:",
+    "Events failing the charge conservation test:",
+    "Events with pseudo-particles in final state:",
+    "Events with off-mass-shell particles in final state:",
+    "Events with number of final state nucleons inconsistent with target:"
+  };
+  const char * summary[kNChecks] = {
+    "events failing the energy/momentum conservation test",
+    "events failing the charge conservation test",
+    "events with pseudo-particles in  final state",
+    "events with off-mass-shell particles in final state",
+    "events with a number of final state nucleons inconsistent with target"
+  };
+
+  const vector<Long64_t> & failed = res.failed[check];
 
   if(gErrLog.is_open()) {
-     if(nerr == 0) {
-         gErrLog << "none" << endl;    
-     }
+    gErrLog << "# " << title[check] << endl;
+    gErrLog << "# " << endl;
+    for(unsigned int i = 0; i < failed.size(); i++) {
+      gErrLog << failed[i] << endl;
+      if(gOptAddEventPrintoutInErrLog) {
+        PrintEventInErrLog(failed[i]);
+      }
+    }
+    if(failed.size() == 0) {
+      gErrLog << "none" << endl;
+    }
   }
 
-  LOG("gevscan", pNOTICE) 
-     << "Found " << nerr 
-     << " events with a number of final state nucleons inconsistent with target";
+  LOG("gevscan", pNOTICE)
+     << "Found " << failed.size() << " " << summary[check];
 }
 //____________________________________________________________________________
-void CheckVertexDistribution(void)
+void ReportVertexDistribution(const ScanResults_t & res)
 {
-  LOG("gevscan", pNOTICE) 
+  LOG("gevscan", pNOTICE)
      << "Checking intra-nuclear vertex distribution...";
 
   if(gErrLog.is_open()) {
@@ -619,52 +786,36 @@ void CheckVertexDistribution(void)
     gErrLog << "# " << endl;
   }
 
-  TH1D * r_distr_mc       = new TH1D("r_distr_mc","",      150,0,30); //fm
-  TH1D * r_distr_expected = new TH1D("r_distr_expected","",150,0,30); //fm
-
-  int Z = -1;
-  int A = -1;
-
-  // get vertex position distribution
-  for(Long64_t i = gFirstEventNum; i <= gLastEventNum; i++) 
-  {
-    gEventTree->GetEntry(i);
-
-    NtpMCRecHeader rec_header = gMCRec->hdr;
-    EventRecord &  event      = *(gMCRec->event);
-
-    LOG("gevscan", pINFO) << "Checking event.... " << i;
-
-    // get target nucleus
-    GHepParticle * nucltgt = event.TargetNucleus();
-    if (!nucltgt) {
-      LOG("gevscan", pINFO)
-           << "Event not in nuclear target - Skipping...";
+  // this test is run on a MC sample for a given target:
+  // use the nuclear target seen first
+  int key = -1;
+  Long64_t first = -1;
+  map<int, Long64_t>::const_iterator it = res.r_first.begin();
+  for( ; it != res.r_first.end(); ++it) {
+    if(first == -1 || it->second < first) {
+      key   = it->first;
+      first = it->second;
     }
-    else {
-      if(Z == -1 && A == -1) {
-         Z = nucltgt->Z();
-         A = nucltgt->A();
-      }
-
-      // this test is run on a MC sample for a given target
-      if(Z != nucltgt->Z() || A != nucltgt->A()) {
-        LOG("gevscan", pINFO)
-             << "Event not in nuclear target seen first - Skipping...";
-      }
-      else {
-        GHepParticle * probe = event.Particle(0);
-        double r = probe->X4()->Vect().Mag();
-
-        r_distr_mc->Fill(r);
-      }
-    } //nucltgt
+  }
+  int Z = (key == -1) ? -1 : key/1000;
+  int A = (key == -1) ? -1 : key%1000;
 
-    gMCRec->Clear(); // clear out explicitly to prevent memory leak w/Root6
+  if(A > 1) {
+    TH1D * r_distr_mc       = new TH1D("r_distr_mc","",      kNRBins,0,kRMax); //fm
+    TH1D * r_distr_expected = new TH1D("r_distr_expected","",kNRBins,0,kRMax); //fm
+
+    const vector<Long64_t> & r_distr = res.r_distr.find(key)->second;
+    Long64_t nentries = 0;
+    for(int ir = 0; ir < kNRBins+2; ir++) {
+      r_distr_mc->SetBinContent(ir, r_distr[ir]);
+      nentries += r_distr[ir];
+    }
+    r_distr_mc->SetEntries(nentries);
 
-  }//i
+    LOG("gevscan", pINFO)
+      << "Vertex distribution for Z = " << Z << ", A = " << A
+      << " from " << nentries << " events";
 
-  if(A > 1) {
     // get expected vertex position distribution
     for(int ir = 1; ir <= r_distr_expected->GetNbinsX(); ir++) {
       double r = r_distr_expected->GetBinCenter(ir);
@@ -673,7 +824,7 @@ void CheckVertexDistribution(void)
       r_distr_expected->SetBinContent(ir,nexp);
     }
 
-    // normalize 
+    // normalize
     double N = r_distr_mc->GetEntries();
     r_distr_expected -> Scale (N / r_distr_expected -> Integral());
 
@@ -683,9 +834,9 @@ void CheckVertexDistribution(void)
 
     if(gErrLog.is_open()) {
        if(pvalue < 0.99) {
-         gErrLog << "Problem! p-value = " << pvalue << endl;    
+         gErrLog << "Problem! p-value = " << pvalue << endl;
        } else {
-         gErrLog << "OK! p-value = " << pvalue << endl;    
+         gErrLog << "OK! p-value = " << pvalue << endl;
        }
     }
 
@@ -700,23 +851,22 @@ void CheckVertexDistribution(void)
   else {
 
     if(gErrLog.is_open()) {
-      gErrLog << "Can not run test with current sample" << endl;   
+      gErrLog << "Can not run test with current sample" << endl;
     }
 
   }
-
 }
 //____________________________________________________________________________
-void CheckDecayerConsistency(void)
+void ReportDecayerConsistency(const ScanResults_t & res)
 {
-// Check that particles seen in the final state in some events do not appear to 
+// Check that particles seen in the final state in some events do not appear to
 // have decayed in other events.
 // This might happen if, for example, particle decay flags which are applied to
 // GENIE events do not get applied to intermediate particles appearing in the
 // PYTHIA hadronization. It might also happen if the decayed particle status is
 // used incorrectly in some modules (eg intranuke).
 //
-  LOG("gevscan", pNOTICE) 
+  LOG("gevscan", pNOTICE)
      << "Checking decayer consistency...";
 
   if(gErrLog.is_open()) {
@@ -727,36 +877,22 @@ void CheckDecayerConsistency(void)
   bool allowdup = false;
   PDGCodeList final_state_particles(allowdup);
   PDGCodeList decayed_particles(allowdup);
-
-  for(Long64_t i = gFirstEventNum; i <= gLastEventNum; i++) 
-  {
-    gEventTree->GetEntry(i);
-
-    NtpMCRecHeader rec_header = gMCRec->hdr;
-    EventRecord &  event      = *(gMCRec->event);
-
-    LOG("gevscan", pINFO) << "Checking event.... " << i;
-
-    GHepParticle * p = 0;
-    TIter event_iter(&event);
-    while ( (p = dynamic_cast<GHepParticle *>(event_iter.Next())) ) {
-      GHepStatus_t ist = p->Status();
-      int pdgc = p->Pdg();
-      if(ist == kIStStableFinalState) { final_state_particles.push_back(pdgc); }
-      if(ist == kIStDecayedState    ) { decayed_particles.push_back(pdgc);     }
-    }//p
-    gMCRec->Clear(); // clear out explicitly to prevent memory leak w/Root6
-  }//i
+  for(unsigned int i = 0; i < res.fs_pdg.size(); i++) {
+    final_state_particles.push_back(res.fs_pdg[i]);
+  }
+  for(unsigned int i = 0; i < res.dec_pdg.size(); i++) {
+    decayed_particles.push_back(res.dec_pdg[i]);
+  }
 
   // find particles which appear in both lists
   PDGCodeList particles_in_both_lists(allowdup);
 
   PDGCodeList::const_iterator iter;
-  for(iter = final_state_particles.begin(); 
-      iter != final_state_particles.end(); ++iter) 
+  for(iter = final_state_particles.begin();
+      iter != final_state_particles.end(); ++iter)
   {
      int pdgc = *iter;
-     if(decayed_particles.ExistsInPDGCodeList(pdgc)) 
+     if(decayed_particles.ExistsInPDGCodeList(pdgc))
      {
         particles_in_both_lists.push_back(pdgc);
      }
@@ -770,14 +906,14 @@ void CheckDecayerConsistency(void)
     ok = false;
     mesg << "Problem!\n" << particles_in_both_lists.size() << " particles seen both final state and to have decayed.";
   }
- 
-  LOG("gevscan", pNOTICE) 
+
+  LOG("gevscan", pNOTICE)
     << mesg.str();
-  LOG("gevscan", pNOTICE) 
+  LOG("gevscan", pNOTICE)
     << "Particles seen in final state: " << final_state_particles;
-  LOG("gevscan", pNOTICE) 
+  LOG("gevscan", pNOTICE)
     << "Particles seen to have decayed: " << decayed_particles;
-  LOG("gevscan", pNOTICE) 
+  LOG("gevscan", pNOTICE)
     << "Particles seen in both lists: " << particles_in_both_lists;
 
   if(gErrLog.is_open()) {
@@ -785,56 +921,41 @@ void CheckDecayerConsistency(void)
      gErrLog << "\nParticles seen in final state:" << final_state_particles << endl;
      gErrLog << "\nParticles seen to have decayed:" << decayed_particles << endl;
      gErrLog << "\nParticles seen in both lists:" << particles_in_both_lists << endl;
-   }
-
-   // find example events
-   if(!ok) {
-      if(gErrLog.is_open()) {
-         gErrLog << "\nExample events: " << endl;          
-      }
-      for(iter  = particles_in_both_lists.begin(); 
-          iter != particles_in_both_lists.end(); ++iter) 
-      {
-         int pdgc_bothlists = *iter;
-         int iev_decay = -1;
-         int iev_fs    = -1;
-         bool have_example = false;
-         for(Long64_t i = gFirstEventNum; i <= gLastEventNum; i++) 
-         {
-           have_example = (iev_decay != -1 && iev_fs != -1);
-           if(have_example) break;
-
-           gEventTree->GetEntry(i);
-           EventRecord &  event = *(gMCRec->event);
-           GHepParticle * p = 0;
-           TIter event_iter(&event);
-           while ( (p = dynamic_cast<GHepParticle *>(event_iter.Next())) ) {
-              int pdgc = p->Pdg();
-              if(pdgc != pdgc_bothlists) continue;
-              GHepStatus_t ist = p->Status();
-              if(ist == kIStStableFinalState && iev_fs    == -1) { iev_fs    = i; }
-              if(ist == kIStDecayedState     && iev_decay == -1) { iev_decay = i; }
-           }//p
-           gMCRec->Clear(); // clear out explicitly to prevent memory leak w/Root6
-         }//i
-         if(gErrLog.is_open()) {
-            gErrLog << ">> " << PDGLibrary::Instance()->Find(pdgc_bothlists)->GetName()
-                    << ": Decayed in event " << iev_decay 
-                    << ". Seen in final state in event " << iev_fs << "." << endl;
-            if(gOptAddEventPrintoutInErrLog) {
-               gEventTree->GetEntry(iev_decay);
-               EventRecord & event_dec = *(gMCRec->event);
-               gErrLog << "Event " << iev_decay << ":";
-               gErrLog << event_dec;
-               gEventTree->GetEntry(iev_fs);
-               EventRecord & event_fs = *(gMCRec->event);
-               gErrLog << "Event: " << iev_fs << ":";
-               gErrLog << event_fs;
-            }
-         }
-      }//pdgc
-   }//!ok
+  }
 
+  // example events (the first ones seen during the scan)
+  if(!ok && gErrLog.is_open()) {
+     gErrLog << "\nExample events: " << endl;
+     for(iter  = particles_in_both_lists.begin();
+         iter != particles_in_both_lists.end(); ++iter)
+     {
+        int pdgc_bothlists = *iter;
+        Long64_t iev_decay = -1;
+        Long64_t iev_fs    = -1;
+        for(unsigned int i = 0; i < res.fs_pdg.size(); i++) {
+          if(res.fs_pdg[i] == pdgc_bothlists) iev_fs = res.fs_first[i];
+        }
+        for(unsigned int i = 0; i < res.dec_pdg.size(); i++) {
+          if(res.dec_pdg[i] == pdgc_bothlists) iev_decay = res.dec_first[i];
+        }
+        gErrLog << ">> " << PDGLibrary::Instance()->Find(pdgc_bothlists)->GetName()
+                << ": Decayed in event " << iev_decay
+                << ". Seen in final state in event " << iev_fs << "." << endl;
+        if(gOptAddEventPrintoutInErrLog) {
+           gErrLog << "Event " << iev_decay << ":";
+           PrintEventInErrLog(iev_decay);
+           gErrLog << "Event: " << iev_fs << ":";
+           PrintEventInErrLog(iev_fs);
+        }
+     }//pdgc
+  }//!ok
+}
+//____________________________________________________________________________
+void PrintEventInErrLog(Long64_t iev)
+{
+  gEventTree->GetEntry(iev);
+  gErrLog << *(gMCRec->event);
+  gMCRec->Clear(); // clear out explicitly to prevent memory leak w/Root6
 }
 //____________________________________________________________________________
 void GetCommandLineArgs(int argc, char ** argv)
@@ -897,18 +1018,23 @@ void GetCommandLineArgs(int argc, char ** argv)
      gOptMaxNumErrs = TMath::Max(1,gOptMaxNumErrs);
   }
   
+  // number of worker processes
+  if( parser.OptionExists('j') ) {
+     gOptNWorkers = TMath::Max(1, parser.ArgAsInt('j'));
+  }
+
   bool all = parser.OptionExists("all");
 
   // checks
-  gOptCheckEnergyMomentumConservation = all ||
+  gOptCheck[kChkEnergyMomentumConservation] = all ||
      parser.OptionExists("check-energy-momentum-conservation");
-  gOptCheckChargeConservation = all || 
+  gOptCheck[kChkChargeConservation] = all || 
      parser.OptionExists("check-charge-conservation");
-  gOptCheckForNumFinStateNucleonsInconsistentWithTarget = all ||
+  gOptCheck[kChkNumFinStateNucleonsInconsistentWithTarget] = all ||
      parser.OptionExists("check-for-num-of-final-state-nucleons-inconsistent-with-target");
-  gOptCheckForPseudoParticlesInFinState = all ||
+  gOptCheck[kChkPseudoParticlesInFinState] = all ||
      parser.OptionExists("check-for-pseudoparticles-in-final-state");
-  gOptCheckForOffMassShellParticlesInFinState = all ||
+  gOptCheck[kChkOffMassShellParticlesInFinState] = all ||
      parser.OptionExists("check-for-off-mass-shell-particles-in-final-state");
   gOptCheckVertexDistribution = all ||
      parser.OptionExists("check-vertex-distribution");
@@ -920,7 +1046,7 @@ void PrintSyntax(void)
 {
   LOG("gevscan", pNOTICE)
     << "\n\n" << "Syntax:" << "\n"
-    << " gevscan -f sample.root [-n n1[,n2]] [-o errlog] [check names]\n";
+    << " gevscan -f sample.root [-n n1[,n2]] [-o errlog] [-j n_workers] [check names]\n";
 }
 //_________________________________________________________________________________
 bool CheckRootFilename(string filename)
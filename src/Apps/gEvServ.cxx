@@ -0,0 +1,794 @@
+//____________________________________________________________________________
+/*!
+
+\program gevserv
+
+\brief   GENIE event generation server.
+
+         Keeps a `warm' GENIE process (tune, cross-section splines and event
+         generation drivers loaded once) and generates events on demand for
+         clients connecting to a local socket. Each request specifies an
+         initial state, a neutrino energy or flux spectrum and a number of
+         events; the events are returned as serialized NtpMCEventRecord objects.
+         Requests can be batched: a single message may carry several of them.
+         See gevserv_client for a client which writes the received events in a
+         GHEP file.
+
+\syntax  gevserv [-h]
+                 [--socket path | --port port_number]
+                 [-j n_workers]
+                 [-p neutrino_codes]
+                 [-t target_codes]
+                 [--seed random_number_seed]
+                 [--cross-sections xml_file]
+                 [--event-generator-list list_name]
+                 [--tune genie_tune]
+                 [--message-thresholds xml_file]
+                 [--unphysical-event-mask mask]
+                 [--event-record-print-level level]
+                 [--cache-file root_file]
+
+         Options :
+           [] Denotes an optional argument.
+           -h
+              Prints-out help on using gevserv and exits.
+           --socket
+              Path of the UNIX domain socket to listen to, so that only
+              clients on the same host can connect [default: gevserv.sock].
+           --port
+              Listen to a TCP/IP port instead. Note that the server then
+              accepts connections from other hosts too.
+           -j
+              Number of worker processes [default: 1].
+              The workers are forked once the server is configured, so that
+              they all share its warm state, and serve clients concurrently
+              (one connection each at a time). Worker processes are used
+              rather than threads as the GENIE singletons are not thread-safe.
+           -p
+              Comma separated list of neutrino PDG codes, and
+           -t
+              comma separated list of target PDG codes (10LZZZAAAI) for which
+              event generation drivers are configured at start-up.
+              Drivers for other initial states are configured by the worker
+              process receiving the first request for them.
+           --seed
+              Random number seed. Worker i uses seed+i; workers restarted
+              after a crash get fresh seeds (seed+n_workers, ...), so that they
+              do not replay the random number sequence of the dead worker.
+           --cross-sections
+              Name (incl. full path) of an XML file with pre-computed
+              cross-section values used for constructing splines.
+           --tune
+              Specifies a GENIE comprehensive neutrino interaction model tune.
+              [default: "Default"].
+           ... and the other standard GENIE run options (see gevgen).
+
+         Protocol :
+           Clients send ROOT string messages (TSocket::Send(const char*)):
+
+           HELLO
+              The server replies `GEVSERV READY: <worker id>'.
+           GENERATE: request_1; request_2; ...
+              Generates events for each request in turn. A request is a
+              space separated list of key=value pairs:
+                probe=<pdg>        neutrino PDG code
+                target=<pdg>       target PDG code
+                energy=<E>         neutrino energy in GeV, or
+                energy=<Emin,Emax> energy range for the flux spectrum below
+                flux=<formula>     flux spectrum as a function of x = E in GeV
+                                   (no spaces, eg `flux=x*exp(-x)')
+                                   [default: flat]
+                n=<nev>            number of events to generate
+                seed=<seed>        reseed the worker before this request
+                                   (optional, for reproducible requests)
+              For each request the server replies `EVENTS: <i> <nev>'
+              followed by nev object messages, each holding a
+              genie::NtpMCEventRecord, or `FAILED: <i> <reason>' if the
+              request can not be served (unsupported initial state, invalid
+              flux, zero cross section, or event generation failing
+              repeatedly - in which case it follows the events generated).
+              Once all requests are processed it replies `DONE: <nreq>'.
+              For a flux spectrum the neutrino energies follow flux x
+              cross section (as for gevgen -f), neutrinos moving along +z.
+           BYE
+              Closes the connection.
+           SHUTDOWN
+              The server replies `SHUTTING DOWN' and all workers exit.
+
+\author  Costas Andreopoulos <constantinos.andreopoulos \at cern.ch>
+ University of Liverpool & STFC Rutherford Appleton Laboratory
+
+\created September 18, 2007
+
+\cpright Copyright (c) 2003-2023, The GENIE Collaboration
+         For the full text of the license visit http://copyright.genie-mc.org
+
+*/
+//____________________________________________________________________________
+
+#include <cstdio>
+#include <cstdlib>
+#include <csignal>
+#include <sstream>
+#include <string>
+#include <vector>
+
+#include <unistd.h>
+#include <sys/stat.h>
+#include <sys/wait.h>
+
+#include <TSystem.h>
+#include <TServerSocket.h>
+#include <TSocket.h>
+#include <TMessage.h>
+#include <TLorentzVector.h>
+#include <TF1.h>
+#include <TStopwatch.h>
+#include <TMath.h>
+
+#include "Framework/EventGen/EventRecord.h"
+#include "Framework/EventGen/GEVGDriver.h"
+#include "Framework/EventGen/GEVGPool.h"
+#include "Framework/EventGen/InteractionList.h"
+#include "Framework/Interaction/InitialState.h"
+#include "Framework/Messenger/Messenger.h"
+#include "Framework/Ntuple/NtpMCEventRecord.h"
+#include "Framework/Numerical/RandomGen.h"
+#include "Framework/ParticleData/PDGCodeList.h"
+#include "Framework/ParticleData/PDGLibrary.h"
+#include "Framework/Utils/AppInit.h"
+#include "Framework/Utils/RunOpt.h"
+#include "Framework/Utils/StringUtils.h"
+#include "Framework/Utils/PrintUtils.h"
+#include "Framework/Utils/CmdLnArgParser.h"
+
+using std::string;
+using std::vector;
+using std::ostringstream;
+
+using namespace genie;
+using namespace genie::utils;
+
+// a single event generation request
+typedef struct SRequest {
+  int      probe;     ///< neutrino pdg code
+  int      target;    ///< target pdg code
+  double   Emin;      ///< neutrino energy, or minimum energy of the flux spectrum
+  double   Emax;      ///< maximum energy of the flux spectrum (Emin if mono-energetic)
+  string   flux;      ///< flux spectrum formula ("" if flat)
+  int      nev;       ///< number of events to generate
+  long int seed;      ///< random number seed (-1 to continue the current sequence)
+} Request_t;
+
+// ** Prototypes
+//
+void         GetCommandLineArgs (int argc, char ** argv);
+void         PrintSyntax        (void);
+void         Initialize         (void);
+void         ConfigureDrivers   (void);
+GEVGDriver * Driver             (int probe, int target, string & err);
+void         RunWorkers         (TServerSocket * serv_sock);
+bool         Serve              (TServerSocket * serv_sock);
+bool         HandleClient       (TSocket * sock);
+void         GenerateBatch      (TSocket * sock, string mesg);
+bool         ParseRequest       (string request, Request_t & req, string & err);
+bool         GenerateEvents     (TSocket * sock, int ireq, const Request_t & req);
+
+// ** Consts & Defaults
+//
+const string kDefSocketPath        = "gevserv.sock";  // default unix domain socket
+const int    kMaxMesgLength        = 1048576;         // max length of client messages
+const int    kShutdownExitCode     = 3;               // worker exit code on SHUTDOWN
+const string kHelloCmdRecv         = "HELLO";
+const string kHelloMesgSent        = "GEVSERV READY";
+const string kGenerateCmdRecv      = "GENERATE";
+const string kEventsMesgSent       = "EVENTS";
+const string kDoneMesgSent         = "DONE";
+const string kByeCmdRecv           = "BYE";
+const string kShutdownCmdRecv      = "SHUTDOWN";
+const string kShutdownOkMesgSent   = "SHUTTING DOWN";
+const string kErr                  = "FAILED";
+const int    kMaxEvGenAttempts     = 1000;            // max consecutive failed event generation attempts
+const int    kMaxFluxAttempts      = 1000000;         // max consecutive rejected flux energies
+
+// ** User-specified options:
+//
+string      gOptSocketPath;    // unix domain socket path
+int         gOptPortNum;       // tcp/ip port number (used if > 0)
+int         gOptNWorkers;      // number of worker processes
+PDGCodeList gOptNuPdgCodes;    // neutrinos for which drivers are configured at start-up
+PDGCodeList gOptTgtPdgCodes;   // targets for which drivers are configured at start-up
+long int    gOptRanSeed;       // random number seed
+string      gOptInpXSecFile;   // cross-section splines
+
+// ** Globals
+//
+GEVGPool    gGPool;            // event generation drivers, one per initial state
+int         gWorkerId = 0;     // id of the current worker process
+
+//____________________________________________________________________________
+int main(int argc, char ** argv)
+{
+  GetCommandLineArgs(argc,argv);
+  Initialize();
+
+  // Load everything that can be shared by the workers before forking them
+  ConfigureDrivers();
+
+  // Open the server socket
+  TServerSocket * serv_sock = 0;
+  ostringstream address;
+  if(gOptPortNum > 0) {
+    address << "port: " << gOptPortNum;
+    serv_sock = new TServerSocket(gOptPortNum, kTRUE);
+  } else {
+    address << "socket: " << gOptSocketPath;
+    // remove a socket left behind by a server that didn't shut down cleanly
+    struct stat st;
+    if(stat(gOptSocketPath.c_str(), &st) == 0 && S_ISSOCK(st.st_mode)) {
+      LOG("gevserv", pWARN) << "Removing stale socket: " << gOptSocketPath;
+      unlink(gOptSocketPath.c_str());
+    }
+    serv_sock = new TServerSocket(gOptSocketPath.c_str());
+  }
+  if(!serv_sock->IsValid()) {
+    LOG("gevserv", pFATAL) << "Can not listen to " << address.str();
+    exit(1);
+  }
+  LOG("gevserv", pNOTICE)
+    << "Listening to " << address.str()
+    << " with " << gOptNWorkers << " worker process(es)";
+
+  if(gOptNWorkers == 1) {
+    Serve(serv_sock);
+  } else {
+    RunWorkers(serv_sock);
+  }
+
+  serv_sock->Close();
+  delete serv_sock;
+  if(gOptPortNum <= 0) unlink(gOptSocketPath.c_str());
+
+  LOG("gevserv", pNOTICE) << "Done!";
+  return 0;
+}
+//____________________________________________________________________________
+void Initialize(void)
+{
+  if ( ! RunOpt::Instance()->Tune() ) {
+    LOG("gevserv", pFATAL) << " No TuneId in RunOption";
+    exit(-1);
+  }
+  RunOpt::Instance()->BuildTune();
+
+  // Initialization of random number generators, cross-section table,
+  // messenger thresholds, cache file
+  utils::app_init::MesgThresholds(RunOpt::Instance()->MesgThresholdFiles());
+  utils::app_init::CacheFile(RunOpt::Instance()->CacheFile());
+  utils::app_init::RandGen(gOptRanSeed);
+  utils::app_init::XSecTable(gOptInpXSecFile, false);
+
+  // Set GHEP print level
+  GHepRecord::SetPrintLevel(RunOpt::Instance()->EventRecordPrintLevel());
+}
+//____________________________________________________________________________
+void ConfigureDrivers(void)
+{
+// Configure an event generation driver for each of the initial states
+// specified at the command-line
+
+  PDGCodeList::const_iterator nuiter;
+  PDGCodeList::const_iterator tgtiter;
+  for(nuiter = gOptNuPdgCodes.begin(); nuiter != gOptNuPdgCodes.end(); ++nuiter) {
+    for(tgtiter = gOptTgtPdgCodes.begin(); tgtiter != gOptTgtPdgCodes.end(); ++tgtiter) {
+      string err;
+      if(!Driver(*nuiter, *tgtiter, err)) {
+        LOG("gevserv", pFATAL)
+          << "Can not configure event generation for probe " << *nuiter
+          << " on target " << *tgtiter << ": " << err;
+        exit(1);
+      }
+    }
+  }
+  LOG("gevserv", pNOTICE)
+    << "Configured " << gGPool.size() << " event generation driver(s)";
+}
+//____________________________________________________________________________
+GEVGDriver * Driver(int probe, int target, string & err)
+{
+// Find the event generation driver for the given initial state.
+// Drivers not configured at start-up are created on demand.
+// Returns 0 (and the reason in err) for unsupported initial states.
+
+  PDGLibrary * pdglib = PDGLibrary::Instance();
+  if(!pdglib->Find(probe) || !pdglib->Find(target)) {
+    err = "unknown probe or target pdg code";
+    return 0;
+  }
+
+  InitialState init_state(target, probe);
+
+  GEVGDriver * evg_driver = gGPool.FindDriver(init_state);
+  if(!evg_driver) {
+    LOG("gevserv", pNOTICE)
+      << "\n\n ---- Creating a GEVGDriver object configured for init-state: "
+      << init_state.AsString() << " ----\n\n";
+
+    evg_driver = new GEVGDriver;
+    evg_driver->SetEventGeneratorList(RunOpt::Instance()->EventGeneratorList());
+    evg_driver->SetUnphysEventMask(*RunOpt::Instance()->UnphysEventMask());
+    evg_driver->Configure(init_state);
+    evg_driver->UseSplines(); // will also check if all splines needed are loaded
+
+    gGPool.insert( GEVGPool::value_type(init_state.AsString(), evg_driver) );
+  }
+
+  const InteractionList * ilst = evg_driver->Interactions();
+  if(!ilst || ilst->size() == 0) {
+    err = "no interactions enabled for " + init_state.AsString();
+    return 0;
+  }
+
+  return evg_driver;
+}
+//____________________________________________________________________________
+void RunWorkers(TServerSocket * serv_sock)
+{
+// Fork the worker processes. They all accept connections on the same server
+// socket. Workers that die are restarted; once a worker receives SHUTDOWN
+// all others are terminated.
+
+  std::cout.flush();
+  std::cerr.flush();
+  fflush(NULL);
+
+  vector<pid_t> pids(gOptNWorkers, -1);
+  long int base_seed = RandomGen::Instance()->GetSeed();
+  long int nstarted  = 0; // number of worker processes started so far
+
+  bool shutdown = false;
+  while(!shutdown) {
+    // (re)start workers
+    for(int w = 0; w < gOptNWorkers; w++) {
+      if(pids[w] > 0) continue;
+      // the first workers use seed+w; restarted ones continue the sequence
+      // of seeds so that they do not replay the stream of the dead worker
+      long int seed = base_seed + nstarted;
+      nstarted++;
+      pid_t pid = fork();
+      if(pid == 0) {
+        gWorkerId = w;
+        RandomGen::Instance()->SetSeed(seed);
+        bool shutdown_requested = Serve(serv_sock);
+        std::cout.flush();
+        std::cerr.flush();
+        fflush(NULL);
+        _exit( (shutdown_requested) ? kShutdownExitCode : 0 );
+      }
+      if(pid < 0) {
+        LOG("gevserv", pFATAL) << "Cannot fork worker process " << w;
+        exit(1);
+      }
+      pids[w] = pid;
+    }
+
+    // wait for any of the workers to exit
+    int status = 0;
+    pid_t pid = waitpid(-1, &status, 0);
+    if(pid < 0) continue;
+    for(int w = 0; w < gOptNWorkers; w++) {
+      if(pids[w] != pid) continue;
+      pids[w] = -1;
+      if(WIFEXITED(status) && WEXITSTATUS(status) == kShutdownExitCode) {
+        shutdown = true;
+      } else {
+        LOG("gevserv", pERROR) << "Worker process " << w << " died - Restarting it";
+      }
+    }
+  }
+
+  for(int w = 0; w < gOptNWorkers; w++) {
+    if(pids[w] > 0) kill(pids[w], SIGTERM);
+  }
+  for(int w = 0; w < gOptNWorkers; w++) {
+    if(pids[w] > 0) waitpid(pids[w], 0, 0);
+  }
+}
+//____________________________________________________________________________
+bool Serve(TServerSocket * serv_sock)
+{
+// Serve clients one connection at a time. Returns true on SHUTDOWN.
+
+  while(1) {
+    TSocket * sock = serv_sock->Accept();
+    if(!sock || sock == (TSocket *)(-1)) {
+      LOG("gevserv", pERROR) << "Failed to accept connection";
+      continue;
+    }
+    LOG("gevserv", pNOTICE) << "Worker " << gWorkerId << " accepted a connection";
+
+    bool shutdown = HandleClient(sock);
+
+    sock->Close();
+    delete sock;
+
+    if(shutdown) return true;
+  }
+  return false;
+}
+//____________________________________________________________________________
+bool HandleClient(TSocket * sock)
+{
+// Process the messages of a client until it disconnects.
+// Returns true if the client asked the server to shut down.
+
+  vector<char> mesg_content(kMaxMesgLength);
+
+  while(1) {
+    TMessage * mesg = 0;
+    if(sock->Recv(mesg) <= 0 || !mesg) {
+      LOG("gevserv", pNOTICE) << "Client disconnected";
+      if(mesg) delete mesg;
+      return false;
+    }
+    if(mesg->What() != kMESS_STRING) {
+      delete mesg;
+      sock->Send( (kErr + ": expected a string message").c_str() );
+      continue;
+    }
+    mesg->ReadString(&mesg_content[0], kMaxMesgLength);
+    delete mesg;
+
+    string cmd = str::TrimSpaces(string(&mesg_content[0]));
+
+    LOG("gevserv", pINFO) << "Processing mesg > " << cmd;
+
+    if(cmd.find(kHelloCmdRecv) == 0) {
+      ostringstream reply;
+      reply << kHelloMesgSent << ": " << gWorkerId;
+      sock->Send(reply.str().c_str());
+    }
+    else if(cmd.find(kGenerateCmdRecv) == 0) {
+      GenerateBatch(sock, cmd);
+    }
+    else if(cmd.find(kByeCmdRecv) == 0) {
+      return false;
+    }
+    else if(cmd.find(kShutdownCmdRecv) == 0) {
+      LOG("gevserv", pNOTICE) << "Shutting GENIE event server down ...";
+      sock->Send(kShutdownOkMesgSent.c_str());
+      return true;
+    }
+    else {
+      sock->Send( (kErr + ": unknown command").c_str() );
+    }
+  }
+  return false;
+}
+//____________________________________________________________________________
+void GenerateBatch(TSocket * sock, string mesg)
+{
+  // Strip the command token and the separating ':' only: the requests
+  // themselves may contain ':' (e.g. in flux formulas)
+  mesg = str::TrimSpaces(mesg.substr(kGenerateCmdRecv.size()));
+  if(mesg.size() > 0 && mesg[0] == ':') mesg = mesg.substr(1);
+
+  vector<string> requests = str::Split(mesg, ";");
+
+  TStopwatch timer;
+  timer.Start();
+
+  int nreq = 0;
+  int nev  = 0;
+  for(unsigned int ireq = 0; ireq < requests.size(); ireq++) {
+    string request = str::TrimSpaces(requests[ireq]);
+    if(request.size() == 0) continue;
+
+    Request_t req;
+    string    err;
+    if(!ParseRequest(request, req, err)) {
+      LOG("gevserv", pERROR) << "Invalid request: " << request << " (" << err << ")";
+      ostringstream reply;
+      reply << kErr << ": " << nreq << " " << err;
+      sock->Send(reply.str().c_str());
+      nreq++;
+      continue;
+    }
+    if(!GenerateEvents(sock, nreq, req)) {
+      LOG("gevserv", pERROR) << "Lost connection to the client";
+      return;
+    }
+    nreq++;
+    nev += req.nev;
+  }
+
+  ostringstream reply;
+  reply << kDoneMesgSent << ": " << nreq;
+  sock->Send(reply.str().c_str());
+
+  timer.Stop();
+  LOG("gevserv", pNOTICE)
+     << "Worker " << gWorkerId << " served " << nev << " events ("
+     << nreq << " requests) in " << timer.RealTime() << " s ("
+     << nev / TMath::Max(timer.RealTime(), 1E-9) << " events/s)";
+}
+//____________________________________________________________________________
+bool ParseRequest(string request, Request_t & req, string & err)
+{
+  req.probe  = 0;
+  req.target = 0;
+  req.Emin   = -1;
+  req.Emax   = -1;
+  req.flux   = "";
+  req.nev    = -1;
+  req.seed   = -1;
+
+  vector<string> options = str::Split(request, " ");
+  vector<string>::const_iterator opt_iter = options.begin();
+  for( ; opt_iter != options.end(); ++opt_iter) {
+    string opt = str::TrimSpaces(*opt_iter);
+    if(opt.size() == 0) continue;
+
+    vector<string> kv = str::Split(opt, "=");
+    if(kv.size() != 2) {
+      err = "malformed option `" + opt + "'";
+      return false;
+    }
+    string key   = kv[0];
+    string value = kv[1];
+
+    if      (key == "probe" ) req.probe  = atoi(value.c_str());
+    else if (key == "target") req.target = atoi(value.c_str());
+    else if (key == "n"     ) req.nev    = atoi(value.c_str());
+    else if (key == "seed"  ) req.seed   = atol(value.c_str());
+    else if (key == "flux"  ) req.flux   = value;
+    else if (key == "energy") {
+      vector<string> erange = str::Split(value, ",");
+      if(erange.size() == 1) {
+        req.Emin = req.Emax = atof(erange[0].c_str());
+      } else if(erange.size() == 2) {
+        req.Emin = atof(erange[0].c_str());
+        req.Emax = atof(erange[1].c_str());
+      } else {
+        err = "malformed energy `" + value + "'";
+        return false;
+      }
+    }
+    else {
+      err = "unknown option `" + key + "'";
+      return false;
+    }
+  }
+
+  if(req.probe == 0 || req.target == 0) {
+    err = "unspecified probe or target";
+    return false;
+  }
+  if(req.Emin <= 0 || req.Emax < req.Emin) {
+    err = "unspecified or invalid energy";
+    return false;
+  }
+  if(req.nev < 0) {
+    err = "unspecified number of events";
+    return false;
+  }
+  return true;
+}
+//____________________________________________________________________________
+bool GenerateEvents(TSocket * sock, int ireq, const Request_t & req)
+{
+// Generates the requested events and sends them to the client.
+// Requests which can not be served are answered with `FAILED: <ireq> <reason>'.
+// Returns false if the client can not be reached.
+
+  string err = "";
+  GEVGDriver * evg_driver = Driver(req.probe, req.target, err);
+
+  if(evg_driver && req.seed > 0) {
+    RandomGen::Instance()->SetSeed(req.seed);
+  }
+
+  // For a flux spectrum, sample the neutrino energy from flux x cross section.
+  // The energies are drawn from the flux and accepted with a probability
+  // proportional to the total cross section (as GMCJDriver does).
+  bool   mono   = (req.Emax == req.Emin);
+  TF1 *  flux   = 0;
+  double xsmax  = 0;
+  if(evg_driver && mono) {
+    TLorentzVector p4(0.,0.,req.Emin,req.Emin);
+    if(evg_driver->XSecSum(p4) <= 0) err = "zero cross section at the requested energy";
+  }
+  if(evg_driver && !mono) {
+    string formula = (req.flux.size() > 0) ? req.flux : "1";
+    flux = new TF1("gevserv_flux", formula.c_str(), req.Emin, req.Emax);
+    if(!flux->IsValid()) {
+      err = "invalid flux formula `" + formula + "'";
+    }
+    else if(!(flux->Integral(req.Emin, req.Emax) > 0)) {
+      err = "flux is not positive in the requested energy range";
+    }
+    else {
+      const int nscan = 100;
+      for(int i = 0; i <= nscan; i++) {
+        double E = req.Emin * TMath::Power(req.Emax/req.Emin, (double)i/nscan);
+        TLorentzVector p4(0.,0.,E,E);
+        xsmax = TMath::Max(xsmax, evg_driver->XSecSum(p4));
+      }
+      xsmax *= 1.2; // safety factor for the maximum between the scan points
+      if(xsmax <= 0) err = "zero cross section in the requested energy range";
+    }
+  }
+
+  if(err.size() > 0) {
+    LOG("gevserv", pERROR) << "Can not serve request " << ireq << ": " << err;
+    if(flux) delete flux;
+    ostringstream reply;
+    reply << kErr << ": " << ireq << " " << err;
+    return sock->Send(reply.str().c_str()) > 0;
+  }
+
+  ostringstream hdr;
+  hdr << kEventsMesgSent << ": " << ireq << " " << req.nev;
+  if(sock->Send(hdr.str().c_str()) <= 0) {
+    if(flux) delete flux;
+    return false;
+  }
+
+  RandomGen * rnd = RandomGen::Instance();
+  NtpMCEventRecord ntprec;
+
+  int ievent    = 0;
+  int nfailed   = 0; // consecutive failed event generation attempts
+  int nrejected = 0; // consecutive rejected flux energies
+  while(ievent < req.nev) {
+
+     double Ev = req.Emin;
+     if(!mono) {
+       Ev = flux->GetRandom();
+       TLorentzVector p4(0.,0.,Ev,Ev);
+       if(rnd->RndEvg().Rndm() * xsmax > evg_driver->XSecSum(p4)) {
+         if(++nrejected < kMaxFluxAttempts) continue;
+         err = "could not sample the flux x cross section";
+         break;
+       }
+       nrejected = 0;
+     }
+     TLorentzVector nu_p4(0.,0.,Ev,Ev); // px,py,pz,E (GeV)
+
+     EventRecord * event = evg_driver->GenerateEvent(nu_p4);
+     if(!event) {
+        if(++nfailed < kMaxEvGenAttempts) {
+          LOG("gevserv", pNOTICE) << "Last attempt failed. Re-trying....";
+          continue;
+        }
+        err = "event generation failed repeatedly";
+        break;
+     }
+     nfailed = 0;
+     LOG("gevserv", pINFO) << "Generated Event GHEP Record: " << *event;
+
+     ntprec.Fill(ievent, event);
+     evg_driver->RecycleEvent(event);
+
+     TMessage mess(kMESS_OBJECT);
+     mess.WriteObject(&ntprec);
+     if(sock->Send(mess) <= 0) {
+       if(flux) delete flux;
+       return false;
+     }
+     ievent++;
+  }
+
+  if(flux) delete flux;
+
+  if(err.size() > 0) {
+    LOG("gevserv", pERROR)
+      << "Request " << ireq << " stopped after " << ievent << " events: " << err;
+    ostringstream reply;
+    reply << kErr << ": " << ireq << " " << err;
+    return sock->Send(reply.str().c_str()) > 0;
+  }
+  return true;
+}
+//____________________________________________________________________________
+void GetCommandLineArgs(int argc, char ** argv)
+{
+  LOG("gevserv", pNOTICE) << "Parsing command line arguments";
+
+  // Common run options. Set defaults and read.
+  RunOpt::Instance()->EnableBareXSecPreCalc(true);
+  RunOpt::Instance()->ReadFromCommandLine(argc,argv);
+
+  CmdLnArgParser parser(argc,argv);
+
+  // help?
+  bool help = parser.OptionExists('h');
+  if(help) {
+      PrintSyntax();
+      exit(0);
+  }
+
+  // socket / port number:
+  gOptSocketPath = kDefSocketPath;
+  gOptPortNum    = -1;
+  if( parser.OptionExists("socket") ) {
+    LOG("gevserv", pINFO) << "Reading socket path";
+    gOptSocketPath = parser.ArgAsString("socket");
+  }
+  if( parser.OptionExists("port") ) {
+    LOG("gevserv", pINFO) << "Reading port number";
+    gOptPortNum = parser.ArgAsInt("port");
+  }
+
+  // number of worker processes
+  if( parser.OptionExists('j') ) {
+    LOG("gevserv", pINFO) << "Reading number of worker processes";
+    gOptNWorkers = parser.ArgAsInt('j');
+    if(gOptNWorkers < 1) {
+      LOG("gevserv", pFATAL) << "Invalid number of worker processes: " << gOptNWorkers;
+      PrintSyntax();
+      exit(1);
+    }
+  } else {
+    gOptNWorkers = 1;
+  }
+
+  // initial states to configure at start-up
+  if( parser.OptionExists('p') ) {
+    LOG("gevserv", pINFO) << "Reading neutrino PDG codes";
+    vector<int> codes = parser.ArgAsIntTokens('p', ",");
+    for(unsigned int i = 0; i < codes.size(); i++) gOptNuPdgCodes.push_back(codes[i]);
+  }
+  if( parser.OptionExists('t') ) {
+    LOG("gevserv", pINFO) << "Reading target PDG codes";
+    vector<int> codes = parser.ArgAsIntTokens('t', ",");
+    for(unsigned int i = 0; i < codes.size(); i++) gOptTgtPdgCodes.push_back(codes[i]);
+  }
+
+  // random number seed
+  if( parser.OptionExists("seed") ) {
+    LOG("gevserv", pINFO) << "Reading random number seed";
+    gOptRanSeed = parser.ArgAsLong("seed");
+  } else {
+    LOG("gevserv", pINFO) << "Unspecified random number seed - Using default";
+    gOptRanSeed = -1;
+  }
+
+  // input cross-section file
+  if( parser.OptionExists("cross-sections") ) {
+    LOG("gevserv", pINFO) << "Reading cross-section file";
+    gOptInpXSecFile = parser.ArgAsString("cross-sections");
+  } else {
+    LOG("gevserv", pWARN) << "Unspecified cross-section file";
+    LOG("gevserv", pWARN) << "*** Expect a significant start-up overhead!";
+    gOptInpXSecFile = "";
+  }
+
+  LOG("gevserv", pNOTICE)
+     << "\n"
+     << utils::print::PrintFramedMesg("gevserv job configuration");
+  if(gOptPortNum > 0) {
+    LOG("gevserv", pNOTICE) << "Port: " << gOptPortNum;
+  } else {
+    LOG("gevserv", pNOTICE) << "Socket: " << gOptSocketPath;
+  }
+  LOG("gevserv", pNOTICE) << "Number of worker processes: " << gOptNWorkers;
+  LOG("gevserv", pNOTICE) << "Neutrinos configured at start-up: " << gOptNuPdgCodes;
+  LOG("gevserv", pNOTICE) << "Targets configured at start-up: " << gOptTgtPdgCodes;
+  LOG("gevserv", pNOTICE) << *RunOpt::Instance();
+}
+//____________________________________________________________________________
+void PrintSyntax(void)
+{
+  LOG("gevserv", pNOTICE)
+    << "\n\n" << "Syntax:" << "\n"
+    << "   gevserv [-h] [--socket path | --port port_number] [-j n_workers]\n"
+    << "           [-p neutrino_codes] [-t target_codes]\n"
+    << "           [--seed random_number_seed] [--cross-sections xml_file]\n"
+    << "           [--event-generator-list list_name] [--tune genie_tune]\n"
+    << "           [--message-thresholds xml_file]\n"
+    << "           [--unphysical-event-mask mask]\n"
+    << "           [--event-record-print-level level]\n"
+    << "           [--cache-file root_file]\n";
+}
+//____________________________________________________________________________
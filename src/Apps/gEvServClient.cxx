@@ -0,0 +1,326 @@
+//____________________________________________________________________________
+/*!
+
+\program gevserv_client
+
+\brief   Client for the GENIE event generation server (gevserv).
+
+         Sends a batch of event generation requests to a gevserv running on
+         the same host, receives the generated events and writes them in a
+         GHEP file. It can also be used to check whether a server is up and
+         to shut it down. See gevserv for the request syntax.
+
+\syntax  gevserv_client [-h]
+                        [--socket path | --host host_name --port port_number]
+                        [-r requests]
+                        [--request-file file]
+                        [-o output_file_name]
+                        [--shutdown]
+
+         Options :
+           [] Denotes an optional argument.
+           -h
+              Prints-out help on using gevserv_client and exits.
+           --socket
+              Path of the UNIX domain socket gevserv listens to
+              [default: gevserv.sock].
+           --host, --port
+              Connect to a server listening to a TCP/IP port instead
+              [default host: localhost].
+           -r
+              Event generation requests, separated by `;', eg
+              -r 'probe=14 target=1000080160 energy=1 n=100;
+                  probe=14 target=1000080160 energy=0.5,10 flux=x*exp(-x) n=100'
+           --request-file
+              Text file with event generation requests, one per line.
+              Empty lines and lines starting with `#' are ignored.
+           -o
+              Name of the output GHEP file. If not set, the events are
+              received but not stored (eg to measure the server throughput).
+           --shutdown
+              Asks the server to shut down (once all requests were served).
+
+         Example:
+           gevserv --cross-sections xsec.xml --tune G18_02a_00_000 \
+                   -p 14 -t 1000080160 -j 4 &
+           gevserv_client -r 'probe=14 target=1000080160 energy=1 n=1000' \
+                   -o gntp.serv.ghep.root --shutdown
+
+\author  Costas Andreopoulos <constantinos.andreopoulos \at cern.ch>
+ University of Liverpool & STFC Rutherford Appleton Laboratory
+
+\created September 18, 2007
+
+\cpright Copyright (c) 2003-2023, The GENIE Collaboration
+         For the full text of the license visit http://copyright.genie-mc.org
+
+*/
+//____________________________________________________________________________
+
+#include <cstdlib>
+#include <fstream>
+#include <sstream>
+#include <string>
+#include <vector>
+
+#include <TSocket.h>
+#include <TMessage.h>
+#include <TStopwatch.h>
+#include <TMath.h>
+
+#include "Framework/EventGen/EventRecord.h"
+#include "Framework/Messenger/Messenger.h"
+#include "Framework/Ntuple/NtpMCEventRecord.h"
+#include "Framework/Ntuple/NtpMCFormat.h"
+#include "Framework/Ntuple/NtpWriter.h"
+#include "Framework/Utils/StringUtils.h"
+#include "Framework/Utils/CmdLnArgParser.h"
+
+using std::string;
+using std::vector;
+using std::ifstream;
+using std::ostringstream;
+
+using namespace genie;
+using namespace genie::utils;
+
+// ** Prototypes
+//
+void      GetCommandLineArgs (int argc, char ** argv);
+void      PrintSyntax        (void);
+TSocket * Connect            (void);
+string    RecvString         (TSocket * sock);
+bool      RequestEvents      (TSocket * sock);
+
+// ** Consts & Defaults
+//
+const string kDefSocketPath = "gevserv.sock";
+const string kDefHost       = "localhost";
+const int    kMaxMesgLength = 4096;
+
+// ** User-specified options:
+//
+string gOptSocketPath;  // unix domain socket path
+string gOptHost;        // server host (if using a tcp/ip port)
+int    gOptPortNum;     // tcp/ip port number (used if > 0)
+string gOptRequests;    // event generation requests, separated by `;'
+string gOptOutFileName; // output GHEP file
+bool   gOptShutdown;    // shut the server down?
+
+//____________________________________________________________________________
+int main(int argc, char ** argv)
+{
+  GetCommandLineArgs(argc,argv);
+
+  TSocket * sock = Connect();
+
+  sock->Send("HELLO");
+  string reply = RecvString(sock);
+  if(reply.find("GEVSERV READY") != 0) {
+    LOG("gevserv_client", pFATAL) << "Unexpected server reply: " << reply;
+    exit(1);
+  }
+  LOG("gevserv_client", pNOTICE) << "Server: " << reply;
+
+  bool ok = true;
+  if(gOptRequests.size() > 0) {
+    ok = RequestEvents(sock);
+  }
+
+  if(gOptShutdown) {
+    sock->Send("SHUTDOWN");
+    LOG("gevserv_client", pNOTICE) << "Server: " << RecvString(sock);
+  } else {
+    sock->Send("BYE");
+  }
+
+  sock->Close();
+  delete sock;
+
+  if(!ok) exit(1);
+
+  LOG("gevserv_client", pNOTICE) << "Done!";
+  return 0;
+}
+//____________________________________________________________________________
+TSocket * Connect(void)
+{
+  TSocket * sock = 0;
+  if(gOptPortNum > 0) {
+    LOG("gevserv_client", pNOTICE)
+      << "Connecting to " << gOptHost << ":" << gOptPortNum;
+    sock = new TSocket(gOptHost.c_str(), gOptPortNum);
+  } else {
+    LOG("gevserv_client", pNOTICE) << "Connecting to " << gOptSocketPath;
+    sock = new TSocket(gOptSocketPath.c_str());
+  }
+  if(!sock->IsValid()) {
+    LOG("gevserv_client", pFATAL) << "Can not connect to the GENIE event server";
+    exit(1);
+  }
+  return sock;
+}
+//____________________________________________________________________________
+string RecvString(TSocket * sock)
+{
+  char mesg[kMaxMesgLength];
+  if(sock->Recv(mesg, kMaxMesgLength) <= 0) {
+    LOG("gevserv_client", pFATAL) << "Lost connection to the GENIE event server";
+    exit(1);
+  }
+  return string(mesg);
+}
+//____________________________________________________________________________
+bool RequestEvents(TSocket * sock)
+{
+// Sends all requests in a single batch and receives the generated events.
+// Returns false if any of the requests failed.
+
+  NtpWriter * ntpw = 0;
+  if(gOptOutFileName.size() > 0) {
+    ntpw = new NtpWriter(kNFGHEP, 0);
+    ntpw->CustomizeFilename(gOptOutFileName);
+    ntpw->Initialize();
+  }
+
+  TStopwatch timer;
+  timer.Start();
+
+  string cmd = "GENERATE: " + gOptRequests;
+  sock->Send(cmd.c_str());
+
+  LOG("gevserv_client", pNOTICE) << "Sent: " << cmd;
+
+  bool     ok     = true;
+  int      nev    = 0;
+  Long64_t nbytes = 0;
+  while(1) {
+    TMessage * mesg = 0;
+    if(sock->Recv(mesg) <= 0 || !mesg) {
+      LOG("gevserv_client", pFATAL) << "Lost connection to the GENIE event server";
+      exit(1);
+    }
+    nbytes += mesg->Length();
+
+    if(mesg->What() == kMESS_OBJECT) {
+      NtpMCEventRecord * rec =
+         dynamic_cast<NtpMCEventRecord *> (
+            (TObject *) mesg->ReadObject(mesg->GetClass()) );
+      delete mesg;
+      if(!rec) {
+        LOG("gevserv_client", pERROR) << "Received an unexpected object";
+        ok = false;
+        continue;
+      }
+      LOG("gevserv_client", pINFO)
+         << "Received event: " << nev << "\n" << *(rec->event);
+      if(ntpw) ntpw->AddEventRecord(nev, rec->event);
+      nev++;
+      delete rec;
+      continue;
+    }
+
+    char content[kMaxMesgLength];
+    mesg->ReadString(content, kMaxMesgLength);
+    delete mesg;
+
+    string reply(content);
+    LOG("gevserv_client", pNOTICE) << "Server: " << reply;
+
+    if(reply.find("FAILED") == 0) ok = false;
+    if(reply.find("DONE")   == 0) break;
+  }
+
+  timer.Stop();
+  LOG("gevserv_client", pNOTICE)
+     << "Received " << nev << " events (" << nbytes/1.E6 << " MB) in "
+     << timer.RealTime() << " s ("
+     << nev / TMath::Max(timer.RealTime(), 1E-9) << " events/s)";
+
+  if(ntpw) {
+    ntpw->Save();
+    delete ntpw;
+  }
+  return ok;
+}
+//____________________________________________________________________________
+void GetCommandLineArgs(int argc, char ** argv)
+{
+  LOG("gevserv_client", pINFO) << "Parsing command line arguments";
+
+  CmdLnArgParser parser(argc,argv);
+
+  // help?
+  bool help = parser.OptionExists('h');
+  if(help) {
+      PrintSyntax();
+      exit(0);
+  }
+
+  // socket / host & port number:
+  gOptSocketPath = kDefSocketPath;
+  gOptHost       = kDefHost;
+  gOptPortNum    = -1;
+  if( parser.OptionExists("socket") ) {
+    gOptSocketPath = parser.ArgAsString("socket");
+  }
+  if( parser.OptionExists("host") ) {
+    gOptHost = parser.ArgAsString("host");
+  }
+  if( parser.OptionExists("port") ) {
+    gOptPortNum = parser.ArgAsInt("port");
+  }
+
+  // requests
+  vector<string> requests;
+  if( parser.OptionExists('r') ) {
+    LOG("gevserv_client", pINFO) << "Reading requests";
+    requests = str::Split(parser.ArgAsString('r'), ";");
+  }
+  if( parser.OptionExists("request-file") ) {
+    string filename = parser.ArgAsString("request-file");
+    LOG("gevserv_client", pINFO) << "Reading requests from: " << filename;
+    ifstream reqfile(filename.c_str());
+    if(!reqfile.good()) {
+      LOG("gevserv_client", pFATAL) << "Can not read: " << filename;
+      exit(1);
+    }
+    string line;
+    while(std::getline(reqfile, line)) {
+      line = str::TrimSpaces(line);
+      if(line.size() == 0 || line[0] == '#') continue;
+      requests.push_back(line);
+    }
+  }
+  ostringstream batch;
+  for(unsigned int i = 0; i < requests.size(); i++) {
+    string request = str::TrimSpaces(requests[i]);
+    if(request.size() == 0) continue;
+    if(batch.str().size() > 0) batch << "; ";
+    batch << request;
+  }
+  gOptRequests = batch.str();
+
+  // output file name
+  if( parser.OptionExists('o') ) {
+    gOptOutFileName = parser.ArgAsString('o');
+  } else {
+    gOptOutFileName = "";
+  }
+
+  gOptShutdown = parser.OptionExists("shutdown");
+
+  if(gOptRequests.size() == 0 && !gOptShutdown) {
+    LOG("gevserv_client", pNOTICE) << "No requests - Will only ping the server";
+  }
+}
+//____________________________________________________________________________
+void PrintSyntax(void)
+{
+  LOG("gevserv_client", pNOTICE)
+    << "\n\n" << "Syntax:" << "\n"
+    << "   gevserv_client [-h] [--socket path | --host host_name --port port_number]\n"
+    << "                  [-r requests] [--request-file file]\n"
+    << "                  [-o output_file_name] [--shutdown]\n";
+}
+//____________________________________________________________________________
@@ -778,7 +778,7 @@ int main(int argc, char ** argv)
      // Add event at the output ntuple, refresh the mc job monitor & clean-up
      ntpw.AddEventRecord(ievent, event);
      mcjmonitor.Update(ievent,event);
-     delete event;
+     mcj_driver->RecycleEvent(event);
      ievent++;
 
   } //1
@@ -0,0 +1,227 @@
+//____________________________________________________________________________
+/*!
+
+\program ghadtens2bin
+
+\brief   Converts ASCII hadron tensor tables (as used by the Nieves MEC,
+         SuSAv2 and CRPA hadron tensor models) into the binary format read
+         by genie::BinaryHadronTensorTable.
+
+         The binary tables are written next to the ASCII ones using the name
+         <ascii_file>.bin. If such a sidecar file exists, the tabulated hadron
+         tensor models load it (memory-mapped, shared between processes) in
+         place of the ASCII table unless PreferBinaryTables is set to false
+         in their configuration. A sidecar records the size and modification
+         time of its ASCII table and is ignored once the ASCII table changes.
+
+         Syntax :
+           ghadtens2bin [-f ascii_file[,ascii_file,...]] [-d directory]
+                        [-o binary_file] [-r]
+                        [--message-thresholds xml_file]
+
+         Options :
+           []  denotes an optional argument
+
+           -f
+              Comma-separated list of ASCII hadron tensor tables to convert
+           -d
+              Directory in which all *.dat hadron tensor tables are converted
+           -o
+              Name of the binary output file. Only allowed when converting
+              a single table. [default: <ascii_file>.bin]
+           -r
+              Overwrite existing binary tables. By default, tables for which
+              an up-to-date binary file already exists are skipped.
+           --message-thresholds
+              Allows users to customize the message stream thresholds.
+
+         Example:
+
+           Convert all hadron tensor tables distributed with GENIE:
+
+           shell$ ghadtens2bin -d $GENIE/data/evgen/hadron_tensors/nieves
+           shell$ ghadtens2bin -d $GENIE/data/evgen/hadron_tensors/crpa_susav2
+
+\author  The GENIE Collaboration
+
+\created October 16, 2026
+
+\cpright Copyright (c) 2003-2023, The GENIE Collaboration
+         For the full text of the license visit http://copyright.genie-mc.org
+*/
+//____________________________________________________________________________
+
+#include <algorithm>
+#include <cstdlib>
+#include <fstream>
+#include <string>
+#include <vector>
+
+#include <TSystem.h>
+
+#include "Framework/Messenger/Messenger.h"
+#include "Framework/Utils/AppInit.h"
+#include "Framework/Utils/RunOpt.h"
+#include "Framework/Utils/StringUtils.h"
+#include "Framework/Utils/CmdLnArgParser.h"
+#include "Physics/HadronTensors/BinaryHadronTensorTable.h"
+#include "Physics/HadronTensors/TabulatedLabFrameHadronTensor.h"
+
+using std::string;
+using std::vector;
+
+using namespace genie;
+
+// Prototypes:
+void GetCommandLineArgs (int argc, char ** argv);
+void PrintSyntax        (void);
+bool ConvertTable       (const string & in_file, const string & out_file);
+void AddDirectoryTables (const string & dir_name);
+
+// User-specified options:
+vector<string> gOptInputFiles;
+string         gOptOutputFile = "";
+bool           gOptOverwrite  = false;
+
+//____________________________________________________________________________
+int main(int argc, char ** argv)
+{
+  GetCommandLineArgs(argc,argv);
+
+  utils::app_init::MesgThresholds(RunOpt::Instance()->MesgThresholdFiles());
+
+  int n_converted = 0;
+  int n_skipped   = 0;
+  int n_failed    = 0;
+
+  vector<string>::const_iterator iter = gOptInputFiles.begin();
+  for( ; iter != gOptInputFiles.end(); ++iter) {
+    const string & in_file = *iter;
+    string out_file = gOptOutputFile.empty() ?
+      in_file + BinaryHadronTensorTable::FileSuffix() : gOptOutputFile;
+
+    if( !gOptOverwrite && std::ifstream(out_file.c_str()).good() ) {
+      if( BinaryHadronTensorTable::MatchesSource(out_file, in_file) ) {
+        LOG("ghadtens2bin", pNOTICE)
+          << "Binary table " << out_file << " is up to date - Skipping";
+        n_skipped++;
+        continue;
+      }
+      LOG("ghadtens2bin", pNOTICE)
+        << "Binary table " << out_file << " is out of date - Rebuilding";
+    }
+
+    if( ConvertTable(in_file, out_file) ) n_converted++;
+    else n_failed++;
+  }
+
+  LOG("ghadtens2bin", pNOTICE)
+    << "Converted " << n_converted << " table(s), skipped " << n_skipped
+    << ", failed " << n_failed;
+
+  return (n_failed == 0) ? 0 : 1;
+}
+//____________________________________________________________________________
+bool ConvertTable(const string & in_file, const string & out_file)
+{
+  if( BinaryHadronTensorTable::IsBinaryTableFile(in_file) ) {
+    LOG("ghadtens2bin", pWARN)
+      << in_file << " is already a binary hadron tensor table";
+    return false;
+  }
+
+  LOG("ghadtens2bin", pNOTICE) << "Converting " << in_file;
+
+  TabulatedLabFrameHadronTensor tensor(in_file);
+  if( !tensor.WriteBinaryTable(out_file, in_file) ) {
+    LOG("ghadtens2bin", pERROR) << "Failed to write " << out_file;
+    return false;
+  }
+
+  // Read back the new file to make sure that it is valid
+  BinaryHadronTensorTable check;
+  if( !check.Open(out_file) ) {
+    LOG("ghadtens2bin", pERROR) << "Validation of " << out_file << " failed";
+    return false;
+  }
+
+  LOG("ghadtens2bin", pNOTICE)
+    << "Wrote " << out_file << " (" << check.NumQ0() << " x "
+    << check.NumQMag() << " grid)";
+
+  return true;
+}
+//____________________________________________________________________________
+void AddDirectoryTables(const string & dir_name)
+{
+  void * dir = gSystem->OpenDirectory(dir_name.c_str());
+  if( !dir ) {
+    LOG("ghadtens2bin", pFATAL) << "Unable to open directory " << dir_name;
+    exit(1);
+  }
+
+  vector<string> tables;
+  const char * entry = 0;
+  while( (entry = gSystem->GetDirEntry(dir)) ) {
+    string name(entry);
+    if( name.size() > 4 && name.compare(name.size() - 4, 4, ".dat") == 0 ) {
+      tables.push_back(dir_name + "/" + name);
+    }
+  }
+  gSystem->FreeDirectory(dir);
+
+  std::sort(tables.begin(), tables.end());
+  gOptInputFiles.insert(gOptInputFiles.end(), tables.begin(), tables.end());
+}
+//____________________________________________________________________________
+void GetCommandLineArgs(int argc, char ** argv)
+{
+  LOG("ghadtens2bin", pINFO) << "Parsing command line arguments";
+
+  // Common run options. Set defaults and read.
+  RunOpt::Instance()->ReadFromCommandLine(argc,argv);
+
+  // Parse run options for this app
+
+  CmdLnArgParser parser(argc,argv);
+
+  // input ASCII tables:
+  if( parser.OptionExists('f') ) {
+    vector<string> files = utils::str::Split(parser.ArgAsString('f'), ",");
+    gOptInputFiles.insert(gOptInputFiles.end(), files.begin(), files.end());
+  }
+
+  // directory holding ASCII tables:
+  if( parser.OptionExists('d') ) {
+    AddDirectoryTables(parser.ArgAsString('d'));
+  }
+
+  if( gOptInputFiles.empty() ) {
+    LOG("ghadtens2bin", pFATAL) << "No input hadron tensor tables specified";
+    PrintSyntax();
+    exit(1);
+  }
+
+  // output file name:
+  if( parser.OptionExists('o') ) {
+    gOptOutputFile = parser.ArgAsString('o');
+    if( gOptInputFiles.size() != 1 ) {
+      LOG("ghadtens2bin", pFATAL)
+        << "The -o option can only be used when converting a single table";
+      PrintSyntax();
+      exit(1);
+    }
+  }
+
+  gOptOverwrite = parser.OptionExists('r');
+}
+//____________________________________________________________________________
+void PrintSyntax(void)
+{
+  LOG("ghadtens2bin", pNOTICE)
+      << "\n\n" << "Syntax:" << "\n"
+      << "   ghadtens2bin [-f ascii_file[,ascii_file,...]] [-d directory]\n"
+      << "                [-o binary_file] [-r]\n"
+      << "                [--message-thresholds xml_file]\n";
+}
+//____________________________________________________________________________
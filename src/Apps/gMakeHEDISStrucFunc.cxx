@@ -6,6 +6,8 @@
          Syntax :
            gmksf [-h]
                   --tune genie_tune
+                 [-j n_workers]
+                 [--split job/n_jobs]
                  [--message-thresholds xml_file]
          Note :
            [] marks optional arguments.
@@ -14,6 +16,16 @@
          Options :
            --tune
               Specifies a GENIE comprehensive neutrino interaction model tune.
+           -j
+              Number of processes computing the structure function tables
+              (default: 1).
+           --split
+              Only compute the share `job' (0 to n_jobs-1) of the structure
+              function tables, so that the computation can be split among
+              several batch jobs. Each table is computed in chunks of Q2 rows
+              saved in checkpoint files, which are also used to resume an
+              interrupted computation. Once all jobs are done, run the program
+              once more without --split to assemble the final tables.
            --message-thresholds
               Allows users to customize the message stream thresholds.
               The thresholds are specified using an XML file.
@@ -34,14 +46,23 @@
 #include "Framework/EventGen/GEVGDriver.h"
 #include "Framework/Utils/AppInit.h"
 #include "Framework/Utils/RunOpt.h"
+#include "Framework/Utils/CmdLnArgParser.h"
+#include "Framework/Utils/StringUtils.h"
 #include "Framework/Interaction/Interaction.h"
 #include "Framework/Interaction/InitialState.h"
 #include "Framework/Messenger/Messenger.h"
+#include "Physics/HEDIS/XSection/HEDISPXSec.h"
+#include "Physics/HEDIS/XSection/HEDISStrucFunc.h"
 
 using namespace genie;
 
+void   GetCommandLineArgs (int argc, char ** argv);
 void   PrintSyntax        (void);
 
+int gOptNWorkers = 1;   // number of processes computing the SF tables
+int gOptIJob     = 0;   // share of the SF tables computed by this job
+int gOptNJobs    = 1;   // number of jobs sharing the SF tables
+
 //____________________________________________________________________________
 int main(int argc, char ** argv)
 {
@@ -56,6 +77,10 @@ int main(int argc, char ** argv)
 
   utils::app_init::MesgThresholds(RunOpt::Instance()->MesgThresholdFiles());
 
+  GetCommandLineArgs(argc,argv);
+  HEDISStrucFunc::SetNWorkers(gOptNWorkers);
+  HEDISStrucFunc::SetJobSplit(gOptIJob,gOptNJobs);
+
   GEVGDriver evg_driver;
   InitialState init_state(1000010020, 14);
   evg_driver.SetEventGeneratorList("CCHEDIS");
@@ -65,16 +90,76 @@ int main(int argc, char ** argv)
   InteractionList::const_iterator intliter = intlst->begin();
   Interaction * interaction = *intliter;
   const XSecAlgorithmI * xsec_alg = evg_driver.FindGenerator(interaction)->CrossSectionAlg();
+  const HEDISPXSec * hedis_alg = dynamic_cast<const HEDISPXSec *>(xsec_alg);
+  if ( ! hedis_alg ) {
+    LOG("gmkhedissf", pFATAL) << "CCHEDIS cross section algorithm is not a HEDISPXSec";
+    exit(1);
+  }
+
+  // Compute (or complete) the SF tables
+  HEDISStrucFunc * sf_tbl = HEDISStrucFunc::Instance(hedis_alg->SFInfo());
+  if ( ! sf_tbl->IsLoaded() ) {
+    LOG("gmkhedissf", pNOTICE) 
+      << "Job " << gOptIJob << "/" << gOptNJobs << " done. Run gmkhedissf without --split once all jobs are done.";
+    return 0;
+  }
+
   interaction->SetBit(kISkipKinematicChk);
   xsec_alg->XSec(interaction, kPSxQ2fE);
 
-}//____________________________________________________________________________
+}
+//____________________________________________________________________________
+void GetCommandLineArgs(int argc, char ** argv)
+{
+  LOG("gmkhedissf", pINFO) << "Parsing command line arguments";
+
+  CmdLnArgParser parser(argc,argv);
+
+  // help?
+  bool help = parser.OptionExists('h');
+  if(help) {
+      PrintSyntax();
+      exit(0);
+  }
+
+  // number of processes
+  if( parser.OptionExists('j') ) {
+    gOptNWorkers = parser.ArgAsInt('j');
+    if ( gOptNWorkers < 1 ) {
+      LOG("gmkhedissf", pFATAL) << "Invalid number of processes: " << gOptNWorkers;
+      PrintSyntax();
+      exit(1);
+    }
+  }
+  LOG("gmkhedissf", pINFO) << "Number of processes: " << gOptNWorkers;
+
+  // split among jobs
+  if( parser.OptionExists("split") ) {
+    vector<string> split = utils::str::Split(parser.ArgAsString("split"), "/");
+    if ( split.size() != 2 ) {
+      LOG("gmkhedissf", pFATAL) << "Invalid --split argument. Expected: job/n_jobs";
+      PrintSyntax();
+      exit(1);
+    }
+    gOptIJob  = atoi(split[0].c_str());
+    gOptNJobs = atoi(split[1].c_str());
+    if ( gOptNJobs < 1 || gOptIJob < 0 || gOptIJob >= gOptNJobs ) {
+      LOG("gmkhedissf", pFATAL) << "Invalid --split argument: " << parser.ArgAsString("split");
+      PrintSyntax();
+      exit(1);
+    }
+    LOG("gmkhedissf", pINFO) << "Computing share " << gOptIJob << " of " << gOptNJobs;
+  }
+}
+//____________________________________________________________________________
 void PrintSyntax(void)
 {
   LOG("gmkhedissf", pNOTICE)
     << "\n\n" << "Syntax:" << "\n"
     << "\n      gmkhedissf [-h]"
     << "\n                  --tune genie_tune"
+    << "\n                 [-j n_workers]"
+    << "\n                 [--split job/n_jobs]"
     << "\n                  --message-thresholds xml_file"
     << "\n";
 }
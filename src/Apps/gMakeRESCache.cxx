@@ -0,0 +1,228 @@
+//____________________________________________________________________________
+/*!
+
+\program gmkrescache
+
+\brief   Pre-computes the free-nucleon resonance production integrals cached
+         by the RES cross section integrators (ReinSehgalRESXSecWithCache,
+         ReinSehgalRESXSecWithCacheFast, SPPXSecWithCache) and writes them
+         in a read-only cache store. Can also merge cache stores.
+
+         Event generation and spline building jobs can read the store with
+         the --cache-store option, so that resonance production integrals
+         are not computed at runtime. The cache branch keys include a digest
+         of the configuration of the integrator and of the cross section
+         model, so only integrals computed with the current configuration
+         are used. They do not include the spline knot settings: the cached
+         integrals are splines, which can be used by jobs with any knots.
+         Any number of jobs can read a store concurrently.
+
+         Syntax :
+           gmkrescache -p nu_pdg_codes -o store_file
+                       [--merge store_files]
+                       [--event-generator-list list_name]
+                       [--tune tune_name]
+                       [--xml-path path]
+                       [--message-thresholds xml_file]
+
+         Options :
+           -p
+              A comma separated list of neutrino PDG codes.
+              Not needed in merge mode.
+           -o
+              Name of the output cache store (ROOT file).
+              An existing store is replaced. Only one job at a time can
+              write a given store.
+           --merge
+              A comma separated list of cache stores to merge into the
+              output store. No integral is computed in this mode.
+           --event-generator-list
+              List of event generators to load (see RunOpt).
+              [default: "Default"]
+           --tune
+              GENIE comprehensive neutrino interaction model tune.
+              [default: "Default"]
+
+         Examples :
+           gmkrescache -p 14,-14,12,-12 --tune G18_10a_02_11b -o res.root
+           gmkrescache --merge numu.root,nue.root -o res.root
+
+\author  The GENIE Collaboration
+
+\created October 16, 2026
+
+\cpright Copyright (c) 2003-2023, The GENIE Collaboration
+         For the full text of the license visit http://copyright.genie-mc.org
+*/
+//____________________________________________________________________________
+
+#include <cstdlib>
+#include <string>
+#include <vector>
+
+#include "Framework/Conventions/Controls.h"
+#include "Framework/EventGen/EventGeneratorI.h"
+#include "Framework/EventGen/GEVGDriver.h"
+#include "Framework/EventGen/InteractionList.h"
+#include "Framework/EventGen/XSecAlgorithmI.h"
+#include "Framework/Interaction/Interaction.h"
+#include "Framework/Messenger/Messenger.h"
+#include "Framework/ParticleData/PDGCodes.h"
+#include "Framework/Utils/AppInit.h"
+#include "Framework/Utils/Cache.h"
+#include "Framework/Utils/CmdLnArgParser.h"
+#include "Framework/Utils/RunOpt.h"
+#include "Framework/Utils/StringUtils.h"
+
+using std::string;
+using std::vector;
+
+using namespace genie;
+
+// Prototypes:
+void GetCommandLineArgs (int argc, char ** argv);
+void PrintSyntax        (void);
+void CacheRESIntegrals  (int nu_pdg, int tgt_pdg);
+
+// User-specified options:
+vector<int>    gOptNuPdgCodes;
+vector<string> gOptMergeFiles;
+string         gOptOutFile = "";
+
+// The probe energy used to trigger the caching; the cached integrals cover
+// the full energy range of each integrator regardless of this value
+const double kTriggerEnergy = 10.; // GeV
+
+//____________________________________________________________________________
+int main(int argc, char ** argv)
+{
+  // Parse command line arguments
+  GetCommandLineArgs(argc,argv);
+
+  if ( ! RunOpt::Instance()->Tune() ) {
+    LOG("gmkrescache", pFATAL) << " No TuneId in RunOption";
+    exit(-1);
+  }
+  RunOpt::Instance()->BuildTune();
+
+  // Init
+  utils::app_init::MesgThresholds(RunOpt::Instance()->MesgThresholdFiles());
+
+  Cache * cache = Cache::Instance();
+
+  string tag = RunOpt::Instance()->Tune()->Name() + "/"
+             + RunOpt::Instance()->EventGeneratorList();
+
+  if( gOptMergeFiles.size() > 0 ) {
+    // Merge mode: read all the input stores (the first store wins for keys
+    // found in more than one store)
+    for(unsigned int i = 0; i < gOptMergeFiles.size(); i++) {
+      cache->ReadCacheStore(gOptMergeFiles[i]);
+    }
+    if(cache->CacheStoreTag().size() > 0) tag = cache->CacheStoreTag();
+  }
+  else {
+    // The free-nucleon integrals are only cached if this is enabled
+    RunOpt::Instance()->EnableBareXSecPreCalc(true);
+
+    for(unsigned int i = 0; i < gOptNuPdgCodes.size(); i++) {
+      CacheRESIntegrals(gOptNuPdgCodes[i], kPdgTgtFreeP);
+      CacheRESIntegrals(gOptNuPdgCodes[i], kPdgTgtFreeN);
+    }
+  }
+
+  LOG("gmkrescache", pNOTICE) << *cache;
+
+  if( ! cache->WriteCacheStore(gOptOutFile, tag) ) {
+    LOG("gmkrescache", pFATAL) << "Could not write cache store: " << gOptOutFile;
+    exit(1);
+  }
+
+  return 0;
+}
+//____________________________________________________________________________
+void CacheRESIntegrals(int nu_pdg, int tgt_pdg)
+{
+  LOG("gmkrescache", pNOTICE)
+     << "Caching RES integrals for probe: " << nu_pdg
+     << ", target: " << tgt_pdg;
+
+  InitialState init_state(tgt_pdg, nu_pdg);
+
+  GEVGDriver driver;
+  driver.SetEventGeneratorList(RunOpt::Instance()->EventGeneratorList());
+  driver.Configure(init_state);
+
+  // Integrating one interaction per integrator, model and process fills
+  // the corresponding cache branches
+  const InteractionList * ilst = driver.Interactions();
+  InteractionList::const_iterator it = ilst->begin();
+  for( ; it != ilst->end(); ++it) {
+    if( ! (*it)->ProcInfo().IsResonant() ) continue;
+
+    Interaction interaction(**it);
+    interaction.InitStatePtr()->SetProbeE(kTriggerEnergy);
+
+    const EventGeneratorI * evgen = driver.FindGenerator(&interaction);
+    if(!evgen) continue;
+    const XSecAlgorithmI * xsec_alg = evgen->CrossSectionAlg();
+    if(!xsec_alg) continue;
+
+    double xsec = xsec_alg->Integral(&interaction);
+    LOG("gmkrescache", pINFO)
+       << "XSec[" << interaction.AsString() << "] (E = "
+       << kTriggerEnergy << " GeV) = " << xsec;
+  }
+}
+//____________________________________________________________________________
+void GetCommandLineArgs(int argc, char ** argv)
+{
+  LOG("gmkrescache", pINFO) << "Parsing command line arguments";
+
+  // Common run options. Set defaults and read.
+  RunOpt::Instance()->EnableBareXSecPreCalc(true);
+  RunOpt::Instance()->ReadFromCommandLine(argc,argv);
+
+  CmdLnArgParser parser(argc,argv);
+
+  // output store
+  if( parser.OptionExists('o') ) {
+    gOptOutFile = parser.ArgAsString('o');
+  } else {
+    LOG("gmkrescache", pFATAL) << "Unspecified output cache store";
+    PrintSyntax();
+    exit(1);
+  }
+
+  // stores to merge
+  if( parser.OptionExists("merge") ) {
+    gOptMergeFiles = utils::str::Split(parser.ArgAsString("merge"), ",");
+  }
+
+  // neutrino PDG codes
+  if( parser.OptionExists('p') ) {
+    vector<string> nuvec = utils::str::Split(parser.ArgAsString('p'), ",");
+    vector<string>::const_iterator iter;
+    for(iter = nuvec.begin(); iter != nuvec.end(); ++iter) {
+      gOptNuPdgCodes.push_back( atoi(iter->c_str()) );
+    }
+  }
+
+  if( gOptMergeFiles.size() == 0 && gOptNuPdgCodes.size() == 0 ) {
+    LOG("gmkrescache", pFATAL)
+      << "Specify either neutrino PDG codes or cache stores to merge";
+    PrintSyntax();
+    exit(1);
+  }
+}
+//____________________________________________________________________________
+void PrintSyntax(void)
+{
+  LOG("gmkrescache", pNOTICE)
+    << "\n\n" << "Syntax:" << "\n"
+    << "   gmkrescache -p nu_pdg_codes -o store_file"
+    << "\n               [--merge store_files]"
+    << RunOpt::RunOptSyntaxString(false)
+    << "\n";
+}
+//____________________________________________________________________________
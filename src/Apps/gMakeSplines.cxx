@@ -16,6 +16,7 @@
                   <-o | --output-cross-sections> xsec_xml_file_name
                   [-n nknots]
                   [-e max_energy]
+                  [-j n_workers]
                   [--no-copy]
                   [--seed seed_number]
                   [--input-cross-sections xml_file]
@@ -51,8 +52,16 @@
                Maximum energy in spline.
                Default: The max energy in the validity range of the spline
                generating thread.
+           -j
+               Number of processes computing the knots of each spline.
+               Default: 1
            --no-copy
                Does not write out the input cross-sections in the output file
+           --no-warm-start
+               Does not reuse the adapted VEGAS grids between integrals (only
+               relevant for integrators configured to use VEGAS). The total
+               time and the number of warm-started integrals are printed at
+               the end of the job, for benchmarking.
            --seed
               Random number seed.
            --input-cross-sections
@@ -88,6 +97,7 @@
 
 #include <cassert>
 #include <cstdlib>
+#include <sstream>
 #include <string>
 #include <vector>
 
@@ -96,6 +106,7 @@
 #endif
 
 #include <TSystem.h>
+#include <TStopwatch.h>
 
 #include "Framework/Conventions/GBuild.h"
 #include "Framework/EventGen/GEVGDriver.h"
@@ -105,11 +116,13 @@
 #include "Framework/ParticleData/PDGCodeList.h"
 #include "Framework/Utils/RunOpt.h"
 #include "Framework/Utils/AppInit.h"
+#include "Framework/Utils/Cache.h"
 #include "Framework/Utils/StringUtils.h"
 //#include "Framework/Utils/SystemUtils.h"
 #include "Framework/Utils/PrintUtils.h"
 #include "Framework/Utils/XSecSplineList.h"
 #include "Framework/Utils/CmdLnArgParser.h"
+#include "Physics/XSectionIntegration/XSecIntegrationContext.h"
 
 #ifdef __GENIE_GEOM_DRIVERS_ENABLED__
 #include "Tools/Geometry/ROOTGeomAnalyzer.h"
@@ -136,7 +149,9 @@ string   gOptTgtPdgCodeList = "";
 string   gOptGeomFilename   = "";
 int      gOptNKnots         = -1;
 double   gOptMaxE           = -1.;
+int      gOptNWorkers       =  1;
 bool     gOptNoCopy         = false;
+bool     gOptNoWarmStart    = false;
 long int gOptRanSeed        = -1;   // random number seed
 string   gOptInpXSecFile    = "";   // input cross-section file
 string   gOptOutXSecFile    = "";   // output cross-section file
@@ -182,6 +197,12 @@ int main(int argc, char ** argv)
   LOG("gmkspl", pINFO) << "Neutrinos: " << *neutrinos;
   LOG("gmkspl", pINFO) << "Targets: "   << *targets;
 
+  XSecSplineList::Instance()->SetNWorkers(gOptNWorkers);
+  XSecIntegrationContext::Instance()->SetWarmStart(!gOptNoWarmStart);
+
+  TStopwatch timer;
+  timer.Start();
+
   // Loop over all possible input init states and ask the GEVGDriver
   // to build splines for all the interactions that its loaded list
   // of event generators can generate.
@@ -200,6 +221,16 @@ int main(int argc, char ** argv)
     }
   }
 
+  timer.Stop();
+  LOG("gmkspl", pNOTICE)
+    << "Computed all splines in " << timer.RealTime() << " s (real), "
+    << timer.CpuTime() << " s (cpu)";
+  LOG("gmkspl", pNOTICE) << *XSecIntegrationContext::Instance();
+
+  std::ostringstream cache_stats;
+  Cache::Instance()->PrintStats(cache_stats);
+  LOG("gmkspl", pNOTICE) << cache_stats.str();
+
   // Save the splines at the requested XML file
   XSecSplineList * xspl = XSecSplineList::Instance();
   bool save_init = !gOptNoCopy;
@@ -259,12 +290,26 @@ void GetCommandLineArgs(int argc, char ** argv)
     gOptMaxE = -1;
   }
 
+  // number of processes computing the spline knots
+  if( parser.OptionExists('j') ) {
+    LOG("gmkspl", pINFO) << "Reading number of workers";
+    gOptNWorkers = parser.ArgAsInt('j');
+  } else {
+    gOptNWorkers = 1;
+  }
+
   // write out input splines?
   if( parser.OptionExists("no-copy") ) {
     LOG("gmkspl", pINFO) << "Not copying input splines to output";
     gOptNoCopy = true;
   }
 
+  // reuse the adapted integration grids?
+  if( parser.OptionExists("no-warm-start") ) {
+    LOG("gmkspl", pINFO) << "Not reusing adapted integration grids";
+    gOptNoWarmStart = true;
+  }
+
   // comma-separated neutrino PDG code list
   if( parser.OptionExists('p') ) {
     LOG("gmkspl", pINFO) << "Reading neutrino PDG codes";
@@ -355,7 +400,9 @@ void PrintSyntax(void)
     << "\n    <-o | --output-cross-sections> xsec_xml_file_name"
     << "\n    [-n nknots]"
     << "\n    [-e max_energy]"
+    << "\n    [-j n_workers]"
     << "\n    [--no-copy]"
+    << "\n    [--no-warm-start]"
     << "\n    [--seed seed_number]"
     << "\n    [--input-cross-sections xml_file]"
     << RunOpt::RunOptSyntaxString(false)
@@ -8,7 +8,7 @@
 
          Syntax:
            gntpc -i input_file [-o output_file] -f format [-n nev] [-v vrs] [-c] 
-                 [--seed random_number_seed]
+                 [-j n_workers] [--seed random_number_seed]
                  [--message-thresholds xml_file]
                  [--event-record-print-level level]
 
@@ -25,6 +25,11 @@
               (optional, default: use latest version of each format)
            -c 
               Copy MC job metadata (gconfig and genv TFolders) from the input GHEP file.
+           -j
+              Number of worker processes (optional, default: 1).
+              The input entries are split in contiguous ranges, converted in
+              parallel into temporary part files, which are then merged (in
+              order) into the requested output file. Not available for `ghad'.
            -f 
               A string that specifies the output file format. 
               >>
@@ -70,6 +75,13 @@
 	             A summary ntuple for intranuclear-rescattering studies using simulated
                      hadron-nucleus samples
               >>
+	      >> Event index formats:
+              >>
+   	       * `gidx': 
+	             The event topology index (see NtpTopoSummary): process flags,
+                     final state hadron counts, neutrino energy and target for each
+                     event. Used by gevpick to read only the selected events.
+              >>
 	      >> Other (depreciated) formats:
               >>
    	       * `nuance_tracker': 
@@ -89,6 +101,7 @@
                `nuance_tracker'       -> *.gtrac_legacy.dat
                `ghad'                 -> *.ghad.dat
                `ginuke'               -> *.ginuke.root
+               `gidx'                 -> *.gidx.root
            --seed
               Random number seed.
          --message-thresholds
@@ -118,6 +131,7 @@
 //_____________________________________________________________________________________________
 
 #include <cassert>
+#include <cstdio>
 #include <string>
 #include <sstream>
 #include <fstream>
@@ -125,12 +139,17 @@
 #include <vector>
 #include <algorithm>
 
+#include <unistd.h>
+#include <sys/wait.h>
+
 #include "libxml/parser.h"
 #include "libxml/xmlmemory.h"
 
 #include <TSystem.h>
 #include <TFile.h>
 #include <TTree.h>
+#include <TChain.h>
+#include <TKey.h>
 #include <TFolder.h>
 #include <TBits.h>
 #include <TObjString.h>
@@ -148,6 +167,9 @@
 #include "Framework/Ntuple/NtpMCTreeHeader.h"
 #include "Framework/Ntuple/NtpMCEventRecord.h"
 #include "Framework/Ntuple/NtpWriter.h"
+#include "Framework/Ntuple/NtpGSTOutput.h"
+#include "Framework/Ntuple/NtpRooTrackerOutput.h"
+#include "Framework/Ntuple/NtpTopoSummary.h"
 #include "Framework/Numerical/RandomGen.h"
 #include "Framework/Messenger/Messenger.h"
 #include "Framework/ParticleData/PDGCodes.h"
@@ -185,13 +207,21 @@ using namespace genie;
 using namespace genie::constants;
 
 //func prototypes
-void   ConvertToGST              (void);
-void   ConvertToGXML             (void);
-void   ConvertToGHepMock         (void);
-void   ConvertToGTracker         (void);
-void   ConvertToGRooTracker      (void);
-void   ConvertToGHad             (void);
-void   ConvertToGINuke           (void);
+bool   ConvertToGST              (void);
+bool   ConvertToGXML             (void);
+bool   ConvertToGHepMock         (void);
+bool   ConvertToGTracker         (void);
+bool   ConvertToGRooTracker      (void);
+bool   ConvertToGHad             (void);
+bool   ConvertToGINuke           (void);
+bool   ConvertToGIdx             (void);
+bool   Convert                   (void);
+void   ConvertInParallel         (void);
+void   MergeROOTParts            (const vector<string> & parts);
+void   MergeTextParts            (const vector<string> & parts);
+Long64_t EntryRange              (TTree * tree, Long64_t & first);
+bool   IsFirstPart               (void);
+bool   IsLastPart                (void);
 void   GetCommandLineArgs        (int argc, char ** argv);
 void   PrintSyntax               (void);
 string DefaultOutputFile         (void);
@@ -215,7 +245,8 @@ typedef enum EGNtpcFmt {
   kConvFmt_t2k_tracker,
   kConvFmt_nuance_tracker,
   kConvFmt_ghad,
-  kConvFmt_ginuke
+  kConvFmt_ginuke,
+  kConvFmt_gidx
 } GNtpcFmt_t;
 
 //input options (from command line arguments):
@@ -226,6 +257,12 @@ int        gOptVersion;             ///< output file format version
 Long64_t   gOptN;                   ///< number of events to process
 bool       gOptCopyJobMeta = false; ///< copy MC job metadata (gconfig, genv TFolders)
 long int   gOptRanSeed;             ///< random number seed
+int        gOptNWorkers = 1;        ///< number of worker processes
+
+//entry range converted by this process (set for gntpc -j workers only)
+int        gWorkerId    = -1;       ///< worker id (-1: not a worker)
+Long64_t   gWorkerFirst =  0;       ///< first entry
+Long64_t   gWorkerLast  = -1;       ///< last entry + 1
 
 //genie version used to generate the input event file 
 int gFileMajorVrs = -1;
@@ -245,48 +282,56 @@ int main(int argc, char ** argv)
   GHepRecord::SetPrintLevel(RunOpt::Instance()->EventRecordPrintLevel());
 
   PDGLibrary::Instance()->AddDarkMatter( 1.0, 0.5 ) ;
-  
-  // Call the appropriate conversion function
+
+  if(gOptNWorkers > 1) {
+    ConvertInParallel();
+  } else {
+    Convert();
+  }
+  return 0;
+}
+//____________________________________________________________________________________
+bool Convert(void)
+{
+  // Call the appropriate conversion function. Returns false if the
+  // conversion failed.
   switch(gOptOutFileFormat) {
 
    case (kConvFmt_gst)  :
 
-	ConvertToGST();        
-	break;  
+	return ConvertToGST();
 
    case (kConvFmt_gxml) :  
 
-	ConvertToGXML();         
-	break;
+	return ConvertToGXML();
 
    case (kConvFmt_ghep_mock_data) :  
 
-	ConvertToGHepMock();         
-	break;
+	return ConvertToGHepMock();
 
    case (kConvFmt_rootracker          ) :  
    case (kConvFmt_rootracker_mock_data) :  
    case (kConvFmt_t2k_rootracker      ) :  
    case (kConvFmt_numi_rootracker     ) :  
 
-	ConvertToGRooTracker(); 
-	break;
+	return ConvertToGRooTracker();
 
    case (kConvFmt_t2k_tracker   )  :  
    case (kConvFmt_nuance_tracker)  :  
 
-	ConvertToGTracker();        
-	break;
+	return ConvertToGTracker();
 
    case (kConvFmt_ghad) :  
 
-	ConvertToGHad();         
-	break;
+	return ConvertToGHad();
 
    case (kConvFmt_ginuke) :  
 
-	ConvertToGINuke();         
-	break;
+	return ConvertToGINuke();
+
+   case (kConvFmt_gidx) :  
+
+	return ConvertToGIdx();
 
    default:
      LOG("gntpc", pFATAL)
@@ -295,232 +340,23 @@ int main(int argc, char ** argv)
      gAbortingInErr = true;
      exit(3);
   }
-  return 0;
 }
 //____________________________________________________________________________________
 // GENIE GHEP EVENT TREE FORMAT -> GENIE SUMMARY NTUPLE 
 //____________________________________________________________________________________
-void ConvertToGST(void)
+bool ConvertToGST(void)
 {
-  // Some constants
-  const double e_h = 1.3; // typical e/h ratio used for computing mean `calorimetric response'
+// The gst columns are computed by NtpGSTOutput, which also writes the gst
+// tree directly from the event generation apps (--ntp-outputs gst)
 
-  // Define branch variables
-  //
-  int    brIev         = 0;      // Event number 
-  int    brNeutrino    = 0;      // Neutrino pdg code
-  int    brFSPrimLept  = 0;      // Final state primary lepton pdg code
-  int    brTarget      = 0;      // Nuclear target pdg code (10LZZZAAAI)
-  int    brTargetZ     = 0;      // Nuclear target Z (extracted from pdg code above)
-  int    brTargetA     = 0;      // Nuclear target A (extracted from pdg code above)
-  int    brHitNuc      = 0;      // Hit nucleon pdg code      (not set for COH,IMD and NuEL events)
-  int    brHitQrk      = 0;      // Hit quark pdg code        (set for DIS events only)
-  bool   brFromSea     = false;  // Hit quark is from sea     (set for DIS events only)
-  int    brResId       = 0;      // Produced baryon resonance (set for resonance events only)
-  bool   brIsQel       = false;  // Is QEL?
-  bool   brIsRes       = false;  // Is RES?
-  bool   brIsDis       = false;  // Is DIS?
-  bool   brIsCoh       = false;  // Is Coherent?
-  bool   brIsMec       = false;  // Is MEC?
-  bool   brIsDfr       = false;  // Is Diffractive?
-  bool   brIsImd       = false;  // Is IMD?
-  bool   brIsNrm       = false;  // Is Norm?
-  bool   brIsSingleK   = false;  // Is single kaon?  
-  bool   brIsImdAnh    = false;  // Is IMD annihilation?
-  bool   brIsNuEL      = false;  // Is ve elastic?
-  bool   brIsEM        = false;  // Is EM process?
-  bool   brIsCC        = false;  // Is Weak CC process?
-  bool   brIsNC        = false;  // Is Weak NC process?
-  bool   brIsCharmPro  = false;  // Produces charm?
-  bool   brIsAMNuGamma = false;  // is anomaly mediated nu gamma
-  bool   brIsHNL       = false;  // is HNL decay?
-  int    brCodeNeut    = 0;      // The equivalent NEUT reaction code (if any)
-  int    brCodeNuance  = 0;      // The equivalent NUANCE reaction code (if any)
-  double brWeight      = 0;      // Event weight
-  double brKineXs      = 0;      // Bjorken x as was generated during kinematical selection; takes fermi momentum / off-shellness into account
-  double brKineYs      = 0;      // Inelasticity y as was generated during kinematical selection; takes fermi momentum / off-shellness into account
-  double brKineTs      = 0;      // Energy transfer to nucleus at COH events as was generated during kinematical selection
-  double brKineQ2s     = 0;      // Momentum transfer Q^2 as was generated during kinematical selection; takes fermi momentum / off-shellness into account
-  double brKineWs      = 0;      // Hadronic invariant mass W as was generated during kinematical selection; takes fermi momentum / off-shellness into account
-  double brKineX       = 0;      // Experimental-like Bjorken x; neglects fermi momentum / off-shellness 
-  double brKineY       = 0;      // Experimental-like inelasticity y; neglects fermi momentum / off-shellness 
-  double brKineT       = 0;      // Experimental-like energy transfer to nucleus at COH events 
-  double brKineQ2      = 0;      // Experimental-like momentum transfer Q^2; neglects fermi momentum / off-shellness
-  double brKineW       = 0;      // Experimental-like hadronic invariant mass W; neglects fermi momentum / off-shellness 
-  double brEvRF        = 0;      // Neutrino energy @ the rest-frame of the hit-object (eg nucleon for CCQE, e- for ve- elastic,...)
-  double brEv          = 0;      // Neutrino energy @ LAB
-  double brPxv         = 0;      // Neutrino px @ LAB
-  double brPyv         = 0;      // Neutrino py @ LAB
-  double brPzv         = 0;      // Neutrino pz @ LAB
-  double brEn          = 0;      // Initial state hit nucleon energy @ LAB
-  double brPxn         = 0;      // Initial state hit nucleon px @ LAB
-  double brPyn         = 0;      // Initial state hit nucleon py @ LAB
-  double brPzn         = 0;      // Initial state hit nucleon pz @ LAB
-  double brEl          = 0;      // Final state primary lepton energy @ LAB
-  double brPxl         = 0;      // Final state primary lepton px @ LAB
-  double brPyl         = 0;      // Final state primary lepton py @ LAB
-  double brPzl         = 0;      // Final state primary lepton pz @ LAB
-  double brPl          = 0;      // Final state primary lepton p  @ LAB
-  double brCosthl      = 0;      // Final state primary lepton cos(theta) wrt to neutrino direction
-  int    brNfP         = 0;      // Nu. of final state p's + \bar{p}'s (after intranuclear rescattering)
-  int    brNfN         = 0;      // Nu. of final state n's + \bar{n}'s
-  int    brNfPip       = 0;      // Nu. of final state pi+'s
-  int    brNfPim       = 0;      // Nu. of final state pi-'s
-  int    brNfPi0       = 0;      // Nu. of final state pi0's (
-  int    brNfKp        = 0;      // Nu. of final state K+'s
-  int    brNfKm        = 0;      // Nu. of final state K-'s
-  int    brNfK0        = 0;      // Nu. of final state K0's + \bar{K0}'s
-  int    brNfEM        = 0;      // Nu. of final state gammas and e-/e+ 
-  int    brNfOther     = 0;      // Nu. of heavier final state hadrons (D+/-,D0,Ds+/-,Lamda,Sigma,Lamda_c,Sigma_c,...)
-  int    brNiP         = 0;      // Nu. of `primary' (: before intranuclear rescattering) p's + \bar{p}'s  
-  int    brNiN         = 0;      // Nu. of `primary' n's + \bar{n}'s  
-  int    brNiPip       = 0;      // Nu. of `primary' pi+'s 
-  int    brNiPim       = 0;      // Nu. of `primary' pi-'s 
-  int    brNiPi0       = 0;      // Nu. of `primary' pi0's 
-  int    brNiKp        = 0;      // Nu. of `primary' K+'s  
-  int    brNiKm        = 0;      // Nu. of `primary' K-'s  
-  int    brNiK0        = 0;      // Nu. of `primary' K0's + \bar{K0}'s 
-  int    brNiEM        = 0;      // Nu. of `primary' gammas and e-/e+ 
-  int    brNiOther     = 0;      // Nu. of other `primary' hadron shower particles
-  int    brNf          = 0;      // Nu. of final state particles in hadronic system
-  int    brPdgf  [kNPmax];       // Pdg code of k^th final state particle in hadronic system
-  double brEf    [kNPmax];       // Energy     of k^th final state particle in hadronic system @ LAB
-  double brPxf   [kNPmax];       // Px         of k^th final state particle in hadronic system @ LAB
-  double brPyf   [kNPmax];       // Py         of k^th final state particle in hadronic system @ LAB
-  double brPzf   [kNPmax];       // Pz         of k^th final state particle in hadronic system @ LAB
-  double brPf    [kNPmax];       // P          of k^th final state particle in hadronic system @ LAB
-  double brCosthf[kNPmax];       // cos(theta) of k^th final state particle in hadronic system @ LAB wrt to neutrino direction
-  int    brNi          = 0;      // Nu. of particles in 'primary' hadronic system (before intranuclear rescattering)
-  int    brPdgi[kNPmax];         // Pdg code of k^th particle in 'primary' hadronic system 
-  int    brResc[kNPmax];         // FSI code of k^th particle in 'primary' hadronic system 
-  double brEi  [kNPmax];         // Energy   of k^th particle in 'primary' hadronic system @ LAB
-  double brPxi [kNPmax];         // Px       of k^th particle in 'primary' hadronic system @ LAB
-  double brPyi [kNPmax];         // Py       of k^th particle in 'primary' hadronic system @ LAB
-  double brPzi [kNPmax];         // Pz       of k^th particle in 'primary' hadronic system @ LAB
-  double brVtxX;                 // Vertex x in detector coord system (SI)
-  double brVtxY;                 // Vertex y in detector coord system (SI)
-  double brVtxZ;                 // Vertex z in detector coord system (SI)
-  double brVtxT;                 // Vertex t in detector coord system (SI)
-  double brSumKEf;               // Sum of kinetic energies of all final state particles
-  double brCalResp0;             // Approximate calorimetric response to the hadronic system computed as sum of
-				 //  - (kinetic energy) for pi+, pi-, p, n 
-                                 //  - (energy + 2*mass) for antiproton, antineutron
-                                 //  - ((e/h) * energy)   for pi0, gamma, e-, e+, where e/h is set to 1.3
-                                 //  - (kinetic energy) for other particles
-
-  Double_t  brXSec;              // the event cross section in 1E-38cm^2
-  Double_t  brDXSec;             // is the differential cross section for the selected in 1E-38cm^2/{K^n}
-  UInt_t    brKPS;               // phase space that the xsec has been evaluated into
-                              
-  // Open output file & create output summary tree & create the tree branches
+  // Open output file & create output summary tree
   //
   LOG("gntpc", pNOTICE) 
        << "*** Saving summary tree to: " << gOptOutFileName;
   TFile fout(gOptOutFileName.c_str(),"recreate");
 
-  TTree * s_tree = new TTree("gst","GENIE Summary Event Tree");
-
-  // Create tree branches
-  //
-  s_tree->Branch("iev",           &brIev,           "iev/I"         );
-  s_tree->Branch("neu",	          &brNeutrino,      "neu/I"	    );
-  s_tree->Branch("fspl",	  &brFSPrimLept,    "fspl/I"	    );
-  s_tree->Branch("tgt",           &brTarget,        "tgt/I"	    );
-  s_tree->Branch("Z",             &brTargetZ,       "Z/I"	    );
-  s_tree->Branch("A",             &brTargetA,       "A/I"	    );
-  s_tree->Branch("hitnuc",        &brHitNuc,        "hitnuc/I"      );
-  s_tree->Branch("hitqrk",        &brHitQrk,        "hitqrk/I"      );
-  s_tree->Branch("resid",         &brResId,	    "resid/I"	    );
-  s_tree->Branch("sea",	          &brFromSea,       "sea/O"	    );
-  s_tree->Branch("qel",	          &brIsQel,	    "qel/O"	    );
-  s_tree->Branch("mec",	          &brIsMec,	    "mec/O"	    );
-  s_tree->Branch("res",	          &brIsRes,	    "res/O"	    );
-  s_tree->Branch("dis",	          &brIsDis,	    "dis/O"	    );
-  s_tree->Branch("coh",           &brIsCoh,         "coh/O"	    );
-  s_tree->Branch("dfr",           &brIsDfr,         "dfr/O"	    );
-  s_tree->Branch("imd",	          &brIsImd,	    "imd/O"	    );
-  s_tree->Branch("norm",          &brIsNrm,         "norm/O"	    );
-  s_tree->Branch("imdanh",        &brIsImdAnh,	    "imdanh/O"	    );
-  s_tree->Branch("singlek",       &brIsSingleK,     "singlek/O"     );  
-  s_tree->Branch("nuel",          &brIsNuEL,        "nuel/O"	    );
-  s_tree->Branch("em",	          &brIsEM,	    "em/O"	    );
-  s_tree->Branch("cc",	          &brIsCC,	    "cc/O"	    );
-  s_tree->Branch("nc",	          &brIsNC,	    "nc/O"	    );
-  s_tree->Branch("charm",         &brIsCharmPro,    "charm/O"	    );
-  s_tree->Branch("amnugamma",     &brIsAMNuGamma,   "amnugamma/O"   );
-  s_tree->Branch("hnl",           &brIsHNL,         "hnl/O"         );
-  s_tree->Branch("neut_code",     &brCodeNeut,      "neut_code/I"   );
-  s_tree->Branch("nuance_code",   &brCodeNuance,    "nuance_code/I" );
-  s_tree->Branch("wght",          &brWeight,        "wght/D"	    );
-  s_tree->Branch("xs",	          &brKineXs,        "xs/D"	    );
-  s_tree->Branch("ys",	          &brKineYs,        "ys/D"	    );
-  s_tree->Branch("ts",	          &brKineTs,        "ts/D"	    );
-  s_tree->Branch("Q2s",	          &brKineQ2s,       "Q2s/D"	    );
-  s_tree->Branch("Ws",	          &brKineWs,        "Ws/D"	    );
-  s_tree->Branch("x",	          &brKineX,	    "x/D"	    );
-  s_tree->Branch("y",	          &brKineY,	    "y/D"	    );
-  s_tree->Branch("t",	          &brKineT,	    "t/D"	    );
-  s_tree->Branch("Q2",	          &brKineQ2,        "Q2/D"	    );
-  s_tree->Branch("W",	          &brKineW,	    "W/D"	    );
-  s_tree->Branch("EvRF",	      &brEvRF,	    "EvRF/D"	    );
-  s_tree->Branch("Ev",	          &brEv,	    "Ev/D"	    );
-  s_tree->Branch("pxv",	          &brPxv,	    "pxv/D"	    );
-  s_tree->Branch("pyv",	          &brPyv,	    "pyv/D"	    );
-  s_tree->Branch("pzv",	          &brPzv,	    "pzv/D"	    );
-  s_tree->Branch("En",	          &brEn,	    "En/D"	    );
-  s_tree->Branch("pxn",	          &brPxn,	    "pxn/D"	    );
-  s_tree->Branch("pyn",	          &brPyn,	    "pyn/D"	    );
-  s_tree->Branch("pzn",	          &brPzn,	    "pzn/D"	    );
-  s_tree->Branch("El",	          &brEl,	    "El/D"	    );
-  s_tree->Branch("pxl",	          &brPxl,	    "pxl/D"	    );
-  s_tree->Branch("pyl",	          &brPyl,	    "pyl/D"	    );
-  s_tree->Branch("pzl",	          &brPzl,	    "pzl/D"	    );
-  s_tree->Branch("pl",            &brPl,            "pl/D"          );
-  s_tree->Branch("cthl",          &brCosthl,        "cthl/D"        );
-  s_tree->Branch("nfp",	          &brNfP,	    "nfp/I"	    );
-  s_tree->Branch("nfn",	          &brNfN,	    "nfn/I"	    );
-  s_tree->Branch("nfpip",         &brNfPip,	    "nfpip/I"	    );
-  s_tree->Branch("nfpim",         &brNfPim,	    "nfpim/I"	    );
-  s_tree->Branch("nfpi0",         &brNfPi0,	    "nfpi0/I"	    );
-  s_tree->Branch("nfkp",          &brNfKp,	    "nfkp/I"	    );
-  s_tree->Branch("nfkm",          &brNfKm,	    "nfkm/I"	    );
-  s_tree->Branch("nfk0",          &brNfK0,	    "nfk0/I"	    );
-  s_tree->Branch("nfem",          &brNfEM,	    "nfem/I"	    );
-  s_tree->Branch("nfother",       &brNfOther,       "nfother/I"     );
-  s_tree->Branch("nip",	          &brNiP,	    "nip/I"	    );
-  s_tree->Branch("nin",	          &brNiN,	    "nin/I"	    );
-  s_tree->Branch("nipip",         &brNiPip,	    "nipip/I"	    );
-  s_tree->Branch("nipim",         &brNiPim,	    "nipim/I"	    );
-  s_tree->Branch("nipi0",         &brNiPi0,	    "nipi0/I"	    );
-  s_tree->Branch("nikp",          &brNiKp,	    "nikp/I"	    );
-  s_tree->Branch("nikm",          &brNiKm,	    "nikm/I"	    );
-  s_tree->Branch("nik0",          &brNiK0,	    "nik0/I"	    );
-  s_tree->Branch("niem",          &brNiEM,	    "niem/I"	    );
-  s_tree->Branch("niother",       &brNiOther,       "niother/I"     );
-  s_tree->Branch("ni",	         &brNi,	            "ni/I"	    );
-  s_tree->Branch("pdgi",          brPdgi,	    "pdgi[ni]/I"   );
-  s_tree->Branch("resc",          brResc,	    "resc[ni]/I"   );
-  s_tree->Branch("Ei",	          brEi,	            "Ei[ni]/D"      );
-  s_tree->Branch("pxi",	          brPxi,	    "pxi[ni]/D"     );
-  s_tree->Branch("pyi",	          brPyi,	    "pyi[ni]/D"     );
-  s_tree->Branch("pzi",	          brPzi,	    "pzi[ni]/D"     );
-  s_tree->Branch("nf",	         &brNf,	            "nf/I"	    );
-  s_tree->Branch("pdgf",          brPdgf,	    "pdgf[nf]/I"   );
-  s_tree->Branch("Ef",	          brEf,	            "Ef[nf]/D"      );
-  s_tree->Branch("pxf",	          brPxf,	    "pxf[nf]/D"     );
-  s_tree->Branch("pyf",	          brPyf,	    "pyf[nf]/D"     );
-  s_tree->Branch("pzf",	          brPzf,	    "pzf[nf]/D"     );
-  s_tree->Branch("pf",            brPf,             "pf[nf]/D"      );
-  s_tree->Branch("cthf",          brCosthf,         "cthf[nf]/D"    );
-  s_tree->Branch("vtxx",         &brVtxX,	    "vtxx/D"        );
-  s_tree->Branch("vtxy",         &brVtxY,	    "vtxy/D"        );
-  s_tree->Branch("vtxz",         &brVtxZ,	    "vtxz/D"        );
-  s_tree->Branch("vtxt",         &brVtxT,	    "vtxt/D"        );
-  s_tree->Branch("sumKEf",       &brSumKEf,	    "sumKEf/D"      );
-  s_tree->Branch("calresp0",     &brCalResp0,	    "calresp0/D"    );
-  s_tree->Branch("XSec",         &brXSec,	    "XSec/D"    );
-  s_tree->Branch("DXSec",         &brDXSec,	    "DXSec/D"    );
-  s_tree->Branch("KPS",          &brKPS,	    "KPS/i"    );
+  NtpGSTOutput gst;
+  gst.Initialize();
 
   // Open the ROOT file and get the TTree & its header
   TFile fin(gOptInpFileName.c_str(),"READ");
@@ -530,7 +366,7 @@ void ConvertToGST(void)
   thdr    = dynamic_cast <NtpMCTreeHeader *> ( fin.Get("header") );
   if (!er_tree) {
     LOG("gntpc", pERROR) << "Null input GHEP event tree";
-    return;
+    return false;
   }
   LOG("gntpc", pINFO) << "Input tree header: " << *thdr;
 
@@ -539,23 +375,21 @@ void ConvertToGST(void)
   er_tree->SetBranchAddress("gmcrec", &mcrec);
   if (!mcrec) {
     LOG("gntpc", pERROR) << "Null MC record";
-    return;
+    return false;
   }
   
   // Figure out how many events to analyze
-  Long64_t nmax = (gOptN<0) ? 
-       er_tree->GetEntries() : TMath::Min( er_tree->GetEntries(), gOptN );
+  Long64_t iev0 = 0;
+  Long64_t nmax = EntryRange(er_tree, iev0);
   if (nmax<0) {
     LOG("gntpc", pERROR) << "Number of events = 0";
-    return;
+    return false;
   }
 
-  LOG("gntpc", pNOTICE) << "*** Analyzing: " << nmax << " events";
+  LOG("gntpc", pNOTICE) << "*** Analyzing: " << nmax-iev0 << " events";
 
-  TLorentzVector pdummy(0,0,0,0);
-    
   // Event loop
-  for(Long64_t iev = 0; iev < nmax; iev++) {
+  for(Long64_t iev = iev0; iev < nmax; iev++) {
     er_tree->GetEntry(iev);
 
     NtpMCRecHeader rec_header = mcrec->hdr;
@@ -564,567 +398,7 @@ void ConvertToGST(void)
     LOG("gntpc", pINFO) << rec_header;
     LOG("gntpc", pINFO) << event;
 
-    // Go further only if the event is physical
-    bool is_unphysical = event.IsUnphysical();
-    if(is_unphysical) {
-      LOG("gntpc", pINFO) << "Skipping unphysical event";
-      mcrec->Clear();
-      continue;
-    }
-
-    // Clean-up arrays
-    //
-    for(int j=0; j<kNPmax; j++) {
-       brPdgi   [j] =  0;     
-       brResc   [j] = -1;     
-       brEi     [j] =  0;     
-       brPxi    [j] =  0;     
-       brPyi    [j] =  0;     
-       brPzi    [j] =  0;     
-       brPdgf   [j] =  0;     
-       brEf     [j] =  0;     
-       brPxf    [j] =  0;     
-       brPyf    [j] =  0;     
-       brPzf    [j] =  0;     
-       brPf     [j] =  0;     
-       brCosthf [j] =  0;     
-    }
-
-    // Computing event characteristics
-    //
-
-    //input particles
-    GHepParticle * neutrino = event.Probe();
-    GHepParticle * target = event.Particle(1);
-    assert(target);
-    GHepParticle * fsl = event.FinalStatePrimaryLepton();
-    GHepParticle * hitnucl = event.HitNucleon();
-
-    if( neutrino ) { LOG("gntpc", pDEBUG) << "neutrino p4 = ( " 
-					  << neutrino->GetP4()->E() << ", "
-					  << neutrino->GetP4()->Px() << ", "
-					  << neutrino->GetP4()->Py() << ", "
-					  << neutrino->GetP4()->Pz() << " )"; }
-    if( target ) { LOG("gntpc", pDEBUG) << "target p4 = ( " 
-					  << target->GetP4()->E() << ", "
-					  << target->GetP4()->Px() << ", "
-					  << target->GetP4()->Py() << ", "
-					  << target->GetP4()->Pz() << " )"; }
-    if( fsl ) { LOG("gntpc", pDEBUG) << "fsl p4 = ( " 
-					  << fsl->GetP4()->E() << ", "
-					  << fsl->GetP4()->Px() << ", "
-					  << fsl->GetP4()->Py() << ", "
-					  << fsl->GetP4()->Pz() << " )"; }
-
-    if( hitnucl ) { LOG("gntpc", pDEBUG) << "hitnucl p4 = ( " 
-					  << hitnucl->GetP4()->E() << ", "
-					  << hitnucl->GetP4()->Px() << ", "
-					  << hitnucl->GetP4()->Py() << ", "
-					  << hitnucl->GetP4()->Pz() << " )"; }
-
-    int tgtZ = 0;
-    int tgtA = 0;
-    if(pdg::IsIon(target->Pdg())) {
-       tgtZ = pdg::IonPdgCodeToZ(target->Pdg());
-       tgtA = pdg::IonPdgCodeToA(target->Pdg());
-    } 
-    if(target->Pdg() == kPdgProton   ) { tgtZ = 1; tgtA = 1; }    
-    if(target->Pdg() == kPdgNeutron  ) { tgtZ = 0; tgtA = 1; }    
-  
-    // Summary info
-    const Interaction * interaction = event.Summary();
-    const InitialState & init_state = interaction->InitState();
-    const ProcessInfo &  proc_info  = interaction->ProcInfo();
-    const Kinematics &   kine       = interaction->Kine();
-    const XclsTag &      xcls       = interaction->ExclTag();
-    const Target &       tgt        = init_state.Tgt();
-
-    // Vertex in detector coord system
-    TLorentzVector * vtx = event.Vertex();
-
-    // Process id
-    bool is_qel    = proc_info.IsQuasiElastic();
-    bool is_res    = proc_info.IsResonant();
-    bool is_dis    = proc_info.IsDeepInelastic();
-    bool is_coh    = proc_info.IsCoherentProduction();
-    bool is_coh_el = proc_info.IsCoherentElastic();
-    bool is_dfr    = proc_info.IsDiffractive();
-    bool is_imd    = proc_info.IsInverseMuDecay();
-    bool is_imdanh = proc_info.IsIMDAnnihilation();
-    bool is_singlek = proc_info.IsSingleKaon();    
-    bool is_nuel      = proc_info.IsNuElectronElastic();
-    bool is_em        = proc_info.IsEM();
-    bool is_weakcc    = proc_info.IsWeakCC();
-    bool is_weaknc    = proc_info.IsWeakNC();
-    bool is_mec       = proc_info.IsMEC();
-    bool is_amnugamma = proc_info.IsAMNuGamma();
-    bool is_hnl       = proc_info.IsHNLDecay();
-    bool is_norm      = proc_info.IsNorm();
-    
-    if (!hitnucl && neutrino) {
-        assert(is_coh || is_imd || is_imdanh || is_nuel | is_amnugamma || is_coh_el || is_hnl || is_norm);
-    }
-  
-    // Hit quark - set only for DIS events
-    int  qrk  = (is_dis) ? tgt.HitQrkPdg() : 0;     
-    bool seaq = (is_dis) ? tgt.HitSeaQrk() : false; 
-
-    // Resonance id ($GENIE/src/BaryonResonance/BaryonResonance.h) -
-    // set only for resonance neutrinoproduction
-    int resid = (is_res) ? EResonance(xcls.Resonance()) : -99;
-
-    // (qel or dis) charm production?
-    bool charm = xcls.IsCharmEvent();
-
-    // Get NEUT and NUANCE equivalent reaction codes (if any)
-    brCodeNeut    = utils::ghep::NeutReactionCode(&event);
-    brCodeNuance  = utils::ghep::NuanceReactionCode(&event);
-
-    // Get event weight
-    double weight = event.Weight();
-
-    // Access kinematical params _exactly_ as they were selected internally
-    // (at the hit nucleon rest frame; 
-    // for bound nucleons: taking into account fermi momentum and off-shell kinematics)
-    //
-    bool get_selected = true;
-    double xs  = kine.x (get_selected);
-    double ys  = kine.y (get_selected);
-    double ts  = (is_coh || is_dfr || is_hnl) ? kine.t (get_selected) : -1;
-    double Q2s = kine.Q2(get_selected);
-    double Ws  = kine.W (get_selected);
-
-    LOG("gntpc", pDEBUG) 
-       << "[Select] Q2 = " << Q2s << ", W = " << Ws 
-       << ", x = " << xs << ", y = " << ys << ", t = " << ts;
-
-    // Calculate the same kinematical params but now as an experimentalist would 
-    // measure them by neglecting the fermi momentum and off-shellness of bound nucleons
-    //
-
-    const TLorentzVector & k1 = (neutrino) ? *(neutrino->P4()) : pdummy;  // v 4-p (k1)
-    const TLorentzVector & k2 = (fsl)      ? *(fsl->P4())      : pdummy;  // l 4-p (k2)
-    const TLorentzVector & p1 = (hitnucl)  ? *(hitnucl->P4())  : pdummy;  // N 4-p (p1)      
-
-    double M  = kNucleonMass; 
-    TLorentzVector q  = k1-k2;                     // q=k1-k2, 4-p transfer
-    double Q2 = -1 * q.M2();                       // momentum transfer
-    
-    double v  = (hitnucl) ? q.Energy()       : -1; // v (E transfer to the nucleus)
-    double x, y, W2, W;
-    if(!is_coh){ 
-    
-       x  = (hitnucl) ? 0.5*Q2/(M*v)     : -1; // Bjorken x
-       y  = (hitnucl) ? v/k1.Energy()    : -1; // Inelasticity, y = q*P1/k1*P1
-
-       W2 = (hitnucl) ? M*M + 2*M*v - Q2 : -1; // Hadronic Invariant mass ^ 2
-       W  = (hitnucl) ? TMath::Sqrt(W2)  : -1; 
-    } else if( is_hnl ) {
-      
-       x = -1;
-       y = -1;
-
-       LOG("gntpc", pDEBUG)
-	 << "Here is k1 = ( " << k1.E() << ", " << k1.Px() << ", " << k1.Py() << ", " << k1.Pz() << " )";
-
-       W2 = k1.M2(); // Invariant mass ^ 2 of HNL
-       W = TMath::Sqrt(W2);
-    } else{
-
-       v = q.Energy();
-       x  =  0.5*Q2/(M*v);      // Bjorken x
-       y  = v/k1.Energy();    // Inelasticity, y = q*P1/k1*P1
-
-       W2 = M*M + 2*M*v - Q2;  // Hadronic Invariant mass ^ 2
-       W  = TMath::Sqrt(W2); 
-
-    }
-  
-    double t  = (is_coh || is_dfr || is_hnl) ? kine.t (get_selected) : -1;
-
-    // Get v 4-p at hit nucleon rest-frame
-    TLorentzVector k1_rf = k1;         
-    if(hitnucl) {
-       k1_rf.Boost(-1.*p1.BoostVector());
-    }
-
-//    if(is_mec){
-//      v = q.Energy();
-//      x = 0.5*Q2/(M*v);
-//      y = v/k1.Energy();
-//      W2 = M*M + 2*M*v - Q2;
-//      W = TMath::Sqrt(W2);
-//    }
-
-    LOG("gntpc", pDEBUG) 
-       << "[Calc] Q2 = " << Q2 << ", W = " << W 
-       << ", x = " << x << ", y = " << y << ", t = " << t;
-
-    // Extract more info on the hadronic system
-    // Only for QEL/RES/DIS/COH/MEC events
-    // Edit: Add in HNL events
-    //
-    bool study_hadsyst = (is_qel || is_res || is_dis || is_coh || is_dfr || is_mec || is_singlek || is_hnl);
-    
-    //
-    TObjArrayIter piter(&event);
-    GHepParticle * p = 0;
-    int ip=-1;
-
-    //
-    // Extract the final state system originating from the hadronic vertex 
-    // (after the intranuclear rescattering step)
-    //
-
-    LOG("gntpc", pDEBUG) << "Extracting final state hadronic system";
-
-    vector<int> final_had_syst;
-    while( (p = (GHepParticle *) piter.Next()) && study_hadsyst)
-    {
-      ip++;
-      // don't count final state lepton as part hadronic system 
-      //if(!is_coh && event.Particle(ip)->FirstMother()==0) continue;
-      if(!is_hnl && event.Particle(ip)->FirstMother()==0) continue;
-      if(is_hnl && event.Particle(0)->FirstDaughter()==ip) continue;
-      if(pdg::IsPseudoParticle(p->Pdg())) continue;
-      int pdgc = p->Pdg();
-      int ist  = p->Status();
-      if(ist==kIStStableFinalState && !is_hnl) {
-         if (pdgc == kPdgGamma || pdgc == kPdgElectron || pdgc == kPdgPositron)  {
-            int igmom = p->FirstMother();
-            if(igmom!=-1) {
-	      final_had_syst.push_back(ip);
-            }
-         } else {
-	   final_had_syst.push_back(ip);
-         }
-      }
-      else if(ist==kIStStableFinalState && is_hnl) {
-	// HNL have decays with multiple leptons, such as v + mu + mu
-	// only one of these will be primary, so don't add this to hadronic system
-	if( std::abs(pdgc) == kPdgElectron || 
-	    std::abs(pdgc) == kPdgNuE ||
-	    std::abs(pdgc) == kPdgMuon || 
-	    std::abs(pdgc) == kPdgNuMu ||
-	    std::abs(pdgc) == kPdgTau || 
-	    std::abs(pdgc) == kPdgNuTau ) continue;
-	LOG( "gntpc", pDEBUG ) << "Adding pdg code " << ip << " to FS hadronic system";
-	final_had_syst.push_back(ip);
-      } 
-    }//particle-loop
-
-    if( count(final_had_syst.begin(), final_had_syst.end(), -1) > 0) {
-        mcrec->Clear();
- 	continue;
-    }
-
-    //
-    // Extract info on the primary hadronic system (before any intranuclear rescattering)
-    // looking for particles with status_code == kIStHadronInTheNucleus 
-    // An exception is the coherent production and scattering off free nucleon targets 
-    // (no intranuclear rescattering) in which case primary hadronic system is set to be 
-    // 'identical' with the final  state hadronic system
-    //
-
-    LOG("gntpc", pDEBUG) << "Extracting primary hadronic system";
-    
-    ip = -1;
-    TObjArrayIter piter_prim(&event);
-
-    vector<int> prim_had_syst;
-    if(study_hadsyst) {
-      // if coherent or free nucleon target set primary states equal to final states
-      // Edit: same for HNL
-      
-      if(!pdg::IsIon(target->Pdg()) || (is_coh) || (is_hnl)) {
-
-	for( vector<int>::const_iterator hiter = final_had_syst.begin();
-	     hiter != final_had_syst.end(); ++hiter) {
-
-	  prim_had_syst.push_back(*hiter);
-	}
-      } 
-      
-      else {
-
-	// otherwise loop over all particles and store indices of those which are hadrons
-	// created within the nucleus
-	/*      else {
-		while( (p = (GHepParticle *) piter_prim.Next()) ){
-		ip++;      
-		int ist_comp  = p->Status();
-		if(ist_comp==kIStHadronInTheNucleus) {
-		prim_had_syst.push_back(ip); 
-		}
-		}//particle-loop   */
-	//
-
-
-	//to find the true particles emitted from the principal vertex,
-	// looping over all Ist=14 particles ok for hA, but doesn't
-	// work for hN.  We must now look specifically for these particles.
-	int ist_store = -10;
-	if(is_res){
-	  while( (p = (GHepParticle *) piter_prim.Next()) ){
-	    ip++;      
-	    int ist_comp  = p->Status();
-	    if(ist_comp==kIStDecayedState) {
-	      ist_store = ip;    //store this mother
-	      continue;
-	    }
-	    //	  LOG("gntpc",pNOTICE) << p->FirstMother()<< "  "<<ist_store;
-	    if(p->FirstMother()==ist_store) {
-	      prim_had_syst.push_back(ip);
-	    }
-	  }
-	}
-	if(is_dis){
-	  while( (p = (GHepParticle *) piter_prim.Next()) ){
-	    ip++;      
-	    int ist_comp  = p->Status();
-	    if(ist_comp==kIStDISPreFragmHadronicState) {
-	      ist_store = ip;    //store this mother
-	      continue;
-	    }
-	    if(p->FirstMother()==ist_store) {
-	      prim_had_syst.push_back(ip);
-	    }
-	  }
-	}
-	if(is_qel){
-	  while( (p = (GHepParticle *) piter_prim.Next()) ){
-	    ip++;      
-	    int ist_comp  = p->Status();
-	    if(ist_comp==kIStNucleonTarget) {
-	      ist_store = ip;    //store this mother
-	      continue;
-	    }
-	    //	  LOG("gntpc",pNOTICE) << p->FirstMother()<< "  "<<ist_store;
-	    if(p->FirstMother()==ist_store) {
-	      prim_had_syst.push_back(ip);
-	    }
-	  }
-	}      
-	if(is_mec){
-	  while( (p = (GHepParticle *) piter_prim.Next()) ){
-	    ip++;      
-	    int ist_comp  = p->Status();
-	    if(ist_comp==kIStDecayedState) {
-	      ist_store = ip;    //store this mother
-	      continue;
-	    }
-	    //	  LOG("gntpc",pNOTICE) << "MEC: " << p->FirstMother()<< "  "<<ist_store;
-	    if(p->FirstMother()==ist_store) {
-	      prim_had_syst.push_back(ip);
-	    }
-	  }
-	}
-	
-	
-	// also include gammas from nuclear de-excitations (appearing in the daughter list of the 
-	// hit nucleus, earlier than the primary hadronic system extracted above)
-	for(int i = target->FirstDaughter(); i <= target->LastDaughter(); i++) {
-	  if(i<0) continue;
-	  if(event.Particle(i)->Status()==kIStStableFinalState) { prim_had_syst.push_back(i); }
-	}      
-
-	
-      } // else from ( not ion or coherent ) 
-      
-    }//study_hadsystem?
-    
-    if( count(prim_had_syst.begin(), prim_had_syst.end(), -1) > 0) {
-        mcrec->Clear();
- 	continue;
-    }
-
-    //
-    // Al information has been assembled -- Start filling up the tree branches
-    //
-    brIev        = (int) iev;      
-    brNeutrino   = (neutrino) ? neutrino->Pdg() : 0;      
-    brFSPrimLept = (fsl) ? fsl->Pdg() : 0;
-    brTarget     = target->Pdg(); 
-    brTargetZ    = tgtZ;
-    brTargetA    = tgtA;   
-    brHitNuc     = (hitnucl) ? hitnucl->Pdg() : 0;      
-    brHitQrk     = qrk;     
-    brFromSea    = seaq;  
-    brResId      = resid;
-    brIsQel      = is_qel;
-    brIsRes      = is_res;
-    brIsDis      = is_dis;  
-    brIsCoh      = is_coh;  
-    brIsDfr      = is_dfr;  
-    brIsImd      = is_imd;
-    brIsNrm      = is_norm;
-    brIsSingleK  = is_singlek;    
-    brIsNuEL     = is_nuel;  
-    brIsEM       = is_em;  
-    brIsMec      = is_mec;
-    brIsCC       = is_weakcc;  
-    brIsNC       = is_weaknc;  
-    brIsCharmPro = charm;
-    brIsAMNuGamma= is_amnugamma;
-    brIsHNL      = is_hnl;
-    brWeight     = weight;      
-    brKineXs     = xs;      
-    brKineYs     = ys;      
-    brKineTs     = ts;      
-    brKineQ2s    = Q2s;            
-    brKineWs     = Ws;      
-    brKineX      = x;      
-    brKineY      = y;      
-    brKineT      = t;      
-    brKineQ2     = Q2;      
-    brKineW      = W;      
-    brEvRF       = k1_rf.Energy();      
-    brEv         = k1.Energy();      
-    brPxv        = k1.Px();  
-    brPyv        = k1.Py();  
-    brPzv        = k1.Pz();  
-    brEn         = (hitnucl) ? p1.Energy() : 0;      
-    brPxn        = (hitnucl) ? p1.Px()     : 0;      
-    brPyn        = (hitnucl) ? p1.Py()     : 0;      
-    brPzn        = (hitnucl) ? p1.Pz()     : 0;            
-    brEl         = k2.Energy();      
-    brPxl        = k2.Px();      
-    brPyl        = k2.Py();      
-    brPzl        = k2.Pz();      
-    brPl         = k2.P();
-    brCosthl     = TMath::Cos( k2.Vect().Angle(k1.Vect()) );
-
-    // XSec Info
-
-    brXSec  = event.XSec()*(1E+38/units::cm2);
-    brDXSec = event.DiffXSec()*(1E+38/units::cm2);
-    brKPS   = event.DiffXSecVars();
-
-    // Primary hadronic system (from primary neutrino interaction, before FSI)
-    brNiP        = 0;
-    brNiN        = 0;    
-    brNiPip      = 0;    
-    brNiPim      = 0;    
-    brNiPi0      = 0;    
-    brNiKp       = 0;  
-    brNiKm       = 0;  
-    brNiK0       = 0;  
-    brNiEM       = 0;  
-    brNiOther    = 0;  
-    brNi = prim_had_syst.size();
-    for(int j=0; j<brNi; j++) {
-      p = event.Particle(prim_had_syst[j]);
-      assert(p);
-      brPdgi[j] = p->Pdg();     
-      brResc[j] = p->RescatterCode();     
-      brEi  [j] = p->Energy();     
-      brPxi [j] = p->Px();     
-      brPyi [j] = p->Py();     
-      brPzi [j] = p->Pz();     
-
-      if      (p->Pdg() == kPdgProton  || p->Pdg() == kPdgAntiProton)   brNiP++;
-      else if (p->Pdg() == kPdgNeutron || p->Pdg() == kPdgAntiNeutron)  brNiN++;
-      else if (p->Pdg() == kPdgPiP) brNiPip++; 
-      else if (p->Pdg() == kPdgPiM) brNiPim++; 
-      else if (p->Pdg() == kPdgPi0) brNiPi0++; 
-      else if (p->Pdg() == kPdgKP)  brNiKp++;  
-      else if (p->Pdg() == kPdgKM)  brNiKm++;  
-      else if (p->Pdg() == kPdgK0    || p->Pdg() == kPdgAntiK0)  brNiK0++; 
-      else if (p->Pdg() == kPdgGamma || p->Pdg() == kPdgElectron || p->Pdg() == kPdgPositron) brNiEM++;
-      else brNiOther++;
-
-      LOG("gntpc", pINFO) 
-        << "Counting in primary hadronic system: idx = " << prim_had_syst[j]
-        << " -> " << p->Name();
-    }
-
-    LOG("gntpc", pINFO) 
-     << "N(p):"             << brNiP
-     << ", N(n):"           << brNiN
-     << ", N(pi+):"         << brNiPip
-     << ", N(pi-):"         << brNiPim
-     << ", N(pi0):"         << brNiPi0
-     << ", N(K+,K-,K0):"    << brNiKp+brNiKm+brNiK0
-     << ", N(gamma,e-,e+):" << brNiEM
-     << ", N(etc):"         << brNiOther << "\n";
-
-    // Final state (visible) hadronic system
-    brNfP        = 0;
-    brNfN        = 0;    
-    brNfPip      = 0;    
-    brNfPim      = 0;    
-    brNfPi0      = 0;    
-    brNfKp       = 0;  
-    brNfKm       = 0;  
-    brNfK0       = 0;  
-    brNfEM       = 0;  
-    brNfOther    = 0;  
-
-    brSumKEf     = (fsl) ? fsl->KinE() : 0;
-    brCalResp0   = 0;
-
-    brNf = final_had_syst.size();
-    for(int j=0; j<brNf; j++) {
-      p = event.Particle(final_had_syst[j]);
-      assert(p);
-
-      int    hpdg = p->Pdg();     
-      double hE   = p->Energy();     
-      double hKE  = p->KinE();     
-      double hpx  = p->Px();     
-      double hpy  = p->Py();     
-      double hpz  = p->Pz();     
-      double hp   = TMath::Sqrt(hpx*hpx + hpy*hpy + hpz*hpz);
-      double hm   = p->Mass();     
-      double hcth = TMath::Cos( p->P4()->Vect().Angle(k1.Vect()) );
-
-      brPdgf  [j] = hpdg;
-      brEf    [j] = hE;
-      brPxf   [j] = hpx;
-      brPyf   [j] = hpy;
-      brPzf   [j] = hpz;
-      brPf    [j] = hp;
-      brCosthf[j] = hcth;
-
-      brSumKEf += hKE;
-
-      if      ( hpdg == kPdgProton      )  { brNfP++;     brCalResp0 += hKE;        }
-      else if ( hpdg == kPdgAntiProton  )  { brNfP++;     brCalResp0 += (hE + 2*hm);}
-      else if ( hpdg == kPdgNeutron     )  { brNfN++;     brCalResp0 += hKE;        }
-      else if ( hpdg == kPdgAntiNeutron )  { brNfN++;     brCalResp0 += (hE + 2*hm);}
-      else if ( hpdg == kPdgPiP         )  { brNfPip++;   brCalResp0 += hKE;        }
-      else if ( hpdg == kPdgPiM         )  { brNfPim++;   brCalResp0 += hKE;        }
-      else if ( hpdg == kPdgPi0         )  { brNfPi0++;   brCalResp0 += (e_h * hE); }
-      else if ( hpdg == kPdgKP          )  { brNfKp++;    brCalResp0 += hKE;        }
-      else if ( hpdg == kPdgKM          )  { brNfKm++;    brCalResp0 += hKE;        }
-      else if ( hpdg == kPdgK0          )  { brNfK0++;    brCalResp0 += hKE;        }
-      else if ( hpdg == kPdgAntiK0      )  { brNfK0++;    brCalResp0 += hKE;        }
-      else if ( hpdg == kPdgGamma       )  { brNfEM++;    brCalResp0 += (e_h * hE); }
-      else if ( hpdg == kPdgElectron    )  { brNfEM++;    brCalResp0 += (e_h * hE); }
-      else if ( hpdg == kPdgPositron    )  { brNfEM++;    brCalResp0 += (e_h * hE); }
-      else                                 { brNfOther++; brCalResp0 += hKE;        }
-
-      LOG("gntpc", pINFO) 
-        << "Counting in f/s system from hadronic vtx: idx = " << final_had_syst[j]
-        << " -> " << p->Name();
-    }
-
-    LOG("gntpc", pINFO) 
-     << "N(p):"             << brNfP
-     << ", N(n):"           << brNfN
-     << ", N(pi+):"         << brNfPip
-     << ", N(pi-):"         << brNfPim
-     << ", N(pi0):"         << brNfPi0
-     << ", N(K+,K-,K0):"    << brNfKp+brNfKm+brNfK0
-     << ", N(gamma,e-,e+):" << brNfEM
-     << ", N(etc):"         << brNfOther << "\n";
-
-    brVtxX = vtx->X();   
-    brVtxY = vtx->Y();   
-    brVtxZ = vtx->Z();   
-    brVtxT = vtx->T();
-
-    s_tree->Fill();
+    gst.AddEventRecord((int) iev, &event);
 
     mcrec->Clear();
 
@@ -1144,11 +418,13 @@ void ConvertToGST(void)
 
   fout.Write();
   fout.Close();
+
+  return true;
 }
 //____________________________________________________________________________________
 // GENIE GHEP EVENT TREE FORMAT -> GENIE XML EVENT FILE FORMAT 
 //____________________________________________________________________________________
-void ConvertToGXML(void)
+bool ConvertToGXML(void)
 {
   //-- open the ROOT file and get the TTree & its header
   TFile fin(gOptInpFileName.c_str(),"READ");
@@ -1167,23 +443,25 @@ void ConvertToGXML(void)
   ofstream output(gOptOutFileName.c_str(), ios::out);
 
   //-- add required header
-  output << "<?xml version=\"1.0\" encoding=\"ISO-8859-1\"?>";
-  output << endl << endl;
-  output << "<!-- generated by GENIE gntpc utility -->";   
-  output << endl << endl;
-  output << "<genie_event_list version=\"1.00\">" << endl;
+  if(IsFirstPart()) {
+    output << "<?xml version=\"1.0\" encoding=\"ISO-8859-1\"?>";
+    output << endl << endl;
+    output << "<!-- generated by GENIE gntpc utility -->";   
+    output << endl << endl;
+    output << "<genie_event_list version=\"1.00\">" << endl;
+  }
 
   //-- figure out how many events to analyze
-  Long64_t nmax = (gOptN<0) ? 
-       tree->GetEntries() : TMath::Min(tree->GetEntries(), gOptN);
+  Long64_t iev0 = 0;
+  Long64_t nmax = EntryRange(tree, iev0);
   if (nmax<0) {
     LOG("gntpc", pERROR) << "Number of events = 0";
-    return;
+    return false;
   }
-  LOG("gntpc", pNOTICE) << "*** Analyzing: " << nmax << " events";
+  LOG("gntpc", pNOTICE) << "*** Analyzing: " << nmax-iev0 << " events";
 
   //-- event loop
-  for(Long64_t iev = 0; iev < nmax; iev++) {
+  for(Long64_t iev = iev0; iev < nmax; iev++) {
     tree->GetEntry(iev);
     NtpMCRecHeader rec_header = mcrec->hdr;
     EventRecord &  event      = *(mcrec->event);
@@ -1283,18 +561,22 @@ void ConvertToGXML(void)
   } // event loop
 
   //-- add required footer
-  output << endl << endl;
-  output << "<genie_event_list version=\"1.00\">";
+  if(IsLastPart()) {
+    output << endl << endl;
+    output << "<genie_event_list version=\"1.00\">";
+  }
 
   output.close();
   fin.Close();
 
   LOG("gntpc", pINFO) << "\nDone converting GENIE's GHEP ntuple";
+
+  return true;
 }
 //____________________________________________________________________________________
 // GENIE GHEP FORMAT -> GHEP MOCK DATA FORMAT
 //____________________________________________________________________________________
-void ConvertToGHepMock(void)
+bool ConvertToGHepMock(void)
 {
   //-- open the ROOT file and get the TTree & its header
   TFile fin(gOptInpFileName.c_str(),"READ");
@@ -1310,13 +592,13 @@ void ConvertToGHepMock(void)
   tree->SetBranchAddress("gmcrec", &mcrec);
         
   //-- figure out how many events to analyze
-  Long64_t nmax = (gOptN<0) ?
-       tree->GetEntries() : TMath::Min(tree->GetEntries(), gOptN);
+  Long64_t iev0 = 0;
+  Long64_t nmax = EntryRange(tree, iev0);
   if (nmax<0) {
     LOG("gntpc", pERROR) << "Number of events = 0";
-    return;
+    return false;
   }
-  LOG("gntpc", pNOTICE) << "*** Analyzing: " << nmax << " events";
+  LOG("gntpc", pNOTICE) << "*** Analyzing: " << nmax-iev0 << " events";
 
   //-- initialize an Ntuple Writer
   NtpWriter ntpw(kNFGHEP, thdr->runnu);
@@ -1324,7 +606,7 @@ void ConvertToGHepMock(void)
   ntpw.Initialize();
 
   //-- event loop
-  for(Long64_t iev = 0; iev < nmax; iev++) {
+  for(Long64_t iev = iev0; iev < nmax; iev++) {
     tree->GetEntry(iev);
     NtpMCRecHeader rec_header = mcrec->hdr;
     EventRecord &  event      = *(mcrec->event);
@@ -1362,11 +644,13 @@ void ConvertToGHepMock(void)
   fin.Close();
       
   LOG("gntpc", pINFO) << "\nDone converting GENIE's GHEP ntuple";
+
+  return true;
 }
 //____________________________________________________________________________________
 // GENIE GHEP EVENT TREE FORMAT -> TRACKER FORMATS
 //____________________________________________________________________________________
-void ConvertToGTracker(void)
+bool ConvertToGTracker(void)
 {
   //-- open the ROOT file and get the TTree & its header
   TFile fin(gOptInpFileName.c_str(),"READ");
@@ -1400,16 +684,16 @@ void ConvertToGTracker(void)
   ofstream output(gOptOutFileName.c_str(), ios::out);
 
   //-- figure out how many events to analyze
-  Long64_t nmax = (gOptN<0) ? 
-       tree->GetEntries() : TMath::Min(tree->GetEntries(), gOptN);
+  Long64_t iev0 = 0;
+  Long64_t nmax = EntryRange(tree, iev0);
   if (nmax<0) {
     LOG("gntpc", pERROR) << "Number of events = 0";
-    return;
+    return false;
   }
-  LOG("gntpc", pNOTICE) << "*** Analyzing: " << nmax << " events";
+  LOG("gntpc", pNOTICE) << "*** Analyzing: " << nmax-iev0 << " events";
 
   //-- event loop
-  for(Long64_t iev = 0; iev < nmax; iev++) {
+  for(Long64_t iev = iev0; iev < nmax; iev++) {
     tree->GetEntry(iev);
     NtpMCRecHeader rec_header = mcrec->hdr;
     EventRecord &  event      = *(mcrec->event);
@@ -1809,43 +1093,22 @@ be agreed with the SKDETSIM maintainers.
   } // event loop
 
   // add tracker end-of-file tag
-  output << "$ stop" << endl;
+  if(IsLastPart()) output << "$ stop" << endl;
 
   output.close();
   fin.Close();
 
   LOG("gntpc", pINFO) << "\nDone converting GENIE's GHEP ntuple";
+
+  return true;
 }
 //____________________________________________________________________________________
 // GENIE GHEP EVENT TREE FORMAT -> ROOTRACKER FORMATS 
 //____________________________________________________________________________________
-void ConvertToGRooTracker(void)
+bool ConvertToGRooTracker(void)
 {
-  //-- define the output rootracker tree branches
-
-  // event info
-
-  TBits*      brEvtFlags = 0;             // Generator-specific event flags
-  TObjString* brEvtCode = 0;              // Generator-specific string with 'event code'
-  int         brEvtNum;                   // Event num.
-  double      brEvtXSec;                  // Cross section for selected event (1E-38 cm2)
-  double      brEvtDXSec;                 // Cross section for selected event kinematics (1E-38 cm2 /{K^n})
-  UInt_t      brEvtKPS;                   // Kinematic phase space variables as in KinePhaseSpace_t
-  double      brEvtWght;                  // Weight for that event
-  double      brEvtProb;                  // Probability for that event (given cross section, path lengths, etc)
-  double      brEvtVtx[4];                // Event vertex position in detector coord syst (SI)
-  int         brStdHepN;                  // Number of particles in particle array 
-  // stdhep-like particle array:
-  int         brStdHepPdg   [kNPmax];     // Pdg codes (& generator specific codes for pseudoparticles)
-  int         brStdHepStatus[kNPmax];     // Generator-specific status code
-  int         brStdHepRescat[kNPmax];     // Hadron transport model - specific rescattering code
-  double      brStdHepX4    [kNPmax][4];  // 4-x (x, y, z, t) of particle in hit nucleus frame (fm)
-  double      brStdHepP4    [kNPmax][4];  // 4-p (px,py,pz,E) of particle in LAB frame (GeV)
-  double      brStdHepPolz  [kNPmax][3];  // Polarization vector
-  int         brStdHepFd    [kNPmax];     // First daughter
-  int         brStdHepLd    [kNPmax];     // Last  daughter 
-  int         brStdHepFm    [kNPmax];     // First mother
-  int         brStdHepLm    [kNPmax];     // Last  mother
+  //-- define the output branches of the t2k and numi rootracker variances
+  //   (the common branches are booked and filled by NtpRooTrackerOutput)
 
   //
   // >> info available at the t2k rootracker variance only
@@ -1996,47 +1259,14 @@ void ConvertToGRooTracker(void)
   //-- open the output ROOT file
   TFile fout(gOptOutFileName.c_str(), "RECREATE");
 
-  //-- create the output ROOT tree
-  TTree * rootracker_tree = new TTree("gRooTracker","GENIE event tree rootracker format");
-
   //-- is it a `mock data' variance?
   bool hide_truth = (gOptOutFileFormat == kConvFmt_rootracker_mock_data);
 
-  //-- create the output ROOT tree branches
-
-  // branches common to all rootracker(_mock_data) formats
-  if(!hide_truth) {
-    // full version
-    rootracker_tree->Branch("EvtFlags", "TBits",      &brEvtFlags, 32000, 1);           
-    rootracker_tree->Branch("EvtCode",  "TObjString", &brEvtCode,  32000, 1);            
-    rootracker_tree->Branch("EvtNum",          &brEvtNum,          "EvtNum/I");             
-    rootracker_tree->Branch("EvtXSec",         &brEvtXSec,         "EvtXSec/D");            
-    rootracker_tree->Branch("EvtDXSec",        &brEvtDXSec,        "EvtDXSec/D");           
-    rootracker_tree->Branch("EvtKPS",          &brEvtKPS,          "EvtKPS/i");
-    rootracker_tree->Branch("EvtWght",         &brEvtWght,         "EvtWght/D");            
-    rootracker_tree->Branch("EvtProb",         &brEvtProb,         "EvtProb/D");            
-    rootracker_tree->Branch("EvtVtx",           brEvtVtx,          "EvtVtx[4]/D");             
-    rootracker_tree->Branch("StdHepN",         &brStdHepN,         "StdHepN/I");              
-    rootracker_tree->Branch("StdHepPdg",        brStdHepPdg,       "StdHepPdg[StdHepN]/I");  
-    rootracker_tree->Branch("StdHepStatus",     brStdHepStatus,    "StdHepStatus[StdHepN]/I"); 
-    rootracker_tree->Branch("StdHepRescat",     brStdHepRescat,    "StdHepRescat[StdHepN]/I"); 
-    rootracker_tree->Branch("StdHepX4",         brStdHepX4,        "StdHepX4[StdHepN][4]/D"); 
-    rootracker_tree->Branch("StdHepP4",         brStdHepP4,        "StdHepP4[StdHepN][4]/D"); 
-    rootracker_tree->Branch("StdHepPolz",       brStdHepPolz,      "StdHepPolz[StdHepN][3]/D"); 
-    rootracker_tree->Branch("StdHepFd",         brStdHepFd,        "StdHepFd[StdHepN]/I"); 
-    rootracker_tree->Branch("StdHepLd",         brStdHepLd,        "StdHepLd[StdHepN]/I"); 
-    rootracker_tree->Branch("StdHepFm",         brStdHepFm,        "StdHepFm[StdHepN]/I"); 
-    rootracker_tree->Branch("StdHepLm",         brStdHepLm,        "StdHepLm[StdHepN]/I"); 
-  } else {
-    // for mock_data variances
-    rootracker_tree->Branch("EvtNum",          &brEvtNum,          "EvtNum/I");             
-    rootracker_tree->Branch("EvtWght",         &brEvtWght,         "EvtWght/D");            
-    rootracker_tree->Branch("EvtVtx",           brEvtVtx,          "EvtVtx[4]/D");             
-    rootracker_tree->Branch("StdHepN",         &brStdHepN,         "StdHepN/I");              
-    rootracker_tree->Branch("StdHepPdg",        brStdHepPdg,       "StdHepPdg[StdHepN]/I");  
-    rootracker_tree->Branch("StdHepX4",         brStdHepX4,        "StdHepX4[StdHepN][4]/D"); 
-    rootracker_tree->Branch("StdHepP4",         brStdHepP4,        "StdHepP4[StdHepN][4]/D"); 
-  }
+  //-- create the output ROOT tree and the branches common to all
+  //   rootracker(_mock_data) formats
+  NtpRooTrackerOutput rootracker(hide_truth);
+  rootracker.Initialize();
+  TTree * rootracker_tree = rootracker.Tree();
 
   // extra branches of the t2k rootracker variance
   if(gOptOutFileFormat == kConvFmt_t2k_rootracker) 
@@ -2221,16 +1451,16 @@ void ConvertToGRooTracker(void)
 #endif
 
   //-- figure out how many events to analyze
-  Long64_t nmax = (gOptN<0) ? 
-      gtree->GetEntries() : TMath::Min(gtree->GetEntries(), gOptN);
+  Long64_t iev0 = 0;
+  Long64_t nmax = EntryRange(gtree, iev0);
   if (nmax<0) {
     LOG("gntpc", pERROR) << "Number of events = 0";
-    return;
+    return false;
   }
-  LOG("gntpc", pNOTICE) << "*** Analyzing: " << nmax << " events";
+  LOG("gntpc", pNOTICE) << "*** Analyzing: " << nmax-iev0 << " events";
 
   //-- event loop
-  for(Long64_t iev = 0; iev < nmax; iev++) {
+  for(Long64_t iev = iev0; iev < nmax; iev++) {
     gtree->GetEntry(iev);
 
     NtpMCRecHeader rec_header = mcrec->hdr;
@@ -2251,38 +1481,16 @@ void ConvertToGRooTracker(void)
 #endif
 
     //
-    // clear output tree branches
+    // copy current event info to output tree
     //
-    if(brEvtFlags) delete brEvtFlags;
-    brEvtFlags  = 0;
-    if(brEvtCode) delete brEvtCode;
-    brEvtCode   = 0;
-    brEvtNum    = 0;    
-    brEvtXSec   = 0;
-    brEvtDXSec  = 0;
-    brEvtKPS    = 0;
-    brEvtWght   = 0;
-    brEvtProb   = 0;
-    for(int k=0; k<4; k++) { 
-      brEvtVtx[k] = 0;
-    }
-    brStdHepN = 0; 
-    for(int i=0; i<kNPmax; i++) {
-       brStdHepPdg   [i] =  0;  
-       brStdHepStatus[i] = -1;  
-       brStdHepRescat[i] = -1;  
-       for(int k=0; k<4; k++) {
-         brStdHepX4 [i][k] = 0;  
-         brStdHepP4 [i][k] = 0;  
-       }
-       for(int k=0; k<3; k++) {
-         brStdHepPolz [i][k] = 0;  
-       }
-       brStdHepFd    [i] = 0;  
-       brStdHepLd    [i] = 0;  
-       brStdHepFm    [i] = 0;  
-       brStdHepLm    [i] = 0;  
+    if(!rootracker.Fill((int) iev, event)) {
+      mcrec->Clear();
+      continue;
     }
+
+    //
+    // clear the flux pass-through branches
+    //
     brNuParentPdg     = 0;           
     brNuParentDecMode = 0;       
     for(int k=0; k<4; k++) {  
@@ -2336,59 +1544,6 @@ void ConvertToGRooTracker(void)
     if(brNuFileName) delete brNuFileName;
     brNuFileName = 0;
 
-    //
-    // copy current event info to output tree
-    //
-
-    brEvtFlags  = new TBits(*event.EventFlags());   
-    brEvtCode   = new TObjString(event.Summary()->AsString().c_str());   
-    brEvtNum    = (int) iev;    
-    brEvtXSec   = (1E+38/units::cm2) * event.XSec();    
-    brEvtDXSec  = (1E+38/units::cm2) * event.DiffXSec();    
-    brEvtKPS    = event.DiffXSecVars();
-    LOG( "gntpc", pDEBUG )
-      << "brEvtKPS = " << brEvtKPS
-      << ", event.DiffXSecVars() = " << event.DiffXSecVars();
-    brEvtWght   = event.Weight();    
-    brEvtProb   = event.Probability();    
-    brEvtVtx[0] = event.Vertex()->X();    
-    brEvtVtx[1] = event.Vertex()->Y();    
-    brEvtVtx[2] = event.Vertex()->Z();    
-    brEvtVtx[3] = event.Vertex()->T();    
-
-    int iparticle=0;
-    GHepParticle * p = 0;
-    TIter event_iter(&event);
-    while ( (p = dynamic_cast<GHepParticle *>(event_iter.Next())) ) {
-        assert(p);
-
-        // for mock_data variances write out only stable final state particles
-        if(hide_truth && p->Status() != kIStStableFinalState) continue;
-
-        brStdHepPdg   [iparticle] = p->Pdg(); 
-        brStdHepStatus[iparticle] = (int) p->Status(); 
-        brStdHepRescat[iparticle] = p->RescatterCode(); 
-        brStdHepX4    [iparticle][0] = p->X4()->X(); 
-        brStdHepX4    [iparticle][1] = p->X4()->Y(); 
-        brStdHepX4    [iparticle][2] = p->X4()->Z(); 
-        brStdHepX4    [iparticle][3] = p->X4()->T(); 
-        brStdHepP4    [iparticle][0] = p->P4()->Px(); 
-        brStdHepP4    [iparticle][1] = p->P4()->Py(); 
-        brStdHepP4    [iparticle][2] = p->P4()->Pz(); 
-        brStdHepP4    [iparticle][3] = p->P4()->E(); 
-        if(p->PolzIsSet()) {
-          brStdHepPolz  [iparticle][0] = TMath::Sin(p->PolzPolarAngle()) * TMath::Cos(p->PolzAzimuthAngle());
-          brStdHepPolz  [iparticle][1] = TMath::Sin(p->PolzPolarAngle()) * TMath::Sin(p->PolzAzimuthAngle());
-          brStdHepPolz  [iparticle][2] = TMath::Cos(p->PolzPolarAngle());
-        }
-        brStdHepFd    [iparticle] = p->FirstDaughter(); 
-        brStdHepLd    [iparticle] = p->LastDaughter(); 
-        brStdHepFm    [iparticle] = p->FirstMother(); 
-        brStdHepLm    [iparticle] = p->LastMother(); 
-        iparticle++;
-    }
-    brStdHepN = iparticle; 
-
     //
     // fill in additional info for the t2k_rootracker format
     //
@@ -2602,11 +1757,13 @@ void ConvertToGRooTracker(void)
   fout.Close();
 
   LOG("gntpc", pINFO) << "\nDone converting GENIE's GHEP ntuple";
+
+  return true;
 }
 //____________________________________________________________________________________
 // GENIE GHEP EVENT TREE -> NEUGEN-style format for AGKY studies 
 //____________________________________________________________________________________
-void ConvertToGHad(void)
+bool ConvertToGHad(void)
 {
 // Neugen-style text format for the AGKY hadronization model studies
 // Format:
@@ -2651,16 +1808,16 @@ void ConvertToGHad(void)
 #endif
 
   //-- figure out how many events to analyze
-  Long64_t nmax = (gOptN<0) ? 
-      tree->GetEntries() : TMath::Min(tree->GetEntries(), gOptN);
+  Long64_t iev0 = 0;
+  Long64_t nmax = EntryRange(tree, iev0);
   if (nmax<0) {
     LOG("gntpc", pERROR) << "Number of events = 0";
-    return;
+    return false;
   }
-  LOG("gntpc", pNOTICE) << "*** Analyzing: " << nmax << " events";
+  LOG("gntpc", pNOTICE) << "*** Analyzing: " << nmax-iev0 << " events";
 
   //-- event loop
-  for(Long64_t iev = 0; iev < nmax; iev++) {
+  for(Long64_t iev = iev0; iev < nmax; iev++) {
     tree->GetEntry(iev);
     NtpMCRecHeader rec_header = mcrec->hdr;
     EventRecord &  event      = *(mcrec->event);
@@ -2704,7 +1861,7 @@ void ConvertToGHad(void)
     else if (init_state.IsNuN    ()) im = 2; 
     else if (init_state.IsNuBarP ()) im = 3; 
     else if (init_state.IsNuBarN ()) im = 4; 
-    else return;
+    else return false;
 
     GHepParticle * neutrino = event.Probe();
     assert(neutrino);
@@ -2847,11 +2004,13 @@ void ConvertToGHad(void)
 #endif
 
   LOG("gntpc", pINFO) << "\nDone converting GENIE's GHEP ntuple";
+
+  return true;
 }
 //____________________________________________________________________________________
 // GENIE GHEP EVENT TREE -> Summary tree for INTRANUKE studies 
 //____________________________________________________________________________________
-void ConvertToGINuke(void)
+bool ConvertToGINuke(void)
 {
   //-- output tree branch variables
   //
@@ -2930,7 +2089,7 @@ TTree * tEvtTree = new TTree("ginuke","GENIE INuke Summary Tree");
   thdr    = dynamic_cast <NtpMCTreeHeader *> ( fin.Get("header") );
   if (!er_tree) {
     LOG("gntpc", pERROR) << "Null input tree";
-    return;
+    return false;
   }
   LOG("gntpc", pINFO) << "Input tree header: " << *thdr;
 
@@ -2939,19 +2098,19 @@ TTree * tEvtTree = new TTree("ginuke","GENIE INuke Summary Tree");
   er_tree->SetBranchAddress("gmcrec", &mcrec);
   if (!mcrec) {
     LOG("gntpc", pERROR) << "Null MC record";
-    return;
+    return false;
   }
 
   //-- figure out how many events to analyze
-  Long64_t nmax = (gOptN<0) ?
-       er_tree->GetEntries() : TMath::Min( er_tree->GetEntries(), gOptN );
+  Long64_t iev0 = 0;
+  Long64_t nmax = EntryRange(er_tree, iev0);
   if (nmax<0) {
     LOG("gntpc", pERROR) << "Number of events = 0";
-    return;
+    return false;
   }
-  LOG("gntpc", pNOTICE) << "*** Analyzing: " << nmax << " events";
+  LOG("gntpc", pNOTICE) << "*** Analyzing: " << nmax-iev0 << " events";
 
-  for(Long64_t iev = 0; iev < nmax; iev++) {
+  for(Long64_t iev = iev0; iev < nmax; iev++) {
     brIEv = iev; 
     er_tree->GetEntry(iev);
     NtpMCRecHeader rec_header = mcrec->hdr;
@@ -3060,6 +2219,76 @@ TTree * tEvtTree = new TTree("ginuke","GENIE INuke Summary Tree");
   fout.Close();
 
   LOG("gntpc", pINFO) << "\nDone converting GENIE's GHEP ntuple";
+
+  return true;
+}
+//____________________________________________________________________________________
+// GENIE GHEP EVENT TREE -> Event topology index
+//____________________________________________________________________________________
+bool ConvertToGIdx(void)
+{
+  //-- open output file & create the index tree
+  //
+  LOG("gntpc", pNOTICE)
+       << "*** Saving event topology index to: " << gOptOutFileName;
+  TFile fout(gOptOutFileName.c_str(),"recreate");
+
+  NtpTopoSummary summary;
+  TTree * idx_tree = new TTree(NtpTopoSummary::TreeName().c_str(),
+                               "GENIE Event Topology Index");
+  assert(idx_tree);
+  summary.Book(idx_tree);
+
+  //-- open the ROOT file and get the TTree & its header
+  TFile fin(gOptInpFileName.c_str(),"READ");
+  TTree *           er_tree = 0;
+  NtpMCTreeHeader * thdr    = 0;
+  er_tree = dynamic_cast <TTree *>           ( fin.Get("gtree")  );
+  thdr    = dynamic_cast <NtpMCTreeHeader *> ( fin.Get("header") );
+  if (!er_tree) {
+    LOG("gntpc", pERROR) << "Null input tree";
+    return false;
+  }
+  LOG("gntpc", pINFO) << "Input tree header: " << *thdr;
+
+  //-- get the mc record
+  NtpMCEventRecord * mcrec = 0;
+  er_tree->SetBranchAddress("gmcrec", &mcrec);
+  if (!mcrec) {
+    LOG("gntpc", pERROR) << "Null MC record";
+    return false;
+  }
+
+  //-- figure out how many events to analyze
+  Long64_t iev0 = 0;
+  Long64_t nmax = EntryRange(er_tree, iev0);
+  if (nmax<0) {
+    LOG("gntpc", pERROR) << "Number of events = 0";
+    return false;
+  }
+  LOG("gntpc", pNOTICE) << "*** Analyzing: " << nmax-iev0 << " events";
+
+  for(Long64_t iev = iev0; iev < nmax; iev++) {
+    er_tree->GetEntry(iev);
+    EventRecord & event = *(mcrec->event);
+
+    LOG("gntpc", pINFO) << event;
+
+    summary.Fill(iev, event);
+    idx_tree->Fill();
+
+    mcrec->Clear();
+
+  } // event loop
+
+  fin.Close();
+
+  fout.Write();
+  fout.Close();
+
+  LOG("gntpc", pINFO) << "\nDone converting GENIE's GHEP ntuple";
+
+  return true;
 }
 //____________________________________________________________________________________
 // FUNCTIONS FOR PARSING CMD-LINE ARGUMENTS 
@@ -3111,6 +2340,7 @@ void GetCommandLineArgs(int argc, char ** argv)
     else if (fmt == "nuance_tracker" )       { gOptOutFileFormat = kConvFmt_nuance_tracker;        }
     else if (fmt == "ghad")                  { gOptOutFileFormat = kConvFmt_ghad;                  }
     else if (fmt == "ginuke")                { gOptOutFileFormat = kConvFmt_ginuke;                }
+    else if (fmt == "gidx")                  { gOptOutFileFormat = kConvFmt_gidx;                  }
     else                                     { gOptOutFileFormat = kConvFmt_undef;                 }
 
     if(gOptOutFileFormat == kConvFmt_undef) {
@@ -3162,6 +2392,13 @@ void GetCommandLineArgs(int argc, char ** argv)
   // check whether to copy MC job metadata (only if output file is in ROOT format)
   gOptCopyJobMeta = parser.OptionExists('c');
 
+  // number of worker processes
+  if( parser.OptionExists('j') ) {
+    gOptNWorkers = TMath::Max(1, parser.ArgAsInt('j'));
+  } else {
+    gOptNWorkers = 1;
+  }
+
   // random number seed
   if( parser.OptionExists("seed") ) {
     LOG("gntpc", pINFO) << "Reading random number seed";
@@ -3177,11 +2414,216 @@ void GetCommandLineArgs(int argc, char ** argv)
                         << ", vrs = " << gOptVersion;
   LOG("gntpc", pNOTICE) << "Number of events to be converted = " << gOptN;
   LOG("gntpc", pNOTICE) << "Copy metadata? = " << ((gOptCopyJobMeta) ? "Yes" : "No");
+  LOG("gntpc", pNOTICE) << "Number of worker processes = " << gOptNWorkers;
   LOG("gntpc", pNOTICE) << "Random number seed = " << gOptRanSeed;
 
   LOG("gntpc", pNOTICE) << *RunOpt::Instance();
 }
 //____________________________________________________________________________________
+void ConvertInParallel(void)
+{
+// Converts the input entries in gOptNWorkers forked processes. The GENIE
+// singletons used by the conversion (messenger, PDG library, random number
+// generator, ...) are not thread-safe, so workers are processes rather than
+// threads. Each worker converts a contiguous entry range into its own part
+// file and the parts are then merged, in order, into the output file.
+
+  if(gOptOutFileFormat == kConvFmt_ghad) {
+    LOG("gntpc", pWARN)
+      << "The ghad format can not be converted in parallel - Using a single process";
+    Convert();
+    return;
+  }
+
+  // number of entries to convert
+  Long64_t nentries = 0;
+  {
+    TFile fin(gOptInpFileName.c_str(),"READ");
+    TTree * tree = dynamic_cast <TTree *> ( fin.Get("gtree") );
+    if(!tree) {
+      LOG("gntpc", pFATAL) << "Null input GHEP event tree";
+      gAbortingInErr = true;
+      exit(1);
+    }
+    nentries = (gOptN<0) ?
+       tree->GetEntries() : TMath::Min(tree->GetEntries(), gOptN);
+    fin.Close();
+  }
+  int nworkers = (int) TMath::Min(
+       (Long64_t) gOptNWorkers, TMath::Max(nentries, (Long64_t) 1));
+
+  LOG("gntpc", pNOTICE)
+    << "*** Converting " << nentries << " events in " << nworkers << " processes";
+
+  string outfile = gOptOutFileName;
+  vector<string> parts(nworkers);
+  vector<pid_t>  pids (nworkers, -1);
+
+  std::cout.flush();
+  std::cerr.flush();
+  fflush(NULL);
+
+  for(int w = 0; w < nworkers; w++) {
+    ostringstream part;
+    part << outfile << ".part" << w;
+    parts[w] = part.str();
+
+    pid_t pid = fork();
+    if(pid == 0) {
+      gWorkerId       = w;
+      gOptNWorkers    = nworkers;
+      gWorkerFirst    = (nentries *  w   ) / nworkers;
+      gWorkerLast     = (nentries * (w+1)) / nworkers;
+      gOptOutFileName = parts[w];
+      if(w > 0) gOptCopyJobMeta = false; // merged from the first part only
+      // the workers inherit the random number generator state: give each
+      // one its own seed (eg for the t2k_tracker K0 -> K0L/K0S choice)
+      RandomGen * rnd = RandomGen::Instance();
+      rnd->SetSeed(rnd->GetSeed() + w);
+      bool converted = Convert();
+      std::cout.flush();
+      std::cerr.flush();
+      fflush(NULL);
+      _exit(converted ? 0 : 1);
+    }
+    if(pid < 0) {
+      LOG("gntpc", pERROR) << "Cannot fork worker process " << w;
+      continue;
+    }
+    pids[w] = pid;
+  }
+
+  bool ok = true;
+  for(int w = 0; w < nworkers; w++) {
+    int status = 0;
+    if( pids[w]<0 || waitpid(pids[w], &status, 0)<0 ||
+        !WIFEXITED(status) || WEXITSTATUS(status)!=0 ) {
+      LOG("gntpc", pERROR) << "Worker process " << w << " failed";
+      ok = false;
+    }
+  }
+  if(!ok) {
+    LOG("gntpc", pFATAL)
+      << "Conversion failed - The part files are kept for inspection";
+    gAbortingInErr = true;
+    exit(1);
+  }
+
+  gOptOutFileName = outfile;
+
+  bool is_text = (gOptOutFileFormat == kConvFmt_gxml        ||
+                  gOptOutFileFormat == kConvFmt_t2k_tracker ||
+                  gOptOutFileFormat == kConvFmt_nuance_tracker);
+  if(is_text) {
+    MergeTextParts(parts);
+  } else {
+    MergeROOTParts(parts);
+  }
+
+  for(int w = 0; w < nworkers; w++) {
+    gSystem->Unlink(parts[w].c_str());
+  }
+
+  LOG("gntpc", pNOTICE)
+    << "*** Merged " << nworkers << " parts into: " << gOptOutFileName;
+}
+//____________________________________________________________________________________
+void MergeROOTParts(const vector<string> & parts)
+{
+// Trees are chained across the parts (in order) and copied into the output
+// file. All other objects (eg tree headers, gconfig and genv folders) are
+// copied from the first part.
+
+  TFile fout(gOptOutFileName.c_str(), "RECREATE");
+  TFile fpart(parts[0].c_str(), "READ");
+
+  vector<string> done;
+  TIter next(fpart.GetListOfKeys());
+  TKey * key = 0;
+  while( (key = (TKey *) next()) ) {
+    string name = key->GetName();
+    // only the last cycle of each object
+    if(std::find(done.begin(), done.end(), name) != done.end()) continue;
+    done.push_back(name);
+
+    TObject * obj  = fpart.Get(name.c_str());
+    TTree *   tree = dynamic_cast <TTree *> (obj);
+    fout.cd();
+    if(tree) {
+      TChain chain(name.c_str());
+      for(unsigned int i = 0; i < parts.size(); i++) {
+        chain.Add(parts[i].c_str());
+      }
+      TTree * merged = chain.CloneTree(-1, "fast");
+      merged->SetWeight(tree->GetWeight());
+      merged->Write(name.c_str(), TObject::kOverwrite);
+    } else if(obj) {
+      obj->Write(name.c_str());
+      delete obj;
+    }
+  }
+
+  fpart.Close();
+  fout.Close();
+}
+//____________________________________________________________________________________
+void MergeTextParts(const vector<string> & parts)
+{
+// Concatenates the parts; only the first one has the file header and only
+// the last one has the file footer.
+
+  ofstream output(gOptOutFileName.c_str(), ios::out | ios::binary);
+  for(unsigned int i = 0; i < parts.size(); i++) {
+    std::ifstream input(parts[i].c_str(), ios::in | ios::binary);
+    output << input.rdbuf();
+  }
+  output.close();
+}
+//____________________________________________________________________________________
+Long64_t EntryRange(TTree * tree, Long64_t & first)
+{
+// Returns the end of the range [first, end) of input entries converted by
+// this process: the (first gOptN) entries of the input tree or, for gntpc -j
+// workers, their own share of them. Formats that do not use any flux (or
+// other) pass-through branches read the GHEP record branch only, and the
+// input is read through a tree cache restricted to the converted entries.
+
+  Long64_t last = (gOptN<0) ?
+       tree->GetEntries() : TMath::Min(tree->GetEntries(), gOptN);
+  first = 0;
+  if(gWorkerId >= 0) {
+    first = TMath::Min(gWorkerFirst, last);
+    last  = TMath::Min(gWorkerLast,  last);
+  }
+
+  bool ghep_only = (gOptOutFileFormat == kConvFmt_gst            ||
+                    gOptOutFileFormat == kConvFmt_gxml           ||
+                    gOptOutFileFormat == kConvFmt_ghep_mock_data ||
+                    gOptOutFileFormat == kConvFmt_ghad           ||
+                    gOptOutFileFormat == kConvFmt_ginuke         ||
+                    gOptOutFileFormat == kConvFmt_gidx);
+  if(ghep_only) {
+    tree->SetBranchStatus("*", 0);
+    tree->SetBranchStatus("gmcrec", 1);
+  }
+
+  tree->SetCacheSize(30000000);
+  tree->SetCacheEntryRange(first, last);
+  tree->AddBranchToCache((ghep_only) ? "gmcrec" : "*", true);
+
+  return last;
+}
+//____________________________________________________________________________________
+bool IsFirstPart(void)
+{
+  return (gWorkerId <= 0);
+}
+//____________________________________________________________________________________
+bool IsLastPart(void)
+{
+  return (gWorkerId < 0 || gWorkerId == gOptNWorkers-1);
+}
+//____________________________________________________________________________________
 string DefaultOutputFile(void)
 {
   // filename extension - depending on file format
@@ -3197,6 +2639,7 @@ string DefaultOutputFile(void)
   else if (gOptOutFileFormat == kConvFmt_nuance_tracker       ) { ext = "gtrac_legacy.dat"; }
   else if (gOptOutFileFormat == kConvFmt_ghad                 ) { ext = "ghad.dat";         }
   else if (gOptOutFileFormat == kConvFmt_ginuke               ) { ext = "ginuke.root";      }
+  else if (gOptOutFileFormat == kConvFmt_gidx                 ) { ext = "gidx.root";        }
 
   string inpname = gOptInpFileName;
   unsigned int L = inpname.length();
@@ -3232,6 +2675,7 @@ int LatestFormatVersionNumber(void)
   else if (gOptOutFileFormat == kConvFmt_nuance_tracker       ) return 1;
   else if (gOptOutFileFormat == kConvFmt_ghad                 ) return 1;
   else if (gOptOutFileFormat == kConvFmt_ginuke               ) return 1;
+  else if (gOptOutFileFormat == kConvFmt_gidx                 ) return 1;
 
   return -1;
 }
@@ -863,7 +863,7 @@ int main(int argc, char ** argv)
      // Add event at the output ntuple, refresh the mc job monitor & clean-up
      ntpw.AddEventRecord(ievent, event);
      mcjmonitor.Update(ievent,event);
-     delete event;
+     mcj_driver->RecycleEvent(event);
      if(flux_info) delete flux_info;
      ievent++;
   } //1
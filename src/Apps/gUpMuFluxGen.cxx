@@ -125,6 +125,7 @@
 #include "Framework/Utils/AppInit.h"
 #include "Framework/Utils/RunOpt.h"
 #include "Framework/Utils/CmdLnArgParser.h"
+#include "Physics/MuonEnergyLoss/MuELossTable.h"
 
 #ifdef __GENIE_FLUX_DRIVERS_ENABLED__
 #include "Tools/Flux/GFLUKAAtmoFlux.h"
@@ -138,6 +139,7 @@ using std::ostringstream;
 
 using namespace genie;
 using namespace genie::flux;
+using namespace genie::mueloss;
 using namespace genie::constants;
 
 void       GetCommandLineArgs     (int argc, char ** argv);
@@ -160,9 +162,8 @@ double          gOptDetectorSide;              // detector side length, in mm.
 long int        gOptRanSeed;                   // random number seed
 string          gOptInpXSecFile;               // cross-section splines
 
-// Constants
-const double a = 2e+6;           // a = 2 MeV / (g cm-2)
-const double e = 500e+9;         // e = 500 GeV
+// Muon energy loss in rock, tabulated vs muon energy
+MuELossTable *  gMuELossTable = 0;
 
 // Defaults:
 //
@@ -215,6 +216,9 @@ int main(int argc, char** argv)
   ntupmuflux->Branch("vz",           &brVz,          "vz/D"          );
   ntupmuflux->Branch("xsec",         &brXSec,        "xsec/D"        );
 
+  // Tabulate the total muon energy loss in rock once (-g not implemented yet)
+  gMuELossTable = new MuELossTable(eMuStandardRock);
+
   // Build 3-D pdfs describing the the probability of a muon neutrino (or anti-neutrino)
   // of energy Enu and zenith angle costheta producing a mu- (or mu+) of energy E_mu
   TH3D * pdf3d_numu    = BuildEmuEnuCosThetaPdf (kPdgNuMu    );
@@ -281,6 +285,7 @@ int main(int argc, char** argv)
 
   // Clean-up
   delete flux_driver;
+  delete gMuELossTable;
 
   return 0;
 }
@@ -435,9 +440,13 @@ void GenerateUpNu(GFluxI * flux_driver)
 double ProbabilityEmu(int nu_code, double Enu, double Emu)
 {
 // Calculate the probability of an incoming neutrino of energy Enu
-// generating a muon of energy Emu.
+// generating a muon of energy Emu, up to a normalization (Emu is sampled
+// from the pdfs built from it).
+// The muon energy loss -dE/dx(Emu) is looked up in the tabulated total
+// energy loss in standard rock.
   double dxsec_dxdy = GetCrossSection(nu_code,Enu,Emu);
-  double Int = e * constants::kNA * dxsec_dxdy / (a * (1 + Emu/e));
+  double dedx = gMuELossTable->dE_dx(Emu) / (units::GeV/(units::g/units::cm2));
+  double Int = constants::kNA * dxsec_dxdy / dedx;
   return Int;
 }
 //________________________________________________________________________________________
@@ -0,0 +1,246 @@
+//____________________________________________________________________________
+/*!
+
+\program gpdfcachevalid
+
+\brief   Checks the accuracy of a grid-cached (genie::CachedPDF) PDF set
+         against the PDF set it tabulates.
+
+         The cached and the base PDFs are evaluated at random (x,Q2) points,
+         distributed uniformly in log(x) and log(Q2) within the cache grid.
+         The maximum and mean relative deviation is printed for each flavour.
+
+\syntax  gpdfcachevalid --pdf-set pdf_set [-n n_points] [-t tolerance]
+                        [-o output]
+
+         --pdf-set :
+          Specifies the cached PDF set, as in `genie::CachedPDF/Default'.
+
+         -n :
+          Specifies the number of (x,Q2) points.
+          Default: 100000
+
+         -t :
+          Specifies the tolerated relative deviation. The program exits
+          with a non-zero status if it is exceeded for any flavour.
+          Default: 1E-3
+
+         -o :
+          Specifies the name of an output ROOT file, where an ntuple with
+          the cached and base PDFs at each point is written.
+          Default: none
+
+\example gpdfcachevalid --pdf-set genie::CachedPDF/BYPDF -n 1000000
+
+\author  The GENIE Collaboration
+
+\created October 16, 2026
+
+\cpright Copyright (c) 2003-2023, The GENIE Collaboration
+         For the full text of the license visit http://copyright.genie-mc.org
+
+*/
+//____________________________________________________________________________
+
+#include <cstdlib>
+#include <iomanip>
+#include <sstream>
+#include <string>
+#include <vector>
+
+#include <TNtuple.h>
+#include <TFile.h>
+#include <TMath.h>
+
+#include "Framework/Algorithm/AlgFactory.h"
+#include "Framework/Messenger/Messenger.h"
+#include "Framework/Numerical/RandomGen.h"
+#include "Physics/PartonDistributions/CachedPDF.h"
+#include "Framework/Utils/CmdLnArgParser.h"
+#include "Framework/Utils/StringUtils.h"
+#include "Framework/Utils/RunOpt.h"
+
+using namespace std;
+using namespace genie;
+using namespace genie::utils;
+
+// globals
+string gOptPDFSet    = "";      // --pdf-set argument
+int    gOptNPoints   = 100000;  // -n argument
+double gOptTolerance = 1E-3;    // -t argument
+string gOptOutFile   = "";      // -o argument
+
+const CachedPDF * gCachedPDF = 0;
+
+// PDFs with a smaller magnitude (relative to the largest PDF at the same
+// point) are not used for the relative deviation
+const double kMinRelPDF = 1E-6;
+
+// function prototypes
+void GetCommandLineArgs (int argc, char ** argv);
+void GetAlgorithm       (void);
+bool Validate           (void);
+
+//___________________________________________________________________
+int main(int argc, char ** argv)
+{
+  GetCommandLineArgs (argc,argv);   // Get command line arguments
+  GetAlgorithm();                   // Get the cached PDF algorithm
+
+  bool ok = Validate();
+
+  return (ok ? 0 : 1);
+}
+//_________________________________________________________________________________
+bool Validate(void)
+{
+  const PDFModelI * base = gCachedPDF->BasePDFModel();
+
+  const int nf = 9;
+  const char * names[nf] = {
+    "uval", "dval", "usea", "dsea", "str", "chm", "bot", "top", "gl" };
+
+  TFile *   file = 0;
+  TNtuple * ntpl = 0;
+  if(gOptOutFile.size() > 0) {
+    file = new TFile(gOptOutFile.c_str(), "recreate");
+    ntpl = new TNtuple("nt", "cached and base pdfs",
+       "x:Q2:uv:dv:us:ds:s:g:uv0:dv0:us0:ds0:s0:g0");
+  }
+
+  double log10xmin  = TMath::Log10(gCachedPDF->XMin());
+  double log10xmax  = TMath::Log10(gCachedPDF->XMax());
+  double log10Q2min = TMath::Log10(gCachedPDF->Q2Min());
+  double log10Q2max = TMath::Log10(gCachedPDF->Q2Max());
+
+  double max_dev [nf] = { 0. };
+  double sum_dev [nf] = { 0. };
+  int    n_dev   [nf] = { 0  };
+  double max_x   [nf] = { 0. };
+  double max_Q2  [nf] = { 0. };
+
+  RandomGen * rnd = RandomGen::Instance();
+
+  for(int ip = 0; ip < gOptNPoints; ip++) {
+    double x  = TMath::Power(10.,
+       log10xmin  + (log10xmax  - log10xmin ) * rnd->RndGen().Rndm());
+    double Q2 = TMath::Power(10.,
+       log10Q2min + (log10Q2max - log10Q2min) * rnd->RndGen().Rndm());
+
+    PDF_t c = gCachedPDF->AllPDFs(x,Q2);
+    PDF_t b = base->AllPDFs(x,Q2);
+
+    double vc[nf] = { c.uval, c.dval, c.usea, c.dsea, c.str, c.chm, c.bot, c.top, c.gl };
+    double vb[nf] = { b.uval, b.dval, b.usea, b.dsea, b.str, b.chm, b.bot, b.top, b.gl };
+
+    double scale = 0.;
+    for(int i = 0; i < nf; i++) scale = TMath::Max(scale, TMath::Abs(vb[i]));
+
+    for(int i = 0; i < nf; i++) {
+      if(TMath::Abs(vb[i]) <= kMinRelPDF * scale) continue;
+      double dev = TMath::Abs(vc[i] - vb[i]) / TMath::Abs(vb[i]);
+      sum_dev[i] += dev;
+      n_dev[i]++;
+      if(dev > max_dev[i]) {
+        max_dev[i] = dev;
+        max_x  [i] = x;
+        max_Q2 [i] = Q2;
+      }
+    }
+
+    if(ntpl) {
+      ntpl->Fill(x, Q2, c.uval, c.dval, c.usea, c.dsea, c.str, c.gl,
+                        b.uval, b.dval, b.usea, b.dsea, b.str, b.gl);
+    }
+  }
+
+  if(file) {
+    file->cd();
+    ntpl->Write();
+    file->Close();
+    delete file;
+  }
+
+  bool ok = true;
+
+  ostringstream report;
+  report << "\n" << gOptNPoints << " points, "
+         << gCachedPDF->Id().Key() << " vs " << base->Id().Key() << "\n";
+  for(int i = 0; i < nf; i++) {
+    report << setw(6) << names[i] << ": ";
+    if(n_dev[i] == 0) {
+      report << "not evaluated (null pdf)\n";
+      continue;
+    }
+    report << "max relative deviation = " << setw(12) << max_dev[i]
+           << " (x = " << max_x[i] << ", Q2 = " << max_Q2[i] << " GeV^2)"
+           << ", mean = " << sum_dev[i] / n_dev[i] << "\n";
+    if(max_dev[i] > gOptTolerance) ok = false;
+  }
+
+  LOG("gpdfcachevalid", pNOTICE) << report.str();
+
+  if(!ok) {
+    LOG("gpdfcachevalid", pERROR)
+      << "The relative deviation exceeds the tolerance (" << gOptTolerance
+      << ") - consider a denser cache grid";
+  }
+
+  return ok;
+}
+//_________________________________________________________________________________
+void GetCommandLineArgs(int argc, char ** argv)
+{
+  // necessary for setting from whence it gets ModelConfiguration.xml
+  RunOpt::Instance()->ReadFromCommandLine(argc,argv);
+
+  CmdLnArgParser parser(argc,argv);
+
+  if(parser.OptionExists("pdf-set")){
+    gOptPDFSet = parser.Arg("pdf-set");
+    LOG("gpdfcachevalid", pNOTICE) << "Input PDF set: " << gOptPDFSet;
+  } else {
+    LOG("gpdfcachevalid", pFATAL)
+       << "Please specify the cached PDF set using the --pdf-set argument";
+    gAbortingInErr = true;
+    exit(1);
+  }
+
+  if(parser.OptionExists('n')){
+    gOptNPoints = parser.ArgAsInt('n');
+  }
+  if(parser.OptionExists('t')){
+    gOptTolerance = parser.ArgAsDouble('t');
+  }
+  if(parser.OptionExists('o')){
+    gOptOutFile = parser.Arg('o');
+  }
+}
+//_________________________________________________________________________________
+void GetAlgorithm(void)
+{
+  vector<string> vpdf = str::Split(gOptPDFSet, "/");
+  if(vpdf.size() != 2) {
+     LOG("gpdfcachevalid", pFATAL)
+        << "Need to specify both a PDF algorithm name and configuration "
+        << "as in genie::CachedPDF/Default";
+     gAbortingInErr = true;
+     exit(1);
+  }
+
+  AlgFactory * algf = AlgFactory::Instance();
+  gCachedPDF = dynamic_cast<const CachedPDF *> (
+                  algf->GetAlgorithm(vpdf[0], vpdf[1]));
+
+  if(!gCachedPDF) {
+     LOG("gpdfcachevalid", pFATAL)
+       << "Couldn't instantiate a cached PDF set from " << gOptPDFSet;
+     gAbortingInErr = true;
+     exit(1);
+  }
+  LOG("gpdfcachevalid", pNOTICE)
+    << "\n Instantiated: " << gCachedPDF->Id()
+    << " with the following configuration: "
+    << gCachedPDF->GetConfig();
+}
+//_________________________________________________________________________________
@@ -12,6 +12,8 @@
 #include <string>
 #include <sstream>
 
+#include <TMD5.h>
+
 #include "Framework/Algorithm/AlgFactory.h"
 #include "Framework/Algorithm/Algorithm.h"
 #include "Framework/Algorithm/AlgConfigPool.h"
@@ -25,6 +27,8 @@ using std::endl;
 using namespace genie;
 using namespace genie::utils;
 
+//____________________________________________________________________________
+unsigned long Algorithm::fgConfigGeneration = 0;
 //____________________________________________________________________________
 namespace genie
 {
@@ -234,6 +238,7 @@ void Algorithm::FindConfig(void)
       << "No Tunable parameter set available at the ConfigPool";
   }
 
+  fgConfigGeneration++ ;
   if ( fConfig ) {
     delete fConfig ;
     fConfig = 0 ;
@@ -312,6 +317,50 @@ void Algorithm::SetId(string name, string config)
   fID.SetId(name, config);
 }
 //____________________________________________________________________________
+string Algorithm::ConfigDigest(void) const
+{
+// Digest of the parameter values of this algorithm and, recursively, of
+// the sub-algorithms it points to. Item locks are not included, so the
+// digest only changes when a parameter value changes.
+
+  std::ostringstream cfg;
+  this->ConfigDigestInput(cfg, 0);
+
+  TMD5 md5;
+  md5.Update( (const UChar_t *) cfg.str().c_str(), cfg.str().size() );
+  md5.Final();
+  return string(md5.AsString());
+}
+//____________________________________________________________________________
+void Algorithm::ConfigDigestInput(ostream & stream, int depth) const
+{
+  stream << this->Id().Key() << "{";
+
+  const RgIMap & items = this->GetConfig().GetItemMap();
+  RgIMapConstIter it = items.begin();
+  for( ; it != items.end(); ++it) {
+    const RegistryItemI * ritem = it->second;
+    if(!ritem) continue;
+    stream << it->first << "=";
+    if(ritem->TypeInfo() == kRgAlg && depth < 10) {
+      RgAlg alg = this->GetConfig().GetAlg(it->first);
+      const Algorithm * sub =
+         AlgFactory::Instance()->GetAlgorithm(alg.name, alg.config);
+      if(sub) sub->ConfigDigestInput(stream, depth+1);
+      else    stream << alg;
+    } else {
+      // skip the lock status printed ahead of the value
+      std::ostringstream value;
+      ritem->Print(value);
+      string svalue = value.str();
+      size_t pos = svalue.find(" : ");
+      stream << ((pos == string::npos) ? svalue : svalue.substr(pos+3));
+    }
+    stream << ";";
+  }
+  stream << "}";
+}
+//____________________________________________________________________________
 void Algorithm::Print(ostream & stream) const
 {
   // print algorithm name & parameter-set
@@ -453,6 +502,7 @@ void Algorithm::AdoptSubstructure(void)
   }
 
 
+  fgConfigGeneration++ ;
   if ( fConfig ) {
     delete fConfig ;
     fConfig = 0 ;
@@ -477,6 +527,7 @@ void Algorithm::DeleteConfig(void)
 
   // delete owned configuration registry
 
+  fgConfigGeneration++ ;
   if(fConfig) {
     delete fConfig;
     fConfig=0;
@@ -627,6 +678,7 @@ int Algorithm::AddTopRegistry( Registry * rp, bool own ) {
   fConfVect.insert( fConfVect.begin(), rp ) ;
   fOwnerships.insert( fOwnerships.begin(), own ) ;
 
+  fgConfigGeneration++ ;
   if ( fConfig ) {
     delete fConfig ;
     fConfig = 0 ;
@@ -643,6 +695,7 @@ int Algorithm::AddLowRegistry( Registry * rp, bool own ) {
   fConfVect.push_back( rp ) ;
   fOwnerships.push_back( own ) ;
 
+  fgConfigGeneration++ ;
   if ( fConfig ) {
     delete fConfig ;
     fConfig = 0 ;
@@ -679,6 +732,7 @@ int  Algorithm::MergeTopRegistry( const Registry & r )  {
   }
 
   // The configuration has changed so the summary is not updated anymore and must be deleted
+  fgConfigGeneration++ ;
   if ( fConfig ) {
      delete fConfig ;
      fConfig = 0 ;
@@ -696,6 +750,7 @@ int Algorithm::AddTopRegisties( const vector<Registry*> & rs, bool own ) {
 
   fOwnerships.insert( fOwnerships.begin(), rs.size(), own ) ;
 
+  fgConfigGeneration++ ;
   if ( fConfig ) {
     delete fConfig ;
     fConfig = 0 ;
@@ -130,6 +130,14 @@ public:
   //! data fitting or reweighting
   void AdoptSubstructure (void);
 
+  //! MD5 digest of the configuration of the algorithm and of its
+  //! sub-algorithms, to tag data computed with this configuration
+  string ConfigDigest(void) const;
+
+  //! Counts the configuration changes of all algorithms. Data derived from
+  //! configurations, like ConfigDigest(), can be reused while it is unchanged
+  static unsigned long ConfigGeneration(void) { return fgConfigGeneration; }
+
   //! Print algorithm info
   virtual void Print(ostream & stream) const;
   friend ostream & operator << (ostream & stream, const Algorithm & alg);
@@ -198,6 +206,10 @@ private:
 
   Registry *   fConfig;        ///< Summary configuration derived from fConvVect, not necessarily allocated
 
+  static unsigned long fgConfigGeneration; ///< see ConfigGeneration()
+
+  void ConfigDigestInput(ostream & stream, int depth) const;
+
 };
 
 }       // genie namespace
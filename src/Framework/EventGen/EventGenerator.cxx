@@ -25,6 +25,7 @@
 #include "Framework/EventGen/InteractionListGeneratorI.h"
 #include "Framework/EventGen/EVGThreadException.h"
 #include "Framework/EventGen/GVldContext.h"
+#include "Framework/EventGen/RejectionLoopStats.h"
 #include "Framework/GHEP/GHepVirtualListFolder.h"
 #include "Framework/GHEP/GHepRecord.h"
 #include "Framework/GHEP/GHepFlags.h"
@@ -81,6 +82,11 @@ void EventGenerator::ProcessEventRecord(GHepRecord * event_rec) const
   //-- Reset stop-watch
   fWatch->Reset();
 
+  //-- Rejection method statistics are collected per module and energy bin
+  RejectionLoopStats * rjstats = RejectionLoopStats::Instance();
+  double E = (event_rec->Summary()) ?
+    event_rec->Summary()->InitState().ProbeE(kRfLab) : 0.;
+
   string mesgh = "Event generation thread: " + this->Id().Key() + 
                  " -> Running module: ";
 
@@ -103,14 +109,19 @@ void EventGenerator::ProcessEventRecord(GHepRecord * event_rec) const
     }
     try
     {
+      rjstats->BeginModule();
       fWatch->Start();
       visitor->ProcessEventRecord(event_rec);
       fWatch->Stop();
       fRecHistory.AddSnapshot(istep, event_rec);
       (*fEVGTime)[istep] = fWatch->CpuTime(); // sec
+      rjstats->Collect(visitor->Id().Key(), E, fWatch->CpuTime());
     }
     catch (EVGThreadException exception)
     {
+      fWatch->Stop();
+      rjstats->Collect(visitor->Id().Key(), E, fWatch->CpuTime());
+
       LOG("EventGenerator", pNOTICE)
            << "An exception was thrown and caught by EventGenerator!";
       LOG("EventGenerator", pNOTICE) << exception;
@@ -0,0 +1,87 @@
+//____________________________________________________________________________
+/*
+ Copyright (c) 2003-2023, The GENIE Collaboration
+ For the full text of the license visit http://copyright.genie-mc.org
+
+ The GENIE Collaboration
+*/
+//____________________________________________________________________________
+
+#include "Framework/EventGen/EventRecord.h"
+#include "Framework/EventGen/EventRecordPool.h"
+#include "Framework/Messenger/Messenger.h"
+
+using namespace genie;
+
+//____________________________________________________________________________
+EventRecordPool * EventRecordPool::fInstance = 0;
+//____________________________________________________________________________
+EventRecordPool::EventRecordPool() :
+fMaxFree(16),
+fNCreated(0),
+fNReused(0)
+{
+  fInstance =  0;
+}
+//____________________________________________________________________________
+EventRecordPool::~EventRecordPool()
+{
+  vector<EventRecord *>::iterator it = fFree.begin();
+  for( ; it != fFree.end(); ++it) {
+    delete (*it);
+  }
+  fFree.clear();
+
+  fInstance = 0;
+}
+//____________________________________________________________________________
+EventRecordPool * EventRecordPool::Instance()
+{
+  if(fInstance == 0) {
+    static EventRecordPool::Cleaner cleaner;
+    cleaner.DummyMethodAndSilentCompiler();
+    fInstance = new EventRecordPool;
+  }
+  return fInstance;
+}
+//____________________________________________________________________________
+EventRecord * EventRecordPool::Get(void)
+{
+  if(fFree.empty()) {
+    fNCreated++;
+    return new EventRecord;
+  }
+
+  EventRecord * event = fFree.back();
+  fFree.pop_back();
+  fNReused++;
+
+  return event;
+}
+//____________________________________________________________________________
+void EventRecordPool::Recycle(EventRecord * event)
+{
+  if(!event) return;
+
+  if(fFree.size() >= fMaxFree) {
+    delete event;
+    return;
+  }
+
+  event->ResetRecord();
+  fFree.push_back(event);
+}
+//____________________________________________________________________________
+void EventRecordPool::SetMaxFree(unsigned int n)
+{
+  fMaxFree = n;
+
+  while(fFree.size() > fMaxFree) {
+    delete fFree.back();
+    fFree.pop_back();
+  }
+
+  LOG("EventRecordPool", pINFO)
+     << "Keeping up to " << fMaxFree << " free event records";
+}
+//____________________________________________________________________________
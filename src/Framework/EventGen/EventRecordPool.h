@@ -0,0 +1,82 @@
+//____________________________________________________________________________
+/*!
+
+\class    genie::EventRecordPool
+
+\brief    A pool of EventRecord objects re-used from event to event.
+          The interaction selectors bootstrap each event with a record taken
+          from the pool. Records handed back to the pool (normally via
+          GMCJDriver::RecycleEvent() or GEVGDriver::RecycleEvent(), once the
+          event has been written out) are reset in place, keeping their
+          particle slots, 4-vectors and flag objects, so that the event
+          generation loop stops allocating records once the pool has warmed up.
+          A recycled record must not be used (or deleted) by its previous owner.
+
+\author   The GENIE Collaboration
+
+\created  October 16, 2026
+
+\cpright  Copyright (c) 2003-2023, The GENIE Collaboration
+          For the full text of the license visit http://copyright.genie-mc.org
+*/
+//____________________________________________________________________________
+
+#ifndef _EVENT_RECORD_POOL_H_
+#define _EVENT_RECORD_POOL_H_
+
+#include <vector>
+
+using std::vector;
+
+namespace genie {
+
+class EventRecord;
+
+class EventRecordPool
+{
+public:
+  static EventRecordPool * Instance(void);
+
+  //! get an empty record - the caller owns it until it is recycled
+  EventRecord * Get     (void);
+
+  //! hand back a record; it is reset and kept for a later Get(), or deleted
+  //! if the pool already holds its maximum number of free records
+  void          Recycle (EventRecord * event);
+
+  void          SetMaxFree (unsigned int n);
+
+  unsigned int  MaxFree    (void) const { return fMaxFree;      }
+  unsigned int  NFree      (void) const { return fFree.size();  }
+  unsigned long NCreated   (void) const { return fNCreated;     }
+  unsigned long NReused    (void) const { return fNReused;      }
+
+private:
+  EventRecordPool();
+  EventRecordPool(const EventRecordPool & pool);
+  virtual ~EventRecordPool();
+
+  //! self
+  static EventRecordPool * fInstance;
+
+  vector<EventRecord *> fFree;      ///< reset records, ready for re-use
+  unsigned int          fMaxFree;   ///< max number of free records kept
+  unsigned long         fNCreated;  ///< number of records allocated by Get()
+  unsigned long         fNReused;   ///< number of records re-used by Get()
+
+  //! clean
+  struct Cleaner {
+      void DummyMethodAndSilentCompiler() { }
+      ~Cleaner() {
+         if (EventRecordPool::fInstance !=0) {
+            delete EventRecordPool::fInstance;
+            EventRecordPool::fInstance = 0;
+         }
+      }
+  };
+  friend struct Cleaner;
+};
+
+}      // genie namespace
+
+#endif // _EVENT_RECORD_POOL_H_
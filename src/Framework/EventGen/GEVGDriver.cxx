@@ -21,6 +21,7 @@
 #include "Framework/Conventions/Units.h"
 #include "Framework/EventGen/GEVGDriver.h"
 #include "Framework/EventGen/EventRecord.h"
+#include "Framework/EventGen/EventRecordPool.h"
 #include "Framework/EventGen/EventGeneratorList.h"
 #include "Framework/EventGen/EventGeneratorI.h"
 #include "Framework/EventGen/ToyInteractionSelector.h"
@@ -37,6 +38,7 @@
 #include "Framework/ParticleData/PDGCodes.h"
 #include "Framework/ParticleData/PDGUtils.h"
 #include "Framework/ParticleData/PDGLibrary.h"
+#include "Framework/Utils/Cache.h"
 #include "Framework/Utils/XSecSplineList.h"
 #include "Framework/Utils/PrintUtils.h"
 
@@ -227,6 +229,10 @@ void GEVGDriver::SetUnphysEventMask(const TBits & mask)
 //___________________________________________________________________________
 EventRecord * GEVGDriver::GenerateEvent(const TLorentzVector & nu4p)
 {
+  //-- No cache branch is in use between events: trim the cache if it has
+  //   grown beyond its memory budget
+  Cache::Instance()->EnforceBudget();
+
   //-- Build initial state information from inputs
   LOG("GEVGDriver", pINFO) << "Creating the initial state";
   InitialState init_state(*fInitState);
@@ -309,7 +315,7 @@ EventRecord * GEVGDriver::GenerateEvent(const TLorentzVector & nu4p)
      } else {
        LOG("GEVGDriver", pWARN)
           << "The generated unphysical event is rejected";
-       delete fCurrentRecord;
+       this->RecycleEvent(fCurrentRecord);
        fCurrentRecord = 0;
        fNRecLevel++; // increase the nested level counter
 
@@ -321,7 +327,6 @@ EventRecord * GEVGDriver::GenerateEvent(const TLorentzVector & nu4p)
           LOG("GEVGDriver", pERROR)
                << "Could not produce a physical event after "
                       << kRecursiveModeMaxDepth << " attempts!";
-          delete fCurrentRecord;
           fCurrentRecord = 0;
           fNRecLevel = 0;
           return 0;
@@ -331,6 +336,15 @@ EventRecord * GEVGDriver::GenerateEvent(const TLorentzVector & nu4p)
   }
 }
 //___________________________________________________________________________
+void GEVGDriver::RecycleEvent(EventRecord * event)
+{
+// Hand back an event returned by GenerateEvent(), once the caller is done
+// with it, instead of deleting it. The record is reset and re-used for a
+// later event. The caller must not access (or delete) the event afterwards.
+
+  EventRecordPool::Instance()->Recycle(event);
+}
+//___________________________________________________________________________
 const InteractionList * GEVGDriver::Interactions(void) const
 {
 // Returns the list of all interactions that can be generated by this driver
@@ -658,6 +672,7 @@ void GEVGDriver::CreateSplines(int nknots, double emax, bool useLogE)
                << "The spline wasn't loaded at initialization. "
                << "I can build it now but it might take a while...";
              xsl->CreateSpline(alg, interaction) ;
+             Cache::Instance()->EnforceBudget();
          } else {
              SLOG("GEVGDriver", pDEBUG) << "Spline was found";
          }
@@ -71,6 +71,9 @@ public :
   // Generate single event
   EventRecord * GenerateEvent (const TLorentzVector & nu4p);
 
+  // Hand back a generated event (instead of deleting it) for re-use
+  void RecycleEvent (EventRecord * event);
+
   // Get the list of all interactions that can be simulated for the specified
   // initial state (depends on which event generation threads were loaded into
   // the event generation driver driver)
@@ -20,6 +20,7 @@
 #include "Framework/Conventions/Units.h"
 #include "Framework/Conventions/Controls.h"
 #include "Framework/EventGen/EventRecord.h"
+#include "Framework/EventGen/EventRecordPool.h"
 #include "Framework/EventGen/GMCJDriver.h"
 #include "Framework/EventGen/GEVGDriver.h"
 #include "Framework/EventGen/GEVGPool.h"
@@ -841,6 +842,17 @@ EventRecord * GMCJDriver::GenerateEvent(void)
   return 0;
 }
 //___________________________________________________________________________
+void GMCJDriver::RecycleEvent(EventRecord * event)
+{
+// Hand back an event returned by GenerateEvent(), typically once it has been
+// added to the output ntuple, instead of deleting it. The record is reset in
+// place and re-used for a later event, so that a generation loop recycling
+// its events does not keep re-allocating event records.
+// The caller must not access (or delete) the event afterwards.
+
+  EventRecordPool::Instance()->Recycle(event);
+}
+//___________________________________________________________________________
 EventRecord * GMCJDriver::GenerateEvent1Try(void)
 {
 // attempt generating a neutrino interaction by firing a single flux neutrino
@@ -72,6 +72,9 @@ public :
   // generate single neutrino event for input flux & geometry
   EventRecord * GenerateEvent (void);
 
+  // hand back a generated event (instead of deleting it) for re-use
+  void          RecycleEvent  (EventRecord * event);
+
   // info needed for computing the generated sample normalization
   double   GlobProbScale  (void) const { return fGlobPmax;                  }
   long int NFluxNeutrinos (void) const { return (long int) fNFluxNeutrinos; }
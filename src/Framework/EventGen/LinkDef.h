@@ -14,6 +14,8 @@
 #pragma link C++ class genie::EventGeneratorList;
 #pragma link C++ class genie::EventGeneratorListAssembler;
 #pragma link C++ class genie::RunningThreadInfo;
+#pragma link C++ class genie::EventRecordPool;
+#pragma link C++ class genie::RejectionLoopStats;
 #pragma link C++ class genie::InteractionSelectorI;
 #pragma link C++ class genie::ToyInteractionSelector;
 #pragma link C++ class genie::PhysInteractionSelector;
@@ -20,6 +20,7 @@
 #include "Framework/Conventions/Units.h"
 #include "Framework/EventGen/PhysInteractionSelector.h"
 #include "Framework/EventGen/EventRecord.h"
+#include "Framework/EventGen/EventRecordPool.h"
 #include "Framework/EventGen/EventGeneratorI.h"
 #include "Framework/EventGen/InteractionList.h"
 #include "Framework/EventGen/InteractionGeneratorMap.h"
@@ -191,7 +192,7 @@ EventRecord * PhysInteractionSelector::SelectInteraction
          << "Selected interaction: " << selected_interaction->AsString();
 
        // bootstrap the event record
-       EventRecord * evrec = new EventRecord;
+       EventRecord * evrec = EventRecordPool::Instance()->Get();
        evrec->AttachSummary(selected_interaction);
        evrec->SetXSec(xsec);
 
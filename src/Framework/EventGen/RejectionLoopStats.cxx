@@ -0,0 +1,175 @@
+//____________________________________________________________________________
+/*
+ Copyright (c) 2003-2023, The GENIE Collaboration
+ For the full text of the license visit http://copyright.genie-mc.org
+
+ The GENIE Collaboration
+*/
+//____________________________________________________________________________
+
+#include <cstring>
+#include <iomanip>
+
+#include <TMath.h>
+#include <TTree.h>
+
+#include "Framework/EventGen/RejectionLoopStats.h"
+
+using std::endl;
+using std::setw;
+using std::setprecision;
+
+using namespace genie;
+
+//____________________________________________________________________________
+namespace genie {
+  ostream & operator << (ostream & stream, const RejectionLoopStats & stats)
+  {
+    stats.Print(stream);
+    return stream;
+  }
+}
+//____________________________________________________________________________
+RejectionLoopStats * RejectionLoopStats::fInstance = 0;
+//____________________________________________________________________________
+RejectionLoopStats::RejectionLoopStats() :
+fTrials(0),
+fAccepted(0),
+fViolations(0),
+fBinsPerDecade(10)
+{
+  fInstance =  0;
+}
+//____________________________________________________________________________
+RejectionLoopStats::~RejectionLoopStats()
+{
+  fInstance = 0;
+}
+//____________________________________________________________________________
+RejectionLoopStats * RejectionLoopStats::Instance()
+{
+  if(fInstance == 0) {
+    static RejectionLoopStats::Cleaner cleaner;
+    cleaner.DummyMethodAndSilentCompiler();
+    fInstance = new RejectionLoopStats;
+  }
+  return fInstance;
+}
+//____________________________________________________________________________
+void RejectionLoopStats::BeginModule(void)
+{
+  fTrials     = 0;
+  fAccepted   = 0;
+  fViolations = 0;
+}
+//____________________________________________________________________________
+void RejectionLoopStats::Collect(
+                        const string & module, double E, double cpu_time)
+{
+  Entry & entry = fTotals[ std::make_pair(module, this->EnergyBin(E)) ];
+  entry.calls      += 1;
+  entry.trials     += fTrials;
+  entry.accepted   += fAccepted;
+  entry.violations += fViolations;
+  entry.time       += TMath::Max(0., cpu_time);
+
+  this->BeginModule();
+}
+//____________________________________________________________________________
+int RejectionLoopStats::EnergyBin(double E) const
+{
+  if(E <= 0.) return -9999;
+  return TMath::FloorNint(TMath::Log10(E) * fBinsPerDecade);
+}
+//____________________________________________________________________________
+double RejectionLoopStats::BinLowEdge(int ebin) const
+{
+  return TMath::Power(10., double(ebin) / fBinsPerDecade);
+}
+//____________________________________________________________________________
+double RejectionLoopStats::BinUpEdge(int ebin) const
+{
+  return TMath::Power(10., double(ebin + 1) / fBinsPerDecade);
+}
+//____________________________________________________________________________
+TTree * RejectionLoopStats::CreateTree(const char * name) const
+{
+  char      module[256];
+  double    elow, ehigh, time;
+  ULong64_t calls, trials, accepted, violations;
+
+  TTree * tree = new TTree(name, "GENIE rejection method statistics");
+  tree->Branch("module",     module,      "module/C");
+  tree->Branch("elow",       &elow,       "elow/D");
+  tree->Branch("ehigh",      &ehigh,      "ehigh/D");
+  tree->Branch("calls",      &calls,      "calls/l");
+  tree->Branch("trials",     &trials,     "trials/l");
+  tree->Branch("accepted",   &accepted,   "accepted/l");
+  tree->Branch("violations", &violations, "violations/l");
+  tree->Branch("time",       &time,       "time/D");
+
+  map< std::pair<string,int>, Entry >::const_iterator it;
+  for(it = fTotals.begin(); it != fTotals.end(); ++it) {
+    const Entry & entry = it->second;
+    if(entry.trials == 0) continue;
+
+    std::strncpy(module, it->first.first.c_str(), sizeof(module) - 1);
+    module[sizeof(module) - 1] = '\0';
+    elow       = this->BinLowEdge(it->first.second);
+    ehigh      = this->BinUpEdge (it->first.second);
+    calls      = entry.calls;
+    trials     = entry.trials;
+    accepted   = entry.accepted;
+    violations = entry.violations;
+    time       = entry.time;
+    tree->Fill();
+  }
+
+  return tree;
+}
+//____________________________________________________________________________
+void RejectionLoopStats::Print(ostream & stream) const
+{
+  // Sum over energy bins
+  map<string, Entry> sums;
+  map< std::pair<string,int>, Entry >::const_iterator it;
+  for(it = fTotals.begin(); it != fTotals.end(); ++it) {
+    const Entry & entry = it->second;
+    Entry & sum = sums[ it->first.first ];
+    sum.calls      += entry.calls;
+    sum.trials     += entry.trials;
+    sum.accepted   += entry.accepted;
+    sum.violations += entry.violations;
+    sum.time       += entry.time;
+  }
+
+  stream << "\n[-] Rejection method statistics" << endl;
+  stream << setw(60) << "module"     << " | "
+         << setw(10) << "calls"      << " | "
+         << setw(12) << "trials"     << " | "
+         << setw(10) << "accepted"   << " | "
+         << setw(10) << "trials/acc" << " | "
+         << setw(10) << "violations" << " | "
+         << setw(10) << "time (s)"   << endl;
+
+  map<string, Entry>::const_iterator sit;
+  for(sit = sums.begin(); sit != sums.end(); ++sit) {
+    const Entry & sum = sit->second;
+    if(sum.trials == 0) continue;
+    double cost = (sum.accepted > 0) ? double(sum.trials) / sum.accepted : 0.;
+    stream << setw(60) << sit->first     << " | "
+           << setw(10) << sum.calls      << " | "
+           << setw(12) << sum.trials     << " | "
+           << setw(10) << sum.accepted   << " | "
+           << setw(10) << setprecision(4) << cost << " | "
+           << setw(10) << sum.violations << " | "
+           << setw(10) << setprecision(4) << sum.time << endl;
+  }
+}
+//____________________________________________________________________________
+void RejectionLoopStats::Reset(void)
+{
+  this->BeginModule();
+  fTotals.clear();
+}
+//____________________________________________________________________________
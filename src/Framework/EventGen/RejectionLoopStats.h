@@ -0,0 +1,119 @@
+//____________________________________________________________________________
+/*!
+
+\class    genie::RejectionLoopStats
+
+\brief    Collects rejection method statistics for the event generation
+          modules: number of calls, trials (differential cross section
+          evaluations), accepted trials, maximum cross section violations and
+          CPU time, per module and per probe energy bin.
+
+          Kinematics generators only increment the counters of the module
+          currently running (Trial, Violation). The EventGenerator resets
+          them before invoking each of its modules and adds them, together
+          with the module timing it already measures, to the totals for the
+          module and the current energy bin (Collect). Totals are kept for
+          the whole job and are written to the output event file by the
+          NtpWriter.
+
+\author   The GENIE Collaboration
+
+\created  October 16, 2026
+
+\cpright  Copyright (c) 2003-2023, The GENIE Collaboration
+          For the full text of the license visit http://copyright.genie-mc.org
+*/
+//____________________________________________________________________________
+
+#ifndef _REJECTION_LOOP_STATS_H_
+#define _REJECTION_LOOP_STATS_H_
+
+#include <map>
+#include <ostream>
+#include <string>
+#include <utility>
+
+using std::map;
+using std::ostream;
+using std::string;
+
+class TTree;
+
+namespace genie {
+
+class RejectionLoopStats;
+ostream & operator << (ostream & stream, const RejectionLoopStats & stats);
+
+class RejectionLoopStats
+{
+public:
+  static RejectionLoopStats * Instance(void);
+
+  //! counters for the module currently running
+  void Trial     (bool accepted) { fTrials++; if(accepted) fAccepted++; }
+  void Violation (void)          { fViolations++; }
+
+  //! called by the EventGenerator around each module
+  void BeginModule (void);
+  void Collect     (const string & module, double E, double cpu_time);
+
+  //! totals per module and energy bin
+  struct Entry {
+    Entry() : calls(0), trials(0), accepted(0), violations(0), time(0.) {}
+    unsigned long calls;
+    unsigned long trials;
+    unsigned long accepted;
+    unsigned long violations;
+    double        time;
+  };
+
+  //! energy bin edges for a given bin index
+  double BinLowEdge (int ebin) const;
+  double BinUpEdge  (int ebin) const;
+
+  //! creates a TTree holding the totals (modules with trials only) in the
+  //! current directory, which owns it
+  TTree * CreateTree (const char * name = "rjstats") const;
+
+  void Print (ostream & stream) const;
+  void Reset (void);
+
+  friend ostream & operator << (ostream & stream, const RejectionLoopStats & stats);
+
+private:
+  RejectionLoopStats();
+  RejectionLoopStats(const RejectionLoopStats & stats);
+  virtual ~RejectionLoopStats();
+
+  int EnergyBin (double E) const;
+
+  //! self
+  static RejectionLoopStats * fInstance;
+
+  //! counters for the module currently running
+  unsigned long fTrials;
+  unsigned long fAccepted;
+  unsigned long fViolations;
+
+  //! energy bins per decade
+  int fBinsPerDecade;
+
+  //! totals, keyed by module and energy bin
+  map< std::pair<string,int>, Entry > fTotals;
+
+  //! clean
+  struct Cleaner {
+      void DummyMethodAndSilentCompiler() { }
+      ~Cleaner() {
+         if (RejectionLoopStats::fInstance !=0) {
+            delete RejectionLoopStats::fInstance;
+            RejectionLoopStats::fInstance = 0;
+         }
+      }
+  };
+  friend struct Cleaner;
+};
+
+}      // genie namespace
+
+#endif // _REJECTION_LOOP_STATS_H_
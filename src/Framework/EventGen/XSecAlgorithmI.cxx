@@ -35,6 +35,18 @@ Algorithm(name, config)
 XSecAlgorithmI::~XSecAlgorithmI()
 {
 
+}
+//___________________________________________________________________________
+void XSecAlgorithmI::IntegralBatch(const Interaction* in,
+        const std::vector<double> & energies, std::vector<double> & xsec) const
+{
+  xsec.assign(energies.size(), 0.);
+
+  Interaction interaction(*in);
+  for(unsigned int i = 0; i < energies.size(); i++) {
+    interaction.InitStatePtr()->SetProbeOnShellE(energies[i]);
+    xsec[i] = this->Integral(&interaction);
+  }
 }
 //___________________________________________________________________________
 bool XSecAlgorithmI::ValidKinematics(const Interaction* interaction) const
@@ -18,6 +18,8 @@
 #ifndef _XSEC_ALGORITHM_I_H_
 #define _XSEC_ALGORITHM_I_H_
 
+#include <vector>
+
 #include "Framework/Algorithm/Algorithm.h"
 #include "Framework/Conventions/KinePhaseSpace.h"
 #include "Framework/Interaction/Interaction.h"
@@ -36,6 +38,13 @@ public:
   //! input interaction (kinematical cuts can be included)
   virtual double Integral (const Interaction* i) const = 0;
 
+  //! Integrate the model at each of the input (lab frame) probe energies.
+  //! The default implementation calls Integral() for each energy, in the
+  //! input order. Models can override it to share work across energies.
+  virtual void IntegralBatch (const Interaction* i,
+                              const std::vector<double> & energies,
+                              std::vector<double> & xsec) const;
+
   //! Can this cross section algorithm handle the input process?
   virtual bool ValidProcess    (const Interaction* i) const = 0;
 
@@ -11,6 +11,7 @@
 #include <cstdlib>
 #include <cassert>
 #include <iomanip>
+#include <algorithm>
 
 #include <TMath.h>
 #include <TRootIOCtor.h>
@@ -233,6 +234,31 @@ void GHepParticle::SetPdgCode(int code)
   this->AssertIsKnownParticle();
 }
 //___________________________________________________________________________
+void GHepParticle::Set(int pdg, GHepStatus_t status,
+        int mother1, int mother2, int daughter1, int daughter2,
+        double px, double py, double pz, double En,
+        double x, double y, double z, double t)
+{
+// Same as the TParticle-like constructor, but for an existing particle.
+// Its 4-vectors (if any) are re-used rather than re-allocated.
+
+  this->SetPdgCode(pdg);
+
+  fStatus         = status;
+  fFirstMother    = mother1;
+  fLastMother     = mother2;
+  fFirstDaughter  = daughter1;
+  fLastDaughter   = daughter2;
+  fRescatterCode  = -1;
+  fPolzTheta      = -999;
+  fPolzPhi        = -999;
+  fIsBound        = false;
+  fRemovalEnergy  = 0.;
+
+  this->SetMomentum(px,py,pz,En);
+  this->SetPosition(x,y,z,t);
+}
+//___________________________________________________________________________
 void GHepParticle::SetMomentum(const TLorentzVector & p4)
 {
   if(fP4)
@@ -532,6 +558,26 @@ void GHepParticle::Copy(const GHepParticle & particle)
   this->fRemovalEnergy = particle.fRemovalEnergy;
 }
 //___________________________________________________________________________
+void GHepParticle::Swap(GHepParticle & particle)
+{
+// Exchange contents with the input particle. The 4-vectors are exchanged
+// by pointer, so nothing is allocated or copied.
+
+  std::swap( fPdgCode,       particle.fPdgCode       );
+  std::swap( fStatus,        particle.fStatus        );
+  std::swap( fRescatterCode, particle.fRescatterCode );
+  std::swap( fFirstMother,   particle.fFirstMother   );
+  std::swap( fLastMother,    particle.fLastMother    );
+  std::swap( fFirstDaughter, particle.fFirstDaughter );
+  std::swap( fLastDaughter,  particle.fLastDaughter  );
+  std::swap( fP4,            particle.fP4            );
+  std::swap( fX4,            particle.fX4            );
+  std::swap( fPolzTheta,     particle.fPolzTheta     );
+  std::swap( fPolzPhi,       particle.fPolzPhi       );
+  std::swap( fRemovalEnergy, particle.fRemovalEnergy );
+  std::swap( fIsBound,       particle.fIsBound       );
+}
+//___________________________________________________________________________
 void GHepParticle::AssertIsKnownParticle(void) const
 {
   TParticlePDG * p = PDGLibrary::Instance()->Find(fPdgCode);
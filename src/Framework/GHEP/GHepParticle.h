@@ -134,6 +134,13 @@ public :
   void SetFirstDaughter  (int d)          { fFirstDaughter = d; }
   void SetLastDaughter   (int d)          { fLastDaughter  = d; }
 
+  // Set all the TParticle-like fields at once, re-using the 4-vectors
+  // (used by GHepRecord to re-fill particle slots kept from earlier events)
+  void Set (int pdg, GHepStatus_t status,
+             int mother1, int mother2, int daughter1, int daughter2,
+                    double px, double py, double pz, double E,
+                            double x, double y, double z, double t);
+
   // Set the momentum & position 4-vectors
   void SetMomentum (const TLorentzVector & p4);
   void SetPosition (const TLorentzVector & v4);
@@ -158,6 +165,7 @@ public :
   void Reset   (void);
   void Clear   (Option_t * option);
   void Copy    (const GHepParticle & particle);
+  void Swap    (GHepParticle & particle);
   void Print   (ostream & stream) const;
   void Print   (Option_t * opt)   const;
 
@@ -105,8 +105,8 @@ GHepParticle * GHepRecord::Particle(int position) const
 {
 // Returns the GHepParticle from the specified position of the event record.
 
-  if( position >=0 && position < this->GetEntries() ) {
-     GHepParticle * particle = (GHepParticle *) (*this)[position];
+  if( position >=0 && position < this->GetEntriesFast() ) {
+     GHepParticle * particle = (GHepParticle *) this->UncheckedAt(position);
      if(particle) return particle;
   }
   LOG("GHEP", pINFO)
@@ -123,7 +123,7 @@ GHepParticle * GHepRecord::FindParticle(
 
   int nentries = this->GetEntries();
   for(int i = start; i < nentries; i++) {
-     GHepParticle * p = (GHepParticle *) (*this)[i];
+     GHepParticle * p = (GHepParticle *) this->UncheckedAt(i);
      if(p->Status() == status && p->Pdg() == pdg) return p;
   }
 
@@ -142,7 +142,7 @@ int GHepRecord::ParticlePosition(
 
   int nentries = this->GetEntries();
   for(int i = start; i < nentries; i++) {
-     GHepParticle * p = (GHepParticle *) (*this)[i];
+     GHepParticle * p = (GHepParticle *) this->UncheckedAt(i);
      if(p->Status() == status && p->Pdg() == pdg) return i;
   }
 
@@ -160,7 +160,7 @@ int GHepRecord::ParticlePosition(GHepParticle * particle, int start) const
 
   int nentries = this->GetEntries();
   for(int i = start; i < nentries; i++) {
-     GHepParticle * p = (GHepParticle *) (*this)[i];
+     GHepParticle * p = (GHepParticle *) this->UncheckedAt(i);
      if( p->Compare(particle) ) return i;
   }
 
@@ -190,7 +190,7 @@ vector<int> * GHepRecord::GetStableDescendants(int position) const
 
   for(int i = 0; i < nentries; i++) {
     if(i==position) continue;
-    GHepParticle * p = (GHepParticle *) (*this)[i];
+    GHepParticle * p = (GHepParticle *) this->UncheckedAt(i);
     if(p->Status() != kIStStableFinalState) continue;
     bool is_descendant=false;
     int mom = p->FirstMother();
@@ -478,8 +478,9 @@ unsigned int GHepRecord::NEntries(int pdg, GHepStatus_t ist, int start) const
 {
   unsigned int nentries = 0;
 
-  for(int i = start; i < this->GetEntries(); i++) {
-     GHepParticle * p = (GHepParticle *) (*this)[i];
+  int n = this->GetEntries();
+  for(int i = start; i < n; i++) {
+     GHepParticle * p = (GHepParticle *) this->UncheckedAt(i);
      if(p->Pdg()==pdg && p->Status()==ist) nentries++;
   }
   return nentries;
@@ -489,8 +490,9 @@ unsigned int GHepRecord::NEntries(int pdg, int start) const
 {
   unsigned int nentries = 0;
 
-  for(int i = start; i < this->GetEntries(); i++) {
-     GHepParticle * p = (GHepParticle *) (*this)[i];
+  int n = this->GetEntries();
+  for(int i = start; i < n; i++) {
+     GHepParticle * p = (GHepParticle *) this->UncheckedAt(i);
      if(p->Pdg()==pdg) nentries++;
   }
   return nentries;
@@ -506,7 +508,8 @@ void GHepRecord::AddParticle(const GHepParticle & p)
   LOG("GHEP", pINFO)
     << "Adding particle with pdgc = " << p.Pdg() << " at slot = " << pos;
 #endif
-  new ((*this)[pos]) GHepParticle(p);
+  GHepParticle * slot = (GHepParticle *) this->ConstructedAt(pos);
+  slot->Copy(p);
 
   // Update the mother's daughter list. If the newly inserted particle broke
   // compactification, then run CompactifyDaughterLists()
@@ -525,7 +528,9 @@ void GHepRecord::AddParticle(
   LOG("GHEP", pINFO)
            << "Adding particle with pdgc = " << pdg << " at slot = " << pos;
 #endif
-  new ((*this)[pos]) GHepParticle(pdg,status, mom1,mom2,dau1,dau2, p, v);
+  GHepParticle * slot = (GHepParticle *) this->ConstructedAt(pos);
+  slot->Set(pdg, status, mom1, mom2, dau1, dau2,
+            p.Px(), p.Py(), p.Pz(), p.E(), v.X(), v.Y(), v.Z(), v.T());
 
   // Update the mother's daughter list. If the newly inserted particle broke
   // compactification, then run CompactifyDaughterLists()
@@ -545,8 +550,8 @@ void GHepRecord::AddParticle(
   LOG("GHEP", pINFO)
            << "Adding particle with pdgc = " << pdg << " at slot = " << pos;
 #endif
-  new ( (*this)[pos] ) GHepParticle (
-            pdg, status, mom1, mom2, dau1, dau2, px, py, pz, E, x, y, z, t);
+  GHepParticle * slot = (GHepParticle *) this->ConstructedAt(pos);
+  slot->Set(pdg, status, mom1, mom2, dau1, dau2, px, py, pz, E, x, y, z, t);
 
   // Update the mother's daughter list. If the newly inserted particle broke
   // compactification, then run CompactifyDaughterLists()
@@ -761,12 +766,8 @@ void GHepRecord::SwapParticles(int i, int j)
 
   GHepParticle * pi  = this->Particle(i);
   GHepParticle * pj  = this->Particle(j);
-  GHepParticle * tmp = new GHepParticle(*pi);
 
-  pi->Copy(*pj);
-  pj->Copy(*tmp);
-
-  delete tmp;
+  pi->Swap(*pj);
 
   // tell their daughters
   if(pi->HasDaughters()) {
@@ -801,26 +802,22 @@ void GHepRecord::FinalizeDaughterLists(void)
 // Update all daughter-lists based on particle 'first mother' field.
 // To work correctly, the daughter-lists must have been compactified first.
 
-  GHepParticle * p1 = 0;
-  TIter iter1(this);
-  int i1=0;
-  while( (p1 = (GHepParticle *)iter1.Next()) ) {
-    int dau1 = -1;
-    int dau2 = -1;
-    GHepParticle * p2 = 0;
-    TIter iter2(this);
-    int i2=0;
-    while( (p2 = (GHepParticle *)iter2.Next()) ) {
-
-       if(p2->FirstMother() == i1) {
-          dau1 = (dau1<0) ? i2 : TMath::Min(dau1,i2);
-          dau2 = (dau2<0) ? i2 : TMath::Max(dau2,i2);
-       }
-       i2++;
-    }
-    i1++;
-    p1 -> SetFirstDaughter (dau1);
-    p1 -> SetLastDaughter  (dau2);
+  int n = this->GetEntries();
+
+  for(int i = 0; i < n; i++) {
+    GHepParticle * p = (GHepParticle *) this->UncheckedAt(i);
+    p -> SetFirstDaughter (-1);
+    p -> SetLastDaughter  (-1);
+  }
+  // a single pass over the daughters, each updating its mother's list
+  for(int i = 0; i < n; i++) {
+    int mom_pos = ((GHepParticle *) this->UncheckedAt(i))->FirstMother();
+    if(mom_pos < 0 || mom_pos >= n) continue;
+    GHepParticle * mom = (GHepParticle *) this->UncheckedAt(mom_pos);
+    int dau1 = mom->FirstDaughter();
+    int dau2 = mom->LastDaughter();
+    mom -> SetFirstDaughter ( (dau1<0) ? i : TMath::Min(dau1,i) );
+    mom -> SetLastDaughter  ( (dau2<0) ? i : TMath::Max(dau2,i) );
   }
 }
 //___________________________________________________________________________
@@ -873,11 +870,42 @@ void GHepRecord::CleanRecord(void)
 //___________________________________________________________________________
 void GHepRecord::ResetRecord(void)
 {
+// Resets the record so that it can be re-used for a new event.
+// The record is reset in place: the particle slots (along with their
+// 4-vectors) and the vertex, flag and mask objects are kept and are re-filled
+// by the next event, so that a record re-used from event to event no longer
+// allocates memory once it has seen its largest event.
+
 #ifdef __GENIE_LOW_LEVEL_MESG_ENABLED__
   LOG("GHEP", pDEBUG) << "Reseting GHepRecord";
 #endif
-  this->CleanRecord();
-  this->InitRecord();
+
+  if(!fVtx || !fEventFlags || !fEventMask) {
+    // eg a record created with the ROOT I/O constructor
+    this->CleanRecord();
+    this->InitRecord();
+    return;
+  }
+
+  if (fInteraction) delete fInteraction;
+  fInteraction  = 0;
+  fWeight       = 1.;
+  fProb         = 1.;
+  fXSec         = 0.;
+  fDiffXSec     = 0.;
+  fDiffXSecPhSp = kPSNull;
+
+  fVtx->SetXYZT(0,0,0,0);
+
+  fEventFlags -> ResetAllBits(false);
+  for(unsigned int i = 0; i < GHepFlags::NFlags(); i++) {
+   fEventMask->SetBitNumber(i, true);
+  }
+
+  // Empty the array but keep the constructed GHepParticles in the slots:
+  // AddParticle() re-fills them via ConstructedAt()
+  TClonesArray::Clear();
+  this->SetOwner(true);
 }
 //___________________________________________________________________________
 void GHepRecord::Clear(Option_t * opt)
@@ -913,8 +941,10 @@ void GHepRecord::Copy(const GHepRecord & record)
   unsigned int ientry = 0;
   GHepParticle * p = 0;
   TIter ghepiter(&record);
-  while ( (p = (GHepParticle *) ghepiter.Next()) )
-                              new ( (*this)[ientry++] ) GHepParticle(*p);
+  while ( (p = (GHepParticle *) ghepiter.Next()) ) {
+    GHepParticle * slot = (GHepParticle *) this->ConstructedAt(ientry++);
+    slot->Copy(*p);
+  }
 
   // copy summary
   fInteraction = new Interaction( *record.fInteraction );
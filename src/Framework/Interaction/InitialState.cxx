@@ -180,6 +180,17 @@ void InitialState::SetProbeE(double E)
   fProbeP4 -> SetPz ( E );
 }
 //___________________________________________________________________________
+void InitialState::SetProbeOnShellE(double E)
+{
+  double m  = this->Probe()->Mass();
+  double pz = (m > 0.) ? TMath::Sqrt(TMath::Max(0., E*E - m*m)) : E;
+
+  fProbeP4 -> SetE  ( E );
+  fProbeP4 -> SetPx ( 0.);
+  fProbeP4 -> SetPy ( 0.);
+  fProbeP4 -> SetPz ( pz);
+}
+//___________________________________________________________________________
 void InitialState::SetProbeP4(const TLorentzVector & P4)
 {
   fProbeP4 -> SetE  ( P4.E()  );
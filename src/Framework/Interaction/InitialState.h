@@ -67,6 +67,7 @@ public:
   Target *         TgtPtr     (void) const { return  fTgt; }
   TLorentzVector * GetTgtP4   (RefFrame_t rf = kRfLab) const;
   TLorentzVector * GetProbeP4 (RefFrame_t rf = kRfHitNucRest) const;
+  const TLorentzVector & ProbeP4Lab (void) const { return *fProbeP4; } ///< no copy, in LAB-frame
   double           ProbeE     (RefFrame_t rf) const;
   double           CMEnergy   () const; ///< centre-of-mass energy (sqrt s)
 
@@ -76,6 +77,7 @@ public:
   void SetTgtP4    (const TLorentzVector & P4); // in LAB-frame
   void SetProbeP4  (const TLorentzVector & P4); // in LAB-frame
   void SetProbeE   (double E);                  // in LAB-frame (0,0,E,E)
+  void SetProbeOnShellE (double E);             // in LAB-frame (0,0,pz,E), pz from the probe mass
 
   bool IsNuP    (void) const; ///< is neutrino      + proton?
   bool IsNuN    (void) const; ///< is neutrino      + neutron?
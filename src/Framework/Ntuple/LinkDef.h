@@ -14,5 +14,10 @@
 #pragma link C++ class genie::NtpMCRecordI;
 #pragma link C++ class genie::NtpMCEventRecord;
 #pragma link C++ class genie::NtpWriter;
+#pragma link C++ class genie::NtpOutputI;
+#pragma link C++ class genie::NtpGSTOutput;
+#pragma link C++ class genie::NtpRooTrackerOutput;
+#pragma link C++ class genie::NtpTopoSummary;
+#pragma link C++ class genie::NtpTopoIndexOutput;
 
 #endif
@@ -0,0 +1,507 @@
+//____________________________________________________________________________
+/*
+ Copyright (c) 2003-2023, The GENIE Collaboration
+ For the full text of the license visit http://copyright.genie-mc.org
+
+ The GENIE Collaboration
+*/
+//____________________________________________________________________________
+
+#include <cstdlib>
+
+#include <TTree.h>
+#include <TMath.h>
+#include <TLorentzVector.h>
+
+#include "Framework/Conventions/Constants.h"
+#include "Framework/Conventions/Units.h"
+#include "Framework/EventGen/EventRecord.h"
+#include "Framework/GHEP/GHepStatus.h"
+#include "Framework/GHEP/GHepParticle.h"
+#include "Framework/GHEP/GHepUtils.h"
+#include "Framework/Interaction/Interaction.h"
+#include "Framework/Messenger/Messenger.h"
+#include "Framework/Ntuple/NtpGSTOutput.h"
+#include "Framework/ParticleData/BaryonResonance.h"
+#include "Framework/ParticleData/PDGCodes.h"
+#include "Framework/ParticleData/PDGUtils.h"
+#include "Framework/Utils/StringUtils.h"
+
+using namespace genie;
+using namespace genie::constants;
+
+//____________________________________________________________________________
+NtpGSTOutput::NtpGSTOutput(string columns) :
+NtpOutputI(),
+fTree(0)
+{
+  vector<string> cols = utils::str::Split(columns, ",");
+  vector<string>::const_iterator it = cols.begin();
+  for( ; it != cols.end(); ++it) {
+    string col = utils::str::TrimSpaces(*it);
+    if(col.size() > 0 && col != "all") fColumns.insert(col);
+  }
+
+  // per-particle arrays need their counter
+  const char * iarr[] = { "pdgi", "resc", "Ei", "pxi", "pyi", "pzi" };
+  const char * farr[] = { "pdgf", "Ef", "pxf", "pyf", "pzf", "pf", "cthf" };
+  for(int i = 0; i < 6; i++) {
+    if(fColumns.count(iarr[i]) > 0) fColumns.insert("ni");
+  }
+  for(int i = 0; i < 7; i++) {
+    if(fColumns.count(farr[i]) > 0) fColumns.insert("nf");
+  }
+
+  fFinalHadSyst.reserve(kNPmax);
+  fPrimHadSyst.reserve(kNPmax);
+}
+//____________________________________________________________________________
+NtpGSTOutput::~NtpGSTOutput()
+{
+  // the tree is owned by the output file
+}
+//____________________________________________________________________________
+bool NtpGSTOutput::IsSelected(string column) const
+{
+  return (fColumns.size() == 0 || fColumns.count(column) > 0);
+}
+//____________________________________________________________________________
+void NtpGSTOutput::Branch(
+  const char * name, void * address, const char * leaflist)
+{
+  if(this->IsSelected(name)) {
+    fTree->Branch(name, address, leaflist);
+  }
+}
+//____________________________________________________________________________
+void NtpGSTOutput::Initialize(void)
+{
+  LOG("Ntp", pINFO) << "Creating the output summary (gst) tree";
+
+  fTree = new TTree("gst","GENIE Summary Event Tree");
+  fTree->SetAutoSave(200000000);  // autosave when 0.2 Gbyte written
+
+  this->Branch("iev",         &fIev,         "iev/I"         );
+  this->Branch("neu",         &fNeutrino,    "neu/I"         );
+  this->Branch("fspl",        &fFSPrimLept,  "fspl/I"        );
+  this->Branch("tgt",         &fTarget,      "tgt/I"         );
+  this->Branch("Z",           &fTargetZ,     "Z/I"           );
+  this->Branch("A",           &fTargetA,     "A/I"           );
+  this->Branch("hitnuc",      &fHitNuc,      "hitnuc/I"      );
+  this->Branch("hitqrk",      &fHitQrk,      "hitqrk/I"      );
+  this->Branch("resid",       &fResId,       "resid/I"       );
+  this->Branch("sea",         &fFromSea,     "sea/O"         );
+  this->Branch("qel",         &fIsQel,       "qel/O"         );
+  this->Branch("mec",         &fIsMec,       "mec/O"         );
+  this->Branch("res",         &fIsRes,       "res/O"         );
+  this->Branch("dis",         &fIsDis,       "dis/O"         );
+  this->Branch("coh",         &fIsCoh,       "coh/O"         );
+  this->Branch("dfr",         &fIsDfr,       "dfr/O"         );
+  this->Branch("imd",         &fIsImd,       "imd/O"         );
+  this->Branch("norm",        &fIsNrm,       "norm/O"        );
+  this->Branch("imdanh",      &fIsImdAnh,    "imdanh/O"      );
+  this->Branch("singlek",     &fIsSingleK,   "singlek/O"     );
+  this->Branch("nuel",        &fIsNuEL,      "nuel/O"        );
+  this->Branch("em",          &fIsEM,        "em/O"          );
+  this->Branch("cc",          &fIsCC,        "cc/O"          );
+  this->Branch("nc",          &fIsNC,        "nc/O"          );
+  this->Branch("charm",       &fIsCharmPro,  "charm/O"       );
+  this->Branch("amnugamma",   &fIsAMNuGamma, "amnugamma/O"   );
+  this->Branch("hnl",         &fIsHNL,       "hnl/O"         );
+  this->Branch("neut_code",   &fCodeNeut,    "neut_code/I"   );
+  this->Branch("nuance_code", &fCodeNuance,  "nuance_code/I" );
+  this->Branch("wght",        &fWeight,      "wght/D"        );
+  this->Branch("xs",          &fKineXs,      "xs/D"          );
+  this->Branch("ys",          &fKineYs,      "ys/D"          );
+  this->Branch("ts",          &fKineTs,      "ts/D"          );
+  this->Branch("Q2s",         &fKineQ2s,     "Q2s/D"         );
+  this->Branch("Ws",          &fKineWs,      "Ws/D"          );
+  this->Branch("x",           &fKineX,       "x/D"           );
+  this->Branch("y",           &fKineY,       "y/D"           );
+  this->Branch("t",           &fKineT,       "t/D"           );
+  this->Branch("Q2",          &fKineQ2,      "Q2/D"          );
+  this->Branch("W",           &fKineW,       "W/D"           );
+  this->Branch("EvRF",        &fEvRF,        "EvRF/D"        );
+  this->Branch("Ev",          &fEv,          "Ev/D"          );
+  this->Branch("pxv",         &fPxv,         "pxv/D"         );
+  this->Branch("pyv",         &fPyv,         "pyv/D"         );
+  this->Branch("pzv",         &fPzv,         "pzv/D"         );
+  this->Branch("En",          &fEn,          "En/D"          );
+  this->Branch("pxn",         &fPxn,         "pxn/D"         );
+  this->Branch("pyn",         &fPyn,         "pyn/D"         );
+  this->Branch("pzn",         &fPzn,         "pzn/D"         );
+  this->Branch("El",          &fEl,          "El/D"          );
+  this->Branch("pxl",         &fPxl,         "pxl/D"         );
+  this->Branch("pyl",         &fPyl,         "pyl/D"         );
+  this->Branch("pzl",         &fPzl,         "pzl/D"         );
+  this->Branch("pl",          &fPl,          "pl/D"          );
+  this->Branch("cthl",        &fCosthl,      "cthl/D"        );
+  this->Branch("nfp",         &fNfP,         "nfp/I"         );
+  this->Branch("nfn",         &fNfN,         "nfn/I"         );
+  this->Branch("nfpip",       &fNfPip,       "nfpip/I"       );
+  this->Branch("nfpim",       &fNfPim,       "nfpim/I"       );
+  this->Branch("nfpi0",       &fNfPi0,       "nfpi0/I"       );
+  this->Branch("nfkp",        &fNfKp,        "nfkp/I"        );
+  this->Branch("nfkm",        &fNfKm,        "nfkm/I"        );
+  this->Branch("nfk0",        &fNfK0,        "nfk0/I"        );
+  this->Branch("nfem",        &fNfEM,        "nfem/I"        );
+  this->Branch("nfother",     &fNfOther,     "nfother/I"     );
+  this->Branch("nip",         &fNiP,         "nip/I"         );
+  this->Branch("nin",         &fNiN,         "nin/I"         );
+  this->Branch("nipip",       &fNiPip,       "nipip/I"       );
+  this->Branch("nipim",       &fNiPim,       "nipim/I"       );
+  this->Branch("nipi0",       &fNiPi0,       "nipi0/I"       );
+  this->Branch("nikp",        &fNiKp,        "nikp/I"        );
+  this->Branch("nikm",        &fNiKm,        "nikm/I"        );
+  this->Branch("nik0",        &fNiK0,        "nik0/I"        );
+  this->Branch("niem",        &fNiEM,        "niem/I"        );
+  this->Branch("niother",     &fNiOther,     "niother/I"     );
+  this->Branch("ni",          &fNi,          "ni/I"          );
+  this->Branch("pdgi",         fPdgi,        "pdgi[ni]/I"    );
+  this->Branch("resc",         fResc,        "resc[ni]/I"    );
+  this->Branch("Ei",           fEi,          "Ei[ni]/D"      );
+  this->Branch("pxi",          fPxi,         "pxi[ni]/D"     );
+  this->Branch("pyi",          fPyi,         "pyi[ni]/D"     );
+  this->Branch("pzi",          fPzi,         "pzi[ni]/D"     );
+  this->Branch("nf",          &fNf,          "nf/I"          );
+  this->Branch("pdgf",         fPdgf,        "pdgf[nf]/I"    );
+  this->Branch("Ef",           fEf,          "Ef[nf]/D"      );
+  this->Branch("pxf",          fPxf,         "pxf[nf]/D"     );
+  this->Branch("pyf",          fPyf,         "pyf[nf]/D"     );
+  this->Branch("pzf",          fPzf,         "pzf[nf]/D"     );
+  this->Branch("pf",           fPf,          "pf[nf]/D"      );
+  this->Branch("cthf",         fCosthf,      "cthf[nf]/D"    );
+  this->Branch("vtxx",        &fVtxX,        "vtxx/D"        );
+  this->Branch("vtxy",        &fVtxY,        "vtxy/D"        );
+  this->Branch("vtxz",        &fVtxZ,        "vtxz/D"        );
+  this->Branch("vtxt",        &fVtxT,        "vtxt/D"        );
+  this->Branch("sumKEf",      &fSumKEf,      "sumKEf/D"      );
+  this->Branch("calresp0",    &fCalResp0,    "calresp0/D"    );
+  this->Branch("XSec",        &fXSec,        "XSec/D"        );
+  this->Branch("DXSec",       &fDXSec,       "DXSec/D"       );
+  this->Branch("KPS",         &fKPS,         "KPS/i"         );
+
+  int nbranches = fTree->GetListOfBranches()->GetEntries();
+  if(nbranches == 0) {
+    LOG("Ntp", pFATAL)
+       << "None of the requested gst columns is known - Exiting";
+    exit(1);
+  }
+  LOG("Ntp", pNOTICE) << "Writing " << nbranches << " gst columns";
+}
+//____________________________________________________________________________
+void NtpGSTOutput::AddEventRecord(int ievent, const EventRecord * ev_rec)
+{
+  if(!fTree || !ev_rec) return;
+
+  if(this->Fill(ievent, *ev_rec)) {
+    fTree->Fill();
+  }
+}
+//____________________________________________________________________________
+bool NtpGSTOutput::Fill(int ievent, const EventRecord & event)
+{
+// Computes the gst columns exactly as gntpc does.
+// Returns false for events that gntpc would skip.
+
+  const double e_h = 1.3; // typical e/h ratio used for computing mean `calorimetric response'
+
+  if(event.IsUnphysical()) {
+    LOG("Ntp", pINFO) << "Skipping unphysical event";
+    return false;
+  }
+
+  GHepParticle * neutrino = event.Probe();
+  GHepParticle * target   = event.Particle(1);
+  GHepParticle * fsl      = event.FinalStatePrimaryLepton();
+  GHepParticle * hitnucl  = event.HitNucleon();
+  if(!target) return false;
+
+  int tgtZ = 0;
+  int tgtA = 0;
+  if(pdg::IsIon(target->Pdg())) {
+     tgtZ = pdg::IonPdgCodeToZ(target->Pdg());
+     tgtA = pdg::IonPdgCodeToA(target->Pdg());
+  }
+  if(target->Pdg() == kPdgProton   ) { tgtZ = 1; tgtA = 1; }
+  if(target->Pdg() == kPdgNeutron  ) { tgtZ = 0; tgtA = 1; }
+
+  // Summary info
+  const Interaction * interaction = event.Summary();
+  const InitialState & init_state = interaction->InitState();
+  const ProcessInfo &  proc_info  = interaction->ProcInfo();
+  const Kinematics &   kine       = interaction->Kine();
+  const XclsTag &      xcls       = interaction->ExclTag();
+  const Target &       tgt        = init_state.Tgt();
+
+  // Process id
+  bool is_qel       = proc_info.IsQuasiElastic();
+  bool is_res       = proc_info.IsResonant();
+  bool is_dis       = proc_info.IsDeepInelastic();
+  bool is_coh       = proc_info.IsCoherentProduction();
+  bool is_dfr       = proc_info.IsDiffractive();
+  bool is_imd       = proc_info.IsInverseMuDecay();
+  bool is_imdanh    = proc_info.IsIMDAnnihilation();
+  bool is_singlek   = proc_info.IsSingleKaon();
+  bool is_nuel      = proc_info.IsNuElectronElastic();
+  bool is_em        = proc_info.IsEM();
+  bool is_weakcc    = proc_info.IsWeakCC();
+  bool is_weaknc    = proc_info.IsWeakNC();
+  bool is_mec       = proc_info.IsMEC();
+  bool is_amnugamma = proc_info.IsAMNuGamma();
+  bool is_hnl       = proc_info.IsHNLDecay();
+  bool is_norm      = proc_info.IsNorm();
+
+  // Kinematical params _exactly_ as they were selected internally
+  bool get_selected = true;
+  double xs  = kine.x (get_selected);
+  double ys  = kine.y (get_selected);
+  double ts  = (is_coh || is_dfr || is_hnl) ? kine.t (get_selected) : -1;
+  double Q2s = kine.Q2(get_selected);
+  double Ws  = kine.W (get_selected);
+
+  // The same kinematical params as an experimentalist would measure them,
+  // neglecting the fermi momentum and off-shellness of bound nucleons
+  TLorentzVector pdummy(0,0,0,0);
+  const TLorentzVector & k1 = (neutrino) ? *(neutrino->P4()) : pdummy;  // v 4-p (k1)
+  const TLorentzVector & k2 = (fsl)      ? *(fsl->P4())      : pdummy;  // l 4-p (k2)
+  const TLorentzVector & p1 = (hitnucl)  ? *(hitnucl->P4())  : pdummy;  // N 4-p (p1)
+
+  double M  = kNucleonMass;
+  TLorentzVector q  = k1-k2;                     // q=k1-k2, 4-p transfer
+  double Q2 = -1 * q.M2();                       // momentum transfer
+  double v  = (hitnucl) ? q.Energy()       : -1; // v (E transfer to the nucleus)
+  double x, y, W2, W;
+  if(!is_coh) {
+     x  = (hitnucl) ? 0.5*Q2/(M*v)     : -1; // Bjorken x
+     y  = (hitnucl) ? v/k1.Energy()    : -1; // Inelasticity, y = q*P1/k1*P1
+     W2 = (hitnucl) ? M*M + 2*M*v - Q2 : -1; // Hadronic Invariant mass ^ 2
+     W  = (hitnucl) ? TMath::Sqrt(W2)  : -1;
+  } else {
+     v  = q.Energy();
+     x  = 0.5*Q2/(M*v);
+     y  = v/k1.Energy();
+     W2 = M*M + 2*M*v - Q2;
+     W  = TMath::Sqrt(W2);
+  }
+  double t = ts;
+
+  // v 4-p at hit nucleon rest-frame
+  TLorentzVector k1_rf = k1;
+  if(hitnucl) {
+     k1_rf.Boost(-1.*p1.BoostVector());
+  }
+
+  // Extract the hadronic system, only for QEL/RES/DIS/COH/MEC/HNL events
+  bool study_hadsyst = (is_qel || is_res || is_dis || is_coh ||
+                        is_dfr || is_mec || is_singlek || is_hnl);
+
+  int np = event.GetEntries();
+
+  // final state system originating from the hadronic vertex
+  // (after the intranuclear rescattering step)
+  fFinalHadSyst.clear();
+  for(int ip = 0; study_hadsyst && ip < np; ip++) {
+    GHepParticle * p = event.Particle(ip);
+    // don't count final state lepton as part hadronic system
+    if(!is_hnl && p->FirstMother()==0) continue;
+    if(is_hnl && event.Particle(0)->FirstDaughter()==ip) continue;
+    if(pdg::IsPseudoParticle(p->Pdg())) continue;
+    int pdgc = p->Pdg();
+    int ist  = p->Status();
+    if(ist != kIStStableFinalState) continue;
+    if(!is_hnl) {
+      if (pdgc == kPdgGamma || pdgc == kPdgElectron || pdgc == kPdgPositron) {
+        if(p->FirstMother() != -1) fFinalHadSyst.push_back(ip);
+      } else {
+        fFinalHadSyst.push_back(ip);
+      }
+    } else {
+      // HNL decays with multiple leptons: only one of these is primary
+      int apdgc = std::abs(pdgc);
+      if( apdgc == kPdgElectron || apdgc == kPdgNuE  ||
+          apdgc == kPdgMuon     || apdgc == kPdgNuMu ||
+          apdgc == kPdgTau      || apdgc == kPdgNuTau ) continue;
+      fFinalHadSyst.push_back(ip);
+    }
+  }
+
+  // primary hadronic system (before any intranuclear rescattering);
+  // for coherent production, HNL decays and free nucleon targets it is set
+  // to be identical with the final state hadronic system
+  fPrimHadSyst.clear();
+  if(study_hadsyst) {
+    if(!pdg::IsIon(target->Pdg()) || is_coh || is_hnl) {
+      fPrimHadSyst = fFinalHadSyst;
+    } else {
+      // look for the particles emitted from the principal vertex
+      int ist_mother = -1;
+      if      (is_res || is_mec) ist_mother = kIStDecayedState;
+      else if (is_dis)           ist_mother = kIStDISPreFragmHadronicState;
+      else if (is_qel)           ist_mother = kIStNucleonTarget;
+      if(ist_mother != -1) {
+        int ist_store = -10;
+        for(int ip = 0; ip < np; ip++) {
+          GHepParticle * p = event.Particle(ip);
+          if(p->Status() == ist_mother) {
+            ist_store = ip;    //store this mother
+            continue;
+          }
+          if(p->FirstMother() == ist_store) fPrimHadSyst.push_back(ip);
+        }
+      }
+      // also include gammas from nuclear de-excitations
+      for(int i = target->FirstDaughter(); i <= target->LastDaughter(); i++) {
+        if(i<0) continue;
+        if(event.Particle(i)->Status()==kIStStableFinalState) {
+          fPrimHadSyst.push_back(i);
+        }
+      }
+    }
+  }
+
+  if((int)fFinalHadSyst.size() > kNPmax || (int)fPrimHadSyst.size() > kNPmax) {
+    LOG("Ntp", pWARN)
+      << "Too many hadrons in event " << ievent << " - Skipping it";
+    return false;
+  }
+
+  // Fill the columns
+  fIev          = ievent;
+  fNeutrino     = (neutrino) ? neutrino->Pdg() : 0;
+  fFSPrimLept   = (fsl) ? fsl->Pdg() : 0;
+  fTarget       = target->Pdg();
+  fTargetZ      = tgtZ;
+  fTargetA      = tgtA;
+  fHitNuc       = (hitnucl) ? hitnucl->Pdg() : 0;
+  fHitQrk       = (is_dis) ? tgt.HitQrkPdg() : 0;
+  fFromSea      = (is_dis) ? tgt.HitSeaQrk() : false;
+  fResId        = (is_res) ? EResonance(xcls.Resonance()) : -99;
+  fIsQel        = is_qel;
+  fIsRes        = is_res;
+  fIsDis        = is_dis;
+  fIsCoh        = is_coh;
+  fIsDfr        = is_dfr;
+  fIsImd        = is_imd;
+  fIsNrm        = is_norm;
+  fIsImdAnh     = is_imdanh;
+  fIsSingleK    = is_singlek;
+  fIsNuEL       = is_nuel;
+  fIsEM         = is_em;
+  fIsMec        = is_mec;
+  fIsCC         = is_weakcc;
+  fIsNC         = is_weaknc;
+  fIsCharmPro   = xcls.IsCharmEvent();
+  fIsAMNuGamma  = is_amnugamma;
+  fIsHNL        = is_hnl;
+  fCodeNeut     = utils::ghep::NeutReactionCode(&event);
+  fCodeNuance   = utils::ghep::NuanceReactionCode(&event);
+  fWeight       = event.Weight();
+  fKineXs       = xs;
+  fKineYs       = ys;
+  fKineTs       = ts;
+  fKineQ2s      = Q2s;
+  fKineWs       = Ws;
+  fKineX        = x;
+  fKineY        = y;
+  fKineT        = t;
+  fKineQ2       = Q2;
+  fKineW        = W;
+  fEvRF         = k1_rf.Energy();
+  fEv           = k1.Energy();
+  fPxv          = k1.Px();
+  fPyv          = k1.Py();
+  fPzv          = k1.Pz();
+  fEn           = (hitnucl) ? p1.Energy() : 0;
+  fPxn          = (hitnucl) ? p1.Px()     : 0;
+  fPyn          = (hitnucl) ? p1.Py()     : 0;
+  fPzn          = (hitnucl) ? p1.Pz()     : 0;
+  fEl           = k2.Energy();
+  fPxl          = k2.Px();
+  fPyl          = k2.Py();
+  fPzl          = k2.Pz();
+  fPl           = k2.P();
+  fCosthl       = TMath::Cos( k2.Vect().Angle(k1.Vect()) );
+  fXSec         = event.XSec()*(1E+38/units::cm2);
+  fDXSec        = event.DiffXSec()*(1E+38/units::cm2);
+  fKPS          = event.DiffXSecVars();
+
+  // Primary hadronic system (from primary neutrino interaction, before FSI)
+  fNiP = fNiN = fNiPip = fNiPim = fNiPi0 = 0;
+  fNiKp = fNiKm = fNiK0 = fNiEM = fNiOther = 0;
+  fNi = fPrimHadSyst.size();
+  for(int j=0; j<fNi; j++) {
+    GHepParticle * p = event.Particle(fPrimHadSyst[j]);
+    int hpdg = p->Pdg();
+    fPdgi[j] = hpdg;
+    fResc[j] = p->RescatterCode();
+    fEi  [j] = p->Energy();
+    fPxi [j] = p->Px();
+    fPyi [j] = p->Py();
+    fPzi [j] = p->Pz();
+
+    if      (hpdg == kPdgProton  || hpdg == kPdgAntiProton)   fNiP++;
+    else if (hpdg == kPdgNeutron || hpdg == kPdgAntiNeutron)  fNiN++;
+    else if (hpdg == kPdgPiP) fNiPip++;
+    else if (hpdg == kPdgPiM) fNiPim++;
+    else if (hpdg == kPdgPi0) fNiPi0++;
+    else if (hpdg == kPdgKP)  fNiKp++;
+    else if (hpdg == kPdgKM)  fNiKm++;
+    else if (hpdg == kPdgK0    || hpdg == kPdgAntiK0)  fNiK0++;
+    else if (hpdg == kPdgGamma || hpdg == kPdgElectron || hpdg == kPdgPositron) fNiEM++;
+    else fNiOther++;
+  }
+
+  // Final state (visible) hadronic system
+  fNfP = fNfN = fNfPip = fNfPim = fNfPi0 = 0;
+  fNfKp = fNfKm = fNfK0 = fNfEM = fNfOther = 0;
+  fSumKEf   = (fsl) ? fsl->KinE() : 0;
+  fCalResp0 = 0;
+  fNf = fFinalHadSyst.size();
+  for(int j=0; j<fNf; j++) {
+    GHepParticle * p = event.Particle(fFinalHadSyst[j]);
+
+    int    hpdg = p->Pdg();
+    double hE   = p->Energy();
+    double hKE  = p->KinE();
+    double hpx  = p->Px();
+    double hpy  = p->Py();
+    double hpz  = p->Pz();
+    double hm   = p->Mass();
+
+    fPdgf  [j] = hpdg;
+    fEf    [j] = hE;
+    fPxf   [j] = hpx;
+    fPyf   [j] = hpy;
+    fPzf   [j] = hpz;
+    fPf    [j] = TMath::Sqrt(hpx*hpx + hpy*hpy + hpz*hpz);
+    fCosthf[j] = TMath::Cos( p->P4()->Vect().Angle(k1.Vect()) );
+
+    fSumKEf += hKE;
+
+    if      ( hpdg == kPdgProton      )  { fNfP++;     fCalResp0 += hKE;        }
+    else if ( hpdg == kPdgAntiProton  )  { fNfP++;     fCalResp0 += (hE + 2*hm);}
+    else if ( hpdg == kPdgNeutron     )  { fNfN++;     fCalResp0 += hKE;        }
+    else if ( hpdg == kPdgAntiNeutron )  { fNfN++;     fCalResp0 += (hE + 2*hm);}
+    else if ( hpdg == kPdgPiP         )  { fNfPip++;   fCalResp0 += hKE;        }
+    else if ( hpdg == kPdgPiM         )  { fNfPim++;   fCalResp0 += hKE;        }
+    else if ( hpdg == kPdgPi0         )  { fNfPi0++;   fCalResp0 += (e_h * hE); }
+    else if ( hpdg == kPdgKP          )  { fNfKp++;    fCalResp0 += hKE;        }
+    else if ( hpdg == kPdgKM          )  { fNfKm++;    fCalResp0 += hKE;        }
+    else if ( hpdg == kPdgK0          )  { fNfK0++;    fCalResp0 += hKE;        }
+    else if ( hpdg == kPdgAntiK0      )  { fNfK0++;    fCalResp0 += hKE;        }
+    else if ( hpdg == kPdgGamma       )  { fNfEM++;    fCalResp0 += (e_h * hE); }
+    else if ( hpdg == kPdgElectron    )  { fNfEM++;    fCalResp0 += (e_h * hE); }
+    else if ( hpdg == kPdgPositron    )  { fNfEM++;    fCalResp0 += (e_h * hE); }
+    else                                 { fNfOther++; fCalResp0 += hKE;        }
+  }
+
+  TLorentzVector * vtx = event.Vertex();
+  fVtxX = vtx->X();
+  fVtxY = vtx->Y();
+  fVtxZ = vtx->Z();
+  fVtxT = vtx->T();
+
+  return true;
+}
+//____________________________________________________________________________
@@ -0,0 +1,168 @@
+//____________________________________________________________________________
+/*!
+
+\class    genie::NtpGSTOutput
+
+\brief    Writes the GENIE summary ntuple ("gst" tree, as produced by
+          `gntpc -f gst') directly from the event generation job, so that the
+          GHEP event tree does not need to be re-read and converted.
+          The column names and definitions are those of gntpc. A subset of the
+          columns may be selected (eg `Ev,El,Q2,W,cc,nc,pdgf'); the counters of
+          any selected per-particle arrays (`ni', `nf') are added automatically.
+
+\author   The GENIE Collaboration
+
+\created  October 16, 2026
+
+\cpright  Copyright (c) 2003-2023, The GENIE Collaboration
+          For the full text of the license visit http://copyright.genie-mc.org
+*/
+//____________________________________________________________________________
+
+#ifndef _NTP_GST_OUTPUT_H_
+#define _NTP_GST_OUTPUT_H_
+
+#include <set>
+#include <string>
+#include <vector>
+
+#include "Framework/Ntuple/NtpOutputI.h"
+
+using std::set;
+using std::string;
+using std::vector;
+
+namespace genie {
+
+class NtpGSTOutput : public NtpOutputI {
+
+public :
+  ///< columns: comma-separated list of gst columns to write (all if empty)
+  NtpGSTOutput(string columns = "");
+ ~NtpGSTOutput();
+
+  // NtpOutputI interface
+  void    Initialize     (void);
+  void    AddEventRecord (int ievent, const EventRecord * ev_rec);
+  string  Name           (void) const { return "gst"; }
+  TTree * Tree           (void) const { return fTree; }
+
+  static const int kNPmax = 250;
+
+private:
+
+  bool IsSelected (string column) const;
+  void Branch     (const char * name, void * address, const char * leaflist);
+  bool Fill       (int ievent, const EventRecord & event);
+
+  TTree *     fTree;
+  set<string> fColumns;  ///< selected columns (empty: all)
+
+  // gst tree columns (see gntpc)
+  int    fIev;
+  int    fNeutrino;
+  int    fFSPrimLept;
+  int    fTarget;
+  int    fTargetZ;
+  int    fTargetA;
+  int    fHitNuc;
+  int    fHitQrk;
+  bool   fFromSea;
+  int    fResId;
+  bool   fIsQel;
+  bool   fIsRes;
+  bool   fIsDis;
+  bool   fIsCoh;
+  bool   fIsMec;
+  bool   fIsDfr;
+  bool   fIsImd;
+  bool   fIsNrm;
+  bool   fIsSingleK;
+  bool   fIsImdAnh;
+  bool   fIsNuEL;
+  bool   fIsEM;
+  bool   fIsCC;
+  bool   fIsNC;
+  bool   fIsCharmPro;
+  bool   fIsAMNuGamma;
+  bool   fIsHNL;
+  int    fCodeNeut;
+  int    fCodeNuance;
+  double fWeight;
+  double fKineXs;
+  double fKineYs;
+  double fKineTs;
+  double fKineQ2s;
+  double fKineWs;
+  double fKineX;
+  double fKineY;
+  double fKineT;
+  double fKineQ2;
+  double fKineW;
+  double fEvRF;
+  double fEv;
+  double fPxv;
+  double fPyv;
+  double fPzv;
+  double fEn;
+  double fPxn;
+  double fPyn;
+  double fPzn;
+  double fEl;
+  double fPxl;
+  double fPyl;
+  double fPzl;
+  double fPl;
+  double fCosthl;
+  int    fNfP;
+  int    fNfN;
+  int    fNfPip;
+  int    fNfPim;
+  int    fNfPi0;
+  int    fNfKp;
+  int    fNfKm;
+  int    fNfK0;
+  int    fNfEM;
+  int    fNfOther;
+  int    fNiP;
+  int    fNiN;
+  int    fNiPip;
+  int    fNiPim;
+  int    fNiPi0;
+  int    fNiKp;
+  int    fNiKm;
+  int    fNiK0;
+  int    fNiEM;
+  int    fNiOther;
+  int    fNf;
+  int    fPdgf   [kNPmax];
+  double fEf     [kNPmax];
+  double fPxf    [kNPmax];
+  double fPyf    [kNPmax];
+  double fPzf    [kNPmax];
+  double fPf     [kNPmax];
+  double fCosthf [kNPmax];
+  int    fNi;
+  int    fPdgi   [kNPmax];
+  int    fResc   [kNPmax];
+  double fEi     [kNPmax];
+  double fPxi    [kNPmax];
+  double fPyi    [kNPmax];
+  double fPzi    [kNPmax];
+  double fVtxX;
+  double fVtxY;
+  double fVtxZ;
+  double fVtxT;
+  double fSumKEf;
+  double fCalResp0;
+  double fXSec;
+  double fDXSec;
+  unsigned int fKPS;
+
+  // hadronic system bookkeeping, re-used from event to event
+  vector<int> fFinalHadSyst;
+  vector<int> fPrimHadSyst;
+};
+
+}      // genie namespace
+#endif // _NTP_GST_OUTPUT_H_
@@ -0,0 +1,55 @@
+//____________________________________________________________________________
+/*!
+
+\class    genie::NtpOutputI
+
+\brief    Interface for the additional (flat) output trees that NtpWriter can
+          fill directly during event generation, alongside or instead of the
+          GHEP event tree. Each backend books its own TTree in the output file
+          at Initialize() and fills one entry per event record it is given.
+
+\author   The GENIE Collaboration
+
+\created  October 16, 2026
+
+\cpright  Copyright (c) 2003-2023, The GENIE Collaboration
+          For the full text of the license visit http://copyright.genie-mc.org
+*/
+//____________________________________________________________________________
+
+#ifndef _NTP_OUTPUT_I_H_
+#define _NTP_OUTPUT_I_H_
+
+#include <string>
+
+class TTree;
+
+using std::string;
+
+namespace genie {
+
+class EventRecord;
+
+class NtpOutputI {
+
+public :
+  virtual ~NtpOutputI() { }
+
+  ///< book the output tree in the current ROOT directory
+  virtual void Initialize (void) = 0;
+
+  ///< add event
+  virtual void AddEventRecord (int ievent, const EventRecord * ev_rec) = 0;
+
+  ///< name of the output format (as used in the --ntp-outputs option)
+  virtual string Name (void) const = 0;
+
+  ///< get the output tree
+  virtual TTree * Tree (void) const = 0;
+
+protected:
+  NtpOutputI() { }
+};
+
+}      // genie namespace
+#endif // _NTP_OUTPUT_I_H_
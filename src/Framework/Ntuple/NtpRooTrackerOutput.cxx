@@ -0,0 +1,161 @@
+//____________________________________________________________________________
+/*
+ Copyright (c) 2003-2023, The GENIE Collaboration
+ For the full text of the license visit http://copyright.genie-mc.org
+
+ The GENIE Collaboration
+*/
+//____________________________________________________________________________
+
+#include <TTree.h>
+#include <TBits.h>
+#include <TObjString.h>
+#include <TMath.h>
+#include <TLorentzVector.h>
+
+#include "Framework/Conventions/Units.h"
+#include "Framework/EventGen/EventRecord.h"
+#include "Framework/GHEP/GHepParticle.h"
+#include "Framework/GHEP/GHepStatus.h"
+#include "Framework/Interaction/Interaction.h"
+#include "Framework/Messenger/Messenger.h"
+#include "Framework/Ntuple/NtpRooTrackerOutput.h"
+
+using namespace genie;
+
+//____________________________________________________________________________
+NtpRooTrackerOutput::NtpRooTrackerOutput(bool mock_data) :
+NtpOutputI(),
+fTree(0),
+fMockData(mock_data),
+fEvtFlags(0),
+fEvtCode(0)
+{
+
+}
+//____________________________________________________________________________
+NtpRooTrackerOutput::~NtpRooTrackerOutput()
+{
+  // the tree is owned by the output file
+  if(fEvtFlags) delete fEvtFlags;
+  if(fEvtCode)  delete fEvtCode;
+}
+//____________________________________________________________________________
+string NtpRooTrackerOutput::Name(void) const
+{
+  return (fMockData) ? "rootracker_mock_data" : "rootracker";
+}
+//____________________________________________________________________________
+void NtpRooTrackerOutput::Initialize(void)
+{
+  LOG("Ntp", pINFO) << "Creating the output rootracker tree";
+
+  // the branch objects are kept and re-filled (in place) for each event
+  fEvtFlags = new TBits;
+  fEvtCode  = new TObjString;
+
+  fTree = new TTree("gRooTracker","GENIE event tree rootracker format");
+  fTree->SetAutoSave(200000000);  // autosave when 0.2 Gbyte written
+
+  if(fMockData) {
+    fTree->Branch("EvtNum",       &fEvtNum,       "EvtNum/I");
+    fTree->Branch("EvtWght",      &fEvtWght,      "EvtWght/D");
+    fTree->Branch("EvtVtx",        fEvtVtx,       "EvtVtx[4]/D");
+    fTree->Branch("StdHepN",      &fStdHepN,      "StdHepN/I");
+    fTree->Branch("StdHepPdg",     fStdHepPdg,    "StdHepPdg[StdHepN]/I");
+    fTree->Branch("StdHepX4",      fStdHepX4,     "StdHepX4[StdHepN][4]/D");
+    fTree->Branch("StdHepP4",      fStdHepP4,     "StdHepP4[StdHepN][4]/D");
+    return;
+  }
+
+  fTree->Branch("EvtFlags", "TBits",      &fEvtFlags, 32000, 1);
+  fTree->Branch("EvtCode",  "TObjString", &fEvtCode,  32000, 1);
+  fTree->Branch("EvtNum",       &fEvtNum,       "EvtNum/I");
+  fTree->Branch("EvtXSec",      &fEvtXSec,      "EvtXSec/D");
+  fTree->Branch("EvtDXSec",     &fEvtDXSec,     "EvtDXSec/D");
+  fTree->Branch("EvtKPS",       &fEvtKPS,       "EvtKPS/i");
+  fTree->Branch("EvtWght",      &fEvtWght,      "EvtWght/D");
+  fTree->Branch("EvtProb",      &fEvtProb,      "EvtProb/D");
+  fTree->Branch("EvtVtx",        fEvtVtx,       "EvtVtx[4]/D");
+  fTree->Branch("StdHepN",      &fStdHepN,      "StdHepN/I");
+  fTree->Branch("StdHepPdg",     fStdHepPdg,    "StdHepPdg[StdHepN]/I");
+  fTree->Branch("StdHepStatus",  fStdHepStatus, "StdHepStatus[StdHepN]/I");
+  fTree->Branch("StdHepRescat",  fStdHepRescat, "StdHepRescat[StdHepN]/I");
+  fTree->Branch("StdHepX4",      fStdHepX4,     "StdHepX4[StdHepN][4]/D");
+  fTree->Branch("StdHepP4",      fStdHepP4,     "StdHepP4[StdHepN][4]/D");
+  fTree->Branch("StdHepPolz",    fStdHepPolz,   "StdHepPolz[StdHepN][3]/D");
+  fTree->Branch("StdHepFd",      fStdHepFd,     "StdHepFd[StdHepN]/I");
+  fTree->Branch("StdHepLd",      fStdHepLd,     "StdHepLd[StdHepN]/I");
+  fTree->Branch("StdHepFm",      fStdHepFm,     "StdHepFm[StdHepN]/I");
+  fTree->Branch("StdHepLm",      fStdHepLm,     "StdHepLm[StdHepN]/I");
+}
+//____________________________________________________________________________
+void NtpRooTrackerOutput::AddEventRecord(int ievent, const EventRecord * ev_rec)
+{
+  if(!fTree || !ev_rec) return;
+
+  if(this->Fill(ievent, *ev_rec)) {
+    fTree->Fill();
+  }
+}
+//____________________________________________________________________________
+bool NtpRooTrackerOutput::Fill(int ievent, const EventRecord & event)
+{
+  int np = event.GetEntries();
+  if(np > kNPmax) {
+    LOG("Ntp", pWARN)
+      << "Too many particles in event " << ievent << " - Skipping it";
+    return false;
+  }
+
+  *fEvtFlags = *event.EventFlags();
+  fEvtCode->SetString(event.Summary()->AsString().c_str());
+  fEvtNum    = ievent;
+  fEvtXSec   = (1E+38/units::cm2) * event.XSec();
+  fEvtDXSec  = (1E+38/units::cm2) * event.DiffXSec();
+  fEvtKPS    = event.DiffXSecVars();
+  fEvtWght   = event.Weight();
+  fEvtProb   = event.Probability();
+  fEvtVtx[0] = event.Vertex()->X();
+  fEvtVtx[1] = event.Vertex()->Y();
+  fEvtVtx[2] = event.Vertex()->Z();
+  fEvtVtx[3] = event.Vertex()->T();
+
+  int n = 0;
+  for(int ip = 0; ip < np; ip++) {
+    GHepParticle * p = event.Particle(ip);
+
+    // for the mock data variant write out only stable final state particles
+    if(fMockData && p->Status() != kIStStableFinalState) continue;
+
+    fStdHepPdg   [n] = p->Pdg();
+    fStdHepStatus[n] = (int) p->Status();
+    fStdHepRescat[n] = p->RescatterCode();
+    fStdHepX4    [n][0] = p->X4()->X();
+    fStdHepX4    [n][1] = p->X4()->Y();
+    fStdHepX4    [n][2] = p->X4()->Z();
+    fStdHepX4    [n][3] = p->X4()->T();
+    fStdHepP4    [n][0] = p->P4()->Px();
+    fStdHepP4    [n][1] = p->P4()->Py();
+    fStdHepP4    [n][2] = p->P4()->Pz();
+    fStdHepP4    [n][3] = p->P4()->E();
+    if(p->PolzIsSet()) {
+      fStdHepPolz[n][0] = TMath::Sin(p->PolzPolarAngle()) * TMath::Cos(p->PolzAzimuthAngle());
+      fStdHepPolz[n][1] = TMath::Sin(p->PolzPolarAngle()) * TMath::Sin(p->PolzAzimuthAngle());
+      fStdHepPolz[n][2] = TMath::Cos(p->PolzPolarAngle());
+    } else {
+      fStdHepPolz[n][0] = 0;
+      fStdHepPolz[n][1] = 0;
+      fStdHepPolz[n][2] = 0;
+    }
+    fStdHepFd    [n] = p->FirstDaughter();
+    fStdHepLd    [n] = p->LastDaughter();
+    fStdHepFm    [n] = p->FirstMother();
+    fStdHepLm    [n] = p->LastMother();
+    n++;
+  }
+  fStdHepN = n;
+
+  return true;
+}
+//____________________________________________________________________________
@@ -0,0 +1,81 @@
+//____________________________________________________________________________
+/*!
+
+\class    genie::NtpRooTrackerOutput
+
+\brief    Writes the generic GENIE rootracker tree ("gRooTracker", as produced
+          by `gntpc -f rootracker') directly from the event generation job.
+          It is also used by gntpc for all rootracker variants: the
+          experiment-specific flux pass-through branches (t2k_rootracker,
+          numi_rootracker) are added to the tree and filled by gntpc, and the
+          `mock data' variant keeps only a few branches and the stable final
+          state particles.
+
+\author   The GENIE Collaboration
+
+\created  October 16, 2026
+
+\cpright  Copyright (c) 2003-2023, The GENIE Collaboration
+          For the full text of the license visit http://copyright.genie-mc.org
+*/
+//____________________________________________________________________________
+
+#ifndef _NTP_ROOTRACKER_OUTPUT_H_
+#define _NTP_ROOTRACKER_OUTPUT_H_
+
+#include "Framework/Ntuple/NtpOutputI.h"
+
+class TBits;
+class TObjString;
+
+namespace genie {
+
+class NtpRooTrackerOutput : public NtpOutputI {
+
+public :
+  ///< mock_data: hide the event truth information (rootracker_mock_data)
+  NtpRooTrackerOutput(bool mock_data = false);
+ ~NtpRooTrackerOutput();
+
+  // NtpOutputI interface
+  void    Initialize     (void);
+  void    AddEventRecord (int ievent, const EventRecord * ev_rec);
+  string  Name           (void) const;
+  TTree * Tree           (void) const { return fTree; }
+
+  ///< sets the branches for the input event without filling the tree, so that
+  ///< branches added to Tree() can be set too; false if the event is skipped
+  bool    Fill           (int ievent, const EventRecord & event);
+
+  static const int kNPmax = 250;
+
+private:
+
+  TTree *      fTree;
+  bool         fMockData;                 ///< write only the stable final state particles?
+
+  // rootracker tree branches (see gntpc)
+  TBits *      fEvtFlags;                 ///< generator-specific event flags
+  TObjString * fEvtCode;                  ///< generator-specific string with 'event code'
+  int          fEvtNum;                   ///< event num.
+  double       fEvtXSec;                  ///< cross section for selected event (1E-38 cm2)
+  double       fEvtDXSec;                 ///< cross section for selected event kinematics (1E-38 cm2 /{K^n})
+  unsigned int fEvtKPS;                   ///< kinematic phase space variables as in KinePhaseSpace_t
+  double       fEvtWght;                  ///< weight for that event
+  double       fEvtProb;                  ///< probability for that event
+  double       fEvtVtx[4];                ///< event vertex position in detector coord syst (SI)
+  int          fStdHepN;                  ///< number of particles in particle array
+  int          fStdHepPdg   [kNPmax];     ///< pdg codes (& generator specific codes for pseudoparticles)
+  int          fStdHepStatus[kNPmax];     ///< generator-specific status code
+  int          fStdHepRescat[kNPmax];     ///< hadron transport model - specific rescattering code
+  double       fStdHepX4    [kNPmax][4];  ///< 4-x (x, y, z, t) of particle in hit nucleus frame (fm)
+  double       fStdHepP4    [kNPmax][4];  ///< 4-p (px,py,pz,E) of particle in LAB frame (GeV)
+  double       fStdHepPolz  [kNPmax][3];  ///< polarization vector
+  int          fStdHepFd    [kNPmax];     ///< first daughter
+  int          fStdHepLd    [kNPmax];     ///< last  daughter
+  int          fStdHepFm    [kNPmax];     ///< first mother
+  int          fStdHepLm    [kNPmax];     ///< last  mother
+};
+
+}      // genie namespace
+#endif // _NTP_ROOTRACKER_OUTPUT_H_
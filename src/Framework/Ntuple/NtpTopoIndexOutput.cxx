@@ -0,0 +1,49 @@
+//____________________________________________________________________________
+/*
+ Copyright (c) 2003-2023, The GENIE Collaboration
+ For the full text of the license visit http://copyright.genie-mc.org
+
+ The GENIE Collaboration
+*/
+//____________________________________________________________________________
+
+#include <TTree.h>
+
+#include "Framework/EventGen/EventRecord.h"
+#include "Framework/Messenger/Messenger.h"
+#include "Framework/Ntuple/NtpTopoIndexOutput.h"
+
+using namespace genie;
+
+//____________________________________________________________________________
+NtpTopoIndexOutput::NtpTopoIndexOutput() :
+NtpOutputI(),
+fTree(0)
+{
+
+}
+//____________________________________________________________________________
+NtpTopoIndexOutput::~NtpTopoIndexOutput()
+{
+  // the tree is owned by the output file
+}
+//____________________________________________________________________________
+void NtpTopoIndexOutput::Initialize(void)
+{
+  LOG("Ntp", pINFO) << "Creating the output event topology index (gidx) tree";
+
+  fTree = new TTree(NtpTopoSummary::TreeName().c_str(),
+                    "GENIE Event Topology Index");
+  fTree->SetAutoSave(200000000);  // autosave when 0.2 Gbyte written
+
+  fSummary.Book(fTree);
+}
+//____________________________________________________________________________
+void NtpTopoIndexOutput::AddEventRecord(int ievent, const EventRecord * ev_rec)
+{
+  if(!fTree || !ev_rec) return;
+
+  fSummary.Fill(ievent, *ev_rec);
+  fTree->Fill();
+}
+//____________________________________________________________________________
@@ -0,0 +1,47 @@
+//____________________________________________________________________________
+/*!
+
+\class    genie::NtpTopoIndexOutput
+
+\brief    Writes the event topology index ("gidx" tree, see NtpTopoSummary)
+          directly from the event generation job, next to the GHEP event
+          tree, so that topology selections (eg gevpick) do not need to
+          unpack every event record.
+
+\author   The GENIE Collaboration
+
+\created  October 16, 2026
+
+\cpright  Copyright (c) 2003-2023, The GENIE Collaboration
+          For the full text of the license visit http://copyright.genie-mc.org
+*/
+//____________________________________________________________________________
+
+#ifndef _NTP_TOPO_INDEX_OUTPUT_H_
+#define _NTP_TOPO_INDEX_OUTPUT_H_
+
+#include "Framework/Ntuple/NtpOutputI.h"
+#include "Framework/Ntuple/NtpTopoSummary.h"
+
+namespace genie {
+
+class NtpTopoIndexOutput : public NtpOutputI {
+
+public :
+  NtpTopoIndexOutput();
+ ~NtpTopoIndexOutput();
+
+  // NtpOutputI interface
+  void    Initialize     (void);
+  void    AddEventRecord (int ievent, const EventRecord * ev_rec);
+  string  Name           (void) const { return "gidx"; }
+  TTree * Tree           (void) const { return fTree; }
+
+private:
+
+  TTree *        fTree;
+  NtpTopoSummary fSummary;  ///< index entry, re-filled for each event
+};
+
+}      // genie namespace
+#endif // _NTP_TOPO_INDEX_OUTPUT_H_
@@ -0,0 +1,231 @@
+//____________________________________________________________________________
+/*
+ Copyright (c) 2003-2023, The GENIE Collaboration
+ For the full text of the license visit http://copyright.genie-mc.org
+
+ The GENIE Collaboration
+*/
+//____________________________________________________________________________
+
+#include <TTree.h>
+#include <TLorentzVector.h>
+
+#include "Framework/EventGen/EventRecord.h"
+#include "Framework/GHEP/GHepStatus.h"
+#include "Framework/GHEP/GHepParticle.h"
+#include "Framework/Interaction/Interaction.h"
+#include "Framework/Messenger/Messenger.h"
+#include "Framework/Ntuple/NtpTopoSummary.h"
+#include "Framework/ParticleData/PDGCodes.h"
+#include "Framework/ParticleData/PDGUtils.h"
+
+using namespace genie;
+
+//____________________________________________________________________________
+NtpTopoSummary::NtpTopoSummary()
+{
+  this->Reset();
+}
+//____________________________________________________________________________
+NtpTopoSummary::~NtpTopoSummary()
+{
+
+}
+//____________________________________________________________________________
+void NtpTopoSummary::Reset(void)
+{
+  iev     = -1;
+  neu     = 0;
+  tgt     = 0;
+  hitnuc  = 0;
+  Ev      = 0;
+  cc      = false;
+  nc      = false;
+  em      = false;
+  qel     = false;
+  mec     = false;
+  res     = false;
+  dis     = false;
+  coh     = false;
+  dfr     = false;
+  imd     = false;
+  nuel    = false;
+  charm   = false;
+  strange = false;
+  nfp     = 0;
+  nfpbar  = 0;
+  nfn     = 0;
+  nfnbar  = 0;
+  nfpip   = 0;
+  nfpim   = 0;
+  nfpi0   = 0;
+  nfkp    = 0;
+  nfkm    = 0;
+  nfk0    = 0;
+  nfk0bar = 0;
+  nfsigp  = 0;
+  nfsig0  = 0;
+  nfsigm  = 0;
+  nflam   = 0;
+  nfxi0   = 0;
+  nfxim   = 0;
+  nfomm   = 0;
+  nfother = 0;
+}
+//____________________________________________________________________________
+void NtpTopoSummary::Fill(int ievent, const EventRecord & event)
+{
+  this->Reset();
+
+  const Interaction * interaction = event.Summary();
+  const ProcessInfo & proc_info   = interaction->ProcInfo();
+  const XclsTag &     xcls_tag    = interaction->ExclTag();
+  const Target &      target      = interaction->InitState().Tgt();
+
+  iev     = ievent;
+  neu     = event.Probe()->Pdg();
+  tgt     = target.Pdg();
+  hitnuc  = (target.HitNucIsSet()) ? target.HitNucPdg() : 0;
+  Ev      = event.Probe()->P4()->E();
+  cc      = proc_info.IsWeakCC();
+  nc      = proc_info.IsWeakNC();
+  em      = proc_info.IsEM();
+  qel     = proc_info.IsQuasiElastic();
+  mec     = proc_info.IsMEC();
+  res     = proc_info.IsResonant();
+  dis     = proc_info.IsDeepInelastic();
+  coh     = proc_info.IsCoherentProduction();
+  dfr     = proc_info.IsDiffractive();
+  imd     = proc_info.IsInverseMuDecay();
+  nuel    = proc_info.IsNuElectronElastic();
+  charm   = xcls_tag.IsCharmEvent();
+  strange = xcls_tag.IsStrangeEvent();
+
+  int np = event.GetEntries();
+  for(int ip = 0; ip < np; ip++) {
+    GHepParticle * p = event.Particle(ip);
+    // only final state particles
+    if(p->Status() != kIStStableFinalState) continue;
+    // don't count final state lepton as part of the hadronic system
+    if(p->FirstMother() == 0) continue;
+    // skip pseudo-particles
+    int pdgc = p->Pdg();
+    if(pdg::IsPseudoParticle(pdgc)) continue;
+    // count ...
+    if      (pdgc == kPdgProton     ) nfp++;
+    else if (pdgc == kPdgAntiProton ) nfpbar++;
+    else if (pdgc == kPdgNeutron    ) nfn++;
+    else if (pdgc == kPdgAntiNeutron) nfnbar++;
+    else if (pdgc == kPdgPiP        ) nfpip++;
+    else if (pdgc == kPdgPiM        ) nfpim++;
+    else if (pdgc == kPdgPi0        ) nfpi0++;
+    else if (pdgc == kPdgKP         ) nfkp++;
+    else if (pdgc == kPdgKM         ) nfkm++;
+    else if (pdgc == kPdgK0         ) nfk0++;
+    else if (pdgc == kPdgAntiK0     ) nfk0bar++;
+    else if (pdgc == kPdgSigmaP     ) nfsigp++;
+    else if (pdgc == kPdgSigma0     ) nfsig0++;
+    else if (pdgc == kPdgSigmaM     ) nfsigm++;
+    else if (pdgc == kPdgLambda     ) nflam++;
+    else if (pdgc == kPdgXi0        ) nfxi0++;
+    else if (pdgc == kPdgXiM        ) nfxim++;
+    else if (pdgc == kPdgOmegaM     ) nfomm++;
+    else                              nfother++;
+  }
+}
+//____________________________________________________________________________
+void NtpTopoSummary::Book(TTree * tree)
+{
+  tree->Branch("iev",     &iev,     "iev/I"     );
+  tree->Branch("neu",     &neu,     "neu/I"     );
+  tree->Branch("tgt",     &tgt,     "tgt/I"     );
+  tree->Branch("hitnuc",  &hitnuc,  "hitnuc/I"  );
+  tree->Branch("Ev",      &Ev,      "Ev/D"      );
+  tree->Branch("cc",      &cc,      "cc/O"      );
+  tree->Branch("nc",      &nc,      "nc/O"      );
+  tree->Branch("em",      &em,      "em/O"      );
+  tree->Branch("qel",     &qel,     "qel/O"     );
+  tree->Branch("mec",     &mec,     "mec/O"     );
+  tree->Branch("res",     &res,     "res/O"     );
+  tree->Branch("dis",     &dis,     "dis/O"     );
+  tree->Branch("coh",     &coh,     "coh/O"     );
+  tree->Branch("dfr",     &dfr,     "dfr/O"     );
+  tree->Branch("imd",     &imd,     "imd/O"     );
+  tree->Branch("nuel",    &nuel,    "nuel/O"    );
+  tree->Branch("charm",   &charm,   "charm/O"   );
+  tree->Branch("strange", &strange, "strange/O" );
+  tree->Branch("nfp",     &nfp,     "nfp/I"     );
+  tree->Branch("nfpbar",  &nfpbar,  "nfpbar/I"  );
+  tree->Branch("nfn",     &nfn,     "nfn/I"     );
+  tree->Branch("nfnbar",  &nfnbar,  "nfnbar/I"  );
+  tree->Branch("nfpip",   &nfpip,   "nfpip/I"   );
+  tree->Branch("nfpim",   &nfpim,   "nfpim/I"   );
+  tree->Branch("nfpi0",   &nfpi0,   "nfpi0/I"   );
+  tree->Branch("nfkp",    &nfkp,    "nfkp/I"    );
+  tree->Branch("nfkm",    &nfkm,    "nfkm/I"    );
+  tree->Branch("nfk0",    &nfk0,    "nfk0/I"    );
+  tree->Branch("nfk0bar", &nfk0bar, "nfk0bar/I" );
+  tree->Branch("nfsigp",  &nfsigp,  "nfsigp/I"  );
+  tree->Branch("nfsig0",  &nfsig0,  "nfsig0/I"  );
+  tree->Branch("nfsigm",  &nfsigm,  "nfsigm/I"  );
+  tree->Branch("nflam",   &nflam,   "nflam/I"   );
+  tree->Branch("nfxi0",   &nfxi0,   "nfxi0/I"   );
+  tree->Branch("nfxim",   &nfxim,   "nfxim/I"   );
+  tree->Branch("nfomm",   &nfomm,   "nfomm/I"   );
+  tree->Branch("nfother", &nfother, "nfother/I" );
+}
+//____________________________________________________________________________
+bool NtpTopoSummary::Connect(TTree * tree)
+{
+  if(!tree) return false;
+
+  const char * names[] = {
+    "iev", "neu", "tgt", "hitnuc", "Ev",
+    "cc", "nc", "em", "qel", "mec", "res", "dis", "coh", "dfr", "imd",
+    "nuel", "charm", "strange",
+    "nfp", "nfpbar", "nfn", "nfnbar", "nfpip", "nfpim", "nfpi0",
+    "nfkp", "nfkm", "nfk0", "nfk0bar", "nfsigp", "nfsig0", "nfsigm",
+    "nflam", "nfxi0", "nfxim", "nfomm", "nfother"
+  };
+  void * addresses[] = {
+    &iev, &neu, &tgt, &hitnuc, &Ev,
+    &cc, &nc, &em, &qel, &mec, &res, &dis, &coh, &dfr, &imd,
+    &nuel, &charm, &strange,
+    &nfp, &nfpbar, &nfn, &nfnbar, &nfpip, &nfpim, &nfpi0,
+    &nfkp, &nfkm, &nfk0, &nfk0bar, &nfsigp, &nfsig0, &nfsigm,
+    &nflam, &nfxi0, &nfxim, &nfomm, &nfother
+  };
+  const int n = sizeof(names) / sizeof(names[0]);
+
+  for(int i = 0; i < n; i++) {
+    if(!tree->GetBranch(names[i])) {
+      LOG("Ntp", pWARN)
+        << "The " << tree->GetName() << " tree has no " << names[i] << " column";
+      return false;
+    }
+  }
+  for(int i = 0; i < n; i++) {
+    tree->SetBranchAddress(names[i], addresses[i]);
+  }
+  return true;
+}
+//____________________________________________________________________________
+string NtpTopoSummary::IndexFilename(string ghep_filename)
+{
+  string name = ghep_filename;
+
+  // remove the `ghep.root' or `root' extension, if any
+  const string exts[] = { "ghep.root", "root" };
+  for(int i = 0; i < 2; i++) {
+    const string & ext = exts[i];
+    if(name.size() >= ext.size() &&
+       name.compare(name.size()-ext.size(), ext.size(), ext) == 0) {
+      name.erase(name.size()-ext.size());
+      break;
+    }
+  }
+  if(name.size() == 0 || name[name.size()-1] != '.') name += ".";
+
+  return name + "gidx.root";
+}
+//____________________________________________________________________________
@@ -0,0 +1,104 @@
+//____________________________________________________________________________
+/*!
+
+\class    genie::NtpTopoSummary
+
+\brief    A compact per-event summary of the interaction and of the final
+          state topology (process flags, final state hadron counts, neutrino
+          energy, target) stored, one entry per GHEP event, in the event
+          topology index tree ("gidx").
+          The index can be written by the event generation job itself
+          (`--ntp-outputs ghep,gidx') or built afterwards for an existing
+          GHEP file (`gntpc -f gidx'). Applications such as gevpick can then
+          apply their selection cuts on the index and read only the matching
+          GHEP events.
+
+\author   The GENIE Collaboration
+
+\created  October 16, 2026
+
+\cpright  Copyright (c) 2003-2023, The GENIE Collaboration
+          For the full text of the license visit http://copyright.genie-mc.org
+*/
+//____________________________________________________________________________
+
+#ifndef _NTP_TOPO_SUMMARY_H_
+#define _NTP_TOPO_SUMMARY_H_
+
+#include <string>
+
+class TTree;
+
+using std::string;
+
+namespace genie {
+
+class EventRecord;
+
+class NtpTopoSummary {
+
+public :
+  NtpTopoSummary();
+ ~NtpTopoSummary();
+
+  void Reset (void);
+  void Fill  (int ievent, const EventRecord & event);
+
+  ///< create the index branches in the given tree
+  void Book    (TTree * tree);
+
+  ///< read the index from the given tree; false if it lacks any column
+  bool Connect (TTree * tree);
+
+  ///< name of the index tree
+  static string TreeName (void) { return "gidx"; }
+
+  ///< name of the stand-alone index file for the given GHEP file
+  ///< (eg gntp.0.ghep.root -> gntp.0.gidx.root, as written by gntpc)
+  static string IndexFilename (string ghep_filename);
+
+  // Index is treated like a C-struct with public data members and
+  // rule-breaking field data members not prefaced by "f" and mostly lowercase.
+  // The final state counts include the hadronic system only: the primary
+  // final state lepton and pseudo-particles are not counted.
+  int    iev;      ///< event number
+  int    neu;      ///< neutrino pdg code
+  int    tgt;      ///< nuclear target pdg code (10LZZZAAAI)
+  int    hitnuc;   ///< hit nucleon pdg code (0 if none)
+  double Ev;       ///< neutrino energy (GeV)
+  bool   cc;       ///< is weak CC?
+  bool   nc;       ///< is weak NC?
+  bool   em;       ///< is EM?
+  bool   qel;      ///< is QEL?
+  bool   mec;      ///< is MEC?
+  bool   res;      ///< is RES?
+  bool   dis;      ///< is DIS?
+  bool   coh;      ///< is coherent?
+  bool   dfr;      ///< is diffractive?
+  bool   imd;      ///< is inverse muon decay?
+  bool   nuel;     ///< is ve elastic?
+  bool   charm;    ///< produces charm?
+  bool   strange;  ///< produces strangeness?
+  int    nfp;      ///< number of final state p
+  int    nfpbar;   ///< number of final state \bar{p}
+  int    nfn;      ///< number of final state n
+  int    nfnbar;   ///< number of final state \bar{n}
+  int    nfpip;    ///< number of final state \pi^{+}
+  int    nfpim;    ///< number of final state \pi^{-}
+  int    nfpi0;    ///< number of final state \pi^{0}
+  int    nfkp;     ///< number of final state K^{+}
+  int    nfkm;     ///< number of final state K^{-}
+  int    nfk0;     ///< number of final state K^{0}
+  int    nfk0bar;  ///< number of final state \bar{K^{0}}
+  int    nfsigp;   ///< number of final state \Sigma^{+}
+  int    nfsig0;   ///< number of final state \Sigma^{0}
+  int    nfsigm;   ///< number of final state \Sigma^{-}
+  int    nflam;    ///< number of final state \Lambda^{0}
+  int    nfxi0;    ///< number of final state \Xi^{0}
+  int    nfxim;    ///< number of final state \Xi^{-}
+  int    nfomm;    ///< number of final state \Omega^{-}
+  int    nfother;  ///< number of other final state particles
+};
+
+}      // genie namespace
+#endif // _NTP_TOPO_SUMMARY_H_
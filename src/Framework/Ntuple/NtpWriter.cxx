@@ -9,6 +9,7 @@
 //____________________________________________________________________________
 
 #include <cassert>
+#include <cstdlib>
 #include <sstream>
 
 #include <TFile.h>
@@ -17,13 +18,19 @@
 #include <TFolder.h>
 
 #include "Framework/EventGen/EventRecord.h"
+#include "Framework/EventGen/RejectionLoopStats.h"
 #include "Framework/Messenger/Messenger.h"
 #include "Framework/Ntuple/NtpWriter.h"
 #include "Framework/Ntuple/NtpMCEventRecord.h"
 #include "Framework/Ntuple/NtpMCTreeHeader.h"
 #include "Framework/Ntuple/NtpMCJobConfig.h"
 #include "Framework/Ntuple/NtpMCJobEnv.h"
+#include "Framework/Ntuple/NtpGSTOutput.h"
+#include "Framework/Ntuple/NtpRooTrackerOutput.h"
+#include "Framework/Ntuple/NtpTopoIndexOutput.h"
+#include "Framework/Utils/Cache.h"
 #include "Framework/Utils/RunOpt.h"
+#include "Framework/Utils/StringUtils.h"
 
 #include "RVersion.h"
 
@@ -40,7 +47,8 @@ fOutFile(0),
 fOutTree(0),
 fEventBranch(0),
 fNtpMCEventRecord(0),
-fNtpMCTreeHeader(0)
+fNtpMCTreeHeader(0),
+fWriteGHEP(true)
 {
   LOG("Ntp", pNOTICE) << "Run number: " << runnu;
   LOG("Ntp", pNOTICE)
@@ -51,7 +59,42 @@ fNtpMCTreeHeader(0)
 //____________________________________________________________________________
 NtpWriter::~NtpWriter()
 {
+  if(fNtpMCEventRecord) delete fNtpMCEventRecord;
 
+  vector<NtpOutputI *>::iterator it = fOutputs.begin();
+  for( ; it != fOutputs.end(); ++it) {
+    delete (*it);
+  }
+  fOutputs.clear();
+}
+//____________________________________________________________________________
+void NtpWriter::AddOutput(NtpOutputI * output)
+{
+  if(!output) return;
+
+  if(fOutFile) {
+    LOG("Ntp", pERROR)
+      << "Can not add the " << output->Name()
+      << " output after the writer was initialized";
+    delete output;
+    return;
+  }
+  if(this->HasOutput(output->Name())) {
+    LOG("Ntp", pWARN)
+      << "Output " << output->Name() << " already added - Ignoring it";
+    delete output;
+    return;
+  }
+  fOutputs.push_back(output);
+}
+//____________________________________________________________________________
+bool NtpWriter::HasOutput(string name) const
+{
+  vector<NtpOutputI *>::const_iterator it = fOutputs.begin();
+  for( ; it != fOutputs.end(); ++it) {
+    if((*it)->Name() == name) return true;
+  }
+  return false;
 }
 //____________________________________________________________________________
 void NtpWriter::AddEventRecord(int ievent, const EventRecord * ev_rec)
@@ -69,26 +112,50 @@ void NtpWriter::AddEventRecord(int ievent, const EventRecord * ev_rec)
 
   switch (fNtpFormat) {
      case kNFGHEP:
-          fNtpMCEventRecord = new NtpMCEventRecord();
-          fNtpMCEventRecord->Fill(ievent, ev_rec);
-          fOutTree->Fill();
-          delete fNtpMCEventRecord;
-          fNtpMCEventRecord = 0;
+          // the branch record is kept and re-filled (in place) for each event
+          if(fWriteGHEP) {
+            if(!fNtpMCEventRecord) fNtpMCEventRecord = new NtpMCEventRecord();
+            fNtpMCEventRecord->Fill(ievent, ev_rec);
+          }
+          // the tree may still carry branches added by the application
+          // (eg flux pass-through info) when the GHEP record is not written
+          if(fOutTree->GetListOfBranches()->GetEntries() > 0) {
+            fOutTree->Fill();
+          }
           break;
      default:
         break;
   }
+
+  vector<NtpOutputI *>::iterator it = fOutputs.begin();
+  for( ; it != fOutputs.end(); ++it) {
+    (*it)->AddEventRecord(ievent, ev_rec);
+  }
 }
 //____________________________________________________________________________
 void NtpWriter::Initialize()
 {
   LOG("Ntp",pINFO) << "Initializing GENIE output MC tree";
 
+  this->CreateRequestedOutputs(); // add outputs requested via RunOpt
+
   this->OpenFile(fOutFilename); // open ROOT file
   this->CreateTree();           // create output tree
 
   //-- create the event branch
-  this->CreateEventBranch();
+  if(fWriteGHEP) {
+    this->CreateEventBranch();
+  } else {
+    LOG("Ntp", pNOTICE) << "The GHEP event record will not be written out";
+  }
+
+  //-- create the additional flat output trees
+  vector<NtpOutputI *>::iterator it = fOutputs.begin();
+  for( ; it != fOutputs.end(); ++it) {
+    fOutFile->cd();
+    (*it)->Initialize();
+  }
+  fOutFile->cd();
 
   //-- create the tree header
   this->CreateTreeHeader();
@@ -125,6 +192,47 @@ void NtpWriter::Initialize()
   environment.TakeSnapshot()->Write();
 }
 //____________________________________________________________________________
+void NtpWriter::CreateRequestedOutputs(void)
+{
+  // comma-separated list of outputs, eg `ghep,gst' (default: ghep)
+  RunOpt * opt = RunOpt::Instance();
+  vector<string> outputs = utils::str::Split(opt->NtpOutputs(), ",");
+
+  fWriteGHEP = false;
+  vector<string>::const_iterator it = outputs.begin();
+  for( ; it != outputs.end(); ++it) {
+    string name = utils::str::ToLower(utils::str::TrimSpaces(*it));
+    if(name.size() == 0) continue;
+    if(name == "ghep") {
+      fWriteGHEP = true;
+    }
+    else if(name == "gst") {
+      if(!this->HasOutput(name)) {
+        fOutputs.push_back(new NtpGSTOutput(opt->GSTColumns()));
+      }
+    }
+    else if(name == "rootracker") {
+      if(!this->HasOutput(name)) {
+        fOutputs.push_back(new NtpRooTrackerOutput);
+      }
+    }
+    else if(name == "gidx") {
+      if(!this->HasOutput(name)) {
+        fOutputs.push_back(new NtpTopoIndexOutput);
+      }
+    }
+    else {
+      LOG("Ntp", pFATAL) << "Unknown output ntuple format: " << name;
+      exit(1);
+    }
+  }
+
+  if(!fWriteGHEP && fOutputs.size() == 0) {
+    LOG("Ntp", pFATAL) << "No output ntuple was requested - Exiting";
+    exit(1);
+  }
+}
+//____________________________________________________________________________
 void NtpWriter::CustomizeFilename(string filename)
 {
  fOutFilename = filename;
@@ -191,7 +299,11 @@ void NtpWriter::CreateGHEPEventBranch(void)
 {
   LOG("Ntp", pINFO) << "Creating a NtpMCEventRecord TBranch";
 
-  fNtpMCEventRecord = 0;
+  // The record is allocated before booking the branch so that the writer,
+  // not ROOT, owns it: it is re-filled in place for each event and deleted
+  // by the writer (the branch would delete a record it allocated itself
+  // when the output file is closed)
+  if(!fNtpMCEventRecord) fNtpMCEventRecord = new NtpMCEventRecord();
   TTree::SetBranchStyle(1);
 
 #if ROOT_VERSION_CODE >= ROOT_VERSION(6,0,0)
@@ -228,6 +340,17 @@ void NtpWriter::Save(void)
 
   if(fOutFile) {
 
+    // store the rejection method statistics collected during the job
+    RejectionLoopStats * rjstats = RejectionLoopStats::Instance();
+    LOG("Ntp", pNOTICE) << *rjstats;
+    fOutFile->cd();
+    rjstats->CreateTree();
+
+    // cache usage during the job
+    std::ostringstream cache_stats;
+    Cache::Instance()->PrintStats(cache_stats);
+    LOG("Ntp", pNOTICE) << cache_stats.str();
+
     fOutFile->Write();
     fOutFile->Close();
     delete fOutFile;
@@ -20,6 +20,7 @@
 #define _NTP_WRITER_H_
 
 #include <string>
+#include <vector>
 
 #include "Framework/Ntuple/NtpMCFormat.h"
 
@@ -29,12 +30,14 @@ class TBranch;
 class TClonesArray;
 
 using std::string;
+using std::vector;
 
 namespace genie {
 
 class EventRecord;
 class NtpMCEventRecord;
 class NtpMCTreeHeader;
+class NtpOutputI;
 
 class NtpWriter {
 
@@ -54,6 +57,11 @@ public :
   ///< get the even tree
   TTree *  EventTree (void) { return fOutTree; }
 
+  ///< use before Initialize() to write an additional flat output tree
+  ///< (eg NtpGSTOutput) in the same file; the writer adopts the output.
+  ///< Outputs requested via RunOpt (--ntp-outputs) are added at Initialize()
+  void AddOutput (NtpOutputI * output);
+
   ///< use before Initialize() only if you wish to override the default
   ///< filename, or the default filename prefix
   void CustomizeFilename       (string filename);
@@ -67,6 +75,8 @@ private:
   void CreateTreeHeader      (void);
   void CreateEventBranch     (void);
   void CreateGHEPEventBranch (void);
+  void CreateRequestedOutputs (void);
+  bool HasOutput             (string name) const;
 
   NtpMCFormat_t      fNtpFormat;          ///< enumeration of event formats
   Long_t             fRunNu;              ///< run nu
@@ -77,6 +87,8 @@ private:
   TBranch *          fEventBranch;        ///< the generated event branch
   NtpMCEventRecord * fNtpMCEventRecord;   ///<
   NtpMCTreeHeader *  fNtpMCTreeHeader;    ///<
+  bool               fWriteGHEP;          ///< fill the GHEP event branch?
+  vector<NtpOutputI *> fOutputs;          ///< additional flat output trees
 };
 
 }      // genie namespace
@@ -0,0 +1,162 @@
+#ifndef BLI2DNONUNIF_MULTI_GRID_H_
+#define BLI2DNONUNIF_MULTI_GRID_H_
+
+#include <algorithm>
+#include <cstddef>
+
+namespace genie {
+
+//____________________________________________________________________________
+/*!
+
+\brief    A class template that performs bilinear interpolation of several
+          tabulated functions defined on the same non-uniform grid.
+
+\details  This is a structure-of-arrays counterpart of
+          genie::BLI2DNonUnifObjectGrid. The main differences are
+
+            * The NumComponents functions are stored as separate contiguous
+              arrays (one per component, each in row-major (x, y) order)
+              rather than as a single array of objects
+
+            * A single pair of binary searches (one per axis) and a single
+              set of bilinear weights is used to interpolate all components
+              at once. The inner loop over components has no branches and is
+              written so that it can be vectorized by the compiler.
+
+            * The grid is described by raw pointers, so it can be used with
+              data held in std::vector objects or in memory-mapped files.
+              As with genie::BLI2DNonUnifObjectGrid, the grid object does not
+              take ownership of the data.
+
+          Points outside of the grid are evaluated at the nearest grid edge
+          (no extrapolation).
+
+\tparam   NumComponents Number of tabulated functions
+
+\author   The GENIE Collaboration
+
+\created  October 16, 2026
+
+\cpright  Copyright (c) 2003-2023, The GENIE Collaboration
+          For the full text of the license visit http://copyright.genie-mc.org
+          or see $GENIE/LICENSE
+*/
+//____________________________________________________________________________
+
+template<int NumComponents> class BLI2DNonUnifMultiGrid
+{
+  public:
+
+  BLI2DNonUnifMultiGrid() : fNumX(0), fNumY(0), fX(0), fY(0)
+  {
+    for (int c = 0; c < NumComponents; ++c) fZ[c] = 0;
+  }
+
+  /// \param[in] num_x Number of grid points along the x axis (at least 2)
+  /// \param[in] X Pointer to the first of num_x increasing x coordinates
+  /// \param[in] num_y Number of grid points along the y axis (at least 2)
+  /// \param[in] Y Pointer to the first of num_y increasing y coordinates
+  /// \param[in] Z Pointers to the first element of each of the tabulated
+  /// components. Each component holds num_x * num_y values in row-major
+  /// (x, y) order.
+  BLI2DNonUnifMultiGrid(int num_x, const double* X, int num_y,
+    const double* Y, const double* const Z[NumComponents])
+  {
+    this->set_grid(num_x, X, num_y, Y, Z);
+  }
+
+  /// Points the grid to a new set of axes and component tables
+  void set_grid(int num_x, const double* X, int num_y, const double* Y,
+    const double* const Z[NumComponents])
+  {
+    fNumX = num_x;
+    fNumY = num_y;
+    fX = X;
+    fY = Y;
+    for (int c = 0; c < NumComponents; ++c) fZ[c] = Z[c];
+  }
+
+  inline int num_x() const { return fNumX; }
+  inline int num_y() const { return fNumY; }
+
+  /// Retrieve the minimum x value
+  inline double x_min() const { return fX[0]; }
+
+  /// Retrieve the maximum x value
+  inline double x_max() const { return fX[fNumX - 1]; }
+
+  /// Retrieve the minimum y value
+  inline double y_min() const { return fY[0]; }
+
+  /// Retrieve the maximum y value
+  inline double y_max() const { return fY[fNumY - 1]; }
+
+  /// Uses bilinear interpolation to compute all components at the given
+  /// x and y coordinates
+  /// \param[in] x The x coordinate
+  /// \param[in] y The y coordinate
+  /// \param[out] result Array of NumComponents interpolated values
+  void interpolate(double x, double y, double result[NumComponents]) const
+  {
+    std::size_t i11;
+    double w[4];
+    this->weights(x, y, i11, w);
+
+    std::size_t i12 = i11 + 1;
+    std::size_t i21 = i11 + fNumY;
+    std::size_t i22 = i21 + 1;
+
+    for (int c = 0; c < NumComponents; ++c) {
+      const double* z = fZ[c];
+      result[c] = w[0]*z[i11] + w[1]*z[i12] + w[2]*z[i21] + w[3]*z[i22];
+    }
+  }
+
+protected:
+
+  /// Computes the index of the lower-left grid point of the cell containing
+  /// (x, y) and the bilinear weights of the four corners of the cell
+  /// (ordered (lo, lo), (lo, hi), (hi, lo), (hi, hi) in (x, y)).
+  void weights(double x, double y, std::size_t& index, double w[4]) const
+  {
+    // For points outside the grid, evaluate the components at the end points
+    double evalx = std::min( std::max(x, fX[0]), fX[fNumX - 1] );
+    double evaly = std::min( std::max(y, fY[0]), fY[fNumY - 1] );
+
+    int ix = lower_index(fX, fNumX, evalx);
+    int iy = lower_index(fY, fNumY, evaly);
+
+    double tx = (evalx - fX[ix]) / (fX[ix + 1] - fX[ix]);
+    double ty = (evaly - fY[iy]) / (fY[iy + 1] - fY[iy]);
+
+    w[0] = (1. - tx) * (1. - ty);
+    w[1] = (1. - tx) * ty;
+    w[2] = tx * (1. - ty);
+    w[3] = tx * ty;
+
+    index = static_cast<std::size_t>(ix) * fNumY + iy;
+  }
+
+  /// Returns the index of the grid point at the lower edge of the grid cell
+  /// containing val. Values on the upper edge of the grid belong to the last
+  /// cell.
+  static int lower_index(const double* vec, int num, double val)
+  {
+    int index = std::upper_bound(vec, vec + num, val) - vec - 1;
+    return std::min( std::max(index, 0), num - 2 );
+  }
+
+  int fNumX; ///< Number of grid points along the x axis
+  int fNumY; ///< Number of grid points along the y axis
+
+  const double* fX; ///< Pointer to the x coordinates
+  const double* fY; ///< Pointer to the y coordinates
+
+  /// Pointers to the tabulated components
+  const double* fZ[NumComponents];
+
+}; // template class BLI2DNonUnifMultiGrid
+
+} // namespace genie
+#endif
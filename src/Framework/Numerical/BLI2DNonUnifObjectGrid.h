@@ -26,6 +26,10 @@ namespace genie {
             * The genie::BLI2DNonUnifGrid object does not take ownership of the
               grid vectors, which must be stored elsewhere
 
+          When several scalar functions share the same grid, the
+          structure-of-arrays genie::BLI2DNonUnifMultiGrid interpolates all
+          of them with a single lookup and is usually faster.
+
 \tparam   ZObject Type of the object describing each z coordinate
 \tparam   IndexType Type to use when computing indices in the vectors
 \tparam   XType Type used to represent x coordinates
@@ -8,8 +8,19 @@
 */
 //____________________________________________________________________________
 
+#include <algorithm>
+#include <cerrno>
+#include <cstdio>
+#include <cstring>
+#include <iomanip>
 #include <sstream>
 #include <iostream>
+#include <utility>
+#include <vector>
+
+#include <fcntl.h>
+#include <unistd.h>
+#include <sys/file.h>
 
 #include <TSystem.h>
 #include <TDirectory.h>
@@ -22,6 +33,9 @@
 
 using std::ostringstream;
 using std::endl;
+using std::setw;
+using std::pair;
+using std::vector;
 
 namespace genie {
 
@@ -39,6 +53,14 @@ Cache::Cache()
   fInstance  = 0;
   fCacheMap  = 0;
   fCacheFile = 0;
+  fStoreLoaded = false;
+
+  fMemoryBudget = 0;
+  fPeakMemory   = 0;
+  fNOperations  = 0;
+  fNHits        = 0;
+  fNMisses      = 0;
+  fNEvictions   = 0;
 }
 //____________________________________________________________________________
 Cache::~Cache()
@@ -57,6 +79,12 @@ Cache::~Cache()
     fCacheMap->clear();
     delete fCacheMap;
   }
+  map<string, CacheBranchI * >::iterator siter;
+  for(siter = fStoreMap.begin(); siter != fStoreMap.end(); ++siter) {
+    delete siter->second;
+  }
+  fStoreMap.clear();
+
   if(fCacheFile) {
     fCacheFile->Close();
     delete fCacheFile;
@@ -79,14 +107,35 @@ Cache * Cache::Instance()
 //____________________________________________________________________________
 CacheBranchI * Cache::FindCacheBranch(string key)
 {
+  fNOperations++;
+
   map<string, CacheBranchI *>::const_iterator map_iter = fCacheMap->find(key);
+  if (map_iter != fCacheMap->end()) {
+    fNHits++;
+    if(map_iter->second) map_iter->second->fLastUse = fNOperations;
+    return map_iter->second;
+  }
 
-  if (map_iter == fCacheMap->end()) return 0;
+  // Read the cache store at the first lookup
+  if(!fStoreLoaded && fStoreFile.size() > 0) {
+    fStoreLoaded = true;
+    this->ReadCacheStore(fStoreFile);
+  }
+
+  map_iter = fStoreMap.find(key);
+  if (map_iter == fStoreMap.end()) {
+    fNMisses++;
+    return 0;
+  }
+  fNHits++;
   return map_iter->second;
 }
 //____________________________________________________________________________
 void Cache::AddCacheBranch(string key, CacheBranchI * branch)
 {
+  fNOperations++;
+  if(branch) branch->fLastUse = fNOperations;
+
   fCacheMap->insert( map<string, CacheBranchI *>::value_type(key,branch) );
 }
 //____________________________________________________________________________
@@ -105,6 +154,11 @@ void Cache::RmCacheBranch(string key)
 {
   LOG("Cache", pNOTICE) << "Removing cache branch: " << key;
 
+  map<string, CacheBranchI * >::iterator citer = fCacheMap->find(key);
+  if(citer == fCacheMap->end()) return;
+
+  delete citer->second;
+  fCacheMap->erase(citer);
 }
 //____________________________________________________________________________
 void Cache::RmAllCacheBranches(void)
@@ -128,6 +182,15 @@ void Cache::RmMatchedCacheBranches(string key_substring)
 {
   LOG("Cache", pNOTICE) << "Removing cache branches: *"<< key_substring<< "*";
 
+  map<string, CacheBranchI * >::iterator citer = fCacheMap->begin();
+  while(citer != fCacheMap->end()) {
+    if(citer->first.find(key_substring) != string::npos) {
+      delete citer->second;
+      fCacheMap->erase(citer++);
+    } else {
+      ++citer;
+    }
+  }
 }
 //____________________________________________________________________________
 void Cache::Load(void)
@@ -203,6 +266,281 @@ void Cache::OpenCacheFile(string filename)
   this->Load();
 }
 //____________________________________________________________________________
+void Cache::SetCacheStore(string filename)
+{
+  LOG("Cache", pNOTICE) << "Using cache store: " << filename;
+
+  fStoreFile   = filename;
+  fStoreLoaded = false;
+}
+//____________________________________________________________________________
+void Cache::ReadCacheStore(string filename)
+{
+// Reads the branches of the input cache store. Branches already in memory
+// (computed by this job or read from another store) are kept.
+
+  TDirectory * cwd = gDirectory;
+
+  TFile store(filename.c_str(), "READ");
+  if(!store.IsOpen()) {
+    LOG("Cache", pWARN) << "Could not open cache store: " << filename;
+    if(cwd) cwd->cd();
+    return;
+  }
+
+  TObjString * tag = (TObjString *) store.Get("store_tag");
+  if(tag) fStoreTag = string(tag->GetString().Data());
+
+  TList * keys = (TList*) store.Get("key_list");
+  TIter kiter(keys);
+  TObjString * keyobj = 0;
+  int ib=0, nread=0;
+  while ((keyobj = (TObjString *)kiter.Next())) {
+    string key = string(keyobj->GetString().Data());
+    ostringstream bname;
+    bname << "buffer_" << ib++;
+    CacheBranchI * buffer = (CacheBranchI*) store.Get(bname.str().c_str());
+    if(!buffer) continue;
+    bool exists = (fCacheMap->count(key) > 0 || fStoreMap.count(key) > 0);
+    if(exists) {
+      delete buffer;
+      continue;
+    }
+    fStoreMap.insert( map<string, CacheBranchI *>::value_type(key,buffer) );
+    nread++;
+  }
+  if(keys) {
+    keys->SetOwner(true);
+    delete keys;
+  }
+  delete tag;
+
+  store.Close();
+  if(cwd) cwd->cd();
+
+  LOG("Cache", pNOTICE)
+    << "Read " << nread << " cache branches from cache store: " << filename
+    << " (tag: " << fStoreTag << ")";
+}
+//____________________________________________________________________________
+bool Cache::WriteCacheStore(string filename, string tag) const
+{
+// Writes all cache branches in memory (computed by this job or read from
+// cache stores) to the input cache store file.
+// Only one writer at a time is allowed, through an flock(2) lock on a lock
+// file, which is released when the writer exits or dies. The store is
+// written to a temporary file and moved in place, so that jobs reading the
+// store concurrently see either the old or the new store.
+
+  string lock_file = filename + ".lock";
+  int lock = open(lock_file.c_str(), O_CREAT | O_RDWR, 0644);
+  if(lock < 0) {
+    LOG("Cache", pERROR)
+      << "Could not open lock file: " << lock_file << " ("
+      << std::strerror(errno) << ")";
+    return false;
+  }
+  if(flock(lock, LOCK_EX | LOCK_NB) != 0) {
+    char owner[32] = "";
+    ssize_t n = read(lock, owner, sizeof(owner)-1);
+    owner[(n > 0) ? n : 0] = 0;
+    LOG("Cache", pERROR)
+      << "Could not lock: " << lock_file << " ("
+      << std::strerror(errno) << ") - Is another job (pid: "
+      << ((n > 0) ? owner : "unknown") << ") writing the store?";
+    close(lock);
+    return false;
+  }
+  // record the writer, for the message above
+  ostringstream pid;
+  pid << getpid();
+  if(ftruncate(lock, 0) != 0 ||
+     write(lock, pid.str().c_str(), pid.str().size()) < 0) {
+    LOG("Cache", pWARN) << "Could not write the pid to: " << lock_file;
+  }
+
+  ostringstream tmp_file;
+  tmp_file << filename << ".tmp." << getpid();
+
+  TDirectory * cwd = gDirectory;
+
+  bool ok = false;
+  TFile store(tmp_file.str().c_str(), "RECREATE");
+  if(store.IsOpen()) {
+    store.cd();
+
+    int ib=0;
+    TList * keys = new TList;
+    keys->SetOwner(true);
+
+    const map<string, CacheBranchI * > * maps[2] = { fCacheMap, &fStoreMap };
+    for(int im = 0; im < 2; im++) {
+      map<string, CacheBranchI * >::const_iterator citer;
+      for(citer = maps[im]->begin(); citer != maps[im]->end(); ++citer) {
+        string key = citer->first;
+        CacheBranchI * branch = citer->second;
+        if(!branch) continue;
+        if(im == 1 && fCacheMap->count(key) > 0) continue;
+        ostringstream bname;
+        bname << "buffer_" << ib++;
+        keys->Add(new TObjString(key.c_str()));
+        branch->Write(bname.str().c_str(), TObject::kOverwrite);
+      }
+    }
+    keys->Write("key_list", TObject::kSingleKey | TObject::kOverwrite );
+    TObjString store_tag(tag.c_str());
+    store_tag.Write("store_tag", TObject::kOverwrite);
+
+    keys->Clear();
+    delete keys;
+
+    store.Close();
+
+    ok = (std::rename(tmp_file.str().c_str(), filename.c_str()) == 0);
+    if(ok) {
+      LOG("Cache", pNOTICE)
+        << "Wrote " << ib << " cache branches to cache store: " << filename
+        << " (tag: " << tag << ")";
+    } else {
+      LOG("Cache", pERROR)
+        << "Could not move " << tmp_file.str() << " to " << filename;
+      std::remove(tmp_file.str().c_str());
+    }
+  } else {
+    LOG("Cache", pERROR) << "Could not write: " << tmp_file.str();
+  }
+  if(cwd) cwd->cd();
+
+  // the lock file is left in place: removing it could let a job lock the
+  // removed file while another one locks a new file
+  flock(lock, LOCK_UN);
+  close(lock);
+
+  return ok;
+}
+//____________________________________________________________________________
+void Cache::SetMemoryBudget(size_t nbytes)
+{
+  LOG("Cache", pNOTICE)
+    << "Cache memory budget: "
+    << ((nbytes > 0) ? nbytes / (1024.*1024.) : 0.) << " MB"
+    << ((nbytes > 0) ? "" : " (unlimited)");
+
+  fMemoryBudget = nbytes;
+}
+//____________________________________________________________________________
+size_t Cache::MemoryUsage(void) const
+{
+  size_t nbytes = 0;
+  const map<string, CacheBranchI * > * maps[2] = { fCacheMap, &fStoreMap };
+  for(int im = 0; im < 2; im++) {
+    map<string, CacheBranchI * >::const_iterator citer;
+    for(citer = maps[im]->begin(); citer != maps[im]->end(); ++citer) {
+      if(citer->second) nbytes += citer->second->MemorySize();
+    }
+  }
+  return nbytes;
+}
+//____________________________________________________________________________
+void Cache::EnforceBudget(void)
+{
+// Evicts the least recently used branches until the memory budget is met.
+// Callers hold cache branches while using them, so this must only be called
+// when no branch is in use (eg between events).
+// Branch sizes change as points are added, so they are summed afresh.
+
+  if(fMemoryBudget == 0) return;
+
+  size_t usage = 0;
+  vector< pair<unsigned long, map<string, CacheBranchI *>::iterator> > lru;
+
+  map<string, CacheBranchI * >::iterator citer;
+  for(citer = fCacheMap->begin(); citer != fCacheMap->end(); ++citer) {
+    CacheBranchI * branch = citer->second;
+    if(!branch) continue;
+    usage += branch->MemorySize();
+    lru.push_back(std::make_pair(branch->fLastUse, citer));
+  }
+  map<string, CacheBranchI * >::const_iterator siter;
+  for(siter = fStoreMap.begin(); siter != fStoreMap.end(); ++siter) {
+    if(siter->second) usage += siter->second->MemorySize();
+  }
+
+  fPeakMemory = std::max(fPeakMemory, usage);
+  if(usage <= fMemoryBudget) return;
+
+  // Evict the least recently used branches first
+  std::sort(lru.begin(), lru.end(),
+    [](const pair<unsigned long, map<string, CacheBranchI *>::iterator> & a,
+       const pair<unsigned long, map<string, CacheBranchI *>::iterator> & b)
+    { return a.first < b.first; });
+
+  unsigned int nevicted = 0;
+  for(unsigned int i = 0; i < lru.size() && usage > fMemoryBudget; i++) {
+    map<string, CacheBranchI * >::iterator it = lru[i].second;
+    LOG("Cache", pDEBUG) << "Evicting cache branch: " << it->first;
+    usage -= std::min(usage, it->second->MemorySize());
+    delete it->second;
+    fCacheMap->erase(it);
+    nevicted++;
+  }
+  fNEvictions += nevicted;
+
+  if(nevicted > 0) {
+    LOG("Cache", pINFO)
+      << "Evicted " << nevicted << " cache branches - Memory usage: "
+      << usage / (1024.*1024.) << " MB";
+  }
+  if(usage > fMemoryBudget) {
+    LOG("Cache", pWARN)
+      << "Cache memory usage (" << usage / (1024.*1024.)
+      << " MB) exceeds the budget (" << fMemoryBudget / (1024.*1024.)
+      << " MB) with only cache store branches left";
+  }
+}
+//____________________________________________________________________________
+void Cache::PrintStats(ostream & stream) const
+{
+  // Group the branches by key prefix: the algorithm (name/config) owning them
+  map<string, pair<unsigned int, size_t> > groups;
+  const map<string, CacheBranchI * > * maps[2] = { fCacheMap, &fStoreMap };
+  for(int im = 0; im < 2; im++) {
+    map<string, CacheBranchI * >::const_iterator citer;
+    for(citer = maps[im]->begin(); citer != maps[im]->end(); ++citer) {
+      const string & key = citer->first;
+      size_t pos = key.find('/');
+      if(pos != string::npos) pos = key.find('/', pos+1);
+      string prefix = key.substr(0, pos);
+      pair<unsigned int, size_t> & group = groups[prefix];
+      group.first++;
+      if(citer->second) group.second += citer->second->MemorySize();
+    }
+  }
+
+  const double MB = 1024.*1024.;
+  unsigned long nlookups = fNHits + fNMisses;
+
+  stream << "\n [-] GENIE Cache Statistics:";
+  stream << "\n  |";
+  stream << "\n  |  Lookups: " << nlookups << " (hits: " << fNHits
+         << ", misses: " << fNMisses << ", hit rate: "
+         << ((nlookups > 0) ? 100. * fNHits / nlookups : 0.) << "%)";
+  stream << "\n  |  Evictions: " << fNEvictions;
+  stream << "\n  |  Memory usage: " << this->MemoryUsage() / MB
+         << " MB (peak: " << std::max(fPeakMemory, this->MemoryUsage()) / MB
+         << " MB, budget: ";
+  if(fMemoryBudget > 0) stream << fMemoryBudget / MB << " MB)";
+  else                  stream << "unlimited)";
+  stream << "\n  |";
+  map<string, pair<unsigned int, size_t> >::const_iterator giter;
+  for(giter = groups.begin(); giter != groups.end(); ++giter) {
+    stream << "\n  |--o  " << setw(60) << std::left << giter->first << std::right
+           << setw(8) << giter->second.first << " branches "
+           << setw(12) << giter->second.second / MB << " MB";
+  }
+  stream << "\n";
+}
+//____________________________________________________________________________
 void Cache::Print(ostream & stream) const
 {
   stream << "\n [-] GENIE Cache Buffers:";
@@ -216,6 +554,14 @@ void Cache::Print(ostream & stream) const
       stream << " *** NULL *** ";
     }
   }
+  if(fStoreFile.size() > 0) {
+    stream << "\n  |";
+    stream << "\n  | Cache store: " << fStoreFile << " (tag: " << fStoreTag << ")";
+    map<string, CacheBranchI * >::const_iterator siter;
+    for(siter = fStoreMap.begin(); siter != fStoreMap.end(); ++siter) {
+      stream << "\n  |--o  " << siter->first;
+    }
+  }
   stream << "\n";
 }
 //___________________________________________________________________________
@@ -5,6 +5,26 @@
 
 \brief    GENIE Cache Memory
 
+          Besides the cache file (opened in update mode, for a single job),
+          cache branches can be read from a cache store: a file written once
+          (eg by gmkrescache) and only read afterwards. The store is read when
+          a cache branch is first looked up and the file is closed right
+          after, so any number of jobs can share it. Stores are written to a
+          temporary file which is then renamed, while holding an flock(2) lock
+          (released even if the writer dies), so readers never see a partially
+          written store.
+
+          The memory used by the cache branches can be limited with a
+          budget (0, the default, means no limit). The budget is enforced by
+          EnforceBudget(), called by the drivers between events and between
+          cross section splines, when no cache branch is in use: the least
+          recently used branches computed by the job are evicted and get
+          recomputed if needed again. Branches read from the cache store are
+          never evicted.
+          Hits, misses, evictions and memory usage per cache key prefix (the
+          algorithm and configuration owning the branches) can be printed
+          with PrintStats().
+
 \author   Costas Andreopoulos <constantinos.andreopoulos \at cern.ch>
           University of Liverpool & STFC Rutherford Appleton Laboratory
 
@@ -18,6 +38,7 @@
 #ifndef _CACHE_H_
 #define _CACHE_H_
 
+#include <cstddef>
 #include <map>
 #include <string>
 #include <ostream>
@@ -44,6 +65,13 @@ public:
   //! cache file
   void OpenCacheFile (string filename);
 
+  //! read-only cache store
+  void   SetCacheStore   (string filename);
+  bool   HasCacheStore   (void) const { return fStoreFile.size() > 0; }
+  string CacheStoreTag   (void) const { return fStoreTag; }
+  void   ReadCacheStore  (string filename);
+  bool   WriteCacheStore (string filename, string tag) const;
+
   //! finding/adding cache branches
   CacheBranchI * FindCacheBranch (string key);
   void           AddCacheBranch  (string key, CacheBranchI * branch);
@@ -54,6 +82,17 @@ public:
   void RmAllCacheBranches    (void);
   void RmMatchedCacheBranches(string key_substring);
 
+  //! memory budget (bytes, 0: unlimited) and usage statistics
+  void          SetMemoryBudget (size_t nbytes);
+  void          EnforceBudget   (void);
+  size_t        MemoryBudget    (void) const { return fMemoryBudget; }
+  size_t        MemoryUsage     (void) const;
+  size_t        PeakMemoryUsage (void) const { return fPeakMemory;   }
+  unsigned long NHits           (void) const { return fNHits;        }
+  unsigned long NMisses         (void) const { return fNMisses;      }
+  unsigned long NEvictions      (void) const { return fNEvictions;   }
+  void          PrintStats      (ostream & stream) const;
+
   //! print cache buffers
   void   Print (ostream & stream) const;
   friend ostream & operator << (ostream & stream, const Cache & cache);
@@ -71,6 +110,20 @@ private:
   map<string, CacheBranchI * > * fCacheMap;
   TFile *                        fCacheFile;
 
+  //! branches read from the cache store
+  map<string, CacheBranchI * >   fStoreMap;
+  string                         fStoreFile;
+  string                         fStoreTag;
+  bool                           fStoreLoaded;
+
+  //! memory budget, access counters and statistics
+  size_t                         fMemoryBudget;
+  size_t                         fPeakMemory;
+  unsigned long                  fNOperations;
+  unsigned long                  fNHits;
+  unsigned long                  fNMisses;
+  unsigned long                  fNEvictions;
+
   //! singleton class: constructors are private
   Cache();
   Cache(const Cache & cache);
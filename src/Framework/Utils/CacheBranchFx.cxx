@@ -8,6 +8,8 @@
 */
 //____________________________________________________________________________
 
+#include <algorithm>
+
 #include "Framework/Utils/CacheBranchFx.h"
 
 using namespace genie;
@@ -44,14 +46,17 @@ CacheBranchFx::~CacheBranchFx()
 //____________________________________________________________________________
 void CacheBranchFx::Init(void)
 {
-  fName   = "";
-  fSpline = 0;
+  fName       = "";
+  fSpline     = 0;
+  fSplineType = "";
+  fRebuild    = false;
 }
 //____________________________________________________________________________
 void CacheBranchFx::CleanUp(void)
 {
   if(fSpline) delete fSpline;
-  fFx.clear();
+  fX.clear();
+  fY.clear();
 }
 //____________________________________________________________________________
 void CacheBranchFx::Reset(void)
@@ -60,42 +65,67 @@ void CacheBranchFx::Reset(void)
   this->Init();
 }
 //____________________________________________________________________________
+unsigned int CacheBranchFx::LowerBound(double x) const
+{
+  return std::lower_bound(fX.begin(), fX.end(), x) - fX.begin();
+}
+//____________________________________________________________________________
 void CacheBranchFx::AddValues(double x, double y)
 {
-  fFx.insert(map<double,double>::value_type(x,y));
+  // Points at an existing x are ignored (as for the earlier x->y map)
+  unsigned int i = this->LowerBound(x);
+  if(i < fX.size() && fX[i] == x) return;
+
+  fX.insert(fX.begin() + i, x);
+  fY.insert(fY.begin() + i, y);
 }
 //____________________________________________________________________________
 void CacheBranchFx::CreateSpline(string type)
 {
-  int n = fFx.size();
-  double * x = new double[n];
-  double * y = new double[n];
-
-  int i=0;
-  map<double,double>::const_iterator iter = fFx.begin();
-  for( ; iter !=fFx.end(); ++iter) {
-    x[i] = iter->first;
-    y[i] = iter->second;
-    i++;
-  }
+  fSplineType = type;
+  fRebuild    = true;
+}
+//____________________________________________________________________________
+void CacheBranchFx::BuildSpline(void) const
+{
+  fRebuild = false;
 
   if(fSpline) delete fSpline;
-  fSpline = new Spline(n,x,y);
-  fSpline->SetType(type);
+  fSpline = 0;
+
+  int n = fX.size();
+  if(n == 0) return;
 
-  delete [] x;
-  delete [] y;
+  fSpline = new Spline(n, const_cast<double *>(&fX[0]), const_cast<double *>(&fY[0]));
+  fSpline->SetType(fSplineType);
+}
+//____________________________________________________________________________
+Spline * CacheBranchFx::Spl(void) const
+{
+  if(fRebuild) this->BuildSpline();
+  return fSpline;
+}
+//____________________________________________________________________________
+size_t CacheBranchFx::MemorySize(void) const
+{
+  size_t size = sizeof(*this) + fName.capacity() + fSplineType.capacity();
+  size += (fX.capacity() + fY.capacity()) * sizeof(double);
+  // knots plus interpolation coefficients
+  if(fSpline) size += sizeof(Spline) + fSpline->NKnots() * 8 * sizeof(double);
+  return size;
 }
 //____________________________________________________________________________
 void CacheBranchFx::Print(ostream & stream) const
 {
-  stream << "type: [CacheBranchFx]  - nentries: " << fFx.size()
-           << " / spline: " << ((fSpline) ? "built" : "null");
+  stream << "type: [CacheBranchFx]  - nentries: " << fX.size()
+           << " / spline: " << ((fSpline) ? "built" : "null")
+           << ((fRebuild) ? " (to be rebuilt)" : "");
 }
 //____________________________________________________________________________
 double CacheBranchFx::operator () (double x) const
 {
-  if(!fSpline) return 0;
-  else         return fSpline->Evaluate(x);
+  Spline * spl = this->Spl();
+  if(!spl) return 0;
+  else     return spl->Evaluate(x);
 }
 //____________________________________________________________________________
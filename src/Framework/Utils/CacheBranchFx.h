@@ -7,12 +7,17 @@
 
 \author   Costas Andreopoulos <constantinos.andreopoulos \at cern.ch>
           University of Liverpool & STFC Rutherford Appleton Laboratory
-          
-          Update May 15, 2022 IK: 
-          Now type of spline can be:  TSpline3, TSpline5 and 
+
+          Update May 15, 2022 IK:
+          Now type of spline can be:  TSpline3, TSpline5 and
           ROOT::Math::GSLInterpolator (LINEAR, POLYNOMIAL, CSPLINE, CSPLINE_PERIODIC,
           AKIMA, AKIMA_PERIODIC)
-          
+
+          The (x,y) points are kept in two sorted arrays. CreateSpline()
+          only marks the spline for rebuilding: the spline is rebuilt once,
+          when it is next used, however many points were added or
+          CreateSpline() calls were made in between.
+
 \ref      [1] GENIE docdb 297
 
 \author   Costas Andreopoulos <constantinos.andreopoulos \at cern.ch>
@@ -23,7 +28,7 @@
 \created  November 26, 2004
 
 \cpright  Copyright (c) 2003-2023, The GENIE Collaboration
-          For the full text of the license visit http://copyright.genie-mc.org          
+          For the full text of the license visit http://copyright.genie-mc.org
 */
 //____________________________________________________________________________
 
@@ -32,14 +37,14 @@
 
 #include <iostream>
 #include <string>
-#include <map>
+#include <vector>
 
 #include "Framework/Numerical/Spline.h"
 #include "Framework/Utils/CacheBranchI.h"
 
 using std::string;
 using std::ostream;
-using std::map;
+using std::vector;
 
 namespace genie {
 
@@ -55,8 +60,15 @@ public:
   CacheBranchFx(string name);
   ~CacheBranchFx();
 
-  const map<double,double> & Map (void) const { return fFx;     }
-  Spline *                   Spl (void) const { return fSpline; }
+  //! cached points, sorted in x
+  unsigned int           NPoints (void) const { return fX.size(); }
+  const vector<double> & X       (void) const { return fX; }
+  const vector<double> & Y       (void) const { return fY; }
+
+  //! index of the first point with x >= the input x (NPoints() if none)
+  unsigned int LowerBound (double x) const;
+
+  Spline * Spl (void) const;
 
   void CreateSpline(string type = "TSpline3");
   void AddValues(double x, double y);
@@ -64,18 +76,24 @@ public:
   void Reset (void);
   void Print (ostream & stream) const;
 
+  size_t MemorySize (void) const;
+
   double operator () (double x) const;
   friend ostream & operator << (ostream & stream, const CacheBranchFx & cbntp);
 
 private:
-  void Init    (void);
-  void CleanUp (void);
-
-  string             fName;   ///< cache branch name
-  map<double,double> fFx;     ///< x->y map
-  Spline *           fSpline; ///< spline y = f(x)
-
-ClassDef(CacheBranchFx,1)
+  void Init        (void);
+  void CleanUp     (void);
+  void BuildSpline (void) const;
+
+  string           fName;        ///< cache branch name
+  vector<double>   fX;           ///< x values, sorted
+  vector<double>   fY;           ///< y values
+  mutable Spline * fSpline;      ///< spline y = f(x)
+  string           fSplineType;  ///< spline type requested at CreateSpline()
+  mutable bool     fRebuild;     ///< spline to be rebuilt at the next use
+
+ClassDef(CacheBranchFx,2)
 };
 
 }      // genie namespace
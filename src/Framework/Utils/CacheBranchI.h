@@ -18,6 +18,8 @@
 #ifndef _CACHE_BRANCH_I_H_
 #define _CACHE_BRANCH_I_H_
 
+#include <cstddef>
+
 #include <TObject.h>
 
 namespace genie {
@@ -26,8 +28,15 @@ class CacheBranchI : public TObject
 {
 public:
   virtual ~CacheBranchI() {}
+
+  //! approximate memory used by the branch (bytes), for the Cache budget
+  virtual size_t MemorySize(void) const { return sizeof(*this); }
 protected:
-  CacheBranchI() : TObject() {}
+  CacheBranchI() : TObject(), fLastUse(0) {}
+
+private:
+  friend class Cache;
+  unsigned long fLastUse; //! Cache operation count at the last access (for LRU eviction)
 
 ClassDef(CacheBranchI,0)
 };
@@ -78,6 +78,17 @@ void CacheBranchNtp::Print(ostream & stream) const
   }
 }
 //____________________________________________________________________________
+size_t CacheBranchNtp::MemorySize(void) const
+{
+  size_t size = sizeof(*this);
+  if(fNtp) {
+    // the (circular) buffer holds one double per entry and variable
+    size += sizeof(TNtupleD) +
+            size_t(fNtp->GetEntries()) * fNtp->GetNvar() * sizeof(double);
+  }
+  return size;
+}
+//____________________________________________________________________________
 TNtupleD * CacheBranchNtp::operator () (void) const
 {
   return this->Ntuple();
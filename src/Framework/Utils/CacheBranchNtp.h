@@ -48,6 +48,8 @@ public:
   void Reset (void);
   void Print (ostream & stream) const;
 
+  size_t MemorySize (void) const;
+
   TNtupleD *       operator () (void) const;
   friend ostream & operator << (ostream & stream, const CacheBranchNtp & cbntp);
 
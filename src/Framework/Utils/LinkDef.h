@@ -26,6 +26,14 @@
 #pragma link C++ class genie::CacheBranchI;
 #pragma link C++ class genie::CacheBranchNtp;
 #pragma link C++ class genie::CacheBranchFx;
+
+// CacheBranchFx v1 stored the cached points in an x->y map
+#pragma read sourceClass="genie::CacheBranchFx" version="[1]" \
+  source="map<double,double> fFx" targetClass="genie::CacheBranchFx" target="fX,fY" \
+  code="{ fX.clear(); fY.clear(); \
+          for(map<double,double>::const_iterator it = onfile.fFx.begin(); it != onfile.fFx.end(); ++it) { \
+            fX.push_back(it->first); fY.push_back(it->second); } }"
+
 #pragma link C++ class genie::CmdLnArgParser;
 #pragma link C++ class genie::XSecSplineList;
 #pragma link C++ class genie::Range1D_t;
@@ -8,12 +8,23 @@
 */
 //____________________________________________________________________________
 
+#include <algorithm>
+#include <map>
+#include <vector>
+
 #include <TMath.h>
 
 #include "Framework/Conventions/Constants.h"
 #include "Framework/Conventions/Units.h"
 #include "Framework/Utils/PREM.h"
 
+namespace {
+  // PREM shell boundaries (in km), where the density is discontinuous
+  const int    kNShells       = 9;
+  const double kShellRadius[] = { 1221.5, 3480.0, 5701.0, 5771.0, 5971.0,
+                                  6151.0, 6346.6, 6356.0, 6368.0 };
+}
+
 //___________________________________________________________________________
 double genie::utils::prem::Density(double r)
 {
@@ -74,3 +85,146 @@ double genie::utils::prem::Density(double r)
   return rho;
 }
 //___________________________________________________________________________
+double genie::utils::prem::PathLength(double costheta, double depth)
+{
+// Return the distance travelled in the Earth by a neutrino reaching a
+// detector at the input depth from the direction with the input zenith angle
+// Inputs:  costheta, cosine of the zenith angle of the incoming direction
+//          depth,    detector depth below the surface (in std GENIE units)
+// Outputs: L,        path length (in std GENIE units)
+//
+  double rE = constants::kREarth;
+  double r0 = TMath::Max(0., rE - depth);
+  costheta  = TMath::Max(-1., TMath::Min(1., costheta));
+
+  // solve |r0*z + s*n| = rE for s > 0, where n.z = costheta
+  double D = r0*r0*costheta*costheta - r0*r0 + rE*rE;
+  return TMath::Max(0., -r0*costheta + TMath::Sqrt(TMath::Max(0., D)));
+}
+//___________________________________________________________________________
+double genie::utils::prem::ColumnDepth(double costheta, double depth)
+{
+// Return the column depth (density integrated along the path) for a
+// neutrino reaching a detector at the input depth from the direction with
+// the input zenith angle
+// Inputs:  costheta, cosine of the zenith angle of the incoming direction
+//          depth,    detector depth below the surface (in std GENIE units)
+// Outputs: X,        column depth (in std GENIE units)
+//
+// The column depth is interpolated in a table vs cos(zenith), built once
+// for each detector depth.
+//
+  static std::map<double, ColumnDepthTable *> tables;
+
+  std::map<double, ColumnDepthTable *>::const_iterator it = tables.find(depth);
+  if(it == tables.end()) {
+    it = tables.insert(std::make_pair(depth, new ColumnDepthTable(depth))).first;
+  }
+  return it->second->ColumnDepth(costheta);
+}
+//___________________________________________________________________________
+genie::utils::prem::ColumnDepthTable::ColumnDepthTable(
+   double depth, int npoints) :
+fDepth(depth)
+{
+  // uniform grid in cos(zenith)
+  npoints = TMath::Max(npoints, 2);
+  for(int i = 0; i < npoints; i++) {
+    fCosTheta.push_back(-1. + 2.*i/(npoints-1));
+  }
+
+  // the column depth has a square-root kink at the directions tangent to
+  // a shell boundary: add these as nodes, with a geometric refinement around
+  // each of them
+  double h  = 2./(npoints-1);
+  double r0 = TMath::Max(0., constants::kREarth - depth);
+  for(int i = 0; i < kNShells; i++) {
+    double rs = kShellRadius[i] * units::km;
+    if(rs >= r0) continue;
+    double ct = -TMath::Sqrt(1. - (rs/r0)*(rs/r0));
+    fCosTheta.push_back(ct);
+    double d = h;
+    for(int k = 0; k < 8; k++, d *= 0.25) {
+      if(ct - d > -1.) fCosTheta.push_back(ct - d);
+      if(ct + d <  1.) fCosTheta.push_back(ct + d);
+    }
+  }
+  std::sort(fCosTheta.begin(), fCosTheta.end());
+  fCosTheta.erase(std::unique(fCosTheta.begin(), fCosTheta.end()),
+                  fCosTheta.end());
+
+  fX.resize(fCosTheta.size());
+  for(unsigned int i = 0; i < fCosTheta.size(); i++) {
+    fX[i] = ColumnDepthTable::Integrate(fCosTheta[i], depth);
+  }
+}
+//___________________________________________________________________________
+double genie::utils::prem::ColumnDepthTable::ColumnDepth(
+   double costheta) const
+{
+  costheta = TMath::Max(-1., TMath::Min(1., costheta));
+  int n = fCosTheta.size();
+  int i = std::upper_bound(fCosTheta.begin(), fCosTheta.end(), costheta)
+          - fCosTheta.begin() - 1;
+  i = TMath::Max(0, TMath::Min(i, n-2));
+  double f = (costheta - fCosTheta[i]) / (fCosTheta[i+1] - fCosTheta[i]);
+  return (1-f)*fX[i] + f*fX[i+1];
+}
+//___________________________________________________________________________
+double genie::utils::prem::ColumnDepthTable::PathLength(
+   double costheta) const
+{
+  return prem::PathLength(costheta, fDepth);
+}
+//___________________________________________________________________________
+double genie::utils::prem::ColumnDepthTable::Integrate(
+   double costheta, double depth)
+{
+// Integrates the density along the path, to build the table
+//
+  double rE = constants::kREarth/units::km;
+  double r0 = TMath::Max(0., rE - depth/units::km);
+  double c  = TMath::Max(-1., TMath::Min(1., costheta));
+  double L  = prem::PathLength(c, depth)/units::km;
+  if(L <= 0.) return 0.;
+
+  // split the path where it crosses shell boundaries, so that the density
+  // is smooth within each segment
+  std::vector<double> s;
+  s.push_back(0.);
+  s.push_back(L);
+  for(int i = 0; i < kNShells; i++) {
+    double D = r0*r0*c*c - r0*r0 + kShellRadius[i]*kShellRadius[i];
+    if(D <= 0.) continue;
+    double sq = TMath::Sqrt(D);
+    double s1 = -r0*c - sq;
+    double s2 = -r0*c + sq;
+    if(s1 > 0. && s1 < L) s.push_back(s1);
+    if(s2 > 0. && s2 < L) s.push_back(s2);
+  }
+  std::sort(s.begin(), s.end());
+
+  // Simpson's rule within each segment
+  const int n = 32; // even
+  double X = 0.;
+  for(unsigned int iseg = 0; iseg+1 < s.size(); iseg++) {
+    double a = s[iseg];
+    double h = (s[iseg+1] - a)/n;
+    if(h <= 0.) continue;
+    double sum = 0.;
+    for(int k = 0; k <= n; k++) {
+      // the edges are evaluated just inside the segment, to pick the
+      // density of the current shell
+      double sk = a + k*h;
+      if(k == 0) sk += 1e-6*h;
+      if(k == n) sk -= 1e-6*h;
+      double r  = TMath::Sqrt(TMath::Max(0., r0*r0 + sk*sk + 2*r0*sk*c));
+      double w = (k == 0 || k == n) ? 1. : ((k % 2) ? 4. : 2.);
+      sum += w * Density(r*units::km);
+    }
+    X += sum * h/3.;
+  }
+
+  return X * units::km;
+}
+//___________________________________________________________________________
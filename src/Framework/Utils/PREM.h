@@ -5,6 +5,11 @@
 
 \brief      Preliminary Earth Model
 
+            Besides the density profile, provides the path length and column
+            depth along the chord between the Earth surface and a detector
+            for any zenith angle, and a table of column depth vs zenith angle
+            for use in event loops (atmospheric and up-going muon workflows).
+
 \author     Costas Andreopoulos <constantinos.andreopoulos \at cern.ch>
             University of Liverpool & STFC Rutherford Appleton Laboratory
 
@@ -18,6 +23,8 @@
 #ifndef _PREM_H_
 #define _PREM_H_
 
+#include <vector>
+
 namespace genie {
 namespace utils {
 
@@ -31,6 +38,39 @@ namespace prem
   //
   double Density(double r);
 
+  //
+  // length of and column depth (integrated density) along the chord from
+  // the Earth surface to a detector at the input depth below the surface,
+  // for a neutrino coming from the direction with the input zenith angle
+  // (costheta = +1: from above, -1: from below). Std GENIE units.
+  // ColumnDepth() interpolates in a ColumnDepthTable built once per depth.
+  //
+  double PathLength  (double costheta, double depth = 0);
+  double ColumnDepth (double costheta, double depth = 0);
+
+  //
+  // column depth tabulated vs cos(zenith) for a given detector depth, on a
+  // uniform grid refined around the directions tangent to the PREM shell
+  // boundaries, with linear interpolation
+  //
+  class ColumnDepthTable
+  {
+  public:
+    ColumnDepthTable(double depth = 0, int npoints = 2001);
+
+    double ColumnDepth (double costheta) const;
+    double PathLength  (double costheta) const;
+    double Depth       (void) const { return fDepth; }
+
+    /// integrates the density along the chord, shell by shell
+    static double Integrate (double costheta, double depth);
+
+  private:
+    double              fDepth;     ///< detector depth
+    std::vector<double> fCosTheta;  ///< cos(zenith) nodes
+    std::vector<double> fX;         ///< column depth at each node
+  };
+
 } // prem  namespace
 } // utils namespace
 } // genie namespace
@@ -15,6 +15,7 @@
 #include <TBits.h>
 
 #include "Framework/GHEP/GHepFlags.h"
+#include "Framework/Utils/Cache.h"
 #include "Framework/Utils/CmdLnArgParser.h"
 #include "Framework/Utils/RunOpt.h"
 #include "Framework/Utils/SystemUtils.h"
@@ -66,6 +67,10 @@ void RunOpt::Init(void)
   fTune = 0 ;
   fEnableBareXSecPreCalc = true;
   fCacheFile = "";
+  fCacheStore = "";
+  fCacheMemoryBudget = 0.;
+  fNtpOutputs = "ghep";
+  fGSTColumns = "";
   fMesgThresholds = "";
   fUnphysEventMask = new TBits(GHepFlags::NFlags());
 //fUnphysEventMask->ResetAllBits(true);
@@ -112,6 +117,24 @@ void RunOpt::ReadFromCommandLine(int argc, char ** argv)
     fCacheFile = parser.ArgAsString("cache-file");
   }
 
+  if( parser.OptionExists("cache-store") ) {
+    fCacheStore = parser.ArgAsString("cache-store");
+    Cache::Instance()->SetCacheStore(fCacheStore);
+  }
+
+  if( parser.OptionExists("cache-memory-budget") ) {
+    fCacheMemoryBudget = TMath::Max(0., parser.ArgAsDouble("cache-memory-budget"));
+    Cache::Instance()->SetMemoryBudget(size_t(fCacheMemoryBudget * 1024 * 1024));
+  }
+
+  if( parser.OptionExists("ntp-outputs") ) {
+    fNtpOutputs = parser.ArgAsString("ntp-outputs");
+  }
+
+  if( parser.OptionExists("gst-columns") ) {
+    fGSTColumns = parser.ArgAsString("gst-columns");
+  }
+
   if( parser.OptionExists("message-thresholds") ) {
     fMesgThresholds = parser.ArgAsString("message-thresholds");
   }
@@ -173,6 +196,10 @@ std::string RunOpt::RunOptSyntaxString(bool include_generator_specific)
       << "\n         [--event-record-print-level level]"
       << "\n         [--mc-job-status-refresh-rate rate]"
       << "\n         [--cache-file root_file]"
+      << "\n         [--cache-store root_file]"
+      << "\n         [--cache-memory-budget MB]"
+      << "\n         [--ntp-outputs ghep,gst,rootracker,gidx]"
+      << "\n         [--gst-columns list]"
       << "\n         [--enable-bare-xsec-pre-calc]"
       << "\n         [--disable-bare-xsec-pre-calc]"
       << "\n         [--unphysical-event-mask mask]"
@@ -189,6 +216,12 @@ void RunOpt::Print(ostream & stream) const
   stream << "\n Event generator list: " << fEventGeneratorList;
   stream << "\n User-specified message thresholds : " << fMesgThresholds;
   stream << "\n Cache file : " << fCacheFile;
+  stream << "\n Cache store : " << fCacheStore;
+  stream << "\n Cache memory budget (MB, 0: unlimited) : " << fCacheMemoryBudget;
+  stream << "\n Output ntuples : " << fNtpOutputs;
+  if (fGSTColumns.size()) {
+    stream << "\n Summary ntuple (gst) columns : " << fGSTColumns;
+  }
   stream << "\n Unphysical event mask (bits: "
          << GHepFlags::NFlags()-1 << " -> 0) : " << *fUnphysEventMask;
   stream << "\n Event record print level : " << fEventRecordPrintLevel;
@@ -46,6 +46,10 @@ public:
   TuneId * Tune                 (void) const { return fTune;                   }
   string EventGeneratorList     (void) const { return fEventGeneratorList;     }
   string CacheFile              (void) const { return fCacheFile;              }
+  string CacheStore             (void) const { return fCacheStore;             }
+  double CacheMemoryBudget      (void) const { return fCacheMemoryBudget;      }
+  string NtpOutputs             (void) const { return fNtpOutputs;             }
+  string GSTColumns             (void) const { return fGSTColumns;             }
   string MesgThresholdFiles     (void) const { return fMesgThresholds;         }
   TBits* UnphysEventMask        (void) const { return fUnphysEventMask;        }
   int    EventRecordPrintLevel  (void) const { return fEventRecordPrintLevel;  }
@@ -73,6 +77,10 @@ private:
   TuneId * fTune;                    ///< GENIE comprehensive neutrino interaction model tune.
   string fEventGeneratorList;        ///< Name of event generator list to be loaded by the event generation drivers.
   string fCacheFile;                 ///< Name of cache file, is cache is to be re-used.
+  string fCacheStore;                ///< Name of read-only cache store (see gmkrescache).
+  double fCacheMemoryBudget;         ///< Cache memory budget in MB (0: unlimited).
+  string fNtpOutputs;                ///< Output trees written by NtpWriter (comma-separated; ghep, gst, rootracker, gidx).
+  string fGSTColumns;                ///< Columns of the gst output tree (comma-separated; empty: all).
   string fMesgThresholds;            ///< List of files (delimited with : if more than one) with custom mesg stream thresholds.
   TBits* fUnphysEventMask;           ///< Unphysical event mask.
   int    fEventRecordPrintLevel;     ///< GHEP event r ecord print level.
@@ -15,6 +15,10 @@
 
 #include <fstream>
 #include <cstdlib>
+#include <cstdio>
+#include <iostream>
+#include <unistd.h>
+#include <sys/wait.h>
 
 #include "libxml/parser.h"
 #include "libxml/xmlmemory.h"
@@ -57,6 +61,7 @@ XSecSplineList::XSecSplineList()
   fNKnots      = 100;
   fEmin        =   0.01; // GeV
   fEmax        = 100.00; // GeV
+  fNWorkers    =   1;
 }
 //____________________________________________________________________________
 XSecSplineList::~XSecSplineList()
@@ -235,27 +240,22 @@ void XSecSplineList::CreateSpline(const XSecAlgorithmI * alg,
   // Compute cross sections for the input interaction at the selected
   // set of energies
   //
-  double pr_mass = interaction->InitStatePtr()->Probe()->Mass();
-  for (int i = 0; i < nknots; i++) {
-    TLorentzVector p4(0,0,E[i],E[i]);
-    if (pr_mass > 0.) {
-      double pz = TMath::Max(0.,E[i]*E[i] - pr_mass*pr_mass);
-      pz = TMath::Sqrt(pz);
-      p4.SetPz(pz);
-    }
-    interaction->InitStatePtr()->SetProbeP4(p4);
+  steady_clock::time_point start = steady_clock::now();
 
-    steady_clock::time_point start = steady_clock::now();
+  this->IntegrateKnots(alg, interaction, E, xsec);
 
-    xsec[i] = alg->Integral(interaction);
+  steady_clock::time_point end = steady_clock::now();
 
-    steady_clock::time_point end = steady_clock::now();
+  duration<double> time_span = duration_cast<duration<double>>(end - start);
 
-    duration<double> time_span = duration_cast<duration<double>>(end - start);
+  SLOG("XSecSplLst", pNOTICE)
+     << nknots << " knots evaluated in " << time_span.count() << " s"
+     << " (" << TMath::Min(fNWorkers, nknots) << " process(es))";
 
+  for (int i = 0; i < nknots; i++) {
     SLOG("XSecSplLst", pNOTICE)
                        << "xsec(E = " << E[i] << ") =  "
-                       << (1E+38/units::cm2)*xsec[i] << " x 1E-38 cm^2, evaluated in " << time_span.count() << " s";
+                       << (1E+38/units::cm2)*xsec[i] << " x 1E-38 cm^2";
     if ( std::isnan(xsec[i]) ) {
       // this sometimes happens near threshold, warn and move on
       SLOG("XSecSplLst", pWARN)
@@ -336,6 +336,113 @@ void XSecSplineList::SetMaxE(double Ev)
   if(Ev>0) fEmax = Ev;
 }
 //____________________________________________________________________________
+void XSecSplineList::SetNWorkers(int n)
+{
+  fNWorkers = TMath::Max(1, n);
+}
+//____________________________________________________________________________
+void XSecSplineList::IntegrateKnots(const XSecAlgorithmI * alg,
+   const Interaction * interaction, const vector<double> & E,
+   vector<double> & xsec) const
+{
+// Computes the cross section at each knot energy.
+// With more than one worker, the knots are shared among forked processes:
+// cross section algorithms keep mutable state (and some use non re-entrant
+// external libraries) so they can not be used from several threads. Worker
+// w computes knots w, w+n, w+2n, ... so that the (energy dependent) cost is
+// balanced, and sends the results back through a pipe. Knots of a failed
+// worker are computed by the parent process.
+// The last knot (which is above threshold) is computed by the parent before
+// forking. This builds any energy independent cache the algorithm fills
+// lazily (e.g. the DIS free nucleon cross section cache branches) in the
+// parent: the workers inherit it rather than each rebuilding it, and it is
+// kept for the splines computed afterwards.
+
+  int nknots   = E.size();
+  int nworkers = TMath::Min(fNWorkers, nknots-1);
+
+  if(nworkers <= 1) {
+    alg->IntegralBatch(interaction, E, xsec);
+    return;
+  }
+
+  xsec.assign(nknots, 0.);
+
+  vector<double> Elast(1, E[nknots-1]), xseclast;
+  alg->IntegralBatch(interaction, Elast, xseclast);
+  xsec[nknots-1] = xseclast[0];
+
+  // knots shared among the workers
+  int nshared = nknots-1;
+
+  std::cout.flush();
+  std::cerr.flush();
+  fflush(NULL);
+
+  vector<pid_t> pids(nworkers, -1);
+  vector<int>   fds (nworkers, -1);
+
+  for(int w = 0; w < nworkers; w++) {
+    int fd[2];
+    if(pipe(fd) != 0) continue;
+
+    pid_t pid = fork();
+    if(pid == 0) {
+      close(fd[0]);
+      vector<double> Ew, xsecw;
+      for(int i = w; i < nshared; i += nworkers) Ew.push_back(E[i]);
+      alg->IntegralBatch(interaction, Ew, xsecw);
+      const char * buf = (const char *) &xsecw[0];
+      size_t left = xsecw.size() * sizeof(double);
+      while(left > 0) {
+        ssize_t n = write(fd[1], buf, left);
+        if(n <= 0) _exit(1);
+        buf  += n;
+        left -= n;
+      }
+      close(fd[1]);
+      _exit(0);
+    }
+    close(fd[1]);
+    if(pid < 0) {
+      close(fd[0]);
+      continue;
+    }
+    pids[w] = pid;
+    fds [w] = fd[0];
+  }
+
+  for(int w = 0; w < nworkers; w++) {
+    vector<double> Ew;
+    for(int i = w; i < nshared; i += nworkers) Ew.push_back(E[i]);
+    vector<double> xsecw(Ew.size(), 0.);
+
+    bool ok = false;
+    if(pids[w] > 0) {
+      char * buf = (char *) &xsecw[0];
+      size_t left = xsecw.size() * sizeof(double);
+      while(left > 0) {
+        ssize_t n = read(fds[w], buf, left);
+        if(n <= 0) break;
+        buf  += n;
+        left -= n;
+      }
+      close(fds[w]);
+      int status = 0;
+      waitpid(pids[w], &status, 0);
+      ok = (left == 0 && WIFEXITED(status) && WEXITSTATUS(status) == 0);
+    }
+    if(!ok) {
+      SLOG("XSecSplLst", pWARN)
+        << "Worker " << w << " failed - computing its knots in the main process";
+      alg->IntegralBatch(interaction, Ew, xsecw);
+    }
+    for(unsigned int j = 0; j < Ew.size(); j++) {
+      xsec[w + j*nworkers] = xsecw[j];
+    }
+  }
+}
+//____________________________________________________________________________
 void XSecSplineList::SaveAsXml(const string & filename, bool save_init) const
 {
 //! Save XSecSplineList to XML file
@@ -589,6 +696,7 @@ void XSecSplineList::Print(ostream & stream) const
   stream << "\n  |-----o  Spline Emin..............." << fEmin;
   stream << "\n  |-----o  Spline Emax..............." << fEmax;
   stream << "\n  |-----o  Spline NKnots............." << fNKnots;
+  stream << "\n  |-----o  Spline NWorkers..........." << fNWorkers;
   stream << "\n  |";
 
   map<string, map<string, Spline *> >::const_iterator mm_iter;
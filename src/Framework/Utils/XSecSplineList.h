@@ -85,10 +85,12 @@ public:
   void   SetNKnots (int    nk); ///< set default number of knots for building the spline
   void   SetMinE   (double Ev); ///< set default minimum energy for xsec splines
   void   SetMaxE   (double Ev); ///< set default maximum energy for xsec splines
+  void   SetNWorkers (int n);     ///< set number of processes computing the knots of each spline
   bool   UseLogE   (void) const { return fUseLogE;  }
   int    NKnots    (void) const { return fNKnots;   }
   double Emin      (void) const { return fEmin;     }
   double Emax      (void) const { return fEmax;     }
+  int    NWorkers  (void) const { return fNWorkers; }
 
 private:
 
@@ -96,12 +98,16 @@ private:
   XSecSplineList(const XSecSplineList & spline_list);
   virtual ~XSecSplineList();
 
+  void IntegrateKnots (const XSecAlgorithmI * alg, const Interaction * i,
+                       const vector<double> & E, vector<double> & xsec) const;
+
   static XSecSplineList * fInstance;
 
   bool   fUseLogE;
   int    fNKnots;
   double fEmin;
   double fEmax;
+  int    fNWorkers;
 
   string fCurrentTune; ///< The `active' tune, out the many that can co-exist
 
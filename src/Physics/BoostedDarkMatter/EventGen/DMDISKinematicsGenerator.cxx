@@ -158,6 +158,8 @@ void DMDISKinematicsGenerator::ProcessEventRecord(GHepRecord * evrec) const
         accept = (xsec>0);
      }
 
+     this->CountTrial(accept);
+
      //-- If the generated kinematics are accepted, finish-up module's job
      if(accept) {
          LOG("DMDISKinematics", pNOTICE) 
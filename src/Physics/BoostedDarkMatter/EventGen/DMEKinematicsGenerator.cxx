@@ -123,6 +123,8 @@ void DMEKinematicsGenerator::ProcessEventRecord(GHepRecord * evrec) const
        accept = (xsec>0);
      }
 
+     this->CountTrial(accept);
+
      //-- If the generated kinematics are accepted, finish-up module's job
      if(accept) {
         LOG("DMEKinematics", pINFO) << "Selected: y = " << y;
@@ -170,6 +170,8 @@ void DMELKinematicsGenerator::ProcessEventRecord(GHepRecord * evrec) const
         accept = (xsec>0);
      }
 
+     this->CountTrial(accept);
+
      //-- If the generated kinematics are accepted, finish-up module's job
      if(accept) {
         LOG("DMELKinematics", pINFO) << "Selected: Q^2 = " << gQ2;
@@ -390,6 +392,8 @@ void DMELKinematicsGenerator::SpectralFuncExperimentalCode(
 //        accept = (xsec>0);
 //     }
 
+     this->CountTrial(accept);
+
      //-- If the generated kinematics are accepted, finish-up module's job
      if(accept) {
         LOG("DMELKinematics", pNOTICE) << "Selected: Q^2 = " << gQ2;
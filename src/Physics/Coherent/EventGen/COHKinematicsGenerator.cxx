@@ -142,6 +142,8 @@ void COHKinematicsGenerator::CalculateKin_BergerSehgal(GHepRecord * evrec) const
     //-- decide whether to accept the current kinematics
     accept = (xsec_max * rnd->RndKine().Rndm() < xsec);
 
+    this->CountTrial(accept);
+
     //-- If the generated kinematics are accepted, finish-up module's job
     if(accept) {
       LOG("COHKinematics", pNOTICE)
@@ -262,6 +264,8 @@ void COHKinematicsGenerator::CalculateKin_BergerSehgalFM(GHepRecord * evrec) con
     //-- decide whether to accept the current kinematics
     accept = (xsec_max * rnd->RndKine().Rndm() < xsec);
 
+    this->CountTrial(accept);
+
     //-- If the generated kinematics are accepted, finish-up module's job
     if(accept) {
       LOG("COHKinematics", pNOTICE)
@@ -373,6 +377,8 @@ void COHKinematicsGenerator::CalculateKin_ReinSehgal(GHepRecord * evrec) const
       accept = (xsec>0);
     }
 
+    this->CountTrial(accept);
+
     //-- If the generated kinematics are accepted, finish-up module's job
     if(accept) {
       LOG("COHKinematics", pNOTICE) << "Selected: x = "<< gx << ", y = "<< gy;
@@ -526,6 +532,8 @@ void COHKinematicsGenerator::CalculateKin_AlvarezRuso(GHepRecord * evrec) const
       accept = (xsec>0);
     }
 
+    this->CountTrial(accept);
+
     //-- If the generated kinematics are accepted, finish-up module's job
     if(accept) {
       LOG("COHKinematics", pNOTICE) << "Selected: Lepton(" <<
@@ -0,0 +1,151 @@
+//____________________________________________________________________________
+/*
+ Copyright (c) 2003-2023, The GENIE Collaboration
+ For the full text of the license visit http://copyright.genie-mc.org
+
+ The GENIE Collaboration
+*/
+//____________________________________________________________________________
+
+#include <TMath.h>
+
+#include "Framework/Messenger/Messenger.h"
+#include "Physics/Coherent/XSection/ARWavefunctionCache.h"
+#include "Physics/Coherent/XSection/ARSampledNucleus.h"
+
+namespace genie {
+namespace alvarezruso {
+
+//____________________________________________________________________________
+ARWavefunctionCache::ARWavefunctionCache(double step, unsigned int max_size) :
+fEnergyStep(step),
+fMaxSize(max_size),
+fNHits(0),
+fNMisses(0)
+{
+
+}
+//____________________________________________________________________________
+ARWavefunctionCache::~ARWavefunctionCache()
+{
+  this->Clear();
+
+  std::map<unsigned long, ARSampledNucleus *>::iterator it;
+  for ( it = fNuclei.begin(); it != fNuclei.end(); ++it ) delete it->second;
+  fNuclei.clear();
+}
+//____________________________________________________________________________
+ARSampledNucleus * ARWavefunctionCache::Nucleus(
+                   unsigned int Z, unsigned int A, unsigned int sampling)
+{
+  unsigned long key = (1000UL * Z + A) * 1000UL + sampling;
+
+  std::map<unsigned long, ARSampledNucleus *>::iterator it = fNuclei.find(key);
+  if ( it != fNuclei.end() ) return it->second;
+
+  LOG("ARWavefunctionCache", pINFO)
+    << "Sampling nucleus Z = " << Z << ", A = " << A << " with " << sampling << " points";
+
+  ARSampledNucleus * nucleus = new ARSampledNucleus(Z, A, sampling);
+  fNuclei[key] = nucleus;
+  return nucleus;
+}
+//____________________________________________________________________________
+double ARWavefunctionCache::SolvedKineticEnergy(double T_pi, double hbar) const
+{
+  if ( fEnergyStep <= 0. ) return T_pi;
+
+  double step = fEnergyStep / hbar;
+  return ( TMath::Floor( TMath::Max(0., T_pi) / step ) + 0.5 ) * step;
+}
+//____________________________________________________________________________
+const ARWavefunctionSet * ARWavefunctionCache::Find(
+                   const ARSampledNucleus * nucleus, double m_pi, double T_pi)
+{
+  Key key;
+  key.nucleus = nucleus;
+  key.m_pi    = m_pi;
+  key.T_pi    = T_pi;
+
+  std::map<Key, Entry>::iterator it = fSolutions.find(key);
+  if ( it == fSolutions.end() ) {
+    fNMisses++;
+    return 0;
+  }
+
+  // Move to the front of the usage list
+  fUsage.splice( fUsage.begin(), fUsage, it->second.use );
+  fNHits++;
+
+  return it->second.wf;
+}
+//____________________________________________________________________________
+ARWavefunctionSet * ARWavefunctionCache::Insert(
+                   const ARSampledNucleus * nucleus, double m_pi, double T_pi)
+{
+  // Remove the least recently used solutions
+  while ( fMaxSize > 0 && fSolutions.size() >= fMaxSize && !fUsage.empty() ) {
+    std::map<Key, Entry>::iterator it = fSolutions.find( fUsage.back() );
+    delete it->second.wf;
+    fSolutions.erase(it);
+    fUsage.pop_back();
+  }
+
+  Key key;
+  key.nucleus = nucleus;
+  key.m_pi    = m_pi;
+  key.T_pi    = T_pi;
+
+  std::map<Key, Entry>::iterator it = fSolutions.find(key);
+  if ( it != fSolutions.end() ) return it->second.wf;
+
+  fUsage.push_front(key);
+
+  Entry entry;
+  entry.wf  = new ARWavefunctionSet( nucleus->GetSampling() );
+  entry.use = fUsage.begin();
+  fSolutions[key] = entry;
+
+  return entry.wf;
+}
+//____________________________________________________________________________
+void ARWavefunctionCache::SetEnergyStep(double step)
+{
+  if ( step != fEnergyStep ) this->Clear();
+  fEnergyStep = step;
+}
+//____________________________________________________________________________
+void ARWavefunctionCache::SetMaxSize(unsigned int max_size)
+{
+  fMaxSize = max_size;
+}
+//____________________________________________________________________________
+void ARWavefunctionCache::Clear(void)
+{
+  std::map<Key, Entry>::iterator it;
+  for ( it = fSolutions.begin(); it != fSolutions.end(); ++it ) delete it->second.wf;
+  fSolutions.clear();
+  fUsage.clear();
+}
+//____________________________________________________________________________
+void ARWavefunctionCache::Print(std::ostream & stream) const
+{
+  double nlookups = fNHits + fNMisses;
+  stream << "\n[-] Alvarez-Ruso wavefunction cache: "
+         << fNuclei.size() << " nuclei, "
+         << fSolutions.size() << " stored solutions, "
+         << fNHits << " hits, " << fNMisses << " solved"
+         << " (hit rate: " << ( nlookups > 0 ? fNHits / nlookups : 0. ) << ")"
+         << std::endl;
+}
+//____________________________________________________________________________
+bool ARWavefunctionCache::Key::operator< (const Key & k) const
+{
+  if ( nucleus != k.nucleus ) return nucleus < k.nucleus;
+  if ( m_pi    != k.m_pi    ) return m_pi    < k.m_pi;
+  return T_pi < k.T_pi;
+}
+//____________________________________________________________________________
+
+} //namespace alvarezruso
+} //namespace genie
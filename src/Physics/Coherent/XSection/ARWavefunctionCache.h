@@ -0,0 +1,124 @@
+//____________________________________________________________________________
+/*!
+
+\class    genie::alvarezruso::ARWavefunctionCache
+
+\brief    Cache of the sampled nuclei and pion wavefunction solutions used by
+          the Alvarez-Ruso Coherent Pion Production xsec
+
+\details  Each AlvarezRusoCOHPiPXSec instance owns one cache, so algorithms
+          with different configurations never share solutions.
+
+          Sampled nuclei are only a function of (Z, A, sampling) and are
+          shared by all the differential cross section objects of the
+          algorithm.
+
+          The pion wavefunctions (and their derivatives) are only a function
+          of the nucleus, the pion mass and the pion energy. The pion kinetic
+          energy is quantized in steps of configurable size and the
+          wavefunctions are solved once per step, at its centre. A step of 0
+          disables the quantization, so that solutions are only reused for
+          identical pion energies. The number of stored solutions is limited;
+          the least recently used solution is removed when the limit is
+          reached.
+
+\author   The GENIE Collaboration
+
+\created  October 16, 2026
+
+\cpright  Copyright (c) 2003-2023, The GENIE Collaboration
+          For the full text of the license visit http://copyright.genie-mc.org
+*/
+//____________________________________________________________________________
+
+#ifndef _AR_WAVEFUNCTION_CACHE_H_
+#define _AR_WAVEFUNCTION_CACHE_H_
+
+#include <list>
+#include <map>
+#include <ostream>
+#include <vector>
+
+#include "Physics/Coherent/XSection/ARWavefunction.h"
+
+namespace genie
+{
+namespace alvarezruso
+{
+
+class ARSampledNucleus;
+
+//! Pion wavefunction and its derivatives on the sampled nucleus
+struct ARWavefunctionSet
+{
+  ARWavefunctionSet(unsigned int sampling) :
+    fUwave(sampling), fUwaveDr(sampling), fUwaveDtheta(sampling) { }
+
+  ARWavefunction fUwave;
+  ARWavefunction fUwaveDr;
+  ARWavefunction fUwaveDtheta;
+};
+
+class ARWavefunctionCache
+{
+  public:
+
+    //! The step is in GeV
+    ARWavefunctionCache(double step, unsigned int max_size);
+    ~ARWavefunctionCache();
+
+    //! Sampled nucleus, created on first use
+    ARSampledNucleus * Nucleus (unsigned int Z, unsigned int A, unsigned int sampling);
+
+    //! Pion kinetic energy at which the wavefunctions are solved for the
+    //! given kinetic energy (same units)
+    double SolvedKineticEnergy (double T_pi, double hbar) const;
+
+    //! Stored wavefunctions, or NULL if they were not solved yet
+    const ARWavefunctionSet * Find (const ARSampledNucleus * nucleus,
+                                    double m_pi, double T_pi);
+
+    //! New (empty) wavefunctions, to be filled by the caller
+    ARWavefunctionSet * Insert (const ARSampledNucleus * nucleus,
+                                double m_pi, double T_pi);
+
+    //! Configuration. The step is in GeV.
+    void SetEnergyStep (double step);
+    void SetMaxSize    (unsigned int max_size);
+
+    //! Removes the stored wavefunctions (eg after a configuration change)
+    void Clear (void);
+
+    void Print (std::ostream & stream) const;
+
+  private:
+
+    ARWavefunctionCache(const ARWavefunctionCache & cache);
+
+    struct Key {
+      const ARSampledNucleus * nucleus;
+      double m_pi;
+      double T_pi;
+      bool operator< (const Key & k) const;
+    };
+    typedef std::list<Key> KeyList;
+    struct Entry {
+      ARWavefunctionSet * wf;
+      KeyList::iterator   use;  // position in the usage list
+    };
+
+    std::map<unsigned long, ARSampledNucleus *> fNuclei;
+    std::map<Key, Entry> fSolutions;
+    KeyList fUsage;   // most recently used first
+
+    double       fEnergyStep;  // GeV
+    unsigned int fMaxSize;
+
+    unsigned long fNHits;
+    unsigned long fNMisses;
+};
+
+} //namespace alvarezruso
+} //namespace genie
+
+#endif
@@ -36,6 +36,7 @@
 #include "Physics/Coherent/XSection/AREikonalSolution.h"
 #include "Framework/Numerical/IntegrationTools.h"
 #include "Physics/Coherent/XSection/ARWavefunction.h"
+#include "Physics/Coherent/XSection/ARWavefunctionCache.h"
 
 using namespace genie::constants;
 
@@ -46,7 +47,8 @@ typedef ROOT::Math::SVector< cdouble , 4> CVector;
 namespace genie {
 namespace alvarezruso {
 
-AlvarezRusoCOHPiPDXSec::AlvarezRusoCOHPiPDXSec(unsigned int Z_, unsigned int A_, const current_t current_,
+AlvarezRusoCOHPiPDXSec::AlvarezRusoCOHPiPDXSec(ARWavefunctionCache * cache_,
+   unsigned int Z_, unsigned int A_, const current_t current_,
    const flavour_t flavour_, const nutype_t nutype_,const formfactors_t ff_)
   : debug_(false),
   fZ(Z_),
@@ -58,12 +60,12 @@ AlvarezRusoCOHPiPDXSec::AlvarezRusoCOHPiPDXSec(unsigned int Z_, unsigned int A_,
   nutype( nutype_ ),
   formfactors( ff_ ),
   fConstants ( new ARConstants() ),
-  fNucleus   ( new ARSampledNucleus(fZ, fA, fSampling) ),
+  fCache     ( cache_ ),
+  fNucleus   ( fCache->Nucleus(fZ, fA, fSampling) ),
   fWfsolution ( new AREikonalSolution(debug_, this) ),
-  fLastE_pi  (-9999999.),
-  fUwave      ( new ARWavefunction(fSampling, debug_) ),
-  fUwaveDr    ( new ARWavefunction(fSampling, debug_) ),
-  fUwaveDtheta( new ARWavefunction(fSampling, debug_) )
+  fUwave      ( NULL ),
+  fUwaveDr    ( NULL ),
+  fUwaveDtheta( NULL )
 {
   SetCurrent();
   SetFlavour();
@@ -73,10 +75,6 @@ AlvarezRusoCOHPiPDXSec::AlvarezRusoCOHPiPDXSec(unsigned int Z_, unsigned int A_,
 AlvarezRusoCOHPiPDXSec::~AlvarezRusoCOHPiPDXSec()
 {
   delete this->fWfsolution;
-  delete this->fUwave;
-  delete this->fUwaveDr;
-  delete this->fUwaveDtheta;
-  delete this->fNucleus;
   delete this->fConstants;
 }
 
@@ -120,10 +118,9 @@ double AlvarezRusoCOHPiPDXSec::DXSec( const double E_nu_, const double E_l_, con
   fF_direct_nucleon = PiDecayVertex( fP_pi, fConstants->NucleonMass());
   fF_cross_nucleon  = PiDecayVertex(-fP_pi, fConstants->NucleonMass());
 
-  // Only need to resolve wave funtions if Epi changes
-  if ( TMath::Abs(fLastE_pi-fP_pi.E()) > 1E-10 ){
-    SolveWavefunctions();
-  }
+  // Wave functions are shared with other cross section objects through
+  // the wavefunction cache, so they are looked up on every call
+  LoadWavefunctions();
 
   LorentzVector pni = fP_pi - fQ;
   pni *= 0.5;
@@ -134,8 +131,6 @@ double AlvarezRusoCOHPiPDXSec::DXSec( const double E_nu_, const double E_l_, con
 
   double dxsec = DifferentialCrossSection();
 
-  fLastE_pi = fP_pi.E();
-
   return dxsec;
 }
 
@@ -293,12 +288,29 @@ void AlvarezRusoCOHPiPDXSec::SetCurrent()
  * Solve the wavefunctions
  */
 
-/// This is only a function of the nucleus and pion momentum/energy
-/// so if neither of those have changed there is no need to re-calculate
-/// the wavefunction values.
-/// Such a caching has not been implemented here yet!
+/// This is only a function of the nucleus and pion mass and energy,
+/// so the solutions are kept in the wavefunction cache and shared by
+/// all the cross section objects of the algorithm.
+
+void AlvarezRusoCOHPiPDXSec::LoadWavefunctions()
+{
+  ARWavefunctionCache * cache = fCache;
+
+  double T_pi = cache->SolvedKineticEnergy( fP_pi.E() - fM_pi, fConstants->HBar() );
+
+  const ARWavefunctionSet * wf = cache->Find( fNucleus, fM_pi, T_pi );
+  if ( !wf ) {
+    ARWavefunctionSet * new_wf = cache->Insert( fNucleus, fM_pi, T_pi );
+    SolveWavefunctions( *new_wf, T_pi + fM_pi );
+    wf = new_wf;
+  }
+
+  fUwave       = &(wf->fUwave);
+  fUwaveDr     = &(wf->fUwaveDr);
+  fUwaveDtheta = &(wf->fUwaveDtheta);
+}
 
-void AlvarezRusoCOHPiPDXSec::SolveWavefunctions()
+void AlvarezRusoCOHPiPDXSec::SolveWavefunctions(ARWavefunctionSet & wf, double e_pion)
 {
   unsigned int n_points = fNucleus->GetNDensities();
 
@@ -326,18 +338,18 @@ void AlvarezRusoCOHPiPDXSec::SolveWavefunctions()
       cosine_rz = x2 / radius;
 
       // Calculate wavefunction
-      fUwave->set(i, j, fWfsolution->Element(radius, -cosine_rz,
-                          fP_pi.E()));
+      wf.fUwave.set(i, j, fWfsolution->Element(radius, -cosine_rz,
+                          e_pion));
       delta_r = 0.0001;
       if( radius < delta_r ) delta_r = radius;
 
       // Calculate derivative of wavefunction in the radial direction
       uwave_plus  = fWfsolution->Element( (radius+delta_r), -cosine_rz,
-                                     fP_pi.E());
+                                     e_pion);
       uwave_minus = fWfsolution->Element( (radius-delta_r), -cosine_rz,
-                                     fP_pi.E());
+                                     e_pion);
 
-      fUwaveDr->set(i, j, (uwave_plus - uwave_minus) / (2.0 * delta_r) );
+      wf.fUwaveDr.set(i, j, (uwave_plus - uwave_minus) / (2.0 * delta_r) );
 
       // Calculate derivative of wavefunction in the angle space
       delta_c = 0.0001;
@@ -345,10 +357,10 @@ void AlvarezRusoCOHPiPDXSec::SolveWavefunctions()
       else if( (cosine_rz + delta_c) >=  1.0 )  delta_c = 1.0 - cosine_rz - 1E-12;
 
       uwave_plus  = fWfsolution->Element(radius, -(cosine_rz+delta_c),
-                                        fP_pi.E());
+                                        e_pion);
       uwave_minus = fWfsolution->Element(radius, -(cosine_rz-delta_c),
-                                        fP_pi.E());
-      fUwaveDtheta->set( i, j, (uwave_plus - uwave_minus) / (2.0 * delta_c) );
+                                        e_pion);
+      wf.fUwaveDtheta.set( i, j, (uwave_plus - uwave_minus) / (2.0 * delta_c) );
 
     }
   }
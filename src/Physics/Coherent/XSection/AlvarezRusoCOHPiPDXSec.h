@@ -37,6 +37,8 @@ namespace alvarezruso
 {
 
 class ARWFSolution;
+struct ARWavefunctionSet;
+class  ARWavefunctionCache;
 
 enum current_t{kCC, kNC};
 enum flavour_t{kE, kMu, kTau};
@@ -47,7 +49,8 @@ class AlvarezRusoCOHPiPDXSec
 {
   public:
 
-    AlvarezRusoCOHPiPDXSec(unsigned int Z_, unsigned int A_, const current_t current_,
+    AlvarezRusoCOHPiPDXSec(ARWavefunctionCache * cache_,
+          unsigned int Z_, unsigned int A_, const current_t current_,
           const flavour_t flavour_ = kE, const nutype_t nutype = kNu,
           const formfactors_t ff_ = kNieves);
     ~AlvarezRusoCOHPiPDXSec();
@@ -99,8 +102,10 @@ class AlvarezRusoCOHPiPDXSec
 
         void NuclearCurrent(ROOT::Math::LorentzVector<ROOT::Math::PxPyPzE4D<double> > q, ROOT::Math::LorentzVector<ROOT::Math::PxPyPzE4D<double> > pdir, ROOT::Math::LorentzVector<ROOT::Math::PxPyPzE4D<double> > pcrs, ROOT::Math::LorentzVector<ROOT::Math::PxPyPzE4D<double> > ppi, std::complex<double>  *jPtr);
 
-        // Fill the wavefunctions
-        void SolveWavefunctions();
+        // Fill the wavefunctions for the current pion energy, from the
+        // wavefunction cache when available
+        void LoadWavefunctions();
+        void SolveWavefunctions(ARWavefunctionSet & wf, double e_pion);
 
         //______________________________________________________________
         // Properties
@@ -120,7 +125,10 @@ class AlvarezRusoCOHPiPDXSec
         formfactors_t formfactors;
         // Constants
         ARConstants * fConstants;
-        // Nuclear values
+        // Wavefunction solutions, shared with the other cross section
+        // objects of the algorithm
+        ARWavefunctionCache * fCache;
+        // Nuclear values (owned by the wavefunction cache)
         ARSampledNucleus * fNucleus;
         // Wavefunction calculator
         ARWFSolution* fWfsolution;
@@ -132,8 +140,6 @@ class AlvarezRusoCOHPiPDXSec
         double fTheta_pi; // pion angle
         double fPhi;      // angle between lepton and pion
 
-        double fLastE_pi;
-
         // Four-momenta of particles and transfers involved
         ROOT::Math::LorentzVector<ROOT::Math::PxPyPzE4D<double> > fQ;    // momentum-transfer
         ROOT::Math::LorentzVector<ROOT::Math::PxPyPzE4D<double> > fP_nu;    // incoming neutrino
@@ -156,10 +162,10 @@ class AlvarezRusoCOHPiPDXSec
         double fF_cross_delta;
         double fF_cross_nucleon;
 
-        // Wavefunction
-        ARWavefunction* fUwave;
-        ARWavefunction* fUwaveDr;
-        ARWavefunction* fUwaveDtheta;
+        // Wavefunction (owned by the wavefunction cache)
+        const ARWavefunction* fUwave;
+        const ARWavefunction* fUwaveDr;
+        const ARWavefunction* fUwaveDtheta;
 
         std::complex<double>  fJ_hadronic[4];
 };
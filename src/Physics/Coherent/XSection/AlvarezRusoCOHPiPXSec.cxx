@@ -29,6 +29,7 @@
 #include "Physics/Coherent/XSection/ARSampledNucleus.h"
 #include "Physics/Coherent/XSection/AlvarezRusoCOHPiPDXSec.h"
 #include "Physics/Coherent/XSection/AREikonalSolution.h"
+#include "Physics/Coherent/XSection/ARWavefunctionCache.h"
 
 
 using namespace genie;
@@ -39,22 +40,23 @@ using namespace alvarezruso;
 
 //____________________________________________________________________________
 AlvarezRusoCOHPiPXSec::AlvarezRusoCOHPiPXSec() :
-XSecAlgorithmI("genie::AlvarezRusoCOHPiPXSec")
+XSecAlgorithmI("genie::AlvarezRusoCOHPiPXSec"),
+fWavefunctionCache(0)
 {
-  fMultidiff = NULL;
-  fLastInteraction = NULL;
+
 }
 //____________________________________________________________________________
 AlvarezRusoCOHPiPXSec::AlvarezRusoCOHPiPXSec(string config) :
-XSecAlgorithmI("genie::AlvarezRusoCOHPiPXSec", config)
+XSecAlgorithmI("genie::AlvarezRusoCOHPiPXSec", config),
+fWavefunctionCache(0)
 {
-  fMultidiff = NULL;
-  fLastInteraction = NULL;
+
 }
 //____________________________________________________________________________
 AlvarezRusoCOHPiPXSec::~AlvarezRusoCOHPiPXSec()
 {
-  if (fMultidiff) delete fMultidiff;
+  this->ClearMultidiffs();
+  delete fWavefunctionCache;
 }
 //____________________________________________________________________________
 double AlvarezRusoCOHPiPXSec::XSec(
@@ -74,51 +76,51 @@ double AlvarezRusoCOHPiPXSec::XSec(
   const TLorentzVector p4_pi  = kinematics.HadSystP4();
   double E_lep = p4_lep.E();
 
-  if (fLastInteraction!=interaction) {
-    if (fMultidiff != NULL) {
-      delete fMultidiff;
-      fMultidiff = NULL;
-    }
-
-    current_t current;
-    if ( interaction->ProcInfo().IsWeakCC() ) {
-      current = kCC;
-    }
-    else if ( interaction->ProcInfo().IsWeakNC() ) {
-      current = kNC;
-    }
-    else {
-      LOG("AlvarezRusoCohPi",pDEBUG)<<"Unknown current for AlvarezRuso implementation";
-      return 0.;
-    }
-
-    flavour_t flavour;
-    if ( init_state.ProbePdg() == 12 || init_state.ProbePdg() == -12) {
-      flavour=kE;
-    }
-    else if ( init_state.ProbePdg() == 14 || init_state.ProbePdg() == -14) {
-      flavour=kMu;
-    }
-    else if ( init_state.ProbePdg() == 16 || init_state.ProbePdg() == -16) {
-      flavour=kTau;
-    }
-    else {
-      LOG("AlvarezRusoCohPi",pDEBUG)<<"Unknown probe for AlvarezRuso implementation";
-      return 0.;
-    }
-
-    nutype_t nutype;
-    if ( init_state.ProbePdg() > 0) {
-      nutype = kNu;
-    } else {
-      nutype = kAntiNu;
-    }
-
-    fMultidiff = new AlvarezRusoCOHPiPDXSec(Z, A ,current, flavour, nutype);
-    fLastInteraction = interaction;
+  current_t current;
+  if ( interaction->ProcInfo().IsWeakCC() ) {
+    current = kCC;
+  }
+  else if ( interaction->ProcInfo().IsWeakNC() ) {
+    current = kNC;
+  }
+  else {
+    LOG("AlvarezRusoCohPi",pDEBUG)<<"Unknown current for AlvarezRuso implementation";
+    return 0.;
+  }
+
+  flavour_t flavour;
+  if ( init_state.ProbePdg() == 12 || init_state.ProbePdg() == -12) {
+    flavour=kE;
+  }
+  else if ( init_state.ProbePdg() == 14 || init_state.ProbePdg() == -14) {
+    flavour=kMu;
+  }
+  else if ( init_state.ProbePdg() == 16 || init_state.ProbePdg() == -16) {
+    flavour=kTau;
+  }
+  else {
+    LOG("AlvarezRusoCohPi",pDEBUG)<<"Unknown probe for AlvarezRuso implementation";
+    return 0.;
   }
 
-  double xsec = fMultidiff->DXSec(E_nu, E_lep, p4_lep.Theta(), p4_lep.Phi(), p4_pi.Theta(), p4_pi.Phi());
+  nutype_t nutype;
+  if ( init_state.ProbePdg() > 0) {
+    nutype = kNu;
+  } else {
+    nutype = kAntiNu;
+  }
+
+  // Differential cross section objects are reused across interactions. The
+  // sampled nuclei and pion wavefunctions they use are shared through the
+  // wavefunction cache of this algorithm.
+  long key = ((( (long)Z * 1000 + A ) * 10 + current ) * 10 + flavour ) * 10 + nutype;
+  std::map<long, AlvarezRusoCOHPiPDXSec *>::iterator it = fMultidiffs.find(key);
+  if ( it == fMultidiffs.end() ) {
+    it = fMultidiffs.insert( std::make_pair(key, new AlvarezRusoCOHPiPDXSec(fWavefunctionCache, Z, A ,current, flavour, nutype)) ).first;
+  }
+  AlvarezRusoCOHPiPDXSec * multidiff = it->second;
+
+  double xsec = multidiff->DXSec(E_nu, E_lep, p4_lep.Theta(), p4_lep.Phi(), p4_pi.Theta(), p4_pi.Phi());
   xsec = xsec * 1E-38 * units::cm2;
 
   if (kps != kPSElOlOpifE) {
@@ -180,6 +182,20 @@ void AlvarezRusoCOHPiPXSec::LoadConfig(void)
   ffStar   = fConfig->GetDoubleDef("fStar",         gc->GetDouble("COHAR-fStar"));*/
 
 
+  //-- differential cross sections and wavefunctions depend on the
+  //   configuration: drop those computed so far
+  this->ClearMultidiffs();
+  delete fWavefunctionCache;
+
+  //-- pion wavefunction solutions
+  int cache_size = 500;
+  GetParamDef( "WavefunctionEStep",     fWavefunctionEStep, 0.0001 );
+  GetParamDef( "WavefunctionCacheSize", cache_size,         500    );
+  fWavefunctionCacheSize = (unsigned int) TMath::Max(0, cache_size);
+
+  fWavefunctionCache =
+      new ARWavefunctionCache( fWavefunctionEStep, fWavefunctionCacheSize );
+
   //-- load the differential cross section integrator
   fXSecIntegrator =
       dynamic_cast<const XSecIntegratorI *> (this->SubAlg("XSec-Integrator"));
@@ -187,3 +203,10 @@ void AlvarezRusoCOHPiPXSec::LoadConfig(void)
 
 }
 //____________________________________________________________________________
+void AlvarezRusoCOHPiPXSec::ClearMultidiffs(void)
+{
+  std::map<long, AlvarezRusoCOHPiPDXSec *>::iterator it;
+  for (it = fMultidiffs.begin(); it != fMultidiffs.end(); ++it) delete it->second;
+  fMultidiffs.clear();
+}
+//____________________________________________________________________________
@@ -22,6 +22,8 @@
 #ifndef _ALVAREZ_RUSO_COH_XSEC_H_
 #define _ALVAREZ_RUSO_COH_XSEC_H_
 
+#include <map>
+
 #include "Framework/EventGen/XSecAlgorithmI.h"
 #include "Physics/Coherent/XSection/AlvarezRusoCOHPiPDXSec.h"
 
@@ -49,13 +51,22 @@ public:
 
 private:
   void LoadConfig(void);
+  void ClearMultidiffs(void);
 
   //-- private data members loaded from config Registry or set to defaults
 
   const XSecIntegratorI * fXSecIntegrator;
 
-  mutable alvarezruso::AlvarezRusoCOHPiPDXSec * fMultidiff;
-  mutable const Interaction * fLastInteraction;
+  //-- differential cross section objects, one per (Z, A, current, flavour,
+  //   nu/nubar), kept for the lifetime of the algorithm
+  mutable std::map<long, alvarezruso::AlvarezRusoCOHPiPDXSec *> fMultidiffs;
+
+  //-- sampled nuclei and pion wavefunctions shared by the differential
+  //   cross section objects, owned by this algorithm
+  alvarezruso::ARWavefunctionCache * fWavefunctionCache;
+
+  double       fWavefunctionEStep;      ///< pion kinetic energy step for wavefunction solutions (GeV)
+  unsigned int fWavefunctionCacheSize;  ///< max number of stored wavefunction solutions
   //Parameters
   //bool fUseLookupTable;
   //double fa4;
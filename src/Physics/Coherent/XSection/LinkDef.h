@@ -10,6 +10,7 @@
 #pragma link C++ class genie::alvarezruso::AlvarezRusoCOHPiPDXSec;
 #pragma link C++ class genie::alvarezruso::ARConstants;
 #pragma link C++ class genie::alvarezruso::ARSampledNucleus;
+#pragma link C++ class genie::alvarezruso::ARWavefunctionCache;
 #pragma link C++ class genie::AlvarezRusoCOHPiPXSec;
 
 #pragma link C++ class genie::BergerSehgalCOHPiPXSec2015;
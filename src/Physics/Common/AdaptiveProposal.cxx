@@ -0,0 +1,395 @@
+//____________________________________________________________________________
+/*
+ Copyright (c) 2003-2023, The GENIE Collaboration
+ For the full text of the license visit http://copyright.genie-mc.org
+
+ The GENIE Collaboration
+*/
+//____________________________________________________________________________
+
+#include <algorithm>
+
+#include "Framework/Messenger/Messenger.h"
+#include "Physics/Common/AdaptiveProposal.h"
+
+using namespace genie;
+
+ClassImp(AdaptiveProposal);
+
+//___________________________________________________________________________
+AdaptiveProposal::AdaptiveProposal() :
+CacheBranchI(),
+fNDim(0),
+fNLattice(0),
+fTotal(0.),
+fIntegral(0.),
+fSafetyFactor(1.),
+fNViolations(0)
+{
+
+}
+//___________________________________________________________________________
+AdaptiveProposal::AdaptiveProposal(int ndim) :
+CacheBranchI(),
+fNDim(ndim),
+fNLattice( (ndim <= 2) ? 5 : 3 ),
+fTotal(0.),
+fIntegral(0.),
+fSafetyFactor(1.),
+fNViolations(0)
+{
+
+}
+//___________________________________________________________________________
+AdaptiveProposal::~AdaptiveProposal()
+{
+
+}
+//___________________________________________________________________________
+void AdaptiveProposal::Build(const Function & f, int n_init, int max_cells,
+     double tolerance, double safety_factor)
+{
+  fLo.clear();
+  fHi.clear();
+  fMax.clear();
+  fMean.clear();
+  fEnv.clear();
+  fValues.clear();
+  fSafetyFactor = safety_factor;
+  fNViolations  = 0;
+
+  if(fNDim <= 0) return;
+
+  n_init = std::max(1, n_init);
+
+  // Regular initial grid
+  int n_grid = 1;
+  for(int d = 0; d < fNDim; d++) n_grid *= n_init;
+
+  std::vector<double> lo(fNDim), hi(fNDim);
+  for(int ic = 0; ic < n_grid; ic++) {
+    int index = ic;
+    for(int d = 0; d < fNDim; d++) {
+      int i = index % n_init;
+      index /= n_init;
+      lo[d] = double(i)   / n_init;
+      hi[d] = double(i+1) / n_init;
+    }
+    this->AddCell(f, &lo[0], &hi[0]);
+  }
+
+  // Refine: split the cell wasting the largest envelope volume in two
+  // until the envelope is tight enough or the cell budget is exhausted
+  while( this->NCells() < max_cells ) {
+
+    double waste  = 0.;
+    double volume = 0.;
+    double max_waste = -1.;
+    int    imax = -1;
+    for(int ic = 0; ic < this->NCells(); ic++) {
+      double vol = this->Volume(ic);
+      double cell_waste = (fMax[ic] - fMean[ic]) * vol;
+      waste  += cell_waste;
+      volume += fMax[ic] * vol;
+      if(cell_waste > max_waste) {
+        max_waste = cell_waste;
+        imax = ic;
+      }
+    }
+    if(volume <= 0. || waste < tolerance * volume || imax < 0) break;
+
+    int axis = this->SplitAxis(f, imax);
+
+    std::copy(fLo.begin() + imax*fNDim, fLo.begin() + (imax+1)*fNDim, lo.begin());
+    std::copy(fHi.begin() + imax*fNDim, fHi.begin() + (imax+1)*fNDim, hi.begin());
+    double mid = 0.5 * (lo[axis] + hi[axis]);
+
+    // lower half replaces the parent, upper half is appended
+    fHi[imax*fNDim + axis] = mid;
+    this->Evaluate(f, imax);
+
+    lo[axis] = mid;
+    this->AddCell(f, &lo[0], &hi[0]);
+  }
+
+  // Estimated integral of f, used to report the expected efficiency.
+  // The lattice maxima underestimate the cell maxima: search for the
+  // maximum of each non-empty cell before setting its envelope.
+  fIntegral = 0.;
+  for(int ic = 0; ic < this->NCells(); ic++) {
+    fIntegral += fMean[ic] * this->Volume(ic);
+    if(fMax[ic] > 0.) this->SearchMax(f, ic);
+    fEnv[ic] = fSafetyFactor * fMax[ic];
+  }
+
+  this->FillEmpty();
+  this->Normalize();
+
+  fValues.clear();
+
+  LOG("AdaptiveProposal", pINFO)
+    << "Trained " << fNDim << "-d proposal with " << this->NCells()
+    << " cells - expected acceptance: " << this->Efficiency();
+}
+//___________________________________________________________________________
+double AdaptiveProposal::Sample(const double * r, double * u, int & cell) const
+{
+  if(fTotal <= 0.) {
+    for(int d = 0; d < fNDim; d++) u[d] = r[d+1];
+    cell = -1;
+    return 0.;
+  }
+
+  std::vector<double>::const_iterator it = std::upper_bound(
+    fCumulative.begin(), fCumulative.end(), r[0] * fTotal);
+  cell = std::min( int(it - fCumulative.begin()), this->NCells() - 1 );
+
+  const double * lo = &fLo[cell*fNDim];
+  const double * hi = &fHi[cell*fNDim];
+  for(int d = 0; d < fNDim; d++) u[d] = lo[d] + r[d+1] * (hi[d] - lo[d]);
+
+  return fEnv[cell];
+}
+//___________________________________________________________________________
+void AdaptiveProposal::Violation(int cell, double f)
+{
+  if(cell < 0 || cell >= this->NCells()) return;
+
+  fNViolations++;
+
+  fMax[cell] = std::max(fMax[cell], f);
+  fEnv[cell] = std::max(fEnv[cell], fSafetyFactor * f);
+
+  this->Normalize();
+}
+//___________________________________________________________________________
+double AdaptiveProposal::Efficiency(void) const
+{
+  if(fTotal <= 0.) return 0.;
+  return fIntegral / fTotal;
+}
+//___________________________________________________________________________
+size_t AdaptiveProposal::MemorySize(void) const
+{
+  size_t n = fLo.capacity() + fHi.capacity() + fMax.capacity() +
+             fMean.capacity() + fEnv.capacity() + fCumulative.capacity();
+  size_t size = sizeof(*this) + n * sizeof(double);
+  // lattice points kept while training: key vector, value and map node
+  size += fValues.size() * ((fNDim + 1) * sizeof(double) + 64);
+  return size;
+}
+//___________________________________________________________________________
+void AdaptiveProposal::AddCell(
+     const Function & f, const double * lo, const double * hi)
+{
+  fLo.insert(fLo.end(), lo, lo + fNDim);
+  fHi.insert(fHi.end(), hi, hi + fNDim);
+  fMax.push_back(0.);
+  fMean.push_back(0.);
+  fEnv.push_back(0.);
+  this->Evaluate(f, this->NCells() - 1);
+}
+//___________________________________________________________________________
+void AdaptiveProposal::Evaluate(const Function & f, int cell)
+{
+  const double * lo = &fLo[cell*fNDim];
+  const double * hi = &fHi[cell*fNDim];
+
+  int npoints = 1;
+  for(int d = 0; d < fNDim; d++) npoints *= fNLattice;
+
+  double sum  = 0.;
+  double fmax = 0.;
+  std::vector<double> u(fNDim);
+  for(int ip = 0; ip < npoints; ip++) {
+    int index = ip;
+    for(int d = 0; d < fNDim; d++) {
+      int i = index % fNLattice;
+      index /= fNLattice;
+      u[d] = lo[d] + (hi[d] - lo[d]) * i / (fNLattice - 1);
+    }
+    double value = this->Eval(f, u);
+    fmax = std::max(fmax, value);
+    sum += value;
+  }
+
+  fMax [cell] = fmax;
+  fMean[cell] = sum / npoints;
+  fEnv [cell] = fSafetyFactor * fmax;
+}
+//___________________________________________________________________________
+double AdaptiveProposal::Eval(const Function & f, const std::vector<double> & u)
+{
+  // Lattice points are shared between neighbouring cells, and cell
+  // boundaries are dyadic fractions, so lookups by value are exact
+  std::map< std::vector<double>, double >::const_iterator it = fValues.find(u);
+  if(it != fValues.end()) return it->second;
+
+  double value = std::max(0., f(&u[0]));
+  fValues[u] = value;
+  return value;
+}
+//___________________________________________________________________________
+int AdaptiveProposal::SplitAxis(const Function & f, int cell)
+{
+  // Choose the axis for which the envelope volume of the two halves
+  // (estimated from the lattice points already evaluated) is smallest
+  const double * lo = &fLo[cell*fNDim];
+  const double * hi = &fHi[cell*fNDim];
+
+  int npoints = 1;
+  for(int d = 0; d < fNDim; d++) npoints *= fNLattice;
+
+  int mid = (fNLattice - 1) / 2;
+
+  std::vector<double> max_lo(fNDim, 0.), max_hi(fNDim, 0.);
+  std::vector<double> u(fNDim);
+  std::vector<int> idx(fNDim);
+  for(int ip = 0; ip < npoints; ip++) {
+    int index = ip;
+    for(int d = 0; d < fNDim; d++) {
+      idx[d] = index % fNLattice;
+      index /= fNLattice;
+      u[d] = lo[d] + (hi[d] - lo[d]) * idx[d] / (fNLattice - 1);
+    }
+    double value = this->Eval(f, u);
+    for(int d = 0; d < fNDim; d++) {
+      if(idx[d] <= mid) max_lo[d] = std::max(max_lo[d], value);
+      if(idx[d] >= mid) max_hi[d] = std::max(max_hi[d], value);
+    }
+  }
+
+  int axis = 0;
+  double best = -1.;
+  for(int d = 0; d < fNDim; d++) {
+    double gain = 2. * fMax[cell] - max_lo[d] - max_hi[d];
+    if(gain > best) {
+      best = gain;
+      axis = d;
+    }
+  }
+  return axis;
+}
+//___________________________________________________________________________
+void AdaptiveProposal::SearchMax(const Function & f, int cell)
+{
+  // Compass search for the maximum of f in the cell, starting from the
+  // largest lattice point, with steps from half the lattice spacing down to
+  // 1/32 of it. The search stays within the cell.
+  const double * lo = &fLo[cell*fNDim];
+  const double * hi = &fHi[cell*fNDim];
+
+  int npoints = 1;
+  for(int d = 0; d < fNDim; d++) npoints *= fNLattice;
+
+  std::vector<double> u(fNDim), best(fNDim);
+  double fbest = -1.;
+  for(int ip = 0; ip < npoints; ip++) {
+    int index = ip;
+    for(int d = 0; d < fNDim; d++) {
+      int i = index % fNLattice;
+      index /= fNLattice;
+      u[d] = lo[d] + (hi[d] - lo[d]) * i / (fNLattice - 1);
+    }
+    double value = this->Eval(f, u);
+    if(value > fbest) {
+      fbest = value;
+      best  = u;
+    }
+  }
+
+  const int kNSteps = 5;
+  const int kMaxMoves = 10;
+
+  double step = 0.5 / (fNLattice - 1);
+  for(int is = 0; is < kNSteps; is++, step *= 0.5) {
+    for(int im = 0; im < kMaxMoves; im++) {
+      bool moved = false;
+      for(int d = 0; d < fNDim; d++) {
+        for(int sign = -1; sign <= 1; sign += 2) {
+          u = best;
+          u[d] += sign * step * (hi[d] - lo[d]);
+          if(u[d] < lo[d] || u[d] > hi[d]) continue;
+          double value = std::max(0., f(&u[0]));
+          if(value > fbest) {
+            fbest = value;
+            best  = u;
+            moved = true;
+          }
+        }
+      }
+      if(!moved) break;
+    }
+  }
+
+  fMax[cell] = std::max(fMax[cell], fbest);
+}
+//___________________________________________________________________________
+double AdaptiveProposal::Volume(int cell) const
+{
+  double vol = 1.;
+  for(int d = 0; d < fNDim; d++) {
+    vol *= fHi[cell*fNDim + d] - fLo[cell*fNDim + d];
+  }
+  return vol;
+}
+//___________________________________________________________________________
+bool AdaptiveProposal::Touch(int cell1, int cell2) const
+{
+  for(int d = 0; d < fNDim; d++) {
+    if(fLo[cell1*fNDim + d] > fHi[cell2*fNDim + d]) return false;
+    if(fLo[cell2*fNDim + d] > fHi[cell1*fNDim + d]) return false;
+  }
+  return true;
+}
+//___________________________________________________________________________
+void AdaptiveProposal::FillEmpty(void)
+{
+  // The function may be non-zero inside a cell with no non-zero lattice
+  // point, near the edge of the kinematically allowed region. Give empty
+  // cells the largest envelope of their neighbours, repeating until cells
+  // without a non-empty neighbour are reached as well.
+  std::vector<bool> filled(this->NCells());
+  for(int ic = 0; ic < this->NCells(); ic++) filled[ic] = fMax[ic] > 0.;
+
+  bool changed = true;
+  while(changed) {
+    changed = false;
+    std::vector<double> fill(this->NCells(), 0.);
+    for(int ic = 0; ic < this->NCells(); ic++) {
+      if(filled[ic]) continue;
+      for(int jc = 0; jc < this->NCells(); jc++) {
+        if(!filled[jc]) continue;
+        if(this->Touch(ic, jc)) fill[ic] = std::max(fill[ic], fEnv[jc]);
+      }
+    }
+    for(int ic = 0; ic < this->NCells(); ic++) {
+      if(filled[ic] || fill[ic] <= 0.) continue;
+      fEnv[ic]    = fill[ic];
+      filled[ic]  = true;
+      changed     = true;
+    }
+  }
+
+  // Finally give every cell a small positive floor, so that no part of the
+  // phase space has zero proposal density
+  const double kFloor = 1E-3;
+  double env_max = 0.;
+  for(int ic = 0; ic < this->NCells(); ic++) {
+    env_max = std::max(env_max, fEnv[ic]);
+  }
+  for(int ic = 0; ic < this->NCells(); ic++) {
+    fEnv[ic] = std::max(fEnv[ic], kFloor * env_max);
+  }
+}
+//___________________________________________________________________________
+void AdaptiveProposal::Normalize(void)
+{
+  fCumulative.resize(fEnv.size());
+  fTotal = 0.;
+  for(int ic = 0; ic < this->NCells(); ic++) {
+    fTotal += fEnv[ic] * this->Volume(ic);
+    fCumulative[ic] = fTotal;
+  }
+}
+//___________________________________________________________________________
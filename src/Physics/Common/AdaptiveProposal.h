@@ -0,0 +1,131 @@
+//____________________________________________________________________________
+/*!
+
+\class    genie::AdaptiveProposal
+
+\brief    Cell-based (Foam/VEGAS-like) envelope of a differential cross
+          section, used as the proposal density of the rejection method by
+          the kinematics generators deriving from KineGeneratorWithCache and
+          by the MECGenerator lepton kinematics.
+
+\details  The envelope is defined on the unit hypercube of dimension NDim,
+          which the generators map onto their (energy dependent) phase space.
+          The hypercube is first divided into a regular grid of cells. The
+          cell wasting the largest envelope volume is then repeatedly split
+          in two, along the axis which gives the largest reduction of the
+          envelope volume, until the requested number of cells is reached or
+          the envelope exceeds the estimated integral of the function by less
+          than the requested tolerance. The function is evaluated on a regular
+          lattice of points in each cell (edges included). Once the cells are
+          final, the maximum of each cell is searched for, starting from its
+          largest lattice point, and the cell envelope is set to that maximum
+          times a safety factor. Empty cells inherit the largest envelope of
+          their neighbours, spreading out from the non-empty cells, and every
+          cell envelope is at least 1E-3 of the largest one.
+
+          Sampling picks a cell with probability proportional to its envelope
+          volume and a point uniformly inside it. Accepting the point with
+          probability f / envelope gives points distributed exactly as f, as
+          long as the envelope bounds f. Points where f exceeds the envelope
+          are violations: the points accepted before were drawn from a wrong
+          density, so callers should report them. Violation() raises the
+          envelope of the cell for the following points.
+
+          Trained proposals are stored as Cache branches, so they are trained
+          once per job (or once, if a cache file is used).
+
+\author   The GENIE Collaboration
+
+\created  October 16, 2026
+
+\cpright  Copyright (c) 2003-2023, The GENIE Collaboration
+          For the full text of the license visit http://copyright.genie-mc.org
+*/
+//____________________________________________________________________________
+
+#ifndef _ADAPTIVE_PROPOSAL_H_
+#define _ADAPTIVE_PROPOSAL_H_
+
+#include <map>
+#include <vector>
+
+#include "Framework/Utils/CacheBranchI.h"
+
+namespace genie {
+
+class AdaptiveProposal : public CacheBranchI
+{
+public:
+
+  /// Function bounded by the proposal, evaluated on the unit hypercube
+  class Function {
+  public:
+    virtual ~Function() {}
+    virtual double operator() (const double * u) const = 0;
+  };
+
+  AdaptiveProposal();
+  AdaptiveProposal(int ndim);
+ ~AdaptiveProposal();
+
+  /// Trains the proposal on f
+  /// \param[in] f Function to bound (negative values are treated as 0)
+  /// \param[in] n_init Number of initial cells along each axis
+  /// \param[in] max_cells Maximum number of cells after refinement
+  /// \param[in] tolerance Refinement stops once the envelope volume exceeds
+  /// the estimated integral of f by less than this fraction
+  /// \param[in] safety_factor Factor applied to the sampled cell maxima
+  void   Build     (const Function & f, int n_init, int max_cells,
+                    double tolerance, double safety_factor);
+
+  /// Selects a point using NDim+1 uniform random numbers r. The point is
+  /// written in u. Returns the envelope value at the point and the index of
+  /// the cell containing it.
+  double Sample    (const double * r, double * u, int & cell) const;
+
+  /// Raises the envelope of a cell after f was found to exceed it
+  void   Violation (int cell, double f);
+
+  bool   IsValid     (void) const { return fTotal > 0.; }
+  int    NDim        (void) const { return fNDim;       }
+  int    NCells      (void) const { return fEnv.size(); }
+  int    NViolations (void) const { return fNViolations; }
+
+  /// Expected acceptance of the rejection method (estimated integral of f
+  /// over the envelope volume)
+  double Efficiency  (void) const;
+
+  size_t MemorySize  (void) const;
+
+private:
+
+  void   AddCell     (const Function & f, const double * lo, const double * hi);
+  void   Evaluate    (const Function & f, int cell);
+  double Eval        (const Function & f, const std::vector<double> & u);
+  int    SplitAxis   (const Function & f, int cell);
+  void   SearchMax   (const Function & f, int cell);
+  double Volume      (int cell) const;
+  bool   Touch       (int cell1, int cell2) const;
+  void   FillEmpty   (void);
+  void   Normalize   (void);
+
+  int                 fNDim;
+  int                 fNLattice;     ///< lattice points per axis in each cell
+  std::vector<double> fLo;           ///< lower cell edges (NDim per cell)
+  std::vector<double> fHi;           ///< upper cell edges (NDim per cell)
+  std::vector<double> fMax;          ///< largest sampled value of f per cell
+  std::vector<double> fMean;         ///< mean sampled value of f per cell
+  std::vector<double> fEnv;          ///< envelope value per cell
+  std::vector<double> fCumulative;   ///< cumulative envelope volume
+  double              fTotal;        ///< total envelope volume
+  double              fIntegral;     ///< estimated integral of f
+  double              fSafetyFactor;
+  int                 fNViolations;
+
+  std::map< std::vector<double>, double > fValues; //! f values at the lattice points (only used while training)
+
+ClassDef(AdaptiveProposal,1)
+};
+
+}      // genie namespace
+#endif // _ADAPTIVE_PROPOSAL_H_
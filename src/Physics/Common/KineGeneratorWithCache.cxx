@@ -11,12 +11,15 @@
 #include <sstream>
 #include <cstdlib>
 #include <map>
+#include <vector>
 
 //#include <TSQLResult.h>
 //#include <TSQLRow.h>
 #include <TMath.h>
+#include <TLorentzVector.h>
 
 #include "Framework/EventGen/EVGThreadException.h"
+#include "Framework/EventGen/RejectionLoopStats.h"
 #include "Physics/Common/KineGeneratorWithCache.h"
 #include "Framework/GHEP/GHepRecord.h"
 #include "Framework/GHEP/GHepFlags.h"
@@ -24,6 +27,7 @@
 #include "Framework/Utils/Cache.h"
 #include "Framework/Utils/CacheBranchFx.h"
 #include "Framework/Numerical/MathUtils.h"
+#include "Framework/Numerical/RandomGen.h"
 
 using std::ostringstream;
 using std::map;
@@ -32,19 +36,22 @@ using namespace genie;
 
 //___________________________________________________________________________
 KineGeneratorWithCache::KineGeneratorWithCache() : 
-EventRecordVisitorI(), fSafetyFactor(1.), fNumOfSafetyFactors(-1), fNumOfInterpolatorTypes(-1)
+EventRecordVisitorI(), fSafetyFactor(1.), fNumOfSafetyFactors(-1), fNumOfInterpolatorTypes(-1),
+fGenerateUniformly(false), fUseProposal(false)
 {
 
 }
 //___________________________________________________________________________
 KineGeneratorWithCache::KineGeneratorWithCache(string name) : 
-EventRecordVisitorI(name), fSafetyFactor(1.), fNumOfSafetyFactors(-1), fNumOfInterpolatorTypes(-1)
+EventRecordVisitorI(name), fSafetyFactor(1.), fNumOfSafetyFactors(-1), fNumOfInterpolatorTypes(-1),
+fGenerateUniformly(false), fUseProposal(false)
 {
 
 }
 //___________________________________________________________________________
 KineGeneratorWithCache::KineGeneratorWithCache(string name, string config) : 
-EventRecordVisitorI(name, config), fSafetyFactor(1.), fNumOfSafetyFactors(-1), fNumOfInterpolatorTypes(-1)
+EventRecordVisitorI(name, config), fSafetyFactor(1.), fNumOfSafetyFactors(-1), fNumOfInterpolatorTypes(-1),
+fGenerateUniformly(false), fUseProposal(false)
 {
 
 }
@@ -138,10 +145,9 @@ double KineGeneratorWithCache::FindMaxXSec(
   // if there are not enough points at the cache buffer to have a spline,
   // look whether there is another point that is sufficiently close
   double dE = TMath::Min(0.25, 0.05*E);
-  const map<double,double> & fmap = cb->Map();
-  map<double,double>::const_iterator iter = fmap.lower_bound(E);
-  if(iter != fmap.end()) {
-     if(TMath::Abs(E - iter->first) < dE) return iter->second;
+  unsigned int i = cb->LowerBound(E);
+  if(i < cb->NPoints()) {
+     if(TMath::Abs(E - cb->X()[i]) < dE) return cb->Y()[i];
   }
 
   return -1;
@@ -199,7 +205,7 @@ void KineGeneratorWithCache::CacheMaxXSec(
   if(max_xsec>0) cb->AddValues(E,max_xsec);
 
   if(! cb->Spl() ) {
-    if( cb->Map().size() > 40 ) 
+    if( cb->NPoints() > 40 ) 
       cb->CreateSpline(nkey<=fNumOfInterpolatorTypes-1?vInterpolatorTypes[nkey]:"");
   }
 
@@ -256,6 +262,7 @@ void KineGeneratorWithCache::AssertXSecLimits(
   // maximum cross section used in the rejection MC method for the current
   // interaction at the current energy.
   if(xsec>xsec_max) {
+    RejectionLoopStats::Instance()->Violation();
     double f = 200*(xsec-xsec_max)/(xsec_max+xsec);
     if(f>fMaxXSecDiffTolerance) {
        LOG("Kinematics", pFATAL)
@@ -292,3 +299,179 @@ double KineGeneratorWithCache::ComputeMaxXSec (const Interaction * in, const int
   }
 }
 //___________________________________________________________________________
+void KineGeneratorWithCache::CountTrial(bool accepted) const
+{
+  RejectionLoopStats::Instance()->Trial(accepted);
+}
+//___________________________________________________________________________
+void KineGeneratorWithCache::LoadProposalConfig(void)
+{
+// Reads the adaptive proposal configuration. Generators implementing
+// ProposalDim() and ProposalXSec() should call it from their LoadConfig().
+
+  GetParamDef( "AdaptiveProposal-Enable", fUseProposal, false ) ;
+  GetParamDef( "AdaptiveProposal-EnergyBinsPerDecade", fProposalBinsPerDecade, 20 ) ;
+  GetParamDef( "AdaptiveProposal-InitialCells", fProposalInitCells, 4 ) ;
+  GetParamDef( "AdaptiveProposal-MaxCells", fProposalMaxCells, 256 ) ;
+  GetParamDef( "AdaptiveProposal-Tolerance", fProposalTolerance, 0.05 ) ;
+  GetParamDef( "AdaptiveProposal-SafetyFactor", fProposalSafetyFactor, 1.2 ) ;
+}
+//___________________________________________________________________________
+int KineGeneratorWithCache::ProposalDim(void) const
+{
+// Dimension of the phase space sampled by the generator. Generators which
+// do not support adaptive proposals return 0.
+
+  return 0;
+}
+//___________________________________________________________________________
+double KineGeneratorWithCache::ProposalXSec(
+                               Interaction * /*in*/, const double * /*u*/) const
+{
+// Differential cross section at the point u of the unit hypercube, mapped
+// onto the phase space exactly as done by the generator for the energy of
+// the input interaction. To be implemented by generators supporting
+// adaptive proposals.
+
+  return 0.;
+}
+//___________________________________________________________________________
+namespace genie {
+
+  // Largest differential cross section, as a function of the proposal
+  // coordinates, over a set of probe energies
+  class KineGeneratorWithCache::ProposalFunction : public AdaptiveProposal::Function
+  {
+  public:
+    ProposalFunction(const KineGeneratorWithCache * gen,
+      const Interaction * in, const std::vector<double> & energies) :
+      fGen(gen)
+    {
+      double E = gen->Energy(in);
+      TLorentzVector * p4 = in->InitState().GetProbeP4(kRfLab);
+      for(unsigned int i = 0; i < energies.size(); i++) {
+        Interaction * clone = new Interaction(*in);
+        // For a massless probe the energy in any frame scales with the
+        // LAB-frame probe momentum
+        TLorentzVector scaled = (*p4) * (energies[i]/E);
+        clone->InitStatePtr()->SetProbeP4(scaled);
+        clone->SetBit(kISkipProcessChk);
+        fInteractions.push_back(clone);
+      }
+      delete p4;
+    }
+   ~ProposalFunction()
+    {
+      for(unsigned int i = 0; i < fInteractions.size(); i++) {
+        delete fInteractions[i];
+      }
+    }
+    double operator() (const double * u) const
+    {
+      double xsec = 0.;
+      for(unsigned int i = 0; i < fInteractions.size(); i++) {
+        xsec = TMath::Max(xsec, fGen->ProposalXSec(fInteractions[i], u));
+      }
+      return xsec;
+    }
+  private:
+    const KineGeneratorWithCache * fGen;
+    std::vector<Interaction *>     fInteractions;
+  };
+
+}
+//___________________________________________________________________________
+AdaptiveProposal * KineGeneratorWithCache::Proposal(
+                                       const Interaction * interaction) const
+{
+// Returns the adaptive proposal for the energy bin of the input interaction,
+// training it if needed. Returns 0 if proposals are disabled or not
+// supported, if no valid proposal could be trained, or if the cross section
+// was found to exceed the proposal: the proposal is trained at a few
+// energies of the bin only, so it does not strictly bound the cross section
+// and the generator falls back to the flat proposal with the max xsec.
+
+  int ndim = this->ProposalDim();
+  if(!fUseProposal || fGenerateUniformly || ndim <= 0) return 0;
+
+  double E = this->Energy(interaction);
+  if(E <= 0. || fProposalBinsPerDecade <= 0) return 0;
+
+  int ebin = TMath::FloorNint(TMath::Log10(E) * fProposalBinsPerDecade);
+
+  Cache * cache = Cache::Instance();
+
+  ostringstream bin;
+  bin << "proposal/" << ebin;
+  string key = cache->CacheBranchKey(
+                 this->Id().Key(), interaction->AsString(), bin.str());
+
+  AdaptiveProposal * proposal =
+              dynamic_cast<AdaptiveProposal *> (cache->FindCacheBranch(key));
+  if(!proposal) {
+    LOG("Kinematics", pNOTICE) << "Training adaptive proposal - key = " << key;
+
+    // Bound the cross section over the whole energy bin by taking the
+    // maximum at its low edge, center and high edge
+    std::vector<double> energies;
+    for(int i = 0; i <= 2; i++) {
+      energies.push_back(
+        TMath::Power(10., (ebin + 0.5*i) / fProposalBinsPerDecade));
+    }
+
+    proposal = new AdaptiveProposal(ndim);
+    ProposalFunction f(this, interaction, energies);
+    proposal->Build(f, fProposalInitCells, fProposalMaxCells,
+                    fProposalTolerance, fProposalSafetyFactor);
+
+    LOG("Kinematics", pNOTICE)
+      << "Adaptive proposal with " << proposal->NCells()
+      << " cells, expected acceptance: " << proposal->Efficiency();
+
+    cache->AddCacheBranch(key, proposal);
+  }
+
+  return (proposal->IsValid() && proposal->NViolations() == 0) ? proposal : 0;
+}
+//___________________________________________________________________________
+double KineGeneratorWithCache::SampleProposal(
+  const AdaptiveProposal * proposal, double * u, int & cell) const
+{
+// Selects a point of the unit hypercube from the proposal density. Returns
+// the proposal envelope at that point, to be used in place of the max xsec.
+
+  RandomGen * rnd = RandomGen::Instance();
+
+  int ndim = proposal->NDim();
+  std::vector<double> r(ndim+1);
+  for(int i = 0; i <= ndim; i++) r[i] = rnd->RndKine().Rndm();
+
+  return proposal->Sample(&r[0], u, cell);
+}
+//___________________________________________________________________________
+void KineGeneratorWithCache::CheckProposal(AdaptiveProposal * proposal,
+  int cell, const Interaction * interaction, double xsec, double envelope) const
+{
+// Counterpart of AssertXSecLimits for points sampled from an adaptive
+// proposal. The violation is recorded in the proposal, which is no longer
+// used: the following events of its energy bin are generated from the flat
+// proposal with the max xsec.
+
+  if(xsec > envelope) {
+    RejectionLoopStats::Instance()->Violation();
+    double f = 200*(xsec-envelope)/(envelope+xsec);
+    MAXLOG("Kinematics", pWARN, 10)
+      << "xsec: (curr) = " << xsec << " > (proposal) = " << envelope
+      << " - fractional deviation of " << f << " %\n for " << *interaction;
+    MAXLOG("Kinematics", pWARN, 10)
+      << "*** Exceeding the adaptive proposal - falling back to the max "
+      << "xsec for this energy bin";
+    proposal->Violation(cell, xsec);
+  }
+
+  if(xsec<0) {
+    LOG("Kinematics", pERROR)
+     << "Negative cross section for current kinematics!! \n" << *interaction;
+  }
+}
+//___________________________________________________________________________
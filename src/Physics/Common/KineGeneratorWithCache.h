@@ -18,6 +18,12 @@
           The example of using this opportunity see in 
           the class QELEventGeneratorSM.
 
+          Generators may also opt into an adaptive proposal density
+          (genie::AdaptiveProposal) for their rejection method by implementing
+          ProposalDim() and ProposalXSec(). The proposal is trained lazily per
+          log10(energy) bin and stored in the Cache. Trials, acceptances and
+          max-xsec violations are reported to genie::RejectionLoopStats.
+
 \author   Costas Andreopoulos <constantinos.andreopoulos \at cern.ch>
           University of Liverpool & STFC Rutherford Appleton Laboratory \n
           Igor Kakorin <kakorin@jinr.ru>
@@ -38,6 +44,7 @@
 #include "Framework/EventGen/XSecAlgorithmI.h"
 #include "Framework/EventGen/EventRecordVisitorI.h"
 #include "Framework/Utils/Range1.h"
+#include "Physics/Common/AdaptiveProposal.h"
 
 using std::string;
 
@@ -65,6 +72,20 @@ protected:
 
   virtual void AssertXSecLimits (const Interaction * in, double xsec, double xsec_max) const;
 
+  // adaptive proposal density for the rejection method (opt-in)
+  virtual int    ProposalDim   (void) const;
+  virtual double ProposalXSec  (Interaction * in, const double * u) const;
+  virtual AdaptiveProposal * Proposal (const Interaction * in) const;
+  virtual double SampleProposal (const AdaptiveProposal * proposal, double * u, int & cell) const;
+  virtual void   CheckProposal  (AdaptiveProposal * proposal, int cell,
+                                 const Interaction * in, double xsec, double envelope) const;
+  void           LoadProposalConfig (void);
+
+  // rejection method statistics (see RejectionLoopStats)
+  void CountTrial (bool accepted) const;
+
+  class ProposalFunction;
+
   mutable const XSecAlgorithmI * fXSecModel;
 
   double fSafetyFactor;                     ///< ComputeMaxXSec -> ComputeMaxXSec * fSafetyFactor
@@ -75,6 +96,13 @@ protected:
   double fMaxXSecDiffTolerance;             ///< max{100*(xsec-maxxsec)/.5*(xsec+maxxsec)} if xsec>maxxsec
   double fEMin;                             ///< min E for which maxxsec is cached - forcing explicit calc.
   bool   fGenerateUniformly;                ///< uniform over allowed phase space + event weight?
+
+  bool   fUseProposal;                      ///< sample from an adaptive proposal instead of flat?
+  int    fProposalBinsPerDecade;            ///< proposals are trained per log10(E) bin
+  int    fProposalInitCells;                ///< initial proposal cells along each axis
+  int    fProposalMaxCells;                 ///< maximum number of proposal cells
+  double fProposalTolerance;                ///< target relative excess of the proposal
+  double fProposalSafetyFactor;             ///< safety factor on the proposal cell maxima
 };
 
 }      // genie namespace
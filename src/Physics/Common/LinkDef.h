@@ -18,6 +18,7 @@
 #pragma link C++ class genie::OutgoingDarkGenerator;
 #pragma link C++ class genie::HadronicSystemGenerator;
 #pragma link C++ class genie::KineGeneratorWithCache;
+#pragma link C++ class genie::AdaptiveProposal;
 
 #pragma link C++ class genie::XSecScaleI;
 #pragma link C++ class genie::XSecScaleMap;
@@ -100,8 +100,13 @@ void DISKinematicsGenerator::ProcessEventRecord(GHepRecord * evrec) const
   //   cache. Throw an exception and quit the evg thread if a non-positive
   //   value is found.
   //   If the kinematics are generated uniformly over the allowed phase
-  //   space the max xsec is irrelevant
-  double xsec_max = (fGenerateUniformly) ? -1 : this->MaxXSec(evrec);
+  //   space the max xsec is irrelevant.
+  //   If an adaptive proposal is used, (x,y) are drawn from it and the
+  //   proposal envelope replaces the max xsec.
+  AdaptiveProposal * proposal = this->Proposal(interaction);
+  double xsec_max = (fGenerateUniformly || proposal) ? -1 : this->MaxXSec(evrec);
+  double u[2] = { 0., 0. };
+  int cell = -1;
 
   //-- Try to select a valid (x,y) pair using the rejection method
 
@@ -124,8 +129,14 @@ void DISKinematicsGenerator::ProcessEventRecord(GHepRecord * evrec) const
      }
 
      //-- random x,y
-     gx = xl.min + dx * rnd->RndKine().Rndm();
-     gy = yl.min + dy * rnd->RndKine().Rndm();
+     if(proposal) {
+        xsec_max = this->SampleProposal(proposal, u, cell);
+        gx = xl.min + dx * u[0];
+        gy = yl.min + dy * u[1];
+     } else {
+        gx = xl.min + dx * rnd->RndKine().Rndm();
+        gy = yl.min + dy * rnd->RndKine().Rndm();
+     }
      interaction->KinePtr()->Setx(gx);
      interaction->KinePtr()->Sety(gy);
      kinematics::UpdateWQ2FromXY(interaction);
@@ -140,7 +151,8 @@ void DISKinematicsGenerator::ProcessEventRecord(GHepRecord * evrec) const
 
      //-- decide whether to accept the current kinematics
      if(!fGenerateUniformly) {
-        this->AssertXSecLimits(interaction, xsec, xsec_max);
+        if(proposal) this->CheckProposal(proposal, cell, interaction, xsec, xsec_max);
+        else         this->AssertXSecLimits(interaction, xsec, xsec_max);
         double t = xsec_max * rnd->RndKine().Rndm();
 	double J = 1;
 
@@ -153,6 +165,7 @@ void DISKinematicsGenerator::ProcessEventRecord(GHepRecord * evrec) const
      else {
         accept = (xsec>0);
      }
+     this->CountTrial(accept);
 
      //-- If the generated kinematics are accepted, finish-up module's job
      if(accept) {
@@ -233,6 +246,8 @@ void DISKinematicsGenerator::LoadConfig(void)
   //   an event weight?
     GetParamDef( "UniformOverPhaseSpace", fGenerateUniformly, false ) ;
 
+  //-- Adaptive proposal for the rejection method
+    this->LoadProposalConfig();
 }
 //____________________________________________________________________________
 double DISKinematicsGenerator::ComputeMaxXSec(
@@ -375,3 +390,26 @@ double DISKinematicsGenerator::ComputeMaxXSec(
   return max_xsec;
 }
 //___________________________________________________________________________
+double DISKinematicsGenerator::ProposalXSec(
+                         Interaction * interaction, const double * u) const
+{
+// Cross section at the point u of the unit square, mapped onto the allowed
+// (x,y) range in the same way as in ProcessEventRecord
+
+  const KPhaseSpace & kps = interaction->PhaseSpace();
+  Range1D_t W = kps.Limits(kKVW);
+  if(W.max <=0 || W.min>=W.max) return 0.;
+
+  Range1D_t xl = kps.Limits(kKVx);
+  Range1D_t yl = kps.Limits(kKVy);
+  if(xl.min <= 0 || yl.min <= 0) return 0.;
+
+  double gx = xl.min + (xl.max - xl.min) * u[0];
+  double gy = yl.min + (yl.max - yl.min) * u[1];
+  interaction->KinePtr()->Setx(gx);
+  interaction->KinePtr()->Sety(gy);
+  kinematics::UpdateWQ2FromXY(interaction);
+
+  return fXSecModel->XSec(interaction, kPSxyfE);
+}
+//___________________________________________________________________________
@@ -47,6 +47,8 @@ public :
 private:
   void   LoadConfig      (void);
   double ComputeMaxXSec  (const Interaction * interaction) const;
+  int    ProposalDim     (void) const { return 2; }
+  double ProposalXSec    (Interaction * interaction, const double * u) const;
 };
 
 }      // genie namespace
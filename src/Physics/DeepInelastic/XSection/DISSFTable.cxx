@@ -0,0 +1,163 @@
+//____________________________________________________________________________
+/*
+ Copyright (c) 2003-2023, The GENIE Collaboration
+ For the full text of the license visit http://copyright.genie-mc.org
+
+ The GENIE Collaboration
+*/
+//____________________________________________________________________________
+
+#include <cmath>
+
+#include "Physics/DeepInelastic/XSection/DISSFTable.h"
+
+using namespace genie;
+
+ClassImp(DISSFTable);
+
+namespace {
+
+  // Lagrange weights of 4 equally spaced points (at 0,1,2,3) for the
+  // position u, in units of the spacing
+  inline void CubicWeights(double u, double * w)
+  {
+    double u1 = u - 1.;
+    double u2 = u - 2.;
+    double u3 = u - 3.;
+    w[0] = -       u1 * u2 * u3 / 6.;
+    w[1] =     u *      u2 * u3 / 2.;
+    w[2] = -   u * u1 *      u3 / 2.;
+    w[3] =     u * u1 * u2      / 6.;
+  }
+
+  // First of the 4 grid points used to interpolate at the position t
+  // (in units of the spacing, from the first grid point)
+  inline int Stencil(double t, int n, double & u)
+  {
+    int i = (int) std::floor(t) - 1;
+    if(i < 0    ) i = 0;
+    if(i > n - 4) i = n - 4;
+    u = t - i;
+    return i;
+  }
+
+  inline double Logit(double x) { return std::log(x / (1. - x)); }
+
+}
+
+//___________________________________________________________________________
+DISSFTable::DISSFTable() :
+CacheBranchI(),
+fNX(0),
+fNQ2(0),
+fXMin(0.),
+fXMax(0.),
+fQ2Min(0.),
+fQ2Max(0.),
+fTMin(0.),
+fDT(0.),
+fLogQ2Min(0.),
+fDLogQ2(0.)
+{
+
+}
+//___________________________________________________________________________
+DISSFTable::DISSFTable(int nx, int nq2, double xmin, double xmax,
+                       double Q2min, double Q2max) :
+CacheBranchI(),
+fNX(nx),
+fNQ2(nq2),
+fXMin(xmin),
+fXMax(xmax),
+fQ2Min(Q2min),
+fQ2Max(Q2max)
+{
+  fTMin     = Logit(fXMin);
+  fDT       = (Logit(fXMax) - fTMin) / (fNX - 1);
+  fLogQ2Min = std::log(fQ2Min);
+  fDLogQ2   = (std::log(fQ2Max) - fLogQ2Min) / (fNQ2 - 1);
+
+  fSF.assign(fNX * fNQ2 * kNSF, 0.);
+}
+//___________________________________________________________________________
+DISSFTable::~DISSFTable()
+{
+
+}
+//___________________________________________________________________________
+double DISSFTable::X(int ix) const
+{
+  if(ix == 0      ) return fXMin;
+  if(ix == fNX - 1) return fXMax;
+  return 1. / (1. + std::exp(-(fTMin + ix * fDT)));
+}
+//___________________________________________________________________________
+double DISSFTable::Q2(int iq) const
+{
+  if(iq == 0       ) return fQ2Min;
+  if(iq == fNQ2 - 1) return fQ2Max;
+  return std::exp(fLogQ2Min + iq * fDLogQ2);
+}
+//___________________________________________________________________________
+void DISSFTable::Set(int ix, int iq, const double * sf)
+{
+  double * node = &fSF[ (iq*fNX + ix) * kNSF ];
+  for(int i = 0; i < kNSF; i++) node[i] = sf[i];
+}
+//___________________________________________________________________________
+void DISSFTable::SetRegion(int ix, int iq, int region)
+{
+  if(fRegion.empty()) {
+    if(region == 0) return;
+    fRegion.assign(fNX * fNQ2, 0);
+  }
+  fRegion[iq*fNX + ix] = (char) region;
+}
+//___________________________________________________________________________
+size_t DISSFTable::MemorySize(void) const
+{
+  return sizeof(*this) + fSF.capacity() * sizeof(double) + fRegion.capacity();
+}
+//___________________________________________________________________________
+bool DISSFTable::InGrid(double x, double Q2) const
+{
+  if(fNX < 4 || fNQ2 < 4) return false;
+  return (x >= fXMin && x <= fXMax && Q2 >= fQ2Min && Q2 <= fQ2Max);
+}
+//___________________________________________________________________________
+bool DISSFTable::Interpolate(double x, double Q2, double * sf) const
+{
+  if(!this->InGrid(x,Q2)) return false;
+
+  double ux, uq;
+  int ix = Stencil( (Logit(x)     - fTMin    ) / fDT,    fNX,  ux );
+  int iq = Stencil( (std::log(Q2) - fLogQ2Min) / fDLogQ2, fNQ2, uq );
+
+  // do not interpolate across a discontinuity
+  if(!fRegion.empty()) {
+    char region = fRegion[iq*fNX + ix];
+    for(int i = 0; i < 4; i++) {
+      const char * row = &fRegion[(iq+i)*fNX + ix];
+      for(int j = 0; j < 4; j++) {
+        if(row[j] != region) return false;
+      }
+    }
+  }
+
+  double wx[4], wq[4];
+  CubicWeights(ux, wx);
+  CubicWeights(uq, wq);
+
+  for(int k = 0; k < kNSF; k++) sf[k] = 0.;
+
+  for(int i = 0; i < 4; i++) {
+    const double * row = &fSF[ ((iq+i)*fNX + ix) * kNSF ];
+    for(int j = 0; j < 4; j++) {
+      double w = wq[i] * wx[j];
+      const double * node = row + j * kNSF;
+      for(int k = 0; k < kNSF; k++) sf[k] += w * node[k];
+    }
+  }
+  return true;
+}
+//___________________________________________________________________________
@@ -0,0 +1,93 @@
+//____________________________________________________________________________
+/*!
+
+\class    genie::DISSFTable
+
+\brief    Table of the DIS structure functions F1-F6 on an (x,Q2) grid, used
+          by QPMDISStrucFuncBase when the tabulated structure function mode
+          is enabled.
+
+\details  The grid is uniform in log(x/(1-x)) and log(Q2), which resolves
+          the structure functions both at low x and close to x=1. Values
+          between grid points are obtained by bicubic (4x4 points Lagrange)
+          interpolation, with the same weights for all structure functions.
+          Grid points can be tagged with a region index (e.g. below / above
+          the charm production threshold): no interpolation is done across
+          region boundaries, where the SFs are discontinuous, and the caller
+          has to compute the SFs instead.
+          Tables are stored as Cache branches, so they are computed once per
+          job (or once, if a cache file is used).
+
+\author   The GENIE Collaboration
+
+\created  October 16, 2026
+
+\cpright  Copyright (c) 2003-2023, The GENIE Collaboration
+          For the full text of the license visit http://copyright.genie-mc.org
+*/
+//____________________________________________________________________________
+
+#ifndef _DIS_SF_TABLE_H_
+#define _DIS_SF_TABLE_H_
+
+#include <vector>
+
+#include "Framework/Utils/CacheBranchI.h"
+
+namespace genie {
+
+class DISSFTable : public CacheBranchI
+{
+public:
+
+  static const int kNSF = 6;  ///< number of structure functions (F1-F6)
+
+  DISSFTable();
+  DISSFTable(int nx, int nq2, double xmin, double xmax,
+             double Q2min, double Q2max);
+ ~DISSFTable();
+
+  int    NX  (void) const { return fNX;  }
+  int    NQ2 (void) const { return fNQ2; }
+
+  /// grid point coordinates
+  double X   (int ix) const;
+  double Q2  (int iq) const;
+
+  /// sets F1-F6 at a grid point
+  void   Set (int ix, int iq, const double * sf);
+
+  /// tags a grid point with a region index (all points are in region 0
+  /// unless tagged)
+  void   SetRegion (int ix, int iq, int region);
+
+  /// true if (x,Q2) is covered by the grid
+  bool   InGrid (double x, double Q2) const;
+
+  /// interpolates F1-F6 at (x,Q2), returns false outside the grid or if
+  /// the interpolation points are not all in the same region
+  bool   Interpolate (double x, double Q2, double * sf) const;
+
+  size_t MemorySize  (void) const;
+
+private:
+
+  int    fNX;       ///< number of points in log(x/(1-x))
+  int    fNQ2;      ///< number of points in log(Q2)
+  double fXMin;
+  double fXMax;
+  double fQ2Min;
+  double fQ2Max;
+  double fTMin;     ///< log(xmin/(1-xmin))
+  double fDT;       ///< grid spacing in log(x/(1-x))
+  double fLogQ2Min;
+  double fDLogQ2;   ///< grid spacing in log(Q2)
+
+  std::vector<double> fSF;     ///< F1-F6 at each (Q2,x) point, x running fastest
+  std::vector<char>   fRegion; ///< region index of each (Q2,x) point, if tagged
+
+ClassDef(DISSFTable,2)
+};
+
+}      // genie namespace
+#endif // _DIS_SF_TABLE_H_
@@ -20,6 +20,7 @@
 #include "Framework/Conventions/Units.h"
 #include "Physics/DeepInelastic/XSection/DISXSec.h"
 #include "Physics/XSectionIntegration/GSLXSecFunc.h"
+#include "Physics/XSectionIntegration/XSecIntegrationContext.h"
 #include "Framework/Messenger/Messenger.h"
 #include "Framework/ParticleData/PDGCodes.h"
 #include "Framework/ParticleData/PDGUtils.h"
@@ -156,17 +157,14 @@ double DISXSec::Integrate(
      double xsec = 0.;
 
      if(phsp_ok) {
-       ROOT::Math::IBaseFunctionMultiDim * func =
-          new utils::gsl::d2XSec_dWdQ2_E(model, interaction);
-       ROOT::Math::IntegrationMultiDim::Type ig_type =
-           utils::gsl::IntegrationNDimTypeFromString(fGSLIntgType);
-
-       double abstol = 1; //We mostly care about relative tolerance.
-       ROOT::Math::IntegratorMultiDim ig(*func, ig_type, abstol, fGSLRelTol, fGSLMaxEval);
+       utils::gsl::d2XSec_dWdQ2_E func(model, interaction);
+       string ckey = this->Id().Key();
+       XSecIntegrationContext * ctx = this->IntegrationContext(ckey, false);
+       string gkey = model->Id().Key() + "/" + interaction->AsString();
        double kine_min[2] = { Wl.min, Q2l.min };
        double kine_max[2] = { Wl.max, Q2l.max };
-       xsec = ig.Integral(kine_min, kine_max) * (1E-38 * units::cm2);
-       delete func;
+       xsec = ctx->Integral(ckey, gkey, func, kine_min, kine_max)
+                * (1E-38 * units::cm2);
      }//phase space ok?
 
      LOG("DISXSec", pINFO)  << "XSec[DIS] (E = " << Ev << " GeV) = " << xsec;
@@ -178,6 +176,127 @@ double DISXSec::Integrate(
   return 0;
 }
 //____________________________________________________________________________
+void DISXSec::IntegrateBatch(const XSecAlgorithmI * model,
+     const Interaction * in, const std::vector<double> & energies,
+     std::vector<double> & xsec) const
+{
+// Integrates the input model at each of the input probe energies, using the
+// same integrand and numerical integrator for all energies.
+// If the cross sections are obtained from the free nucleon splines or cache
+// branches (see Integrate()) there is nothing to share: integrate one energy
+// at a time.
+
+  xsec.assign(energies.size(), 0.);
+
+  if(! model->ValidProcess(in) ) return;
+
+  bool use_free_nucleon_xsec = RunOpt::Instance()->BareXSecPreCalc();
+
+  XSecSplineList * xsl = XSecSplineList::Instance();
+  if(in->InitState().Tgt().IsNucleus() && !xsl->IsEmpty() ) {
+    Interaction free_nucleon(*in);
+    Target * target = free_nucleon.InitStatePtr()->TgtPtr();
+    if(pdg::IsProton(target->HitNucPdg())) { target->SetId(kPdgTgtFreeP); }
+    else                                   { target->SetId(kPdgTgtFreeN); }
+    if(xsl->SplineExists(model,&free_nucleon)) use_free_nucleon_xsec = true;
+  }
+
+  if(use_free_nucleon_xsec) {
+    XSecIntegratorI::IntegrateBatch(model, in, energies, xsec);
+    return;
+  }
+
+  // See Integrate() for the DIS nuclear corrections
+  Interaction * interaction = new Interaction(*in);
+  interaction->SetBit(kISkipProcessChk);
+  interaction->SetBit(kINoNuclearCorrection);
+
+  this->IntegrateKnots(model, interaction, energies, xsec, false);
+
+  for(unsigned int i = 0; i < energies.size(); i++) {
+    LOG("DISXSec", pINFO)
+      << "XSec[DIS] (E = " << energies[i] << " GeV) = " << xsec[i];
+  }
+
+  delete interaction;
+}
+//____________________________________________________________________________
+void DISXSec::IntegrateKnots(const XSecAlgorithmI * model,
+     const Interaction * interaction, const std::vector<double> & energies,
+     std::vector<double> & xsec, bool free_nucleon_cache) const
+{
+// Integrates the input model at each of the input probe energies, sharing
+// the integrand and the numerical integrator. Sets the probe energy of the
+// input interaction: the probe is put on its mass shell for spline knots
+// (as XSecSplineList does) and taken massless for the free nucleon cache.
+// The free nucleon cache also sets the minimum number of integrand
+// evaluations, so it uses an integrator of its own.
+
+  xsec.assign(energies.size(), 0.);
+
+  utils::gsl::d2XSec_dWdQ2_E func(model, interaction);
+  string ckey = this->Id().Key();
+  if(free_nucleon_cache) ckey += "/FreeNucleonCache";
+  XSecIntegrationContext * ctx =
+     this->IntegrationContext(ckey, free_nucleon_cache);
+  string gkey = model->Id().Key() + "/" + interaction->AsString();
+
+  const KPhaseSpace & kps = interaction->PhaseSpace();
+  double Ethr = kps.Threshold();
+
+  for(unsigned int ie = 0; ie < energies.size(); ie++) {
+    double Ev = energies[ie];
+    if(free_nucleon_cache) {
+      TLorentzVector p4(0,0,Ev,Ev);
+      interaction->InitStatePtr()->SetProbeP4(p4);
+    } else {
+      interaction->InitStatePtr()->SetProbeOnShellE(Ev);
+    }
+    if(Ev <= Ethr+kASmallNum) continue;
+
+    Range1D_t Wl  = kps.WLim();
+    Range1D_t Q2l = kps.Q2Lim();
+    LOG("DISXSec", pINFO)
+         << "W integration range = [" << Wl.min << ", " << Wl.max << "]";
+    LOG("DISXSec", pINFO)
+      << "Q2 integration range = [" << Q2l.min << ", " << Q2l.max << "]";
+
+    bool phsp_ok =
+       (Q2l.min >= 0. && Q2l.max >= 0. && Q2l.max >= Q2l.min &&
+         Wl.min >= 0. &&  Wl.max >= 0. &&  Wl.max >=  Wl.min);
+    if(!phsp_ok) continue;
+
+    double kine_min[2] = { Wl.min, Q2l.min };
+    double kine_max[2] = { Wl.max, Q2l.max };
+    xsec[ie] = ctx->Integral(ckey, gkey, func, kine_min, kine_max)
+                 * (1E-38 * units::cm2);
+  }
+}
+//____________________________________________________________________________
+XSecIntegrationContext * DISXSec::IntegrationContext(
+     const string & key, bool set_min_pts) const
+{
+// The W,Q2 integrator stored under the input key is shared by all the
+// interactions integrated by this algorithm (all energies, CC/NC,
+// neutrinos/anti-neutrinos)
+
+  ROOT::Math::IntegrationMultiDim::Type ig_type =
+      utils::gsl::IntegrationNDimTypeFromString(fGSLIntgType);
+  double abstol = 1; //We mostly care about relative tolerance.
+
+  XSecIntegrationContext * ctx = XSecIntegrationContext::Instance();
+  ROOT::Math::IntegratorMultiDim & ig = ctx->Integrator(
+        key, 2, ig_type, abstol, fGSLRelTol, fGSLMaxEval);
+
+  if (set_min_pts && ig_type == ROOT::Math::IntegrationMultiDim::kADAPTIVE) {
+     ROOT::Math::AdaptiveIntegratorMultiDim * cast =
+       dynamic_cast<ROOT::Math::AdaptiveIntegratorMultiDim*>( ig.GetIntegrator() );
+     assert(cast);
+     cast->SetMinPts(fGSLMinEval);
+  }
+  return ctx;
+}
+//____________________________________________________________________________
 void DISXSec::Configure(const Registry & config)
 {
   Algorithm::Configure(config);
@@ -259,58 +378,21 @@ void DISXSec::CacheFreeNucleonXSec(
       E[i+nkb] = TMath::Power(10., TMath::Log10(E0) + i * dEa);
   }
 
-  // Create the integrand
-  ROOT::Math::IBaseFunctionMultiDim * func =
-     new utils::gsl::d2XSec_dWdQ2_E(model, interaction);
-
   // Compute the cross section at the given set of knots
-  for(int ie=0; ie<nknots; ie++) {
-    double Ev = E[ie];
-    TLorentzVector p4(0,0,Ev,Ev);
-    interaction->InitStatePtr()->SetProbeP4(p4);
-    double xsec = 0.;
-    if(Ev>Ethr+kASmallNum) {
-       Range1D_t Wl  = kps.WLim();
-       Range1D_t Q2l = kps.Q2Lim();
-       LOG("DISXSec", pINFO)
-            << "W integration range = [" << Wl.min << ", " << Wl.max << "]";
-       LOG("DISXSec", pINFO)
-         << "Q2 integration range = [" << Q2l.min << ", " << Q2l.max << "]";
-
-       bool phsp_ok =
-          (Q2l.min >= 0. && Q2l.max >= 0. && Q2l.max >= Q2l.min &&
-            Wl.min >= 0. &&  Wl.max >= 0. &&  Wl.max >=  Wl.min);
-
-       if(phsp_ok) {
-         ROOT::Math::IntegrationMultiDim::Type ig_type =
-             utils::gsl::IntegrationNDimTypeFromString(fGSLIntgType);
-         double abstol = 1; //We mostly care about relative tolerance.
-         ROOT::Math::IntegratorMultiDim ig(*func, ig_type, abstol, fGSLRelTol, fGSLMaxEval);
-
-         if (ig_type == ROOT::Math::IntegrationMultiDim::kADAPTIVE) {
-            ROOT::Math::AdaptiveIntegratorMultiDim * cast =
-              dynamic_cast<ROOT::Math::AdaptiveIntegratorMultiDim*>( ig.GetIntegrator() );
-            assert(cast);
-            cast->SetMinPts(fGSLMinEval);
-         }
-
-         double kine_min[2] = { Wl.min, Q2l.min };
-         double kine_max[2] = { Wl.max, Q2l.max };
-         xsec = ig.Integral(kine_min, kine_max) * (1E-38 * units::cm2);
-       }// phase space limits ok?
-    }//Ev>threshold
+  std::vector<double> knots(E, E+nknots), xsec;
+  this->IntegrateKnots(model, interaction, knots, xsec, true);
 
+  for(int ie=0; ie<nknots; ie++) {
     LOG("DISXSec", pNOTICE)
-       << "Caching: XSec[DIS] (E = " << Ev << " GeV) = "
-       << xsec / (1E-38 * units::cm2) << " x 1E-38 cm^2";
-    cache_branch->AddValues(Ev,xsec);
+       << "Caching: XSec[DIS] (E = " << E[ie] << " GeV) = "
+       << xsec[ie] / (1E-38 * units::cm2) << " x 1E-38 cm^2";
+    cache_branch->AddValues(E[ie],xsec[ie]);
   }//ie
 
   // Create the spline
   cache_branch->CreateSpline();
 
   delete [] E;
-  delete func;
 }
 //____________________________________________________________________________
 string DISXSec::CacheBranchName(
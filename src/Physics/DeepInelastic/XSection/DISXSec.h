@@ -23,6 +23,8 @@
 
 namespace genie {
 
+class XSecIntegrationContext;
+
 class DISXSec : public XSecIntegratorI {
 
 public:
@@ -32,6 +34,9 @@ public:
 
   //! XSecIntegratorI interface implementation
   double Integrate(const XSecAlgorithmI * model, const Interaction * i) const;
+  void   IntegrateBatch(const XSecAlgorithmI * model, const Interaction * i,
+                        const std::vector<double> & energies,
+                        std::vector<double> & xsec) const;
 
   //! Overload the Algorithm::Configure() methods to load private data
   //! members from configuration options
@@ -42,7 +47,13 @@ private:
   void   LoadConfig (void);
 
   void   CacheFreeNucleonXSec(const XSecAlgorithmI * model, const Interaction * in) const;
+  void   IntegrateKnots      (const XSecAlgorithmI * model, const Interaction * in,
+                              const std::vector<double> & energies,
+                              std::vector<double> & xsec,
+                              bool free_nucleon_cache) const;
   string CacheBranchName     (const XSecAlgorithmI * model, const Interaction * in) const;
+  XSecIntegrationContext * IntegrationContext (const string & key,
+                                               bool set_min_pts) const;
 
   double fVldEmin;
   double fVldEmax;
@@ -7,6 +7,7 @@
 #pragma link C++ namespace genie;
 
 #pragma link C++ class genie::QPMDISStrucFuncBase;
+#pragma link C++ class genie::DISSFTable;
 
 #pragma link C++ class genie::QPMDISStrucFunc;
 #pragma link C++ class genie::QPMDISPXSec;
@@ -193,6 +193,12 @@ double QPMDISPXSec::Integral(const Interaction * interaction) const
   return xsec;
 }
 //____________________________________________________________________________
+void QPMDISPXSec::IntegralBatch(const Interaction * interaction,
+     const std::vector<double> & energies, std::vector<double> & xsec) const
+{
+  fXSecIntegrator->IntegrateBatch(this, interaction, energies, xsec);
+}
+//____________________________________________________________________________
 bool QPMDISPXSec::ValidProcess(const Interaction * interaction) const
 {
   if(interaction->TestBit(kISkipProcessChk)) return true;
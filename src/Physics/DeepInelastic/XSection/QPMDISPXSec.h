@@ -40,6 +40,9 @@ public:
   // XSecAlgorithmI interface implementation
   double XSec            (const Interaction * i, KinePhaseSpace_t k) const;
   double Integral        (const Interaction * i) const;
+  void   IntegralBatch   (const Interaction * i,
+                          const std::vector<double> & energies,
+                          std::vector<double> & xsec) const;
   bool   ValidProcess    (const Interaction * i) const;
 
   // overload the Algorithm::Configure() methods to load private data
@@ -23,6 +23,8 @@
 */
 //____________________________________________________________________________
 
+#include <sstream>
+
 #include <TMath.h>
 
 #include "Framework/Algorithm/AlgConfigPool.h"
@@ -30,6 +32,9 @@
 #include "Framework/Conventions/Constants.h"
 #include "Framework/Conventions/RefFrame.h"
 #include "Framework/Messenger/Messenger.h"
+#include "Framework/ParticleData/PDGLibrary.h"
+#include "Framework/Utils/Cache.h"
+#include "Physics/DeepInelastic/XSection/DISSFTable.h"
 #include "Physics/DeepInelastic/XSection/QPMDISStrucFuncBase.h"
 #include "Physics/PartonDistributions/PDFModelI.h"
 #include "Framework/ParticleData/PDGUtils.h"
@@ -37,6 +42,8 @@
 #include "Physics/NuclearState/NuclearUtils.h"
 #include "Framework/Utils/PhysUtils.h"
 
+using std::ostringstream;
+
 using namespace genie;
 using namespace genie::constants;
 
@@ -44,18 +51,27 @@ using namespace genie::constants;
 QPMDISStrucFuncBase::QPMDISStrucFuncBase() :
 DISStructureFuncModelI()
 {
+  fInInitPhase = true;
+  fUseSFTables = false;
+
   this->InitPDF();
 }
 //____________________________________________________________________________
 QPMDISStrucFuncBase::QPMDISStrucFuncBase(string name) :
 DISStructureFuncModelI(name)
 {
+  fInInitPhase = true;
+  fUseSFTables = false;
+
   this->InitPDF();
 }
 //____________________________________________________________________________
 QPMDISStrucFuncBase::QPMDISStrucFuncBase(string name, string config):
 DISStructureFuncModelI(name, config)
 {
+  fInInitPhase = true;
+  fUseSFTables = false;
+
   this->InitPDF();
 }
 //____________________________________________________________________________
@@ -119,11 +135,45 @@ void QPMDISStrucFuncBase::LoadConfig(void)
   //-- turn charm production off?
   GetParamDef( "Charm-Prod-Off", fCharmOff, false ) ;
 
+  //-- precomputed structure function tables
+  GetParamDef( "UseSFTables",   fUseSFTables,  false  ) ;
+  GetParamDef( "SFTable-NX",    fSFTableNX,    200    ) ;
+  GetParamDef( "SFTable-NQ2",   fSFTableNQ2,   120    ) ;
+  GetParamDef( "SFTable-XMin",  fSFTableXMin,  1.E-6  ) ;
+  GetParamDef( "SFTable-XMax",  fSFTableXMax,  0.999  ) ;
+  GetParamDef( "SFTable-Q2Min", fSFTableQ2Min, 1.E-4  ) ;
+  GetParamDef( "SFTable-Q2Max", fSFTableQ2Max, 1.E+5  ) ;
+  GetParamDef( "SFTable-MassBin", fSFTableMassBin, 0.005 ) ;
+
+  if(fUseSFTables) {
+    if(fSFTableNX < 4 || fSFTableNQ2 < 4 ||
+       fSFTableXMin <= 0. || fSFTableXMax >= 1. || fSFTableXMax <= fSFTableXMin ||
+       fSFTableQ2Min <= 0. || fSFTableQ2Max <= fSFTableQ2Min ||
+       fSFTableMassBin <= 0.) {
+      LOG("DISSF", pFATAL)
+        << "Invalid SF table grid: " << fSFTableNX << " x points in ["
+        << fSFTableXMin << ", " << fSFTableXMax << "], " << fSFTableNQ2
+        << " Q2 points in [" << fSFTableQ2Min << ", " << fSFTableQ2Max << "]"
+        << ", hit nucleon mass bin " << fSFTableMassBin;
+      exit(1);
+    }
+  }
+
   //-- weinberg angle
   double thw ;
   GetParam( "WeinbergAngle", thw ) ;
   fSin2thw = TMath::Power(TMath::Sin(thw), 2);
 
+  // Since this method would be called every time the current algorithm is
+  // reconfigured at run-time, remove the SF tables computed with the
+  // previous configuration
+  if(!fInInitPhase) {
+    Cache * cache = Cache::Instance();
+    string keysubstr = this->Id().Key() + "/DIS-SF-Table";
+    cache->RmMatchedCacheBranches(keysubstr);
+  }
+  fInInitPhase = false;
+
   LOG("DISSF", pDEBUG) << "Done loading configuration";
 }
 //____________________________________________________________________________
@@ -135,6 +185,16 @@ void QPMDISStrucFuncBase::InitPDF(void)
 }
 //____________________________________________________________________________
 void QPMDISStrucFuncBase::Calculate(const Interaction * interaction) const
+{
+  // Look-up the precomputed SF tables, if enabled, and compute the SFs from
+  // the PDFs if they are not (or if the interaction is not covered)
+  if(fUseSFTables) {
+    if(this->CalculateFromTable(interaction)) return;
+  }
+  this->CalculateExact(interaction);
+}
+//____________________________________________________________________________
+void QPMDISStrucFuncBase::CalculateExact(const Interaction * interaction) const
 {
   // Reset mutable members
   fF1 = 0;
@@ -624,3 +684,127 @@ void QPMDISStrucFuncBase::CalcPDFs(const Interaction * interaction) const
 
 }
 //____________________________________________________________________________
+bool QPMDISStrucFuncBase::CalculateFromTable(
+                                      const Interaction * interaction) const
+{
+  const Target & tgt = interaction->InitState().Tgt();
+
+  int  nuc_pdgc = tgt.HitNucPdg();
+  bool is_p     = pdg::IsProton  ( nuc_pdgc );
+  bool is_n     = pdg::IsNeutron ( nuc_pdgc );
+
+  if ( !is_p && !is_n       ) return false;
+  if ( tgt.N() == 0 && is_n ) return false;
+  if ( tgt.Z() == 0 && is_p ) return false;
+
+  // The CC tables are binned in the (possibly off-shell) hit nucleon mass
+  if(interaction->ProcInfo().IsWeakCC() && !fCharmOff) {
+    if(tgt.HitNucP4().M() <= 0.) return false;
+  }
+
+  double x     = interaction->Kine().x();
+  double Q2val = this->Q2(interaction);
+
+  const DISSFTable * table = this->SFTable(interaction);
+
+  double sf[DISSFTable::kNSF];
+  if(!table->Interpolate(x, Q2val, sf)) return false;
+
+  // The tables are computed without the nuclear modification, which only
+  // scales all the SFs
+  double f = this->NuclMod(interaction);
+
+  fF1 = f * sf[0];
+  fF2 = f * sf[1];
+  fF3 = f * sf[2];
+  fF4 = f * sf[3];
+  fF5 = f * sf[4];
+  fF6 = f * sf[5];
+
+  return true;
+}
+//____________________________________________________________________________
+const DISSFTable * QPMDISStrucFuncBase::SFTable(
+                                      const Interaction * interaction) const
+{
+// Returns the SF table for the probe, hit nucleon, hit quark and process
+// type of the input interaction, computing it if needed. The tables are
+// shared by all nuclear targets.
+// The SFs depend on the hit nucleon mass only through the charm production
+// threshold (CC), so the CC tables are also binned in the (possibly off-shell)
+// hit nucleon mass and computed at the centre of the bin. Within a bin the
+// threshold moves by much less than a grid cell, and the tables are not
+// interpolated across it (see BuildSFTable).
+
+  const InitialState & init_state = interaction->InitState();
+  const Target &       tgt        = init_state.Tgt();
+
+  ostringstream tbl;
+  tbl << "nu:" << init_state.ProbePdg() << ";N:" << tgt.HitNucPdg() << ";";
+  if(tgt.HitQrkIsSet()) {
+    tbl << "q:" << tgt.HitQrkPdg() << (tgt.HitSeaQrk() ? "(s)" : "(v)") << ";";
+  }
+  tbl << "proc:" << interaction->ProcInfo().InteractionTypeAsString();
+
+  double M = PDGLibrary::Instance()->Find(tgt.HitNucPdg())->Mass();
+  if(interaction->ProcInfo().IsWeakCC() && !fCharmOff) {
+    int mbin = TMath::Nint(tgt.HitNucP4().M() / fSFTableMassBin);
+    M = mbin * fSFTableMassBin;
+    tbl << ";M:" << mbin;
+  }
+
+  Cache * cache = Cache::Instance();
+  string key = cache->CacheBranchKey(this->Id().Key(), "DIS-SF-Table", tbl.str());
+
+  DISSFTable * table = dynamic_cast<DISSFTable *> (cache->FindCacheBranch(key));
+  if(!table) {
+    LOG("DISSF", pNOTICE) << "Computing SF table - key = " << key;
+    table = this->BuildSFTable(interaction, M);
+    cache->AddCacheBranch(key, table);
+  }
+  return table;
+}
+//____________________________________________________________________________
+DISSFTable * QPMDISStrucFuncBase::BuildSFTable(
+                           const Interaction * interaction, double M) const
+{
+  DISSFTable * table = new DISSFTable(fSFTableNX, fSFTableNQ2,
+         fSFTableXMin, fSFTableXMax, fSFTableQ2Min, fSFTableQ2Max);
+
+  // Hit nucleon of mass M at rest, without nuclear modification
+  Interaction in(*interaction);
+  in.SetBit(kINoNuclearCorrection);
+
+  Target * tgt = in.InitStatePtr()->TgtPtr();
+  tgt->SetHitNucP4(TLorentzVector(0., 0., 0., M));
+
+  // The CC SFs jump at the charm production threshold: tag the grid points
+  // above it so that the table is not interpolated across it
+  bool charm = interaction->ProcInfo().IsWeakCC() && !fCharmOff;
+
+  Kinematics * kine = in.KinePtr();
+  kine->ClearRunningValues();
+
+  double sf[DISSFTable::kNSF];
+  for(int iq = 0; iq < table->NQ2(); iq++) {
+    kine->SetQ2(table->Q2(iq));
+    for(int ix = 0; ix < table->NX(); ix++) {
+      kine->Setx(table->X(ix));
+      this->CalculateExact(&in);
+      sf[0] = fF1;
+      sf[1] = fF2;
+      sf[2] = fF3;
+      sf[3] = fF4;
+      sf[4] = fF5;
+      sf[5] = fF6;
+      table->Set(ix, iq, sf);
+      if(charm) {
+        bool above_charm = utils::kinematics::IsAboveCharmThreshold(
+                     this->ScalingVar(&in), table->Q2(iq), M, fMc);
+        table->SetRegion(ix, iq, above_charm ? 1 : 0);
+      }
+    }
+  }
+  return table;
+}
+//____________________________________________________________________________
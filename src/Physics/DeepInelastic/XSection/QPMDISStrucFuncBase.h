@@ -33,6 +33,8 @@
 
 namespace genie {
 
+class DISSFTable;
+
 class QPMDISStrucFuncBase : public DISStructureFuncModelI {
 
 public:
@@ -69,6 +71,14 @@ protected:
   virtual double R          (const Interaction * i) const;
   virtual void   KFactors   (const Interaction * i, double & kuv,
                                      double & kdv, double & kus, double & kds) const;
+
+  // SF calculation from the PDFs, and look-up in the precomputed SF tables
+  // (returns false if the interaction is not covered by the tables)
+  virtual void       CalculateExact     (const Interaction * i) const;
+  bool               CalculateFromTable (const Interaction * i) const;
+  const DISSFTable * SFTable            (const Interaction * i) const;
+  DISSFTable *       BuildSFTable       (const Interaction * i, double M) const;
+
   // configuration
   //
   double fQ2min;             ///< min Q^2 allowed for PDFs: PDF(Q2<Q2min):=PDF(Q2min)
@@ -87,6 +97,15 @@ protected:
   double fSin2thw;           ///<
   bool   fUse2016Corrections;///< Use 2016 SF relation corrections
   double fLowQ2CutoffF1F2;   ///< Set min for relation between 2xF1 and F2
+  bool   fUseSFTables;       ///< interpolate SFs from precomputed (x,Q2) tables?
+  int    fSFTableNX;         ///< number of SF table points in log(x/(1-x))
+  int    fSFTableNQ2;        ///< number of SF table points in log(Q2)
+  double fSFTableXMin;       ///< SF table limits
+  double fSFTableXMax;       ///<
+  double fSFTableQ2Min;      ///<
+  double fSFTableQ2Max;      ///<
+  double fSFTableMassBin;    ///< hit nucleon mass bin of the CC SF tables
+  bool   fInInitPhase;       ///<
 
   mutable double fF1;
   mutable double fF2;
@@ -169,6 +169,8 @@ void DFRKinematicsGenerator::ProcessEventRecord(GHepRecord * evrec) const
        accept = (xsec>0);
      }
 
+     this->CountTrial(accept);
+
      //-- If the generated kinematics are accepted, finish-up module's job
      if(accept) {
          // reset trust bits
@@ -76,37 +76,39 @@ void HEDISKinematicsGenerator::ProcessEventRecord(GHepRecord * evrec) const
   double Ev  = init_state.ProbeE(kRfLab);
   double M   = init_state.Tgt().HitNucP4().M(); // can be off m-shell
 
-  //-- Get the physical W range 
-  const KPhaseSpace & kps = interaction->PhaseSpace();
-  Range1D_t xl = kps.XLim();
-  Range1D_t Q2l = kps.Q2Lim();
-
-  //-- x and y lower limit restrict by limits in SF tables
-  Q2l.min = TMath::Max(Q2l.min,fSFQ2min);
-  Q2l.max = TMath::Min(Q2l.max,fSFQ2max);
-  xl.min  = TMath::Max(TMath::Max(xl.min,Q2l.min/2./M/Ev),fSFXmin);
+  //-- Get the physical x and Q2 ranges, restricted by the SF tables
+  Range1D_t xl, Q2l;
+  this->Limits(interaction, xl, Q2l);
 
   LOG("HEDISKinematics", pNOTICE) << "x: [" << xl.min << ", " << xl.max << "]"; 
   LOG("HEDISKinematics", pNOTICE) << "log10Q2: [" << Q2l.min << ", " << Q2l.max << "]"; 
 
   //-- For the subsequent kinematic selection with the rejection method:
-  
-  //Scan through a wide region to find the maximum
-  Range1D_t xrange_wide(xl.min*fWideRange,xl.max/fWideRange); 
-  Range1D_t Q2range_wide(Q2l.min*fWideRange,Q2l.max/fWideRange); 
-  double x_wide    = 0.;
-  double Q2_wide   = 0.;
-  double xsec_wide = this->Scan(interaction,xrange_wide,Q2range_wide,fWideNKnotsX,fWideNKnotsQ2,2*M*Ev,x_wide,Q2_wide);
-
-  //Scan through a fine region to find the maximum
-  Range1D_t xrange_fine(TMath::Max(x_wide/fFineRange,xrange_wide.min),TMath::Min(x_wide*fFineRange,xrange_wide.max)); 
-  Range1D_t Q2range_fine(TMath::Max(Q2_wide/fFineRange,Q2range_wide.min),TMath::Min(Q2_wide*fFineRange,Q2range_wide.max)); 
-  double x_fine    = 0.;
-  double Q2_fine   = 0.;
-  double xsec_fine = this->Scan(interaction,xrange_fine,Q2range_fine,fFineNKnotsX,fFineNKnotsQ2,2*M*Ev,x_fine,Q2_fine);
-
-  //Apply safety factor
-  double xsec_max = fSafetyFactor * TMath::Max(xsec_wide,xsec_fine);
+  //   If an adaptive proposal is used, (log10x,log10Q2) are drawn from it
+  //   and the proposal envelope replaces the scanned max xsec.
+  AdaptiveProposal * proposal = this->Proposal(interaction);
+  double u[2] = { 0., 0. };
+  int cell = -1;
+
+  double xsec_max = -1;
+  if(!proposal) {
+    //Scan through a wide region to find the maximum
+    Range1D_t xrange_wide(xl.min*fWideRange,xl.max/fWideRange); 
+    Range1D_t Q2range_wide(Q2l.min*fWideRange,Q2l.max/fWideRange); 
+    double x_wide    = 0.;
+    double Q2_wide   = 0.;
+    double xsec_wide = this->Scan(interaction,xrange_wide,Q2range_wide,fWideNKnotsX,fWideNKnotsQ2,2*M*Ev,x_wide,Q2_wide);
+
+    //Scan through a fine region to find the maximum
+    Range1D_t xrange_fine(TMath::Max(x_wide/fFineRange,xrange_wide.min),TMath::Min(x_wide*fFineRange,xrange_wide.max)); 
+    Range1D_t Q2range_fine(TMath::Max(Q2_wide/fFineRange,Q2range_wide.min),TMath::Min(Q2_wide*fFineRange,Q2range_wide.max)); 
+    double x_fine    = 0.;
+    double Q2_fine   = 0.;
+    double xsec_fine = this->Scan(interaction,xrange_fine,Q2range_fine,fFineNKnotsX,fFineNKnotsQ2,2*M*Ev,x_fine,Q2_fine);
+
+    //Apply safety factor
+    xsec_max = fSafetyFactor * TMath::Max(xsec_wide,xsec_fine);
+  }
 
   //-- Try to select a valid (x,y) pair using the rejection method
   double log10xmin  = TMath::Log10(xl.min);  
@@ -133,8 +135,14 @@ void HEDISKinematicsGenerator::ProcessEventRecord(GHepRecord * evrec) const
        throw exception;
      }
     
-     gx = TMath::Power( 10., log10xmin + dlog10x * rnd->RndKine().Rndm() ); 
-     gQ2 = TMath::Power( 10., log10Q2min + dlog10Q2 * rnd->RndKine().Rndm() ); 
+     if(proposal) {
+       xsec_max = this->SampleProposal(proposal, u, cell);
+       gx = TMath::Power( 10., log10xmin + dlog10x * u[0] ); 
+       gQ2 = TMath::Power( 10., log10Q2min + dlog10Q2 * u[1] ); 
+     } else {
+       gx = TMath::Power( 10., log10xmin + dlog10x * rnd->RndKine().Rndm() ); 
+       gQ2 = TMath::Power( 10., log10Q2min + dlog10Q2 * rnd->RndKine().Rndm() ); 
+     }
 
      interaction->KinePtr()->Setx(gx);
      interaction->KinePtr()->SetQ2(gQ2);
@@ -149,13 +157,15 @@ void HEDISKinematicsGenerator::ProcessEventRecord(GHepRecord * evrec) const
      xsec = fXSecModel->XSec(interaction, kPSlog10xlog10Q2fE);
 
      //-- decide whether to accept the current kinematics
-     this->AssertXSecLimits(interaction, xsec, xsec_max);
+     if(proposal) this->CheckProposal(proposal, cell, interaction, xsec, xsec_max);
+     else         this->AssertXSecLimits(interaction, xsec, xsec_max);
 
      double t = xsec_max * rnd->RndKine().Rndm();
 
      LOG("HEDISKinematics", pDEBUG) << "xsec= " << xsec << ", Rnd= " << t;
 
      accept = (t < xsec);
+     this->CountTrial(accept);
 
      //-- If the generated kinematics are accepted, finish-up module's job
      if(accept) {
@@ -216,6 +226,48 @@ double HEDISKinematicsGenerator::Scan(Interaction * interaction, Range1D_t xrang
 
 }
 //___________________________________________________________________________
+void HEDISKinematicsGenerator::Limits(const Interaction * interaction,
+                                Range1D_t & xl, Range1D_t & Q2l) const
+{
+  const InitialState & init_state = interaction->InitState();
+  double Ev  = init_state.ProbeE(kRfLab);
+  double M   = init_state.Tgt().HitNucP4().M(); // can be off m-shell
+
+  const KPhaseSpace & kps = interaction->PhaseSpace();
+  xl  = kps.XLim();
+  Q2l = kps.Q2Lim();
+
+  //-- x and y lower limit restrict by limits in SF tables
+  Q2l.min = TMath::Max(Q2l.min,fSFQ2min);
+  Q2l.max = TMath::Min(Q2l.max,fSFQ2max);
+  xl.min  = TMath::Max(TMath::Max(xl.min,Q2l.min/2./M/Ev),fSFXmin);
+}
+//___________________________________________________________________________
+double HEDISKinematicsGenerator::ProposalXSec(
+                         Interaction * interaction, const double * u) const
+{
+// Cross section at the point u of the unit square, mapped onto the allowed
+// (log10x,log10Q2) range in the same way as in ProcessEventRecord
+
+  Range1D_t xl, Q2l;
+  this->Limits(interaction, xl, Q2l);
+  if(xl.min <= 0 || xl.min >= xl.max || Q2l.min <= 0 || Q2l.min >= Q2l.max) return 0.;
+
+  double log10xmin  = TMath::Log10(xl.min);
+  double log10xmax  = TMath::Log10(xl.max);
+  double log10Q2min = TMath::Log10(Q2l.min);
+  double log10Q2max = TMath::Log10(Q2l.max);
+
+  double gx  = TMath::Power( 10., log10xmin + (log10xmax - log10xmin) * u[0] );
+  double gQ2 = TMath::Power( 10., log10Q2min + (log10Q2max - log10Q2min) * u[1] );
+
+  interaction->KinePtr()->Setx(gx);
+  interaction->KinePtr()->SetQ2(gQ2);
+  kinematics::UpdateWYFromXQ2(interaction);
+
+  return fXSecModel->XSec(interaction, kPSlog10xlog10Q2fE);
+}
+//___________________________________________________________________________
 double HEDISKinematicsGenerator::ComputeMaxXSec(const Interaction * /* interaction */ ) const
 {
   return 0;
@@ -256,4 +308,6 @@ void HEDISKinematicsGenerator::LoadConfig(void)
   GetParam("Q2Grid-Min", fSFQ2min ) ;
   GetParam("Q2Grid-Max", fSFQ2max ) ;
 
+  //-- Adaptive proposal for the rejection method
+  this->LoadProposalConfig();
 }
@@ -50,6 +50,11 @@ private:
   double Scan(Interaction * interaction, Range1D_t xrange,Range1D_t Q2range, int NKnotsQ2, int NKnotsX, double ME2, double & x_scan, double & Q2_scan) const;
 
   void   LoadConfig           (void);
+  void   Limits               (const Interaction * interaction,
+                               Range1D_t & xl, Range1D_t & Q2l) const;
+
+  int    ProposalDim          (void) const { return 2; }
+  double ProposalXSec         (Interaction * interaction, const double * u) const;
 
   int    fWideNKnotsX;
   int    fWideNKnotsQ2;
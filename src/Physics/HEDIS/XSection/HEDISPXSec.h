@@ -44,6 +44,9 @@ namespace genie {
       void Configure(const Registry & config);
       void Configure(string config);
 
+      // information used to compute the SF tables
+      const SF_info & SFInfo (void) const { return fSFinfo; }
+
     private:
       void   LoadConfig (void);
       double ds_dxdy      (SF_xQ2 sf, double x, double y) const;
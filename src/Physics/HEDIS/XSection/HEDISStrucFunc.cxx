@@ -23,6 +23,13 @@
 
 #include <TSystem.h>
 #include <TMath.h>
+#include <TMD5.h>
+
+#include <cstdio>
+#include <cstring>
+#include <sstream>
+#include <unistd.h>
+#include <sys/wait.h>
 
 #ifdef __GENIE_APFEL_ENABLED__
 #include "APFEL/APFEL.h"
@@ -41,13 +48,31 @@ double Q2PDFmin;                 // Minimum values of Q2 in grid from LHPADF set
 double Q2PDFmax;                 // Maximum values of Q2 in grid from LHPADF set
 std::map<int, double> mPDFQrk;   // Mass of the quark from LHAPDF set
 
+// Number of Q2 rows computed in each chunk of a SF table. Chunks are the
+// unit of work shared among processes and saved in checkpoint files.
+static const int kSFChunkRows = 10;
+static const char kSFTableMagic[] = "GHEDSF01";
+static const char kSFChunkMagic[] = "GHEDCK01";
+
 //_________________________________________________________________________
 HEDISStrucFunc * HEDISStrucFunc::fgInstance = 0;
+int HEDISStrucFunc::fgNWorkers = 1;
+int HEDISStrucFunc::fgIJob     = 0;
+int HEDISStrucFunc::fgNJobs    = 1;
 //_________________________________________________________________________
 HEDISStrucFunc::HEDISStrucFunc(SF_info sfinfo)
 {
 
   fSF = sfinfo;
+  fIsLoaded = false;
+
+  // Digest of the metadata, used to tag the binary tables and checkpoints
+  std::ostringstream meta;
+  meta << fSF;
+  TMD5 md5;
+  md5.Update( (const UChar_t *) meta.str().c_str(), meta.str().size() );
+  md5.Final();
+  fDigest = md5.AsString();
 
   string basedir = "";
   if ( gSystem->Getenv("HEDIS_SF_DATA_PATH")==NULL ) basedir = string(gSystem->Getenv("GENIE")) + "/data/evgen/hedis-sf";
@@ -182,15 +207,6 @@ HEDISStrucFunc::HEDISStrucFunc(SF_info sfinfo)
     LOG("HEDISStrucFunc", pDEBUG) << "x: " << sf_x_array.back();
   }
 
-  // Change to variables that are suitable for BLI2DNonUnifGrid
-  int nx = sf_q2_array.size();
-  int ny = sf_x_array.size();
-  double x[nx];
-  double y[ny];
-  double z[nx*ny];
-  for (int i=0; i<nx; i++) x[i] = sf_q2_array[i];
-  for (int j=0; j<ny; j++) y[j] = sf_x_array[j];
-  
   vector<InteractionType_t> inttype;
   inttype.push_back(kIntWeakCC);
   inttype.push_back(kIntWeakNC);
@@ -201,28 +217,26 @@ HEDISStrucFunc::HEDISStrucFunc(SF_info sfinfo)
   HEDISInteractionListGenerator * helist = new HEDISInteractionListGenerator();
   InteractionList * ilist = helist->CreateHEDISlist(init_state,inttype);
 
-  // Load structure functions for each quark at LO
+  // Compute missing structure functions for each quark at LO
+  vector<SFTableJob> qrk_jobs;
   for(InteractionList::iterator in=ilist->begin(); in!=ilist->end(); ++in) {
+    SFTableJob job;
+    job.in   = *in;
+    job.file = SFname + "/QrkSF_LO_" + QrkSFName(*in);
+    job.nlo  = false;
+    qrk_jobs.push_back(job);
+  }
+  fIsLoaded = this->BuildTables(qrk_jobs);
 
-    string sfFile = SFname + "/QrkSF_LO_" + QrkSFName(*in) + ".dat";
-    // Make sure data files are available
-    LOG("HEDISStrucFunc", pINFO) << "Checking if file " << sfFile << " exists...";        
-    if ( gSystem->AccessPathName( sfFile.c_str()) ) {
-      LOG("HEDISStrucFunc", pWARN) << "File doesnt exist. SF table will be computed.";        
-      CreateQrkSF( *in, sfFile );
-    }
-    else if ( atoi(gSystem->GetFromPipe(("wc -w "+sfFile+" | awk '{print $1}'").c_str()))!=kSFT3*nx*ny ) {
-      LOG("HEDISStrucFunc", pWARN) << "File does not contain all the need points. SF table will be recomputed.";        
-      gSystem->Exec(("rm "+sfFile).c_str());
-      CreateQrkSF( *in, sfFile );
-    }
-    std::ifstream sf_stream(sfFile.c_str(), std::ios::in);
-    // Loop over F1,F2,F3
-    for(int sf = 1; sf < kSFnumber; ++sf) {
-      // Loop over x/Q2 bins
-      for ( int ij=0; ij<nx*ny; ij++ ) sf_stream >> z[ij];
-      // Create SF tables with BLI2DNonUnifGrid using x,Q2 binning
-      fQrkSFLOTables[QrkSFCode(*in)].Table[(HEDISStrucFuncType_t)sf] = new genie::BLI2DNonUnifGrid( nx, ny, x, y, z );
+  // Load structure functions for each quark at LO
+  if (fIsLoaded) {
+    for(vector<SFTableJob>::const_iterator job=qrk_jobs.begin(); job!=qrk_jobs.end(); ++job) {
+      vector<double> sf;
+      if ( !this->ReadTable(job->file, sf) ) {
+        LOG("HEDISStrucFunc", pFATAL) << "Cannot read SF table " << job->file;
+        assert(0);
+      }
+      this->LoadTable( sf, fQrkSFLOTables[QrkSFCode(job->in)] );
     }
   }
 
@@ -268,71 +282,69 @@ HEDISStrucFunc::HEDISStrucFunc(SF_info sfinfo)
                   fSF.Vtd, fSF.Vts, fSF.Vtb);
 #endif
 
-    // Load structure functions for each quark at LO
+    // Compute missing structure functions for each nucleon at NLO
+    vector<SFTableJob> nuc_jobs;
     int nch = -1;
     for(InteractionList::iterator in=ilist->begin(); in!=ilist->end(); ++in) {
-
       if ( nch==NucSFCode(*in) ) continue;
       nch = NucSFCode(*in);
-      
-      string sfFile = SFname + "/NucSF_NLO_" + NucSFName(*in) + ".dat";
-      // Make sure data files are available
-      LOG("HEDISStrucFunc", pINFO) << "Checking if file " << sfFile << " exists...";        
-      if ( gSystem->AccessPathName( sfFile.c_str()) ) {
-#ifdef __GENIE_APFEL_ENABLED__
-        LOG("HEDISStrucFunc", pWARN) << "File doesnt exist. SF table will be computed.";        
-        CreateNucSF( *in, sfFile );
-#else
-        LOG("HEDISStrucFunc", pERROR) << "File doesnt exist. APFEL is needed for NLO SF";        
-        assert(0);
-#endif
-      }
-      else if ( atoi(gSystem->GetFromPipe(("wc -w "+sfFile+" | awk '{print $1}'").c_str()))!=kSFT3*nx*ny ) {
-#ifdef __GENIE_APFEL_ENABLED__
-        LOG("HEDISStrucFunc", pWARN) << "File does not contain all the need points. SF table will be recomputed.";        
-        gSystem->Exec(("rm "+sfFile).c_str());
-        CreateNucSF( *in, sfFile );
-#else
-        LOG("HEDISStrucFunc", pERROR) << "File does not contain all the need points. APFEL is needed for NLO SF";        
-        assert(0);
-#endif
-      }
-      std::ifstream sf_stream(sfFile.c_str(), std::ios::in);
-      // Loop over F1,F2,F3
-      for(int sf = 1; sf < kSFnumber; ++sf) {
-        // Loop over x/Q2 bins
-        for ( int ij=0; ij<nx*ny; ij++ ) sf_stream >> z[ij];
-        // Create SF tables with BLI2DNonUnifGrid using x,Q2 binning
-        fNucSFNLOTables[nch].Table[(HEDISStrucFuncType_t)sf] = new genie::BLI2DNonUnifGrid( nx, ny, x, y, z );
-      }        
-
-      //compute structure functions for each nucleon at LO using quark grids
-      LOG("HEDISStrucFunc", pDEBUG) << "Creating LO " << sfFile;              
-      vector <int> qcodes;
-      for(InteractionList::iterator in2=ilist->begin(); in2!=ilist->end(); ++in2) {
-        if (NucSFCode(*in2)==nch) qcodes.push_back(QrkSFCode(*in2));
-      }
-      // Loop over F1,F2,F3
-      for(int sf = 1; sf < kSFnumber; ++sf) {
+      SFTableJob job;
+      job.in   = *in;
+      job.file = SFname + "/NucSF_NLO_" + NucSFName(*in);
+      job.nlo  = true;
+      nuc_jobs.push_back(job);
+    }
+    bool nuc_loaded = this->BuildTables(nuc_jobs);
+    fIsLoaded = fIsLoaded && nuc_loaded;
+
+    if (fIsLoaded) {
+      int nx = sf_q2_array.size();
+      int ny = sf_x_array.size();
+      for(vector<SFTableJob>::const_iterator job=nuc_jobs.begin(); job!=nuc_jobs.end(); ++job) {
+
+        nch = NucSFCode(job->in);
+
+        // Load structure functions for each nucleon at NLO
+        vector<double> sf;
+        if ( !this->ReadTable(job->file, sf) ) {
+          LOG("HEDISStrucFunc", pFATAL) << "Cannot read SF table " << job->file;
+          assert(0);
+        }
+        this->LoadTable( sf, fNucSFNLOTables[nch] );
+
+        //compute structure functions for each nucleon at LO using quark grids
+        LOG("HEDISStrucFunc", pDEBUG) << "Creating LO " << job->file;
+        vector <int> qcodes;
+        for(InteractionList::iterator in2=ilist->begin(); in2!=ilist->end(); ++in2) {
+          if (NucSFCode(*in2)==nch) qcodes.push_back(QrkSFCode(*in2));
+        }
+        // Loop over F1,F2,F3
         int ij = 0;
-        // Loop over Q2 bins
-        for (int i=0; i<nx; i++) {
-          // Loop over x bins
-          for (int j=0; j<ny; j++) {
-            double sum = 0.;
-            // NucSF = sum_qrks QrkSF
-            for(vector<int>::const_iterator iq=qcodes.begin(); iq!=qcodes.end(); ++iq) 
-              sum += fQrkSFLOTables[*iq].Table[(HEDISStrucFuncType_t)sf]->Evaluate(x[i],y[j]);
-            z[ij] = sum;
-            ij++;
+        for(int isf = 1; isf < kSFnumber; ++isf) {
+          // Loop over Q2 bins
+          for (int i=0; i<nx; i++) {
+            // Loop over x bins
+            for (int j=0; j<ny; j++) {
+              double sum = 0.;
+              // NucSF = sum_qrks QrkSF
+              for(vector<int>::const_iterator iq=qcodes.begin(); iq!=qcodes.end(); ++iq) 
+                sum += fQrkSFLOTables[*iq].Table[(HEDISStrucFuncType_t)isf]->Evaluate(sf_q2_array[i],sf_x_array[j]);
+              sf[ij] = sum;
+              ij++;
+            }
           }
         }
-        // Create SF tables with BLI2DNonUnifGrid using x,Q2 binning
-        fNucSFLOTables[nch].Table[(HEDISStrucFuncType_t)sf] = new genie::BLI2DNonUnifGrid( nx, ny, x, y, z );
+        this->LoadTable( sf, fNucSFLOTables[nch] );
       }
     }
   }
-  
+
+  if (!fIsLoaded) {
+    LOG("HEDISStrucFunc", pWARN) << "SF tables are not complete: only the chunks assigned to job " 
+                                 << fgIJob << " (out of " << fgNJobs << ") were computed.";
+    LOG("HEDISStrucFunc", pWARN) << "Run the remaining jobs, or a single job, to complete the tables.";
+  }
+
   fgInstance = 0;
 
 }
@@ -352,10 +364,24 @@ HEDISStrucFunc * HEDISStrucFunc::Instance(SF_info sfinfo)
   }  
   return fgInstance;
 }
-
+//_________________________________________________________________________
+void HEDISStrucFunc::SetNWorkers( int nworkers )
+{
+  fgNWorkers = TMath::Max(1, nworkers);
+}
+//_________________________________________________________________________
+void HEDISStrucFunc::SetJobSplit( int ijob, int njobs )
+{
+  if ( njobs<1 || ijob<0 || ijob>=njobs ) {
+    LOG("HEDISStrucFunc", pFATAL) << "Invalid job split: " << ijob << "/" << njobs;
+    exit(1);
+  }
+  fgIJob  = ijob;
+  fgNJobs = njobs;
+}
 
 //____________________________________________________________________________
-void HEDISStrucFunc::CreateQrkSF( const Interaction * in, string sfFile ) 
+void HEDISStrucFunc::ComputeQrkSF( const Interaction * in, int i0, int i1, vector<double> & sf_values ) 
 {
 
   // variables used to tag the SF for particular channel
@@ -440,25 +466,27 @@ void HEDISStrucFunc::CreateQrkSF( const Interaction * in, string sfFile )
     else if ( pdg_iq==-5 &&  sea_iq && pdg_fq==-5 ) { qpdf1 = -5;                   Cp2 = c2d; Cp3 = -c3d; }
   }   
 
-  // open file in which SF will be stored
-  std::ofstream sf_stream(sfFile.c_str());
+  // SF are stored in F1,F2,F3 order, then Q2, then x
+  int ny = sf_x_array.size();
+  sf_values.assign( 3*(i1-i0)*ny, 0. );
+  int ij = 0;
 
   // loop over 3 different SF: F1,F2,F3
   for(int sf = 1; sf < 4; sf++) {
-    for ( unsigned int i=0; i<sf_q2_array.size(); i++ ) {
+    for ( int i=i0; i<i1; i++ ) {
       double Q2 = sf_q2_array[i];
-      for ( unsigned int j=0; j<sf_x_array.size(); j++ ) {
+      for ( int j=0; j<ny; j++ ) {
         double x = sf_x_array[j];
 
         double z = x; // this variable is introduce in case you want to apply scaling
 
         // W threshold
         if      (fSF.QrkThrs==1) { 
-            if ( Q2*(1/z-1)+mass_nucl*mass_nucl <= TMath::Power(mass_nucl+mPDFQrk[TMath::Abs(pdg_fq)],2) ) { sf_stream << 0. << "  "; continue; }
+            if ( Q2*(1/z-1)+mass_nucl*mass_nucl <= TMath::Power(mass_nucl+mPDFQrk[TMath::Abs(pdg_fq)],2) ) { sf_values[ij++] = 0.; continue; }
         } 
         // W threshold and slow rescaling
         else if (fSF.QrkThrs==2) {
-            if ( Q2*(1/z-1)+mass_nucl*mass_nucl <= TMath::Power(mass_nucl+mPDFQrk[TMath::Abs(pdg_fq)],2) ) { sf_stream << 0. << "  "; continue; }
+            if ( Q2*(1/z-1)+mass_nucl*mass_nucl <= TMath::Power(mass_nucl+mPDFQrk[TMath::Abs(pdg_fq)],2) ) { sf_values[ij++] = 0.; continue; }
             z *= 1+mPDFQrk[TMath::Abs(pdg_fq)]*mPDFQrk[TMath::Abs(pdg_fq)]/Q2;
         }
         // Slow rescaling
@@ -487,21 +515,18 @@ void HEDISStrucFunc::CreateQrkSF( const Interaction * in, string sfFile )
         else if ( sf==2 ) tmp = fPDF*Cp2*z;
         else if ( sf==3 ) tmp = fPDF*Cp3*sign3;
 
-        // Save SF for particular x and Q2 in file
+        // Save SF for particular x and Q2
         LOG("HEDISStrucFunc", pDEBUG) << "QrkSFLO" << sf << "[x=" << x << "," << Q2 << "] = " << tmp;
-        sf_stream << tmp << "  ";
+        sf_values[ij++] = tmp;
         
       }
     }
   }
 
-  // Close file in which SF are stored
-  sf_stream.close();
-
 }
 #ifdef __GENIE_APFEL_ENABLED__
 //____________________________________________________________________________
-void HEDISStrucFunc::CreateNucSF( const Interaction * in, string sfFile )
+void HEDISStrucFunc::ComputeNucSF( const Interaction * in, int i0, int i1, vector<double> & sf_values )
 {
 
   // variables used to tag the SF for particular channel
@@ -521,22 +546,22 @@ void HEDISStrucFunc::CreateNucSF( const Interaction * in, string sfFile )
 
   // Using APFEL format to store the SF grid
   int nx  = sf_x_array.size();
-  int nq2 = sf_q2_array.size();
-  double xlist[nx*nq2];
-  double q2list[nx*nq2];
-  double F2list[nx*nq2];
-  double FLlist[nx*nq2];
-  double xF3list[nx*nq2];
+  int nq2 = i1-i0;
+  vector<double> xlist(nx*nq2);
+  vector<double> q2list(nx*nq2);
+  vector<double> F2list(nx*nq2);
+  vector<double> FLlist(nx*nq2);
+  vector<double> xF3list(nx*nq2);
 
   int nlist = 0;
-  for ( unsigned int i=0; i<sf_q2_array.size(); i++ ) {
+  for ( int i=i0; i<i1; i++ ) {
     double Q2 = sf_q2_array[i];
     double Q  = TMath::Sqrt(Q2);
     // SF from APFEL are multiplied by a prefactor in NC. We dont want that prefactor
     double norm = iscc ? 1. : 2./TMath::Power( Q2/(Q2 + TMath::Power(APFEL::GetZMass(),2))/4/APFEL::GetSin2ThetaW()/(1-APFEL::GetSin2ThetaW()), 2 );
     APFEL::SetAlphaQCDRef(pdf->alphasQ(Q),Q);
     APFEL::ComputeStructureFunctionsAPFEL(Q,Q);
-    for ( unsigned int j=0; j<sf_x_array.size(); j++ ) {
+    for ( int j=0; j<nx; j++ ) {
       double x = sf_x_array[j];
       q2list[nlist]  = Q2;
       xlist[nlist]   = x;
@@ -547,8 +572,9 @@ void HEDISStrucFunc::CreateNucSF( const Interaction * in, string sfFile )
     }
   }
 
-  // open file in which SF will be stored
-  std::ofstream sf_stream(sfFile.c_str());
+  // SF are stored in F1,F2,F3 order, then Q2, then x
+  sf_values.assign( 3*nx*nq2, 0. );
+  int ij = 0;
 
   double sign3 = isnu ? +1. : -1.;  // sign change for nu/nubar in F3
   // loop over 3 different SF: F1,F2,F3
@@ -558,17 +584,310 @@ void HEDISStrucFunc::CreateNucSF( const Interaction * in, string sfFile )
       if      ( sf==1 ) tmp = (F2list[i]-FLlist[i])/2/xlist[i];
       else if ( sf==2 ) tmp = F2list[i];
       else if ( sf==3 ) tmp = sign3 * xF3list[i] / xlist[i];
-      // Save SF for particular x and Q2 in file
+      // Save SF for particular x and Q2
       LOG("HEDISStrucFunc", pDEBUG) << "NucSFNLO" << sf << "[x=" << xlist[i] << "," << q2list[i] << "] = " << tmp;
-      sf_stream << tmp << "  ";
+      sf_values[ij++] = tmp;
+    }
+  }
+
+}
+#endif
+//____________________________________________________________________________
+bool HEDISStrucFunc::BuildTables( const vector<SFTableJob> & jobs )
+{
+
+  // Find the missing tables and, for each of them, the chunks assigned to
+  // this job which are not available from a previous (interrupted) run
+  vector<int> missing;
+  vector< std::pair<int,int> > todo;
+  for ( unsigned int ij=0; ij<jobs.size(); ij++ ) {
+    LOG("HEDISStrucFunc", pINFO) << "Checking if table " << jobs[ij].file << " exists...";        
+    if ( this->HasTable(jobs[ij].file) ) continue;
+#ifndef __GENIE_APFEL_ENABLED__
+    if ( jobs[ij].nlo ) {
+      LOG("HEDISStrucFunc", pFATAL) << "Table doesnt exist. APFEL is needed for NLO SF";        
+      exit(1);
+    }
+#endif
+    LOG("HEDISStrucFunc", pWARN) << "Table doesnt exist. SF table will be computed.";        
+    missing.push_back(ij);
+    for ( int ic=0; ic<this->NChunks(); ic++ ) {
+      if ( ic%fgNJobs != fgIJob ) continue;
+      if ( this->HasChunk(jobs[ij].file, ic) ) continue;
+      todo.push_back( std::make_pair(ij,ic) );
+    }
+  }
+  if ( missing.empty() ) return true;
+
+  LOG("HEDISStrucFunc", pNOTICE) 
+    << "Computing " << todo.size() << " chunks (of " << kSFChunkRows << " Q2 rows) for " 
+    << missing.size() << " tables using " << fgNWorkers << " process(es)";
+
+  int nworkers = TMath::Min( fgNWorkers, (int)todo.size() );
+  if ( nworkers<=1 ) {
+    for ( unsigned int it=0; it<todo.size(); it++ ) {
+      if ( !this->ComputeChunk( jobs[todo[it].first], todo[it].second ) ) exit(1);
+    }
+  }
+  else {
+    // APFEL and LHAPDF5 keep their state in globals, so the chunks are
+    // shared among forked processes rather than threads
+    vector<pid_t> pids;
+    for ( int iw=0; iw<nworkers; iw++ ) {
+      std::cout.flush();
+      std::cerr.flush();
+      pid_t pid = fork();
+      if ( pid<0 ) {
+        LOG("HEDISStrucFunc", pFATAL) << "Cannot fork worker process " << iw;
+        exit(1);
+      }
+      if ( pid==0 ) {
+        bool ok = true;
+        for ( unsigned int it=iw; it<todo.size() && ok; it+=nworkers ) 
+          ok = this->ComputeChunk( jobs[todo[it].first], todo[it].second );
+        std::cout.flush();
+        std::cerr.flush();
+        _exit( ok ? 0 : 1 );
+      }
+      pids.push_back(pid);
+    }
+    bool ok = true;
+    for ( unsigned int iw=0; iw<pids.size(); iw++ ) {
+      int status = 0;
+      if ( waitpid(pids[iw], &status, 0)<0 || !WIFEXITED(status) || WEXITSTATUS(status)!=0 ) ok = false;
+    }
+    if ( !ok ) {
+      LOG("HEDISStrucFunc", pFATAL) << "A worker process failed.";
+      LOG("HEDISStrucFunc", pFATAL) << "Run again to resume from the chunks already computed.";
+      exit(1);
+    }
+  }
+
+  // Assemble the tables for which all chunks are available
+  bool complete = true;
+  int nsf = 3*sf_q2_array.size()*sf_x_array.size();
+  for ( unsigned int im=0; im<missing.size(); im++ ) {
+    const SFTableJob & job = jobs[missing[im]];
+    vector<double> sf(nsf, 0.);
+    bool ok = true;
+    for ( int ic=0; ic<this->NChunks() && ok; ic++ ) ok = this->ReadChunk(job.file, ic, &sf);
+    if ( !ok ) {
+      complete = false;
+      continue;
     }
+    if ( !this->WriteTable(job.file, sf) ) {
+      LOG("HEDISStrucFunc", pFATAL) << "Cannot write SF table " << job.file;
+      exit(1);
+    }
+    for ( int ic=0; ic<this->NChunks(); ic++ ) std::remove( this->ChunkName(job.file, ic).c_str() );
+    LOG("HEDISStrucFunc", pINFO) << "Table " << job.file << " completed";
   }
-    
-  // Close file in which SF are stored
-  sf_stream.close();
+
+  return complete;
 
 }
+//____________________________________________________________________________
+bool HEDISStrucFunc::ComputeChunk( const SFTableJob & job, int ichunk )
+{
+
+  int nx = sf_x_array.size();
+  int i0 = ichunk*kSFChunkRows;
+  int i1 = TMath::Min( i0+kSFChunkRows, (int)sf_q2_array.size() );
+
+  LOG("HEDISStrucFunc", pINFO) << "Computing Q2 rows [" << i0 << "," << i1 << ") of " << job.file;
+
+  vector<double> sf;
+  if ( job.nlo ) {
+#ifdef __GENIE_APFEL_ENABLED__
+    this->ComputeNucSF( job.in, i0, i1, sf );
 #endif
+  }
+  else this->ComputeQrkSF( job.in, i0, i1, sf );
+
+  // A chunk file is only written for a complete result, so that it is never
+  // mistaken for computed structure functions
+  if ( sf.size() != (unsigned int)(3*(i1-i0)*nx) ) {
+    LOG("HEDISStrucFunc", pFATAL) << "No structure functions computed for Q2 rows [" 
+      << i0 << "," << i1 << ") of " << job.file;
+    return false;
+  }
+
+  // Written in a temporary file, renamed once complete: a chunk file
+  // left by an interrupted run is either complete or absent
+  string name = this->ChunkName(job.file, ichunk);
+  string tmp  = name + ".tmp" + to_string(getpid());
+  std::ofstream out(tmp.c_str(), std::ios::binary);
+  int header[3] = { i0, i1, nx };
+  out.write( kSFChunkMagic, 8 );
+  out.write( fDigest.c_str(), fDigest.size() );
+  out.write( (const char *) header, sizeof(header) );
+  out.write( (const char *) &sf[0], sf.size()*sizeof(double) );
+  out.close();
+  if ( !out || std::rename(tmp.c_str(), name.c_str())!=0 ) {
+    LOG("HEDISStrucFunc", pFATAL) << "Cannot write checkpoint file " << name;
+    return false;
+  }
+  return true;
+
+}
+//____________________________________________________________________________
+int HEDISStrucFunc::NChunks( void ) const
+{
+  return (sf_q2_array.size() + kSFChunkRows - 1) / kSFChunkRows;
+}
+//____________________________________________________________________________
+string HEDISStrucFunc::ChunkName( string file, int ichunk ) const
+{
+  return file + ".chunk" + to_string(ichunk);
+}
+//____________________________________________________________________________
+bool HEDISStrucFunc::HasChunk( string file, int ichunk ) const
+{
+  return this->ReadChunk( file, ichunk, 0 );
+}
+//____________________________________________________________________________
+bool HEDISStrucFunc::ReadChunk( string file, int ichunk, vector<double> * sf ) const
+{
+
+  std::ifstream in( this->ChunkName(file, ichunk).c_str(), std::ios::binary );
+  if ( !in ) return false;
+
+  int nq2 = sf_q2_array.size();
+  int nx  = sf_x_array.size();
+  int i0  = ichunk*kSFChunkRows;
+  int i1  = TMath::Min( i0+kSFChunkRows, nq2 );
+
+  // Chunks computed for different metadata or binning are ignored
+  char magic[8];
+  string digest(fDigest.size(), ' ');
+  int header[3];
+  in.read( magic, 8 );
+  in.read( &digest[0], digest.size() );
+  in.read( (char *) header, sizeof(header) );
+  if ( !in || std::memcmp(magic, kSFChunkMagic, 8)!=0 || digest!=fDigest ) return false;
+  if ( header[0]!=i0 || header[1]!=i1 || header[2]!=nx ) return false;
+
+  vector<double> values( 3*(i1-i0)*nx );
+  in.read( (char *) &values[0], values.size()*sizeof(double) );
+  if ( !in ) return false;
+  if ( !sf ) return true;
+
+  int ij = 0;
+  for ( int isf=0; isf<3; isf++ ) 
+    for ( int i=i0; i<i1; i++ ) 
+      for ( int j=0; j<nx; j++ ) (*sf)[ (isf*nq2 + i)*nx + j ] = values[ij++];
+  return true;
+
+}
+//____________________________________________________________________________
+bool HEDISStrucFunc::HasTable( string file ) const
+{
+
+  int nq2 = sf_q2_array.size();
+  int nx  = sf_x_array.size();
+
+  // Binary table
+  std::ifstream in( (file+".bin").c_str(), std::ios::binary );
+  if ( in ) {
+    char magic[8];
+    string digest(fDigest.size(), ' ');
+    int header[2];
+    in.read( magic, 8 );
+    in.read( &digest[0], digest.size() );
+    in.read( (char *) header, sizeof(header) );
+    if ( in && std::memcmp(magic, kSFTableMagic, 8)==0 && digest==fDigest && header[0]==nq2 && header[1]==nx ) return true;
+    LOG("HEDISStrucFunc", pWARN) << "Binary table " << file << ".bin doesnt match the SF metadata. It will be ignored.";        
+  }
+
+  // ASCII table written by previous GENIE versions
+  string sfFile = file + ".dat";
+  if ( gSystem->AccessPathName( sfFile.c_str()) ) return false;
+  if ( atoi(gSystem->GetFromPipe(("wc -w "+sfFile+" | awk '{print $1}'").c_str()))!=kSFT3*nq2*nx ) {
+    LOG("HEDISStrucFunc", pWARN) << "File " << sfFile << " does not contain all the need points. SF table will be recomputed.";        
+    return false;
+  }
+  return true;
+
+}
+//____________________________________________________________________________
+bool HEDISStrucFunc::ReadTable( string file, vector<double> & sf ) const
+{
+
+  int nq2 = sf_q2_array.size();
+  int nx  = sf_x_array.size();
+  sf.assign( 3*nq2*nx, 0. );
+
+  // Binary table
+  std::ifstream in( (file+".bin").c_str(), std::ios::binary );
+  if ( in ) {
+    char magic[8];
+    string digest(fDigest.size(), ' ');
+    int header[2];
+    in.read( magic, 8 );
+    in.read( &digest[0], digest.size() );
+    in.read( (char *) header, sizeof(header) );
+    if ( in && std::memcmp(magic, kSFTableMagic, 8)==0 && digest==fDigest && header[0]==nq2 && header[1]==nx ) {
+      vector<double> q2(nq2), x(nx);
+      in.read( (char *) &q2[0], nq2*sizeof(double) );
+      in.read( (char *) &x[0],  nx*sizeof(double) );
+      in.read( (char *) &sf[0], sf.size()*sizeof(double) );
+      if ( in ) return true;
+    }
+  }
+
+  // ASCII table written by previous GENIE versions. It is converted to the
+  // binary format to speed up the next initialization.
+  std::ifstream sf_stream( (file+".dat").c_str(), std::ios::in );
+  if ( !sf_stream ) return false;
+  for ( unsigned int ij=0; ij<sf.size(); ij++ ) sf_stream >> sf[ij];
+  if ( !sf_stream ) return false;
+  if ( !this->WriteTable(file, sf) ) {
+    LOG("HEDISStrucFunc", pWARN) << "Cannot convert " << file << ".dat to the binary format";
+  }
+  return true;
+
+}
+//____________________________________________________________________________
+bool HEDISStrucFunc::WriteTable( string file, const vector<double> & sf ) const
+{
+
+  int header[2] = { (int)sf_q2_array.size(), (int)sf_x_array.size() };
+
+  string name = file + ".bin";
+  string tmp  = name + ".tmp" + to_string(getpid());
+  std::ofstream out(tmp.c_str(), std::ios::binary);
+  out.write( kSFTableMagic, 8 );
+  out.write( fDigest.c_str(), fDigest.size() );
+  out.write( (const char *) header, sizeof(header) );
+  out.write( (const char *) &sf_q2_array[0], sf_q2_array.size()*sizeof(double) );
+  out.write( (const char *) &sf_x_array[0],  sf_x_array.size()*sizeof(double) );
+  out.write( (const char *) &sf[0], sf.size()*sizeof(double) );
+  out.close();
+  if ( !out ) {
+    std::remove( tmp.c_str() );
+    return false;
+  }
+  return std::rename(tmp.c_str(), name.c_str())==0;
+
+}
+//____________________________________________________________________________
+void HEDISStrucFunc::LoadTable( const vector<double> & sf, HEDISStrucFuncTable & table ) const
+{
+
+  // Change to variables that are suitable for BLI2DNonUnifGrid
+  int nx = sf_q2_array.size();
+  int ny = sf_x_array.size();
+  vector<double> x(sf_q2_array);
+  vector<double> y(sf_x_array);
+  vector<double> z(sf);
+
+  // Loop over F1,F2,F3
+  for(int isf = 1; isf < kSFnumber; ++isf) {
+    // Create SF tables with BLI2DNonUnifGrid using x,Q2 binning
+    table.Table[(HEDISStrucFuncType_t)isf] = new genie::BLI2DNonUnifGrid( nx, ny, &x[0], &y[0], &z[(isf-1)*nx*ny] );
+  }
+
+}
 //____________________________________________________________________________
 string HEDISStrucFunc::QrkSFName( const Interaction * in) 
 {
@@ -5,6 +5,14 @@
 
 \brief    Singleton class to load Structure Functions used in HEDIS.
 
+          Missing tables are computed in chunks of Q2 rows. Each chunk is
+          saved in a checkpoint file as soon as it is computed, so that an
+          interrupted computation resumes from the chunks already available.
+          The chunks can be shared among several forked processes
+          (SetNWorkers) and among several jobs (SetJobSplit). Once all the
+          chunks of a table are available, the table is saved in a binary
+          file tagged with a digest of the SF_info metadata.
+
 \author   Alfonso Garcia <alfonsog \at nikhef.nl>
           NIKHEF
 
@@ -220,6 +228,15 @@ namespace genie {
 
       static HEDISStrucFunc * Instance(SF_info sfinfo);
 
+      // configuration of the SF table computation (call before Instance)
+      // nworkers    : number of forked processes computing the missing chunks
+      // ijob, njobs : only compute the chunks assigned to job ijob out of njobs
+      static void SetNWorkers ( int nworkers );
+      static void SetJobSplit ( int ijob, int njobs );
+
+      // false if some tables are still incomplete (split jobs)
+      bool IsLoaded (void) const { return fIsLoaded; }
+
       // method to return values of the SF for a particular channel in x and Q2
       SF_xQ2 EvalQrkSFLO  ( const Interaction * in, double x, double Q2 );
       SF_xQ2 EvalNucSFLO  ( const Interaction * in, double x, double Q2 ); 
@@ -232,8 +249,27 @@ namespace genie {
       HEDISStrucFunc(const HEDISStrucFunc &);
      ~HEDISStrucFunc();
 
-      void CreateQrkSF    ( const Interaction * in, string sfFile );
-      void CreateNucSF    ( const Interaction * in, string sfFile );
+      // a table to be computed and the file where it is (or will be) stored
+      struct SFTableJob {
+        const Interaction * in;
+        string              file;
+        bool                nlo;
+      };
+
+      // compute F1,F2,F3 for the Q2 rows [i0,i1)
+      void ComputeQrkSF   ( const Interaction * in, int i0, int i1, vector<double> & sf );
+      void ComputeNucSF   ( const Interaction * in, int i0, int i1, vector<double> & sf );
+
+      bool BuildTables    ( const vector<SFTableJob> & jobs );
+      bool ComputeChunk   ( const SFTableJob & job, int ichunk );
+      int  NChunks        ( void ) const;
+      string ChunkName    ( string file, int ichunk ) const;
+      bool HasChunk       ( string file, int ichunk ) const;
+      bool ReadChunk      ( string file, int ichunk, vector<double> * sf ) const;
+      bool HasTable       ( string file ) const;
+      bool ReadTable      ( string file, vector<double> & sf ) const;
+      bool WriteTable     ( string file, const vector<double> & sf ) const;
+      void LoadTable      ( const vector<double> & sf, HEDISStrucFuncTable & table ) const;
 
       string  QrkSFName ( const Interaction * in ); 
       string  NucSFName ( const Interaction * in ) ;
@@ -243,12 +279,19 @@ namespace genie {
       // Self
       static HEDISStrucFunc * fgInstance;
 
+      // configuration of the SF table computation
+      static int fgNWorkers;
+      static int fgIJob;
+      static int fgNJobs;
+
       // These map holds all SF tables (interaction channel is the key)
       map<int, HEDISStrucFuncTable> fQrkSFLOTables;
       map<int, HEDISStrucFuncTable> fNucSFLOTables;
       map<int, HEDISStrucFuncTable> fNucSFNLOTables;
 
       SF_info fSF;
+      string  fDigest;      // digest of the SF_info metadata
+      bool    fIsLoaded;
       vector<double> sf_x_array;
       vector<double> sf_q2_array;
 
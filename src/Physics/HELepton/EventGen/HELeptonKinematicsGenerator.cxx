@@ -132,6 +132,8 @@ void HELeptonKinematicsGenerator::ProcessEventRecord(GHepRecord * evrec) const
 
       accept = (t<xsec);
 
+      this->CountTrial(accept);
+
       //-- If the generated kinematics are accepted, finish-up module's job
       if(accept) {
         LOG("HELeptonKinematics", pINFO) << "Selected: n1 = " << n1 << ", n2 = " << n2 << ", n3 = " << n3;
@@ -190,6 +192,8 @@ void HELeptonKinematicsGenerator::ProcessEventRecord(GHepRecord * evrec) const
 
       accept = (t<xsec);
 
+      this->CountTrial(accept);
+
       //-- If the generated kinematics are accepted, finish-up module's job
       if(accept) {
         LOG("HELeptonKinematics", pINFO) << "Selected: n1 = " << n1 << ", n2 = " << n2;
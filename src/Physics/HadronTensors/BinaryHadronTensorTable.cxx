@@ -0,0 +1,333 @@
+//____________________________________________________________________________
+/*
+ Copyright (c) 2003-2023, The GENIE Collaboration
+ For the full text of the license visit http://copyright.genie-mc.org
+ or see $GENIE/LICENSE
+
+ Author: The GENIE Collaboration
+
+ For the class documentation see the corresponding header file.
+
+*/
+//____________________________________________________________________________
+
+// standard library includes
+#include <cstdio>
+#include <cstring>
+#include <fstream>
+#include <vector>
+
+// POSIX includes
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+
+// GENIE includes
+#include "Framework/Messenger/Messenger.h"
+#include "Physics/HadronTensors/BinaryHadronTensorTable.h"
+
+namespace {
+
+  /// Magic string stored in the first bytes of every binary table
+  const char kMagic[8] = { 'G', 'H', 'T', 'E', 'N', 'S', 'O', 'R' };
+
+  /// Current version of the binary format
+  const unsigned int kFormatVersion = 2;
+
+  /// Value stored in the header to detect files written on a machine
+  /// with a different byte order
+  const unsigned int kByteOrderMark = 0x01020304;
+
+  /// Maximum length (including the terminating null) of the tensor type name
+  const std::size_t kTypeNameLength = 32;
+
+  /// On-disk header. Its size is a multiple of 8 bytes so that the double
+  /// arrays following it are naturally aligned within the mapping.
+  struct BinaryHeader {
+    char         magic[8];
+    unsigned int version;
+    unsigned int byte_order;
+    int          Z;
+    int          A;
+    int          num_q0;
+    int          num_q_mag;
+    char         type_name[kTypeNameLength];
+    long long    source_size;   ///< size of the ASCII table (bytes)
+    long long    source_mtime;  ///< modification time of the ASCII table
+  };
+
+  /// Gets the size and modification time of a file. Returns false if the
+  /// file cannot be accessed.
+  bool source_stamp(const std::string& file_name, long long& size,
+    long long& mtime)
+  {
+    struct stat file_stat;
+    if ( stat(file_name.c_str(), &file_stat) != 0 ) return false;
+    size = static_cast<long long>(file_stat.st_size);
+    mtime = static_cast<long long>(file_stat.st_mtime);
+    return true;
+  }
+
+  /// Total number of doubles stored after the header
+  std::size_t num_payload_values(int num_q0, int num_q_mag) {
+    std::size_t n_grid = static_cast<std::size_t>(num_q0)
+      * static_cast<std::size_t>(num_q_mag);
+    return num_q0 + num_q_mag
+      + genie::BinaryHadronTensorTable::kNumComponents * n_grid;
+  }
+}
+
+//____________________________________________________________________________
+genie::BinaryHadronTensorTable::BinaryHadronTensorTable()
+  : fMapBase(0), fMapSize(0), fZ(0), fA(0), fTypeName(), fNumQ0(0),
+  fNumQMag(0), fQ0(0), fQMag(0)
+{
+  for (int c = 0; c < kNumComponents; ++c) fComp[c] = 0;
+}
+//____________________________________________________________________________
+genie::BinaryHadronTensorTable::~BinaryHadronTensorTable()
+{
+  this->Close();
+}
+//____________________________________________________________________________
+void genie::BinaryHadronTensorTable::Close(void)
+{
+  if ( fMapBase ) munmap(fMapBase, fMapSize);
+
+  fMapBase = 0;
+  fMapSize = 0;
+  fQ0 = 0;
+  fQMag = 0;
+  for (int c = 0; c < kNumComponents; ++c) fComp[c] = 0;
+}
+//____________________________________________________________________________
+bool genie::BinaryHadronTensorTable::Open(const std::string& file_name)
+{
+  this->Close();
+
+  int fd = open(file_name.c_str(), O_RDONLY);
+  if ( fd < 0 ) {
+    LOG("BinaryHadronTensorTable", pERROR) << "Unable to open the binary"
+      << " hadron tensor file " << file_name;
+    return false;
+  }
+
+  struct stat file_stat;
+  if ( fstat(fd, &file_stat) != 0
+    || file_stat.st_size < static_cast<off_t>(sizeof(BinaryHeader)) )
+  {
+    LOG("BinaryHadronTensorTable", pERROR) << "The binary hadron tensor"
+      << " file " << file_name << " is too short to contain a valid header";
+    close(fd);
+    return false;
+  }
+
+  std::size_t map_size = static_cast<std::size_t>(file_stat.st_size);
+
+  // Map the whole file read-only and shared: all processes reading the same
+  // table on a node are then backed by a single copy in the page cache.
+  void* base = mmap(0, map_size, PROT_READ, MAP_SHARED, fd, 0);
+
+  // The mapping remains valid after the descriptor is closed
+  close(fd);
+
+  if ( base == MAP_FAILED ) {
+    LOG("BinaryHadronTensorTable", pERROR) << "Unable to map the binary"
+      << " hadron tensor file " << file_name << " into memory";
+    return false;
+  }
+
+  const BinaryHeader* header = static_cast<const BinaryHeader*>(base);
+
+  bool ok = true;
+  if ( std::memcmp(header->magic, kMagic, sizeof(kMagic)) != 0 ) {
+    LOG("BinaryHadronTensorTable", pERROR) << file_name
+      << " is not a binary hadron tensor file";
+    ok = false;
+  }
+  else if ( header->byte_order != kByteOrderMark ) {
+    LOG("BinaryHadronTensorTable", pERROR) << "The binary hadron tensor"
+      << " file " << file_name << " was written with a different byte order";
+    ok = false;
+  }
+  else if ( header->version != kFormatVersion ) {
+    LOG("BinaryHadronTensorTable", pERROR) << "Unsupported binary hadron"
+      << " tensor format version " << header->version << " in " << file_name;
+    ok = false;
+  }
+  else if ( header->num_q0 < 2 || header->num_q_mag < 2 ) {
+    LOG("BinaryHadronTensorTable", pERROR) << "Invalid grid dimensions in"
+      << " the binary hadron tensor file " << file_name;
+    ok = false;
+  }
+  else {
+    std::size_t expected_size = sizeof(BinaryHeader) + sizeof(double)
+      * num_payload_values(header->num_q0, header->num_q_mag);
+    if ( map_size < expected_size ) {
+      LOG("BinaryHadronTensorTable", pERROR) << "The binary hadron tensor"
+        << " file " << file_name << " is truncated (expected "
+        << expected_size << " bytes, found " << map_size << ")";
+      ok = false;
+    }
+  }
+
+  if ( !ok ) {
+    munmap(base, map_size);
+    return false;
+  }
+
+  fMapBase = base;
+  fMapSize = map_size;
+
+  fZ = header->Z;
+  fA = header->A;
+  fNumQ0 = header->num_q0;
+  fNumQMag = header->num_q_mag;
+
+  char type_name[kTypeNameLength + 1];
+  std::memcpy(type_name, header->type_name, kTypeNameLength);
+  type_name[kTypeNameLength] = '\0';
+  fTypeName = type_name;
+
+  std::size_t n_grid = static_cast<std::size_t>(fNumQ0) * fNumQMag;
+
+  const double* payload = reinterpret_cast<const double*>(
+    static_cast<const char*>(base) + sizeof(BinaryHeader) );
+
+  fQ0 = payload;
+  fQMag = fQ0 + fNumQ0;
+  fComp[0] = fQMag + fNumQMag;
+  for (int c = 1; c < kNumComponents; ++c) fComp[c] = fComp[c - 1] + n_grid;
+
+  // Hint to the kernel that lookups will jump around the tables
+  madvise(base, map_size, MADV_RANDOM);
+
+  return true;
+}
+//____________________________________________________________________________
+bool genie::BinaryHadronTensorTable::IsBinaryTableFile(
+  const std::string& file_name)
+{
+  std::ifstream in_file(file_name.c_str(), std::ios::in | std::ios::binary);
+  if ( !in_file.good() ) return false;
+
+  char magic[sizeof(kMagic)];
+  in_file.read(magic, sizeof(magic));
+  if ( in_file.gcount() != static_cast<std::streamsize>(sizeof(magic)) ) {
+    return false;
+  }
+
+  return std::memcmp(magic, kMagic, sizeof(kMagic)) == 0;
+}
+//____________________________________________________________________________
+bool genie::BinaryHadronTensorTable::MatchesSource(
+  const std::string& file_name, const std::string& source_file_name)
+{
+  std::ifstream in_file(file_name.c_str(), std::ios::in | std::ios::binary);
+  if ( !in_file.good() ) return false;
+
+  BinaryHeader header;
+  in_file.read(reinterpret_cast<char*>(&header), sizeof(header));
+  if ( in_file.gcount() != static_cast<std::streamsize>(sizeof(header)) ) {
+    return false;
+  }
+
+  if ( std::memcmp(header.magic, kMagic, sizeof(kMagic)) != 0
+    || header.byte_order != kByteOrderMark
+    || header.version != kFormatVersion ) return false;
+
+  long long size = 0;
+  long long mtime = 0;
+  if ( !source_stamp(source_file_name, size, mtime) ) return false;
+
+  return header.source_size == size && header.source_mtime == mtime;
+}
+//____________________________________________________________________________
+bool genie::BinaryHadronTensorTable::Write(const std::string& file_name,
+  const std::string& source_file_name, int Z, int A, const std::string& type_name, int num_q0, int num_q_mag,
+  const double* q0, const double* q_mag,
+  const double* const comp[kNumComponents])
+{
+  if ( type_name.size() >= kTypeNameLength ) {
+    LOG("BinaryHadronTensorTable", pWARN) << "Hadron tensor type name \""
+      << type_name << "\" will be truncated to " << kTypeNameLength - 1
+      << " characters";
+  }
+
+  BinaryHeader header;
+  std::memset(&header, 0, sizeof(header));
+  std::memcpy(header.magic, kMagic, sizeof(kMagic));
+  header.version = kFormatVersion;
+  header.byte_order = kByteOrderMark;
+  header.Z = Z;
+  header.A = A;
+  header.num_q0 = num_q0;
+  header.num_q_mag = num_q_mag;
+  std::strncpy(header.type_name, type_name.c_str(), kTypeNameLength - 1);
+
+  if ( !source_stamp(source_file_name, header.source_size,
+    header.source_mtime) )
+  {
+    LOG("BinaryHadronTensorTable", pERROR) << "Unable to access the ASCII"
+      << " hadron tensor table " << source_file_name;
+    return false;
+  }
+
+  // Write to a temporary file first and rename it when complete so that
+  // concurrent readers never see a partially written table. The temporary
+  // file name is unique so that parallel jobs building the same table do
+  // not write to the same file.
+  std::string tmp_file_name = file_name + ".tmp.XXXXXX";
+  std::vector<char> tmp_name_buf(tmp_file_name.begin(), tmp_file_name.end());
+  tmp_name_buf.push_back('\0');
+
+  int fd = mkstemp( &tmp_name_buf[0] );
+  if ( fd < 0 ) {
+    LOG("BinaryHadronTensorTable", pERROR) << "Unable to create a temporary"
+      << " file for " << file_name;
+    return false;
+  }
+  // mkstemp creates the file readable by its owner only
+  fchmod(fd, S_IRUSR | S_IWUSR | S_IRGRP | S_IROTH);
+  close(fd);
+  tmp_file_name = &tmp_name_buf[0];
+
+  std::ofstream out_file(tmp_file_name.c_str(),
+    std::ios::out | std::ios::binary | std::ios::trunc);
+
+  if ( !out_file.good() ) {
+    std::remove(tmp_file_name.c_str());
+    LOG("BinaryHadronTensorTable", pERROR) << "Unable to open "
+      << tmp_file_name << " for writing";
+    return false;
+  }
+
+  std::size_t n_grid = static_cast<std::size_t>(num_q0) * num_q_mag;
+
+  out_file.write(reinterpret_cast<const char*>(&header), sizeof(header));
+  out_file.write(reinterpret_cast<const char*>(q0), num_q0 * sizeof(double));
+  out_file.write(reinterpret_cast<const char*>(q_mag),
+    num_q_mag * sizeof(double));
+  for (int c = 0; c < kNumComponents; ++c) {
+    out_file.write(reinterpret_cast<const char*>(comp[c]),
+      n_grid * sizeof(double));
+  }
+  out_file.close();
+
+  if ( out_file.fail() ) {
+    LOG("BinaryHadronTensorTable", pERROR) << "Error while writing "
+      << tmp_file_name;
+    std::remove(tmp_file_name.c_str());
+    return false;
+  }
+
+  if ( std::rename(tmp_file_name.c_str(), file_name.c_str()) != 0 ) {
+    LOG("BinaryHadronTensorTable", pERROR) << "Unable to rename "
+      << tmp_file_name << " to " << file_name;
+    std::remove(tmp_file_name.c_str());
+    return false;
+  }
+
+  return true;
+}
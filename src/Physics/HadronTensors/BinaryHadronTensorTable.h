@@ -0,0 +1,137 @@
+//____________________________________________________________________________
+/*!
+
+\class    genie::BinaryHadronTensorTable
+
+\brief    Read-only view of a hadron tensor table stored in the GENIE binary
+          hadron tensor format.
+
+\details  The binary format is a sidecar to the ASCII tables used by
+          genie::TabulatedLabFrameHadronTensor. It consists of a fixed-size
+          header followed by contiguous arrays of doubles:
+
+            * the \f$q_0\f$ axis (num_q0 values)
+            * the \f$\left|\overrightarrow{q}\right|\f$ axis (num_q_mag values)
+            * the W00, ReW0z, Wxx, ImWxy and Wzz tables, each stored as a
+              separate array of num_q0 * num_q_mag values in row-major
+              (q0, q_mag) order
+
+          Files are opened with mmap(2) so that the page cache is shared
+          between all processes reading the same table, and no copy of the
+          tensor values is made on the heap. The binary files are produced
+          from the ASCII tables by the ghadtens2bin utility.
+
+          The header records the size and modification time of the ASCII
+          table the file was made from, so that a sidecar left behind after
+          the ASCII table is updated can be detected (see MatchesSource).
+
+\author   The GENIE Collaboration
+
+\created  October 16, 2026
+
+\cpright  Copyright (c) 2003-2023, The GENIE Collaboration
+          For the full text of the license visit http://copyright.genie-mc.org
+          or see $GENIE/LICENSE
+*/
+//____________________________________________________________________________
+
+#ifndef _BINARY_HADRON_TENSOR_TABLE_H_
+#define _BINARY_HADRON_TENSOR_TABLE_H_
+
+// standard library includes
+#include <cstddef>
+#include <string>
+
+namespace genie {
+
+class BinaryHadronTensorTable {
+
+public:
+
+  /// Index of each tabulated tensor component in the binary file
+  enum EComponent {
+    kW00 = 0,
+    kReW0z,
+    kWxx,
+    kImWxy,
+    kWzz,
+    kNumComponents
+  };
+
+  BinaryHadronTensorTable();
+  ~BinaryHadronTensorTable();
+
+  /// Maps the requested binary table file into memory. Returns false (and
+  /// leaves the object closed) if the file could not be opened or does not
+  /// have a valid header.
+  bool Open(const std::string& file_name);
+
+  /// Unmaps the file (if any)
+  void Close(void);
+
+  inline bool IsOpen(void) const { return fMapBase != 0; }
+
+  inline int Z(void) const { return fZ; }
+  inline int A(void) const { return fA; }
+  inline const std::string& TypeName(void) const { return fTypeName; }
+
+  inline int NumQ0(void) const { return fNumQ0; }
+  inline int NumQMag(void) const { return fNumQMag; }
+
+  /// Pointer to the first element of the \f$q_0\f$ axis
+  inline const double* Q0(void) const { return fQ0; }
+
+  /// Pointer to the first element of the
+  /// \f$\left|\overrightarrow{q}\right|\f$ axis
+  inline const double* QMag(void) const { return fQMag; }
+
+  /// Pointer to the first element of the table for a given tensor component
+  inline const double* Component(EComponent c) const { return fComp[c]; }
+
+  /// Returns true if the file exists and starts with the magic string used
+  /// by the binary hadron tensor format
+  static bool IsBinaryTableFile(const std::string& file_name);
+
+  /// Returns true if the binary table file was made from the current
+  /// version of the ASCII table source_file_name, i.e., if the size and
+  /// modification time stored in its header match those of the ASCII file
+  static bool MatchesSource(const std::string& file_name,
+    const std::string& source_file_name);
+
+  /// Writes a binary hadron tensor table file. The component arrays must
+  /// each contain num_q0 * num_q_mag values in row-major (q0, q_mag) order.
+  /// The size and modification time of the ASCII table source_file_name
+  /// are stored in the header.
+  static bool Write(const std::string& file_name,
+    const std::string& source_file_name, int Z, int A,
+    const std::string& type_name, int num_q0, int num_q_mag,
+    const double* q0, const double* q_mag,
+    const double* const comp[kNumComponents]);
+
+  /// Suffix appended to the name of an ASCII table to obtain the name of the
+  /// corresponding binary sidecar file
+  static const char* FileSuffix(void) { return ".bin"; }
+
+private:
+
+  // Copying would leave two objects owning the same mapping
+  BinaryHadronTensorTable(const BinaryHadronTensorTable&);
+  BinaryHadronTensorTable& operator=(const BinaryHadronTensorTable&);
+
+  void*       fMapBase;   ///< start of the mapped region
+  std::size_t fMapSize;   ///< length of the mapped region (bytes)
+
+  int         fZ;
+  int         fA;
+  std::string fTypeName;
+  int         fNumQ0;
+  int         fNumQMag;
+
+  const double* fQ0;
+  const double* fQMag;
+  const double* fComp[kNumComponents];
+};
+
+} // namespace genie
+
+#endif // _BINARY_HADRON_TENSOR_TABLE_H_
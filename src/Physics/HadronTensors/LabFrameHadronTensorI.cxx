@@ -8,6 +8,16 @@
 #include "Framework/Messenger/Messenger.h"
 #include "Physics/HadronTensors/LabFrameHadronTensorI.h"
 
+void genie::LabFrameHadronTensorI::elements(double q0, double q_mag,
+  Elements& elem) const
+{
+  elem.W00   = this->tt(q0, q_mag).real();
+  elem.ReW0z = this->tz(q0, q_mag).real();
+  elem.Wxx   = this->xx(q0, q_mag).real();
+  elem.ImWxy = this->xy(q0, q_mag).imag();
+  elem.Wzz   = this->zz(q0, q_mag).real();
+}
+
 double genie::LabFrameHadronTensorI::contraction(
   const Interaction* interaction, double Q_value) const
 {
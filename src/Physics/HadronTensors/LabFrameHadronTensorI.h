@@ -134,6 +134,26 @@ public:
 
   /// @}
 
+  /// Values of the tensor elements that may be nonzero in the lab frame
+  /// with \f$\overrightarrow{q}\f$ along the z axis (up to hermiticity)
+  struct Elements {
+    double W00;   ///< \f$W^{00}\f$
+    double ReW0z; ///< \f$\Re W^{0z}\f$
+    double Wxx;   ///< \f$W^{xx} = W^{yy}\f$
+    double ImWxy; ///< \f$\Im W^{xy}\f$
+    double Wzz;   ///< \f$W^{zz}\f$
+  };
+
+  /// Evaluates all of the independent tensor elements at once. The default
+  /// implementation calls the individual element functions, but tabulated
+  /// tensors override it to share a single grid lookup and interpolation
+  /// between all elements.
+  /// \param[in] q0 The energy transfer \f$q^0\f$ in the lab frame (GeV)
+  /// \param[in] q_mag The magnitude of the 3-momentum transfer
+  /// \f$\left|\overrightarrow{q}\right|\f$ in the lab frame (GeV)
+  /// \param[out] elem The tensor elements
+  virtual void elements(double q0, double q_mag, Elements& elem) const;
+
   /// \name Structure functions
   /// \param[in] q0 The energy transfer \f$q^0\f$ in the lab frame (GeV)
   /// \param[in] q_mag The magnitude of the 3-momentum transfer
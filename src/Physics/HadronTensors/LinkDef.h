@@ -9,6 +9,7 @@
 #pragma link C++ class genie::HadronTensorI;
 #pragma link C++ class genie::LabFrameHadronTensorI;
 #pragma link C++ class genie::TabulatedLabFrameHadronTensor;
+#pragma link C++ class genie::BinaryHadronTensorTable;
 
 #pragma link C++ class genie::HadronTensorModelI;
 #pragma link C++ class genie::TabulatedHadronTensorModelI;
@@ -19,6 +19,7 @@
 
 // GENIE includes
 #include "Framework/Messenger/Messenger.h"
+#include "Physics/HadronTensors/BinaryHadronTensorTable.h"
 #include "Physics/HadronTensors/TabulatedHadronTensorModelI.h"
 #include "Physics/HadronTensors/TabulatedLabFrameHadronTensor.h"
 #include "Physics/HadronTensors/HadronTensorI.h"
@@ -223,6 +224,7 @@ void genie::TabulatedHadronTensorModelI::Configure(std::string config)
 void genie::TabulatedHadronTensorModelI::LoadConfig(void)
 {
   GetParamDef( "WarnIfMissing", fWarnIfMissing, true );
+  GetParamDef( "PreferBinaryTables", fPreferBinaryTables, true );
 
   // Either a data path relative to the root GENIE folder
   // or an absolute path can be used. Find out which
@@ -283,6 +285,26 @@ std::string genie::TabulatedHadronTensorModelI::FindTensorTableFile(
   for (size_t p = 0; p < fDataPaths.size(); ++p) {
     const std::string& path = fDataPaths.at( p );
     std::string full_name = path + '/' + basename;
+
+    // Use the binary version of the table if one has been made. It is
+    // memory-mapped rather than parsed, which is much faster to load.
+    // A sidecar made from a different version of the ASCII table is stale
+    // and is ignored.
+    if ( fPreferBinaryTables ) {
+      std::string binary_name = full_name
+        + BinaryHadronTensorTable::FileSuffix();
+      if ( file_exists(binary_name) ) {
+        if ( !file_exists(full_name) ) return binary_name;
+        if ( BinaryHadronTensorTable::MatchesSource(binary_name, full_name) ) {
+          return binary_name;
+        }
+        LOG("TabulatedHadronTensorModelI", pWARN) << "The binary hadron"
+          << " tensor table " << binary_name << " does not match "
+          << full_name << " - Using the ASCII table (rerun ghadtens2bin"
+          << " to update it)";
+      }
+    }
+
     if ( file_exists(full_name) ) return full_name;
   }
 
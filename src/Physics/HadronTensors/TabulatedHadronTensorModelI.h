@@ -76,6 +76,10 @@ protected:
   /// file cannot be found
   bool fWarnIfMissing;
 
+  /// If true, a binary sidecar table (see genie::BinaryHadronTensorTable)
+  /// will be loaded in place of the ASCII table whenever one is available
+  bool fPreferBinaryTables;
+
   /// Cache of hadron tensor objects that have been fully loaded into memory
   ///
   /// Keys are tensor IDs, values are pointers to hadron tensor objects
@@ -1,5 +1,7 @@
 // standard library includes
+#include <algorithm>
 #include <cmath>
+#include <cstdlib>
 #include <fstream>
 
 // GENIE includes
@@ -34,86 +36,179 @@ namespace {
 }
 
 genie::TabulatedLabFrameHadronTensor::TabulatedLabFrameHadronTensor(
+  const std::string& table_file_name) : fTypeName(), fNumQ0(0), fNumQMag(0),
+  fQ0(0), fQMag(0), fOwnedData(), fBinaryTable(), fGrid()
+{
+  for (int c = 0; c < BinaryHadronTensorTable::kNumComponents; ++c) {
+    fComp[c] = 0;
+  }
+
+  if ( BinaryHadronTensorTable::IsBinaryTableFile(table_file_name) ) {
+    this->ReadBinaryTable( table_file_name );
+  }
+  else {
+    this->ReadTextTable( table_file_name );
+  }
+
+  fGrid.set_grid(fNumQ0, fQ0, fNumQMag, fQMag, fComp);
+
+  LOG("TabulatedLabFrameHadronTensor", pINFO) << "Loaded hadron tensor table "
+    << table_file_name << " (Z = " << this->Z() << ", A = " << this->A()
+    << ", type = " << fTypeName << ", num_q0 = " << fNumQ0
+    << ", num_q_mag = " << fNumQMag << ")";
+}
+
+void genie::TabulatedLabFrameHadronTensor::ReadTextTable(
   const std::string& table_file_name)
-  : fGrid(&fq0Points, &fqmagPoints, &fEntries)
 {
   // Read in the table
   std::ifstream in_file( table_file_name.c_str() );
 
+  if ( !in_file.good() ) {
+    LOG("TabulatedLabFrameHadronTensor", pFATAL) << "Unable to open the"
+      << " hadron tensor table " << table_file_name;
+    std::exit(1);
+  }
 
   // Skip the initial comment line
   std::string dummy;
   std::getline(in_file, dummy);
 
-  /// \todo Add error checks
-  std::string type_name;
   int Z, A, num_q0, num_q_mag;
+  in_file >> Z >> A >> fTypeName >> num_q0 >> num_q_mag;
 
-  /// \todo Use type name
-  in_file >> Z >> A >> type_name >> num_q0 >> num_q_mag;
+  std::vector<double> q0_points, q_mag_points;
 
   int q0_flag;
   in_file >> q0_flag;
-  read1DGridValues(num_q0, q0_flag, in_file, fq0Points);
+  read1DGridValues(num_q0, q0_flag, in_file, q0_points);
 
   int q_mag_flag;
   in_file >> q_mag_flag;
-  read1DGridValues(num_q_mag, q_mag_flag, in_file, fqmagPoints);
+  read1DGridValues(num_q_mag, q_mag_flag, in_file, q_mag_points);
+
+  if ( in_file.fail() || q0_points.size() < 2 || q_mag_points.size() < 2 ) {
+    LOG("TabulatedLabFrameHadronTensor", pFATAL) << "Invalid header in the"
+      << " hadron tensor table " << table_file_name;
+    std::exit(1);
+  }
 
   set_pdg( genie::pdg::IonPdgCode(A, Z) );
 
-  std::cout<< "TabulatedLabFrameHadronTensor: reading hadron tensor table" << std::endl;
-  std::cout<< "table_file_name:  " << table_file_name << std::endl;
-  std::cout<< "Z:                " << Z << std::endl;
-  std::cout<< "A:                " << A << std::endl;
-  std::cout<< "num_q0:           " << num_q0 << std::endl;
-  std::cout<< "num_q_mag:        " << num_q_mag << std::endl;
+  fNumQ0 = num_q0;
+  fNumQMag = num_q_mag;
 
-  double W00, ReW0z, Wxx, ImWxy, Wzz;
-  int lineCount=1;
+  // Lay out the owned storage in the same way as the binary format:
+  // the two axes followed by one contiguous array per tensor element
+  size_t n_grid = static_cast<size_t>(num_q0) * num_q_mag;
+  fOwnedData.resize( num_q0 + num_q_mag
+    + BinaryHadronTensorTable::kNumComponents * n_grid );
 
-  for (long j = 0; j < num_q0; ++j) {
-    for (long k = 0; k < num_q_mag; ++k) {
+  double* q0_data = &fOwnedData[0];
+  double* q_mag_data = q0_data + num_q0;
+  std::copy(q0_points.begin(), q0_points.end(), q0_data);
+  std::copy(q_mag_points.begin(), q_mag_points.end(), q_mag_data);
 
-      fEntries.push_back( TableEntry() );
-      TableEntry& entry = fEntries.back();
+  double* comp[ BinaryHadronTensorTable::kNumComponents ];
+  comp[0] = q_mag_data + num_q_mag;
+  for (int c = 1; c < BinaryHadronTensorTable::kNumComponents; ++c) {
+    comp[c] = comp[c - 1] + n_grid;
+  }
 
-      // in_file >> entry.W00 >> entry.ReW0z >> entry.Wxx
-      //   >> entry.ImWxy >> entry.Wzz;
+  // Each line of the table holds W00, ReW0z, Wxx, ImWxy, and Wzz (the same
+  // order as the BinaryHadronTensorTable::EComponent enum)
+  for (size_t i = 0; i < n_grid; ++i) {
+    for (int c = 0; c < BinaryHadronTensorTable::kNumComponents; ++c) {
+      in_file >> comp[c][i];
+    }
+  }
 
-      in_file >> W00 >> ReW0z >> Wxx >> ImWxy >> Wzz;
+  if ( in_file.fail() ) {
+    LOG("TabulatedLabFrameHadronTensor", pFATAL) << "The hadron tensor table "
+      << table_file_name << " ended before all " << n_grid
+      << " grid points could be read";
+    std::exit(1);
+  }
 
-      entry.W00  = W00;
-      entry.ReW0z= ReW0z;
-      entry.Wxx  = Wxx;
-      entry.ImWxy= ImWxy;
-      entry.Wzz  = Wzz;
+  fQ0 = q0_data;
+  fQMag = q_mag_data;
+  for (int c = 0; c < BinaryHadronTensorTable::kNumComponents; ++c) {
+    fComp[c] = comp[c];
+  }
+}
 
-      //if(W00 > 0.0) {
-      //  std::cout<< "line count is" << lineCount << std::endl;
-      //  std::cout<< "Entry: " << entry.W00 << " " << entry.ReW0z << " " << entry.Wxx << " " << entry.ImWxy << " " << entry.Wzz << std::endl;
-      //  std::cout<< "File:  " << W00 << " " << ReW0z << " " << Wxx << " " << ImWxy << " " << Wzz << std::endl;
-      //}
-      lineCount++;
-    }
+void genie::TabulatedLabFrameHadronTensor::ReadBinaryTable(
+  const std::string& table_file_name)
+{
+  if ( !fBinaryTable.Open(table_file_name) ) {
+    LOG("TabulatedLabFrameHadronTensor", pFATAL) << "Unable to load the"
+      << " binary hadron tensor table " << table_file_name;
+    std::exit(1);
   }
+
+  set_pdg( genie::pdg::IonPdgCode(fBinaryTable.A(), fBinaryTable.Z()) );
+
+  fTypeName = fBinaryTable.TypeName();
+  fNumQ0 = fBinaryTable.NumQ0();
+  fNumQMag = fBinaryTable.NumQMag();
+  fQ0 = fBinaryTable.Q0();
+  fQMag = fBinaryTable.QMag();
+  for (int c = 0; c < BinaryHadronTensorTable::kNumComponents; ++c) {
+    fComp[c] = fBinaryTable.Component(
+      static_cast<BinaryHadronTensorTable::EComponent>(c) );
+  }
+}
+
+bool genie::TabulatedLabFrameHadronTensor::WriteBinaryTable(
+  const std::string& file_name, const std::string& source_file_name) const
+{
+  return BinaryHadronTensorTable::Write(file_name, source_file_name,
+    this->Z(), this->A(), fTypeName, fNumQ0, fNumQMag, fQ0, fQMag, fComp);
 }
 
 genie::TabulatedLabFrameHadronTensor::~TabulatedLabFrameHadronTensor()
 {
 }
 
+genie::TabulatedLabFrameHadronTensor::TableEntry
+  genie::TabulatedLabFrameHadronTensor::Interpolate(double q0,
+  double q_mag) const
+{
+  double result[ BinaryHadronTensorTable::kNumComponents ];
+  fGrid.interpolate(q0, q_mag, result);
+
+  TableEntry entry;
+  entry.W00   = result[ BinaryHadronTensorTable::kW00 ];
+  entry.ReW0z = result[ BinaryHadronTensorTable::kReW0z ];
+  entry.Wxx   = result[ BinaryHadronTensorTable::kWxx ];
+  entry.ImWxy = result[ BinaryHadronTensorTable::kImWxy ];
+  entry.Wzz   = result[ BinaryHadronTensorTable::kWzz ];
+
+  return entry;
+}
+
+void genie::TabulatedLabFrameHadronTensor::elements(double q0, double q_mag,
+  Elements& elem) const
+{
+  TableEntry entry = this->Interpolate(q0, q_mag);
+  elem.W00   = entry.W00;
+  elem.ReW0z = entry.ReW0z;
+  elem.Wxx   = entry.Wxx;
+  elem.ImWxy = entry.ImWxy;
+  elem.Wzz   = entry.Wzz;
+}
+
 std::complex<double> genie::TabulatedLabFrameHadronTensor::tt(
   double q0, double q_mag) const
 {
-  TableEntry entry = fGrid.interpolate(q0, q_mag);
+  TableEntry entry = this->Interpolate(q0, q_mag);
   return std::complex<double>(entry.W00, 0.);
 }
 
 std::complex<double> genie::TabulatedLabFrameHadronTensor::tz(
   double q0, double q_mag) const
 {
-  TableEntry entry = fGrid.interpolate(q0, q_mag);
+  TableEntry entry = this->Interpolate(q0, q_mag);
   // Currently only the real part of W0z is tabulated
   /// \todo Think about adding the imaginary part even though it's not needed
   /// for the cross section calculation
@@ -123,14 +218,14 @@ std::complex<double> genie::TabulatedLabFrameHadronTensor::tz(
 std::complex<double> genie::TabulatedLabFrameHadronTensor::xx(
   double q0, double q_mag) const
 {
-  TableEntry entry = fGrid.interpolate(q0, q_mag);
+  TableEntry entry = this->Interpolate(q0, q_mag);
   return std::complex<double>(entry.Wxx, 0.);
 }
 
 std::complex<double> genie::TabulatedLabFrameHadronTensor::xy(
   double q0, double q_mag) const
 {
-  TableEntry entry = fGrid.interpolate(q0, q_mag);
+  TableEntry entry = this->Interpolate(q0, q_mag);
   // The Wxy element is purely imaginary
   return std::complex<double>(0., entry.ImWxy);
 }
@@ -138,7 +233,7 @@ std::complex<double> genie::TabulatedLabFrameHadronTensor::xy(
 std::complex<double> genie::TabulatedLabFrameHadronTensor::zz(
   double q0, double q_mag) const
 {
-  TableEntry entry = fGrid.interpolate(q0, q_mag);
+  TableEntry entry = this->Interpolate(q0, q_mag);
   // The Wxy element is purely imaginary
   return std::complex<double>(entry.Wzz, 0.);
 }
@@ -146,35 +241,35 @@ std::complex<double> genie::TabulatedLabFrameHadronTensor::zz(
 double genie::TabulatedLabFrameHadronTensor::W1(double q0,
   double q_mag, double Mi) const
 {
-  TableEntry entry = fGrid.interpolate(q0, q_mag);
+  TableEntry entry = this->Interpolate(q0, q_mag);
   return W1(q0, q_mag, entry) / Mi;
 }
 
 double genie::TabulatedLabFrameHadronTensor::W2(double q0,
   double q_mag, double Mi) const
 {
-  TableEntry entry = fGrid.interpolate(q0, q_mag);
+  TableEntry entry = this->Interpolate(q0, q_mag);
   return W2(q0, q_mag, entry) / Mi;
 }
 
 double genie::TabulatedLabFrameHadronTensor::W3(double q0,
   double q_mag, double /*Mi*/) const
 {
-  TableEntry entry = fGrid.interpolate(q0, q_mag);
+  TableEntry entry = this->Interpolate(q0, q_mag);
   return W3(q0, q_mag, entry);
 }
 
 double genie::TabulatedLabFrameHadronTensor::W4(double q0,
   double q_mag, double Mi) const
 {
-  TableEntry entry = fGrid.interpolate(q0, q_mag);
+  TableEntry entry = this->Interpolate(q0, q_mag);
   return W4(q0, q_mag, entry) * Mi;
 }
 
 double genie::TabulatedLabFrameHadronTensor::W5(double q0,
   double q_mag, double /*Mi*/) const
 {
-  TableEntry entry = fGrid.interpolate(q0, q_mag);
+  TableEntry entry = this->Interpolate(q0, q_mag);
   return W5(q0, q_mag, entry);
 }
 
@@ -302,7 +397,7 @@ double genie::TabulatedLabFrameHadronTensor::dSigma_dT_dCosTheta(int probe_pdg,
 
   // Find the appropriate values of the hadron tensor elements for the
   // given combination of q0_corrected and q_mag
-  TableEntry entry = fGrid.interpolate(q0_corrected, q_mag);
+  TableEntry entry = this->Interpolate(q0_corrected, q_mag);
 
   // The half-angle formulas come in handy here. See, e.g.,
   // http://mathworld.wolfram.com/Half-AngleFormulas.html
@@ -411,7 +506,7 @@ double genie::TabulatedLabFrameHadronTensor::dSigma_dT_dCosTheta_rosenbluth(int
 
   // Find the appropriate values of the hadron tensor elements for the
   // given combination of q0_corrected and q_mag
-  TableEntry entry = fGrid.interpolate(q0_corrected, q_mag);
+  TableEntry entry = this->Interpolate(q0_corrected, q_mag);
 
   // The half-angle formulas come in handy here. See, e.g.,
   // http://mathworld.wolfram.com/Half-AngleFormulas.html
@@ -8,6 +8,10 @@
           using precomputed tables.
           Is a concrete implementation of the HadronTensorI interface.
 
+\details  Tables may be provided either in the original ASCII format or in
+          the binary format described in genie::BinaryHadronTensorTable.
+          Binary tables are memory-mapped rather than copied onto the heap.
+
 \author   Steven Gardiner <gardiner \at fnal.gov>
           Fermi National Accelerator Laboratory
 
@@ -26,7 +30,8 @@
 #include <vector>
 
 // GENIE includes
-#include "Framework/Numerical/BLI2DNonUnifObjectGrid.h"
+#include "Framework/Numerical/BLI2DNonUnifMultiGrid.h"
+#include "Physics/HadronTensors/BinaryHadronTensorTable.h"
 #include "Physics/HadronTensors/LabFrameHadronTensorI.h"
 
 namespace genie {
@@ -50,6 +55,9 @@ class TabulatedLabFrameHadronTensor : public LabFrameHadronTensorI {
 
   virtual std::complex<double> zz(double q0, double q_mag) const /*override*/;
 
+  virtual void elements(double q0, double q_mag, Elements& elem)
+    const /*override*/;
+
   virtual double W1(double q0, double q_mag, double Mi) const /*override*/;
   virtual double W2(double q0, double q_mag, double Mi) const /*override*/;
   virtual double W3(double q0, double q_mag, double Mi) const /*override*/;
@@ -78,8 +86,23 @@ class TabulatedLabFrameHadronTensor : public LabFrameHadronTensorI {
   inline virtual double qMagMin() const /*override*/ { return fGrid.y_min(); }
   inline virtual double qMagMax() const /*override*/ { return fGrid.y_max(); }
 
+  /// Writes the currently loaded table to a file in the binary hadron
+  /// tensor format
+  /// \param[in] file_name Name of the binary file to create
+  /// \param[in] source_file_name Name of the ASCII table the currently
+  /// loaded table was read from
+  /// \return true if the file was written successfully
+  bool WriteBinaryTable(const std::string& file_name,
+    const std::string& source_file_name) const;
+
   protected:
 
+  /// Reads a table stored in the original ASCII format
+  void ReadTextTable(const std::string& table_file_name);
+
+  /// Maps a table stored in the binary format into memory
+  void ReadBinaryTable(const std::string& table_file_name);
+
   /// Helper function that allows this class to handle variations in the
   /// data file format for the 1D \f$q_0\f$ and
   /// \f$\left|\overrightarrow{q}\right|\f$ grids
@@ -200,11 +223,40 @@ class TabulatedLabFrameHadronTensor : public LabFrameHadronTensorI {
   virtual double W6(double q0, double q_mag, const TableEntry& entry) const;
   ///@}
 
-  std::vector<double> fq0Points;
-  std::vector<double> fqmagPoints;
-  std::vector<TableEntry> fEntries;
+  /// Uses bilinear interpolation to compute all tabulated tensor elements
+  /// at the given kinematics. Points outside of the grid are evaluated at
+  /// the nearest grid edge.
+  TableEntry Interpolate(double q0, double q_mag) const;
+
+  /// Tensor type name stored in the table file
+  std::string fTypeName;
+
+  /// Number of grid points along the \f$q_0\f$ axis
+  int fNumQ0;
+
+  /// Number of grid points along the \f$\left|\overrightarrow{q}\right|\f$
+  /// axis
+  int fNumQMag;
+
+  /// \name Table storage
+  /// \brief The grid axes and each tensor element are stored as separate
+  /// contiguous arrays (tensor elements in row-major (q0, q_mag) order).
+  /// The pointers refer either to fOwnedData (ASCII tables) or to the
+  /// memory-mapped file held by fBinaryTable.
+  /// @{
+  const double* fQ0;
+  const double* fQMag;
+  const double* fComp[ BinaryHadronTensorTable::kNumComponents ];
+  ///@}
+
+  /// Storage used for tables read from ASCII files
+  std::vector<double> fOwnedData;
+
+  /// Memory-mapped binary table (unused for ASCII tables)
+  BinaryHadronTensorTable fBinaryTable;
 
-  BLI2DNonUnifObjectGrid<TableEntry> fGrid;
+  /// Interpolation kernel shared by all tensor elements
+  BLI2DNonUnifMultiGrid< BinaryHadronTensorTable::kNumComponents > fGrid;
 
 }; // class TabulatedLabFrameHadronTensor
 
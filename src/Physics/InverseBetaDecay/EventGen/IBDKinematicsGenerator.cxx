@@ -148,6 +148,8 @@ void IBDKinematicsGenerator::ProcessEventRecord(GHepRecord * evrec) const
         accept = (xsec>0);
      }
 
+     this->CountTrial(accept);
+
      //-- If the generated kinematics are accepted, finish-up module's job
      if(accept) {
         LOG("IBD", pINFO) << "Selected: Q^2 = " << gQ2;
@@ -11,6 +11,10 @@
 */
 //____________________________________________________________________________
 
+#include <algorithm>
+#include <cmath>
+#include <sstream>
+
 #include <TMath.h>
 #include "Math/Minimizer.h"
 #include "Math/Factory.h"
@@ -21,12 +25,14 @@
 #include "Framework/Conventions/Controls.h"
 #include "Framework/EventGen/EVGThreadException.h"
 #include "Framework/EventGen/RunningThreadInfo.h"
+#include "Framework/EventGen/RejectionLoopStats.h"
 #include "Framework/EventGen/EventGeneratorI.h"
 #include "Framework/GHEP/GHepStatus.h"
 #include "Framework/GHEP/GHepFlags.h"
 #include "Framework/GHEP/GHepParticle.h"
 #include "Framework/GHEP/GHepRecord.h"
 #include "Framework/Messenger/Messenger.h"
+#include "Physics/Common/AdaptiveProposal.h"
 #include "Physics/Common/PrimaryLeptonUtils.h"
 #include "Physics/Multinucleon/EventGen/MECGenerator.h"
 #include "Physics/Multinucleon/XSection/MECUtils.h"
@@ -39,6 +45,7 @@
 #include "Framework/ParticleData/PDGCodes.h"
 #include "Framework/ParticleData/PDGUtils.h"
 #include "Framework/ParticleData/PDGLibrary.h"
+#include "Framework/Utils/Cache.h"
 #include "Framework/Utils/KineUtils.h"
 #include "Framework/Utils/PrintUtils.h"
 
@@ -642,19 +649,21 @@ void MECGenerator::SelectNSVLeptonKinematics (GHepRecord * event) const
   // the hadron tensors we expect will be limited in q3
   // therefore also the outgoing lepton KE can't be too low or costheta too backward
   // make the accept/reject loop more efficient by using Min values.
-  if(Enu < fQ3Max){
-    TMin = 0 ;
-    CosthMin = -1 ;
-  } else {
-    TMin = TMath::Sqrt(TMath::Power(LepMass, 2) + TMath::Power((Enu - fQ3Max), 2)) - LepMass;
-    CosthMin = TMath::Sqrt(1 - TMath::Power((fQ3Max / Enu ), 2));
+  this->TlctlLimits( Enu, LepMass, TMin, TMax, CosthMin );
+
+  // Either get the adaptive envelope used as proposal density, or compute
+  // the maximum xsec value for a flat proposal
+  AdaptiveProposal * envelope = 0;
+  if ( fUseEnvelope ) envelope = this->GetEnvelope( *interaction, false );
+
+  double XSecMax = 0.;
+  int cell = -1;
+  if ( !envelope ) {
+    Range1D_t Tl_range ( TMin, TMax ) ;
+    Range1D_t ctl_range ( CosthMin, CosthMax ) ;
+    XSecMax = GetXSecMaxTlctl( *interaction, Tl_range, ctl_range ) ;
   }
 
-  // Compute the maximum xsec value:
-  Range1D_t Tl_range ( TMin, TMax ) ;
-  Range1D_t ctl_range ( CosthMin, CosthMax ) ;
-  double XSecMax = GetXSecMaxTlctl( *interaction, Tl_range, ctl_range ) ;
-
   // -- Generate and Test the Kinematics----------------------------------//
 
   RandomGen * rnd = RandomGen::Instance();
@@ -677,8 +686,17 @@ void MECGenerator::SelectNSVLeptonKinematics (GHepRecord * event) const
       }
 
       // generate random kinetic energy T and Costh
-      T = TMin + (TMax-TMin)*rnd->RndKine().Rndm();
-      Costh = CosthMin + (CosthMax-CosthMin)*rnd->RndKine().Rndm();
+      if ( envelope ) {
+        double r[3], u[2];
+        for ( int i = 0; i < 3; ++i ) r[i] = rnd->RndKine().Rndm();
+        XSecMax = envelope->Sample( r, u, cell );
+        T = TMin + (TMax-TMin)*u[0];
+        Costh = CosthMin + (CosthMax-CosthMin)*u[1];
+      }
+      else {
+        T = TMin + (TMax-TMin)*rnd->RndKine().Rndm();
+        Costh = CosthMin + (CosthMax-CosthMin)*rnd->RndKine().Rndm();
+      }
 
       // Calculate useful values for judging this choice
       genie::utils::mec::Getq0q3FromTlCostl(T, Costh, Enu, LepMass, Q0, Q3);
@@ -719,13 +737,18 @@ void MECGenerator::SelectNSVLeptonKinematics (GHepRecord * event) const
 	interaction->ExclTagPtr()->SetResonance(genie::kNoResonance);
 	double XSecPN = fXSecModel->XSec(interaction, kPSTlctl);
 
-	if (XSec > XSecMax) {
+	if (XSec > XSecMax && envelope) {
+	  this->EnvelopeViolation( envelope, cell, *interaction, XSec, XSecMax );
+	}
+	else if (XSec > XSecMax) {
+	  RejectionLoopStats::Instance()->Violation();
 	  LOG("MEC", pERROR) << "XSec is > XSecMax for nucleus " << TgtPDG << " "
 			     << XSec << " > " << XSecMax
 			     << " don't let this happen.";
 	}
-	assert(XSec <= XSecMax);
+	assert(envelope || XSec <= XSecMax);
 	accept = XSec > XSecMax*rnd->RndKine().Rndm();
+	RejectionLoopStats::Instance()->Trial(accept);
 	LOG("MEC", pINFO) << "Xsec, Max, Accept: " << XSec << ", "
 			  << XSecMax << ", " << accept;
 
@@ -914,13 +937,7 @@ void MECGenerator::SelectSuSALeptonKinematics(GHepRecord* event) const
   // the hadron tensors we expect will be limited in q3
   // therefore also the outgoing lepton KE can't be too low or costheta too backward
   // make the accept/reject loop more efficient by using Min values.
-  if ( Enu < fQ3Max ) {
-    TMin = 0;
-    CosthMin = -1;
-  } else {
-    TMin = TMath::Sqrt( TMath::Power(LepMass, 2) + TMath::Power(Enu - fQ3Max, 2) ) - LepMass;
-    CosthMin = TMath::Sqrt( 1. - TMath::Power(fQ3Max / Enu, 2) );
-  }
+  this->TlctlLimits( Enu, LepMass, TMin, TMax, CosthMin );
 
   // Generate and Test the Kinematics
 
@@ -933,9 +950,17 @@ void MECGenerator::SelectSuSALeptonKinematics(GHepRecord* event) const
   // e-scat xsecs blow up close to theta=0, MC methods won't work ...
   if ( NuPDG == 11 ) maxIter *= 100000;
 
-  // Scan the accessible phase space to find the maximum differential cross
-  // section to throw against
-  double XSecMax = utils::mec::GetMaxXSecTlctl( *fXSecModel, *interaction );
+  // Get the adaptive envelope used as proposal density or, for a flat
+  // proposal, scan the accessible phase space to find the maximum
+  // differential cross section to throw against
+  AdaptiveProposal * envelope = 0;
+  if ( fUseEnvelope ) envelope = this->GetEnvelope( *interaction, true );
+
+  double XSecMax = 0.;
+  int cell = -1;
+  if ( !envelope ) {
+    XSecMax = utils::mec::GetMaxXSecTlctl( *fXSecModel, *interaction );
+  }
 
   // loop over different (randomly) selected T and Costh
   while ( !accept ) {
@@ -953,8 +978,17 @@ void MECGenerator::SelectSuSALeptonKinematics(GHepRecord* event) const
     }
 
     // generate random kinetic energy T and Costh
-    T = TMin + (TMax-TMin)*rnd->RndKine().Rndm();
-    Costh = CosthMin + (CosthMax-CosthMin)*rnd->RndKine().Rndm();
+    if ( envelope ) {
+      double r[3], u[2];
+      for ( int i = 0; i < 3; ++i ) r[i] = rnd->RndKine().Rndm();
+      XSecMax = envelope->Sample( r, u, cell );
+      T = TMin + (TMax-TMin)*u[0];
+      Costh = CosthMin + (CosthMax-CosthMin)*u[1];
+    }
+    else {
+      T = TMin + (TMax-TMin)*rnd->RndKine().Rndm();
+      Costh = CosthMin + (CosthMax-CosthMin)*rnd->RndKine().Rndm();
+    }
 
     // Calculate useful values for judging this choice
     Plep = TMath::Sqrt( T * (T + (2.0 * LepMass)));  // ok is sqrt(E2 - m2)
@@ -982,7 +1016,11 @@ void MECGenerator::SelectSuSALeptonKinematics(GHepRecord* event) const
       // Get total xsec (nn+np)
       double XSec = fXSecModel->XSec( interaction, kPSTlctl );
 
-      if ( XSec > XSecMax ) {
+      if ( XSec > XSecMax && envelope ) {
+        this->EnvelopeViolation( envelope, cell, *interaction, XSec, XSecMax );
+      }
+      else if ( XSec > XSecMax ) {
+        RejectionLoopStats::Instance()->Violation();
         LOG("MEC", pERROR) << "XSec is > XSecMax for nucleus " << TgtPDG << " "
           << XSec << " > " << XSecMax << " don't let this happen.";
 
@@ -1004,6 +1042,7 @@ void MECGenerator::SelectSuSALeptonKinematics(GHepRecord* event) const
       }
 
       accept = XSec > XSecMax*rnd->RndKine().Rndm();
+      RejectionLoopStats::Instance()->Trial(accept);
       LOG("MEC", pINFO) << "Xsec, Max, Accept: " << XSec << ", "
         << XSecMax << ", " << accept;
 
@@ -1349,6 +1388,15 @@ void MECGenerator::LoadConfig(void)
     // in the accept/reject loop for selecting lepton kinematics for SuSAv2.
     // Similar to the tolerance used by QELEventGenerator.
     GetParamDef( "SuSA-MaxXSec-DiffTolerance", fSuSAMaxXSecDiffTolerance, 999999. );
+
+    // Adaptive proposal envelopes for the NSV and SuSAv2 lepton kinematics
+    GetParamDef( "Envelope-Enable", fUseEnvelope, false );
+    GetParamDef( "Envelope-EnergyBinsPerDecade", fEnvBinsPerDecade, 50 );
+    GetParamDef( "Envelope-InitialCells", fEnvInitCells, 8 );
+    GetParamDef( "Envelope-MaxCells", fEnvMaxCells, 400 );
+    GetParamDef( "Envelope-Tolerance", fEnvTolerance, 0.05 );
+    GetParamDef( "Envelope-SafetyFactor", fEnvSafetyFactor, 1.2 );
+    GetParamDef( "Envelope-MaxXSecDiffTolerance", fEnvMaxXSecDiffTolerance, 5. );
 }
 //___________________________________________________________________________
 double MECGenerator::GetXSecMaxTlctl( const Interaction & in,
@@ -1407,3 +1455,200 @@ double MECGenerator::GetXSecMaxTlctl( const Interaction & in,
 }
 
 //___________________________________________________________________________
+void MECGenerator::TlctlLimits( double Enu, double LepMass, double & TMin,
+                                double & TMax, double & CosthMin ) const
+{
+  TMax = Enu - LepMass;
+  if ( Enu < fQ3Max ) {
+    TMin = 0;
+    CosthMin = -1;
+  } else {
+    TMin = TMath::Sqrt( TMath::Power(LepMass, 2) + TMath::Power(Enu - fQ3Max, 2) ) - LepMass;
+    CosthMin = TMath::Sqrt( 1. - TMath::Power(fQ3Max / Enu, 2) );
+  }
+}
+//___________________________________________________________________________
+double MECGenerator::TlctlXSec( Interaction * in, double Enu, double T,
+                                double Costh, bool is_susa ) const
+{
+  // Same kinematic cuts and hit nucleon setting as used by the accept/reject
+  // loops of SelectNSVLeptonKinematics and SelectSuSALeptonKinematics
+  double LepMass = in->FSPrimLepton()->Mass();
+  Kinematics * kinematics = in->KinePtr();
+
+  if ( is_susa ) {
+    double Q2min = genie::controls::kMinQ2Limit;
+    if ( in->ProcInfo().IsEM() ) Q2min = genie::utils::kinematics
+      ::electromagnetic::kMinQ2Limit;
+
+    double Plep = TMath::Sqrt( T * (T + (2.0 * LepMass)) );
+    double Q3 = TMath::Sqrt( Plep*Plep + Enu*Enu - 2.0 * Plep * Enu * Costh );
+    double Q0 = Enu - (T + LepMass);
+    double Q2 = Q3*Q3 - Q0*Q0;
+    if ( Q3 >= fQ3Max || Q2 < Q2min ) return 0.;
+
+    kinematics->SetKV( kKVTl, T );
+    kinematics->SetKV( kKVctl, Costh );
+  }
+  else {
+    double Q0 = 0., Q3 = 0.;
+    genie::utils::mec::Getq0q3FromTlCostl( T, Costh, Enu, LepMass, Q0, Q3 );
+    if ( Q3 > fQ3Max ) return 0.;
+
+    kinematics->SetKV( kKVTl, T );
+    kinematics->SetKV( kKVctl, Costh );
+    kinematics->SetKV( kKVQ0, Q0 );
+    kinematics->SetKV( kKVQ3, Q3 );
+
+    int hit_pdg = ( in->InitState().ProbePdg() > 0 ) ? kPdgClusterNN : kPdgClusterPP;
+    in->InitStatePtr()->TgtPtr()->SetHitNucPdg( hit_pdg );
+    in->ExclTagPtr()->SetResonance( genie::kNoResonance );
+  }
+
+  return fXSecModel->XSec( in, kPSTlctl );
+}
+//___________________________________________________________________________
+void MECGenerator::EnvelopeViolation( AdaptiveProposal * envelope, int cell,
+  const Interaction & in, double xsec, double xsec_env ) const
+{
+  // The envelope is a sampled estimate of the cross section maximum, not a
+  // proven bound. Raise the envelope of the cell so that the following events
+  // are drawn from the corrected density, and report deviations larger than
+  // the configured tolerance.
+  RejectionLoopStats::Instance()->Violation();
+
+  double percent_deviation = 200. * ( xsec - xsec_env ) / ( xsec_env + xsec );
+
+  if ( percent_deviation > fEnvMaxXSecDiffTolerance ) {
+    MAXLOG( "MEC", pERROR, 10 ) << "xsec: (curr) = " << xsec
+      << " > (envelope) = " << xsec_env << "\n for " << in;
+    MAXLOG( "MEC", pERROR, 10 )
+      << "*** Exceeding the lepton kinematics envelope by "
+      << percent_deviation << " % - raising the envelope, consider "
+      << "increasing Envelope-SafetyFactor";
+  }
+  else {
+    MAXLOG( "MEC", pWARN, 10 ) << "xsec: (curr) = " << xsec
+      << " > (envelope) = " << xsec_env << " - fractional deviation of "
+      << percent_deviation << " % allowed, raising the envelope";
+  }
+  envelope->Violation( cell, xsec );
+}
+//___________________________________________________________________________
+namespace {
+
+  // Largest lepton differential cross section, in the normalized (Tl, ctl)
+  // coordinates used by MECGenerator, over a set of neutrino energies
+  class TlctlEnvelopeFunction : public genie::AdaptiveProposal::Function {
+  public:
+    TlctlEnvelopeFunction( const genie::MECGenerator * gen,
+      const genie::Interaction & in, const std::vector<double> & energies,
+      const std::vector<double> & tmin,
+      const std::vector<double> & tmax, const std::vector<double> & cmin,
+      bool is_susa, double (genie::MECGenerator::*xsec)( genie::Interaction *,
+        double, double, double, bool ) const ) :
+      fGen(gen), fEnu(energies), fTMin(tmin), fTMax(tmax), fCMin(cmin),
+      fIsSuSA(is_susa), fXSec(xsec)
+    {
+      // The energies are given in the frame used by the selected model (the
+      // hit nucleon rest frame for NSV). The energy in any frame scales with
+      // the LAB-frame probe momentum, so scale that.
+      genie::RefFrame_t frame = is_susa ? genie::kRfLab : genie::kRfHitNucRest;
+      double E = in.InitState().ProbeE( frame );
+      TLorentzVector * p4 = in.InitState().GetProbeP4( genie::kRfLab );
+      for ( unsigned int i = 0; i < energies.size(); ++i ) {
+        genie::Interaction * clone = new genie::Interaction( in );
+        TLorentzVector scaled = (*p4) * ( energies[i] / E );
+        clone->InitStatePtr()->SetProbeP4( scaled );
+        fInteractions.push_back( clone );
+      }
+      delete p4;
+    }
+    ~TlctlEnvelopeFunction() {
+      for ( unsigned int i = 0; i < fInteractions.size(); ++i ) {
+        delete fInteractions[i];
+      }
+    }
+    double operator() ( const double * u ) const {
+      double xsec = 0.;
+      for ( unsigned int i = 0; i < fInteractions.size(); ++i ) {
+        double T = fTMin[i] + u[0] * ( fTMax[i] - fTMin[i] );
+        double Costh = fCMin[i] + u[1] * ( 1. - fCMin[i] );
+        xsec = std::max( xsec, (fGen->*fXSec)( fInteractions[i], fEnu[i],
+          T, Costh, fIsSuSA ) );
+      }
+      return xsec;
+    }
+  private:
+    const genie::MECGenerator * fGen;
+    std::vector<genie::Interaction *> fInteractions;
+    std::vector<double> fEnu, fTMin, fTMax, fCMin;
+    bool fIsSuSA;
+    double (genie::MECGenerator::*fXSec)( genie::Interaction *, double,
+      double, double, bool ) const;
+  };
+
+}
+//___________________________________________________________________________
+AdaptiveProposal * MECGenerator::GetEnvelope( const Interaction & in,
+                                              bool is_susa ) const
+{
+  // The NSV and SuSAv2 selection methods use the neutrino energy in the hit
+  // nucleon rest frame and in the LAB frame respectively. Envelopes are
+  // binned in, and trained at, the energy in the same frame.
+  RefFrame_t frame = is_susa ? kRfLab : kRfHitNucRest;
+  double Enu = in.InitState().ProbeE( frame );
+  if ( Enu <= 0. || fEnvBinsPerDecade <= 0 ) return 0;
+
+  int ebin = TMath::FloorNint( TMath::Log10( Enu ) * fEnvBinsPerDecade );
+
+  // Envelopes are stored as Cache branches, like the proposals of the
+  // kinematics generators deriving from KineGeneratorWithCache
+  Cache * cache = Cache::Instance();
+
+  std::ostringstream intkey, bin;
+  intkey << fXSecModel->Id().Key() << ";" << in.InitState().ProbePdg()
+         << ";" << in.InitState().Tgt().Pdg()
+         << ";" << in.ProcInfo().AsString();
+  if ( is_susa ) intkey << ";" << in.InitState().Tgt().HitNucPdg();
+  bin << "envelope/" << ebin;
+  string key = cache->CacheBranchKey( this->Id().Key(), intkey.str(), bin.str() );
+
+  AdaptiveProposal * envelope =
+    dynamic_cast<AdaptiveProposal *>( cache->FindCacheBranch( key ) );
+  if ( envelope ) {
+    return envelope->IsValid() ? envelope : 0;
+  }
+
+  // Bound the cross section over the whole energy bin by taking the
+  // maximum at its low edge, center and high edge
+  double LepMass = in.FSPrimLepton()->Mass();
+  std::vector<double> energies, tmin, tmax, cmin;
+  for ( int i = 0; i <= 2; ++i ) {
+    double E = TMath::Power( 10., ( ebin + 0.5 * i ) / fEnvBinsPerDecade );
+    if ( E <= LepMass ) continue;
+    double TMin = 0., TMax = 0., CosthMin = -1.;
+    this->TlctlLimits( E, LepMass, TMin, TMax, CosthMin );
+    energies.push_back( E );
+    tmin.push_back( TMin );
+    tmax.push_back( TMax );
+    cmin.push_back( CosthMin );
+  }
+
+  envelope = new AdaptiveProposal( 2 );
+  if ( !energies.empty() ) {
+    TlctlEnvelopeFunction f( this, in, energies, tmin, tmax, cmin,
+      is_susa, &MECGenerator::TlctlXSec );
+    envelope->Build( f, fEnvInitCells, fEnvMaxCells, fEnvTolerance,
+      fEnvSafetyFactor );
+  }
+
+  LOG("MEC", pNOTICE) << "Built lepton kinematics envelope - key = " << key
+    << " (" << envelope->NCells() << " cells, expected acceptance "
+    << envelope->Efficiency() << ")";
+
+  cache->AddCacheBranch( key, envelope );
+
+  return envelope->IsValid() ? envelope : 0;
+}
+//___________________________________________________________________________
@@ -29,6 +29,7 @@
 
 namespace genie {
 
+class AdaptiveProposal;
 class Interaction;
 class NuclearModelI;
 class XSecAlgorithmI;
@@ -67,6 +68,26 @@ private:
   // in the kPSTlctl phase space
   double GetXSecMaxTlctl( const Interaction & inter, const Range1D_t & Tl_range, const Range1D_t & ctl_range ) const;
 
+  // Limits of the lepton kinetic energy and scattering cosine used when
+  // sampling the NSV and SuSAv2 lepton kinematics
+  void   TlctlLimits (double Enu, double LepMass,
+                      double & TMin, double & TMax, double & CosthMin) const;
+
+  // Differential cross section in the kPSTlctl phase space, including the
+  // Q3 (and, for SuSAv2, Q2) cuts applied by the accept/reject loops.
+  // Enu is the probe energy in the frame used by the selected model.
+  double TlctlXSec   (Interaction * in, double Enu, double T, double Costh,
+                      bool is_susa) const;
+
+  // Returns the proposal envelope for the lepton kinematics in the energy
+  // bin containing the probe energy of the input interaction. Envelopes are
+  // trained on first use and stored in the Cache.
+  AdaptiveProposal * GetEnvelope (const Interaction & in, bool is_susa) const;
+
+  // Handles a point where the cross section exceeds the envelope
+  void EnvelopeViolation (AdaptiveProposal * envelope, int cell,
+                          const Interaction & in, double xsec, double xsec_env) const;
+
   mutable const XSecAlgorithmI * fXSecModel;
   mutable TGenPhaseSpace         fPhaseSpaceGenerator;
   const NuclearModelI *          fNuclModel;
@@ -82,6 +103,16 @@ private:
   // Tolerate this maximum percent deviation above the calculated maximum cross
   // section when sampling lepton kinematics for the SuSAv2-MEC model.
   double fSuSAMaxXSecDiffTolerance;
+
+  // Configuration of the adaptive proposal envelopes used to sample the
+  // NSV and SuSAv2 lepton kinematics
+  bool   fUseEnvelope;             // use envelopes instead of a flat proposal
+  int    fEnvBinsPerDecade;        // energy bins per decade
+  int    fEnvInitCells;            // initial cells per axis
+  int    fEnvMaxCells;             // maximum number of cells
+  double fEnvTolerance;            // target relative envelope excess
+  double fEnvSafetyFactor;         // safety factor on the cell maxima
+  double fEnvMaxXSecDiffTolerance; // tolerated % deviation above the envelope
 };
 
 }      // genie namespace
@@ -273,11 +273,15 @@ double genie::utils::mec::OldTensorContraction(
       = dynamic_cast<const LabFrameHadronTensorI*>( ht_model->GetTensor(targetpdg,
       tensor_type) );
 
-    double W00 = (tensor_table->tt(q0nucleus,q3)).real();
-    double W0Z = (tensor_table->tz(q0nucleus,q3)).real();
-    double WXX = (tensor_table->xx(q0nucleus,q3)).real();
-    double WXY = -1.0*(tensor_table->xy(q0nucleus,q3)).imag();
-    double WZZ = (tensor_table->zz(q0nucleus,q3)).real();
+    // Look up all of the tensor elements with a single interpolation
+    LabFrameHadronTensorI::Elements elem;
+    tensor_table->elements(q0nucleus, q3, elem);
+
+    double W00 = elem.W00;
+    double W0Z = elem.ReW0z;
+    double WXX = elem.Wxx;
+    double WXY = -1.0*elem.ImWxy;
+    double WZZ = elem.Wzz;
 
     w1=WXX/2.;
     w2=(W00+WXX+(q0*q0/(v4q.Vect().Mag()*v4q.Vect().Mag())
@@ -0,0 +1,129 @@
+//____________________________________________________________________________
+/*
+ Copyright (c) 2003-2023, The GENIE Collaboration
+ For the full text of the license visit http://copyright.genie-mc.org
+
+ The GENIE Collaboration
+*/
+//____________________________________________________________________________
+
+#include <cstdlib>
+#include <algorithm>
+
+#include <TMath.h>
+
+#include "Framework/Algorithm/AlgFactory.h"
+#include "Framework/Messenger/Messenger.h"
+#include "Physics/MuonEnergyLoss/MuELossI.h"
+#include "Physics/MuonEnergyLoss/MuELossTable.h"
+
+using namespace genie;
+using namespace genie::mueloss;
+using namespace genie::constants;
+
+//____________________________________________________________________________
+MuELossTable::MuELossTable(
+   MuELMaterial_t material, int npoints, std::string config) :
+fMaterial(material)
+{
+  const char * models[] = {
+     "genie::mueloss::BetheBlochModel",
+     "genie::mueloss::KokoulinPetrukhinModel",
+     "genie::mueloss::PetrukhinShestakovModel",
+     "genie::mueloss::BezrukovBugaevModel"
+  };
+  const int nmodels = 4;
+
+  AlgFactory * algf = AlgFactory::Instance();
+  std::vector<const MuELossI *> mueloss;
+  for(int im = 0; im < nmodels; im++) {
+    const MuELossI * alg = dynamic_cast<const MuELossI *> (
+                                 algf->GetAlgorithm(models[im], config));
+    if(!alg) {
+      LOG("MuELoss", pFATAL)
+        << "Could not get muon energy loss model: " << models[im]
+        << "/" << config;
+      exit(1);
+    }
+    mueloss.push_back(alg);
+  }
+
+  npoints  = TMath::Max(npoints, 2);
+  fEMin    = 2*kMuonMass;
+  fEMax    = kMaxMuE;
+  fLogEMin = TMath::Log(fEMin);
+  fDLogE   = (TMath::Log(fEMax) - fLogEMin) / (npoints-1);
+
+  fdEdx.resize(npoints);
+  fRange.resize(npoints);
+
+  for(int i = 0; i < npoints; i++) {
+    double E = TMath::Exp(fLogEMin + i*fDLogE);
+    double dedx = 0;
+    for(int im = 0; im < nmodels; im++) {
+      dedx += TMath::Max(0., mueloss[im]->dE_dx(E, material));
+    }
+    fdEdx[i] = dedx;
+  }
+
+  // R(E) = integral of dE / (dE/dx) = integral of E dlogE / (dE/dx),
+  // trapezoidal rule in log(E)
+  fRange[0] = 0;
+  for(int i = 1; i < npoints; i++) {
+    double E0 = TMath::Exp(fLogEMin + (i-1)*fDLogE);
+    double E1 = TMath::Exp(fLogEMin +  i   *fDLogE);
+    double f0 = (fdEdx[i-1] > 0) ? E0/fdEdx[i-1] : 0;
+    double f1 = (fdEdx[i]   > 0) ? E1/fdEdx[i]   : 0;
+    fRange[i] = fRange[i-1] + 0.5*(f0+f1)*fDLogE;
+  }
+
+  LOG("MuELoss", pINFO)
+    << "Tabulated muon energy losses in "
+    << MuELMaterial::AsString(material) << " at " << npoints
+    << " energies in [" << fEMin << ", " << fEMax << "] GeV";
+}
+//____________________________________________________________________________
+MuELossTable::~MuELossTable()
+{
+
+}
+//____________________________________________________________________________
+double MuELossTable::Interpolate(
+   const std::vector<double> & table, double E) const
+{
+  int    n = table.size();
+  double x = (TMath::Log(E) - fLogEMin) / fDLogE;
+  if(x <= 0)   return table[0];
+  if(x >= n-1) return table[n-1];
+  int    i = (int) x;
+  double f = x - i;
+  return (1-f)*table[i] + f*table[i+1];
+}
+//____________________________________________________________________________
+double MuELossTable::dE_dx(double E) const
+{
+  if(E <= fEMin) return fdEdx[0];
+  return this->Interpolate(fdEdx, E);
+}
+//____________________________________________________________________________
+double MuELossTable::Range(double E) const
+{
+  if(E <= fEMin) return 0;
+  return this->Interpolate(fRange, E);
+}
+//____________________________________________________________________________
+double MuELossTable::Energy(double E0, double X) const
+{
+  double R = this->Range(E0) - X;
+  if(R <= 0) return 0;
+
+  // invert the (monotonic) range table
+  std::vector<double>::const_iterator it =
+                    std::lower_bound(fRange.begin(), fRange.end(), R);
+  int i = TMath::Max(1, (int)(it - fRange.begin()));
+  if(i >= (int)fRange.size()) return E0;
+
+  double f = (R - fRange[i-1]) / (fRange[i] - fRange[i-1]);
+  return TMath::Exp(fLogEMin + (i-1+f)*fDLogE);
+}
+//____________________________________________________________________________
@@ -0,0 +1,74 @@
+//____________________________________________________________________________
+/*!
+
+\class    genie::mueloss::MuELossTable
+
+\brief    Total muon energy loss, -dE/dx summed over ionization, pair
+          production, bremsstrahlung and nuclear interactions, and the
+          corresponding (continuous slowing down) range, tabulated vs the
+          muon energy for a given material.
+
+          The tables are filled once, from the BetheBloch, KokoulinPetrukhin,
+          PetrukhinShestakov and BezrukovBugaev models, on a uniform grid in
+          log(E) between EMin() and kMaxMuE, and are linearly interpolated in
+          log(E). Muon transport codes (eg gevgen_upmu) can then integrate
+          energy losses with table lookups rather than evaluating the models
+          at each step.
+
+\author   The GENIE Collaboration
+
+\created  October 16, 2026
+
+\cpright  Copyright (c) 2003-2023, The GENIE Collaboration
+          For the full text of the license visit http://copyright.genie-mc.org
+*/
+//____________________________________________________________________________
+
+#ifndef _MUELOSS_TABLE_H_
+#define _MUELOSS_TABLE_H_
+
+#include <string>
+#include <vector>
+
+#include "Physics/MuonEnergyLoss/MuELMaterial.h"
+
+namespace genie   {
+namespace mueloss {
+
+class MuELossTable
+{
+public:
+  MuELossTable(MuELMaterial_t material, int npoints = 500,
+               std::string config = "Default");
+  ~MuELossTable();
+
+  MuELMaterial_t Material (void) const { return fMaterial; }
+  double         EMin     (void) const { return fEMin;     }
+  double         EMax     (void) const { return fEMax;     }
+
+  //! total -dE/dx at the input energy (std GENIE units)
+  double dE_dx  (double E) const;
+
+  //! range of a muon with the input energy, until its energy drops to
+  //! EMin() (column depth, std GENIE units)
+  double Range  (double E) const;
+
+  //! energy of a muon with initial energy E0 after traversing the input
+  //! column depth X (0 if the muon ranges out)
+  double Energy (double E0, double X) const;
+
+private:
+  double Interpolate (const std::vector<double> & table, double E) const;
+
+  MuELMaterial_t      fMaterial;
+  double              fEMin;
+  double              fEMax;
+  double              fLogEMin;
+  double              fDLogE;    ///< grid spacing in log(E)
+  std::vector<double> fdEdx;     ///< total -dE/dx at each node
+  std::vector<double> fRange;    ///< range at each node
+};
+
+}      // mueloss namespace
+}      // genie   namespace
+#endif // _MUELOSS_TABLE_H_
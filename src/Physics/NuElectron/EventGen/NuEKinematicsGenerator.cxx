@@ -112,6 +112,8 @@ void NuEKinematicsGenerator::ProcessEventRecord(GHepRecord * evrec) const
        accept = (xsec>0);
      }
 
+     this->CountTrial(accept);
+
      //-- If the generated kinematics are accepted, finish-up module's job
      if(accept) {
         LOG("NuEKinematics", pINFO) << "Selected: y = " << y;
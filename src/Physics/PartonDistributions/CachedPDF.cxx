@@ -0,0 +1,226 @@
+//____________________________________________________________________________
+/*
+ Copyright (c) 2003-2023, The GENIE Collaboration
+ For the full text of the license visit http://copyright.genie-mc.org
+
+ The GENIE Collaboration
+*/
+//____________________________________________________________________________
+
+#include <cassert>
+#include <cmath>
+#include <cstdlib>
+
+#include "Physics/PartonDistributions/CachedPDF.h"
+#include "Framework/Messenger/Messenger.h"
+
+using namespace genie;
+
+namespace {
+
+  // Lagrange weights of 4 equally spaced points (at 0,1,2,3) for the
+  // position u, in units of the spacing
+  inline void CubicWeights(double u, double * w)
+  {
+    double u1 = u - 1.;
+    double u2 = u - 2.;
+    double u3 = u - 3.;
+    w[0] = -       u1 * u2 * u3 / 6.;
+    w[1] =     u *      u2 * u3 / 2.;
+    w[2] = -   u * u1 *      u3 / 2.;
+    w[3] =     u * u1 * u2      / 6.;
+  }
+
+  // First of the 4 grid points used to interpolate at the position t
+  // (in units of the spacing, from the first grid point), and the position
+  // relative to it
+  inline int Stencil(double t, int n, double & u)
+  {
+    int i = (int) std::floor(t) - 1;
+    if(i < 0    ) i = 0;
+    if(i > n - 4) i = n - 4;
+    u = t - i;
+    return i;
+  }
+
+  inline void AddScaled(PDF_t & sum, const PDF_t & pdf, double w)
+  {
+    sum.uval += w * pdf.uval;
+    sum.dval += w * pdf.dval;
+    sum.usea += w * pdf.usea;
+    sum.dsea += w * pdf.dsea;
+    sum.str  += w * pdf.str;
+    sum.chm  += w * pdf.chm;
+    sum.bot  += w * pdf.bot;
+    sum.top  += w * pdf.top;
+    sum.gl   += w * pdf.gl;
+  }
+
+}
+
+//____________________________________________________________________________
+CachedPDF::CachedPDF() :
+PDFModelI("genie::CachedPDF"),
+fBasePDFModel(0)
+{
+
+}
+//____________________________________________________________________________
+CachedPDF::CachedPDF(string config) :
+PDFModelI("genie::CachedPDF", config),
+fBasePDFModel(0)
+{
+
+}
+//____________________________________________________________________________
+CachedPDF::~CachedPDF()
+{
+
+}
+//____________________________________________________________________________
+double CachedPDF::UpValence(double x, double Q2) const
+{
+  return AllPDFs(x,Q2).uval;
+}
+//____________________________________________________________________________
+double CachedPDF::DownValence(double x, double Q2) const
+{
+  return AllPDFs(x,Q2).dval;
+}
+//____________________________________________________________________________
+double CachedPDF::UpSea(double x, double Q2) const
+{
+  return AllPDFs(x,Q2).usea;
+}
+//____________________________________________________________________________
+double CachedPDF::DownSea(double x, double Q2) const
+{
+  return AllPDFs(x,Q2).dsea;
+}
+//____________________________________________________________________________
+double CachedPDF::Strange(double x, double Q2) const
+{
+  return AllPDFs(x,Q2).str;
+}
+//____________________________________________________________________________
+double CachedPDF::Charm(double x, double Q2) const
+{
+  return AllPDFs(x,Q2).chm;
+}
+//____________________________________________________________________________
+double CachedPDF::Bottom(double x, double Q2) const
+{
+  return AllPDFs(x,Q2).bot;
+}
+//____________________________________________________________________________
+double CachedPDF::Top(double x, double Q2) const
+{
+  return AllPDFs(x,Q2).top;
+}
+//____________________________________________________________________________
+double CachedPDF::Gluon(double x, double Q2) const
+{
+  return AllPDFs(x,Q2).gl;
+}
+//____________________________________________________________________________
+bool CachedPDF::InGrid(double x, double Q2) const
+{
+  if(fGrid.empty()) return false;
+  return (x >= fXMin && x <= fXMax && Q2 >= fQ2Min && Q2 <= fQ2Max);
+}
+//____________________________________________________________________________
+PDF_t CachedPDF::AllPDFs(double x, double Q2) const
+{
+  if(!this->InGrid(x,Q2)) {
+    return fBasePDFModel->AllPDFs(x,Q2);
+  }
+
+  double ux, uq;
+  int ix = Stencil( (std::log(x)  - fLogXMin ) / fDLogX,  fNLogX,  ux );
+  int iq = Stencil( (std::log(Q2) - fLogQ2Min) / fDLogQ2, fNLogQ2, uq );
+
+  double wx[4], wq[4];
+  CubicWeights(ux, wx);
+  CubicWeights(uq, wq);
+
+  PDF_t pdf;
+  pdf.uval = 0.;
+  pdf.dval = 0.;
+  pdf.usea = 0.;
+  pdf.dsea = 0.;
+  pdf.str  = 0.;
+  pdf.chm  = 0.;
+  pdf.bot  = 0.;
+  pdf.top  = 0.;
+  pdf.gl   = 0.;
+
+  for(int i = 0; i < 4; i++) {
+    const PDF_t * row = &fGrid[ (iq+i)*fNLogX + ix ];
+    for(int j = 0; j < 4; j++) {
+      AddScaled(pdf, row[j], wq[i]*wx[j]);
+    }
+  }
+
+  return pdf;
+}
+//____________________________________________________________________________
+void CachedPDF::Configure(const Registry & config)
+{
+  Algorithm::Configure(config);
+  this->LoadConfig();
+}
+//____________________________________________________________________________
+void CachedPDF::Configure(string config)
+{
+  Algorithm::Configure(config);
+  this->LoadConfig();
+}
+//____________________________________________________________________________
+void CachedPDF::LoadConfig(void)
+{
+  fBasePDFModel =
+    dynamic_cast<const PDFModelI *>(this->SubAlg("Base-PDF-Set"));
+  assert(fBasePDFModel);
+
+  GetParam( "NLogX",  fNLogX  );
+  GetParam( "NLogQ2", fNLogQ2 );
+  GetParam( "XMin",   fXMin   );
+  GetParam( "XMax",   fXMax   );
+  GetParam( "Q2Min",  fQ2Min  );
+  GetParam( "Q2Max",  fQ2Max  );
+
+  if(fNLogX < 4 || fNLogQ2 < 4 || fXMin <= 0. || fXMax <= fXMin ||
+     fQ2Min <= 0. || fQ2Max <= fQ2Min) {
+    LOG("CachedPDF", pFATAL)
+      << "Invalid PDF grid: " << fNLogX << " x points in [" << fXMin << ", " << fXMax
+      << "], " << fNLogQ2 << " Q2 points in [" << fQ2Min << ", " << fQ2Max << "]";
+    exit(1);
+  }
+
+  this->BuildGrid();
+}
+//____________________________________________________________________________
+void CachedPDF::BuildGrid(void)
+{
+  fLogXMin  = std::log(fXMin);
+  fLogQ2Min = std::log(fQ2Min);
+  fDLogX    = (std::log(fXMax)  - fLogXMin ) / (fNLogX  - 1);
+  fDLogQ2   = (std::log(fQ2Max) - fLogQ2Min) / (fNLogQ2 - 1);
+
+  LOG("CachedPDF", pNOTICE)
+    << "Tabulating " << fBasePDFModel->Id().Key() << " on a "
+    << fNLogX << " x " << fNLogQ2 << " log(x), log(Q2) grid; x in ["
+    << fXMin << ", " << fXMax << "], Q2 in [" << fQ2Min << ", " << fQ2Max << "] GeV^2";
+
+  fGrid.resize(fNLogX * fNLogQ2);
+  for(int iq = 0; iq < fNLogQ2; iq++) {
+    double Q2 = std::exp(fLogQ2Min + iq * fDLogQ2);
+    if(iq == fNLogQ2 - 1) Q2 = fQ2Max;
+    for(int ix = 0; ix < fNLogX; ix++) {
+      double x = std::exp(fLogXMin + ix * fDLogX);
+      if(ix == fNLogX - 1) x = fXMax;
+      fGrid[iq*fNLogX + ix] = fBasePDFModel->AllPDFs(x,Q2);
+    }
+  }
+}
+//____________________________________________________________________________
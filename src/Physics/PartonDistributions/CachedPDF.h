@@ -0,0 +1,92 @@
+//____________________________________________________________________________
+/*!
+
+\class    genie::CachedPDF
+
+\brief    PDFModelI wrapper serving the PDFs of another PDFModelI from a
+          grid precomputed at configuration time.
+          Concrete implementation of the PDFModelI interface.
+
+\details  All flavours of the base PDF model are tabulated on a grid uniform
+          in log(x) and log(Q2). Lookups inside the grid use one bicubic
+          (4x4 points Lagrange) interpolation, whose weights are shared by
+          all flavours. Lookups outside the grid are passed to the base PDF
+          model. The interpolation accuracy is set by the grid density; it
+          can be checked against the base PDF model with gpdfcachevalid.
+
+\author   The GENIE Collaboration
+
+\created  October 16, 2026
+
+\cpright  Copyright (c) 2003-2023, The GENIE Collaboration
+          For the full text of the license visit http://copyright.genie-mc.org
+*/
+//____________________________________________________________________________
+
+#ifndef _CACHED_PDF_H_
+#define _CACHED_PDF_H_
+
+#include <vector>
+
+#include "Physics/PartonDistributions/PDFModelI.h"
+
+namespace genie {
+
+class CachedPDF : public PDFModelI {
+
+public:
+
+  CachedPDF();
+  CachedPDF(string config);
+  virtual ~CachedPDF();
+
+  // implement the PDFModelI interface
+  double UpValence   (double x, double Q2) const;
+  double DownValence (double x, double Q2) const;
+  double UpSea       (double x, double Q2) const;
+  double DownSea     (double x, double Q2) const;
+  double Strange     (double x, double Q2) const;
+  double Charm       (double x, double Q2) const;
+  double Bottom      (double x, double Q2) const;
+  double Top         (double x, double Q2) const;
+  double Gluon       (double x, double Q2) const;
+  PDF_t  AllPDFs     (double x, double Q2) const;
+
+  // access to the wrapped PDF model and the grid limits
+  const PDFModelI * BasePDFModel (void) const { return fBasePDFModel; }
+  bool   InGrid (double x, double Q2) const;
+  double XMin   (void) const { return fXMin;  }
+  double XMax   (void) const { return fXMax;  }
+  double Q2Min  (void) const { return fQ2Min; }
+  double Q2Max  (void) const { return fQ2Max; }
+
+  // override the default "Configure" implementation
+  // of the Algorithm interface
+  void Configure (const Registry & config);
+  void Configure (string config);
+
+private:
+
+  void LoadConfig (void);
+  void BuildGrid  (void);
+
+  const PDFModelI * fBasePDFModel; ///< tabulated PDF model
+
+  int    fNLogX;    ///< number of grid points in log(x)
+  int    fNLogQ2;   ///< number of grid points in log(Q2)
+  double fXMin;     ///< grid limits
+  double fXMax;
+  double fQ2Min;
+  double fQ2Max;
+
+  double fLogXMin;
+  double fLogQ2Min;
+  double fDLogX;    ///< grid spacing in log(x)
+  double fDLogQ2;   ///< grid spacing in log(Q2)
+
+  std::vector<PDF_t> fGrid;  ///< PDFs at (log(Q2), log(x)), log(x) running fastest
+};
+
+}         // genie namespace
+
+#endif    // _CACHED_PDF_H_
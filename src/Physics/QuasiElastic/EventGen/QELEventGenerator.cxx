@@ -202,6 +202,8 @@ void QELEventGenerator::ProcessEventRecord(GHepRecord * evrec) const
 #endif
         accept = (t < xsec);
 
+        this->CountTrial(accept);
+
         // If the generated kinematics are accepted, finish-up module's job
         if(accept) {
             double gQ2 = interaction->KinePtr()->Q2(false);
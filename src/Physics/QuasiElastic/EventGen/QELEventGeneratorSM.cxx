@@ -203,6 +203,8 @@ void QELEventGeneratorSM::ProcessEventRecord(GHepRecord * evrec) const
         accept = (xsec>0);
      }
 
+     this->CountTrial(accept);
+
      // If the generated kinematics are accepted, finish-up module's job
      if(accept)
      {
@@ -225,6 +225,7 @@ void QELEventGeneratorSuSA::SelectLeptonKinematics (GHepRecord * event) const
           // decide whether to accept or reject these kinematics
           this->AssertXSecLimits( interaction, XSec, XSecMax );
           accept = XSec > XSecMax*rnd->RndKine().Rndm();
+          this->CountTrial(accept);
           LOG("QELEvent", pINFO) << "Xsec, Max, Accept: " << XSec << ", "
               << XSecMax << ", " << accept;
               LOG("QELEvent", pDEBUG) << "XSec in cm2 /neutron is  " << XSec/(units::cm2*pdg::IonPdgCodeToZ(TgtPDG));
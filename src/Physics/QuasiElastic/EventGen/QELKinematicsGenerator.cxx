@@ -163,6 +163,8 @@ void QELKinematicsGenerator::ProcessEventRecord(GHepRecord * evrec) const
         accept = (xsec>0);
      }
 
+     this->CountTrial(accept);
+
      //-- If the generated kinematics are accepted, finish-up module's job
      if(accept) {
         LOG("QELKinematics", pINFO) << "Selected: Q^2 = " << gQ2;
@@ -382,6 +384,8 @@ void QELKinematicsGenerator::SpectralFuncExperimentalCode(
 //        accept = (xsec>0);
 //     }
 
+     this->CountTrial(accept);
+
      //-- If the generated kinematics are accepted, finish-up module's job
      if(accept) {
         LOG("QELKinematics", pNOTICE) << "Selected: Q^2 = " << gQ2;
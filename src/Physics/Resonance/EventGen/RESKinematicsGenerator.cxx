@@ -71,9 +71,6 @@ void RESKinematicsGenerator::ProcessEventRecord(GHepRecord * evrec) const
   Interaction * interaction = evrec->Summary();
   interaction->SetBit(kISkipProcessChk);
 
-  //-- EM or CC/NC process (different importance sampling methods)
-  bool is_em = interaction->ProcInfo().IsEM();
-
   //-- Compute the W limits
   //  (the physically allowed W's, unless an external cut is imposed)
   const KPhaseSpace & kps = interaction->PhaseSpace();
@@ -96,8 +93,13 @@ void RESKinematicsGenerator::ProcessEventRecord(GHepRecord * evrec) const
   //   cache. Throw an exception and quit the evg thread if a non-positive
   //   value is found.
   //   If the kinematics are generated uniformly over the allowed phase
-  //   space the max xsec is irrelevant
-  double xsec_max = (fGenerateUniformly) ? -1 : this->MaxXSec(evrec);
+  //   space the max xsec is irrelevant.
+  //   If an adaptive proposal is used, (W,QD2) are drawn from it and the
+  //   proposal envelope replaces the max xsec.
+  AdaptiveProposal * proposal = this->Proposal(interaction);
+  double xsec_max = (fGenerateUniformly || proposal) ? -1 : this->MaxXSec(evrec);
+  double u[2] = { 0., 0. };
+  int cell = -1;
 
   //-- Try to select a valid W, Q2 pair using the rejection method
   double dW   = W.max - W.min;
@@ -139,21 +141,17 @@ void RESKinematicsGenerator::ProcessEventRecord(GHepRecord * evrec) const
         // neutrino scattering
         // Selecting unweighted event kinematics using an importance sampling
         // method. Q2 with be transformed to QD2 to take out the dipole form.
-        interaction->KinePtr()->SetW(W.min);
-        Range1D_t Q2 = kps.Q2Lim_W();
-        double Q2min  = -99.;
-        if (is_em) 
-            Q2min  = Q2.min + kASmallNum; 
-        else 
-            Q2min  = 0 + kASmallNum;
-        double Q2max  = Q2.max - kASmallNum;
-        
-        // In unweighted mode - use transform that takes out the dipole form
-        double QD2min = utils::kinematics::Q2toQD2(Q2max);
-        double QD2max = utils::kinematics::Q2toQD2(Q2min);
-        
-        gW  = W.min + dW  * rnd->RndKine().Rndm();
-        gQD2 = QD2min + (QD2max - QD2min) * rnd->RndKine().Rndm();
+        double QD2min = 0., QD2max = 0.;
+        this->QD2Limits(interaction, W.min, QD2min, QD2max);
+
+        if(proposal) {
+          xsec_max = this->SampleProposal(proposal, u, cell);
+          gW   = W.min + dW * u[0];
+          gQD2 = QD2min + (QD2max - QD2min) * u[1];
+        } else {
+          gW  = W.min + dW  * rnd->RndKine().Rndm();
+          gQD2 = QD2min + (QD2max - QD2min) * rnd->RndKine().Rndm();
+        }
          
         // QD2 -> Q2
         gQ2 = utils::kinematics::QD2toQ2(gQD2);
@@ -173,13 +171,15 @@ void RESKinematicsGenerator::ProcessEventRecord(GHepRecord * evrec) const
      {
        // unified neutrino / electron scattering
        double t   = xsec_max * rnd->RndKine().Rndm();
-       this->AssertXSecLimits(interaction, xsec, xsec_max);
+       if(proposal) this->CheckProposal(proposal, cell, interaction, xsec, xsec_max);
+       else         this->AssertXSecLimits(interaction, xsec, xsec_max);
        accept = (t < xsec);
      } // charged lepton or neutrino scattering?
      else 
      {
         accept = (xsec>0);
      } // uniformly over phase space
+     this->CountTrial(accept);
 
      //-- If the generated kinematics are accepted, finish-up module's job
      if(accept) {
@@ -257,6 +257,9 @@ void RESKinematicsGenerator::LoadConfig(void)
   // an event weight?
   this->GetParamDef("UniformOverPhaseSpace", fGenerateUniformly, false);
 
+  // Adaptive proposal for the rejection method
+  this->LoadProposalConfig();
+
   // Envelope employed when importance sampling is used
   // (initialize with dummy range)
   if(fEnvelope) delete fEnvelope;
@@ -266,6 +269,51 @@ void RESKinematicsGenerator::LoadConfig(void)
   gROOT->GetListOfFunctions()->Remove(fEnvelope);
 }
 //____________________________________________________________________________
+void RESKinematicsGenerator::QD2Limits(Interaction * interaction,
+                         double Wmin, double & QD2min, double & QD2max) const
+{
+// QD2 range used for importance sampling, computed from the Q2 limits at the
+// lowest W (Q2 is transformed to QD2 to take out the dipole form)
+
+  bool is_em = interaction->ProcInfo().IsEM();
+  const KPhaseSpace & kps = interaction->PhaseSpace();
+
+  interaction->KinePtr()->SetW(Wmin);
+  Range1D_t Q2 = kps.Q2Lim_W();
+  double Q2min  = -99.;
+  if (is_em) 
+      Q2min  = Q2.min + kASmallNum; 
+  else 
+      Q2min  = 0 + kASmallNum;
+  double Q2max  = Q2.max - kASmallNum;
+
+  QD2min = utils::kinematics::Q2toQD2(Q2max);
+  QD2max = utils::kinematics::Q2toQD2(Q2min);
+}
+//____________________________________________________________________________
+double RESKinematicsGenerator::ProposalXSec(
+                         Interaction * interaction, const double * u) const
+{
+// Cross section at the point u of the unit square, mapped onto the (W,QD2)
+// range in the same way as in ProcessEventRecord
+
+  const KPhaseSpace & kps = interaction->PhaseSpace();
+  Range1D_t W = kps.Limits(kKVW);
+  if(W.max <=0 || W.min>=W.max) return 0.;
+
+  double QD2min = 0., QD2max = 0.;
+  this->QD2Limits(interaction, W.min, QD2min, QD2max);
+
+  double gW   = W.min + (W.max - W.min) * u[0];
+  double gQD2 = QD2min + (QD2max - QD2min) * u[1];
+  double gQ2  = utils::kinematics::QD2toQ2(gQD2);
+
+  interaction->KinePtr()->SetW(gW);
+  interaction->KinePtr()->SetQ2(gQ2);
+
+  return fXSecModel->XSec(interaction, kPSWQD2fE);
+}
+//____________________________________________________________________________
 double RESKinematicsGenerator::ComputeMaxXSec(
                                        const Interaction * interaction) const
 {
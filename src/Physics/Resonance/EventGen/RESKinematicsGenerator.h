@@ -44,6 +44,10 @@ public :
 private:
   void   LoadConfig      (void);
   double ComputeMaxXSec  (const Interaction * interaction) const;
+  int    ProposalDim     (void) const { return 2; }
+  double ProposalXSec    (Interaction * interaction, const double * u) const;
+  void   QD2Limits       (Interaction * interaction, double Wmin,
+                          double & QD2min, double & QD2max) const;
 
   mutable TF2 * fEnvelope; ///< 2-D envelope used for importance sampling
   double fWcut;            ///< Wcut parameter in DIS/RES join scheme
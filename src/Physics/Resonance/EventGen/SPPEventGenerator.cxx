@@ -168,6 +168,8 @@ void SPPEventGenerator::ProcessEventRecord(GHepRecord * evrec) const
         accept = (xsec>0);
      }
      
+     this->CountTrial(accept);
+
      // If the generated kinematics are accepted, finish-up module's job
      if(accept)
      {
@@ -23,6 +23,7 @@
 #include "Framework/Numerical/GSLUtils.h"
 #include "Physics/Resonance/XSection/RESXSec.h"
 #include "Physics/XSectionIntegration/GSLXSecFunc.h"
+#include "Physics/XSectionIntegration/XSecIntegrationContext.h"
 
 using namespace genie;
 using namespace genie::constants;
@@ -62,18 +63,24 @@ double RESXSec::Integrate(
   interaction->SetBit(kISkipProcessChk);
   //interaction->SetBit(kISkipKinematicChk);
 
-  ROOT::Math::IBaseFunctionMultiDim * func =
-      new utils::gsl::d2XSec_dWdQ2_E(model, interaction);
+  utils::gsl::d2XSec_dWdQ2_E func(model, interaction);
 
   ROOT::Math::IntegrationMultiDim::Type ig_type =
       utils::gsl::IntegrationNDimTypeFromString(fGSLIntgType);
   double abstol = 1E-16; //We mostly care about relative tolerance.
 
-  ROOT::Math::IntegratorMultiDim ig(*func, ig_type, abstol, fGSLRelTol, fGSLMaxEval);
+  // The integrator is shared by all the interactions integrated by this
+  // algorithm. Its adapted grid is kept only while the interaction (channel
+  // and resonance) stays the same.
+  XSecIntegrationContext * ctx = XSecIntegrationContext::Instance();
+  ROOT::Math::IntegratorMultiDim & ig = ctx->Integrator(
+        this->Id().Key(), 2, ig_type, abstol, fGSLRelTol, fGSLMaxEval);
 
   double kine_min[2] = { Wl.min, Q2l.min };
   double kine_max[2] = { Wl.max, Q2l.max };
-  double xsec = ig.Integral(kine_min, kine_max) * (1E-38 * units::cm2);
+  string gkey = model->Id().Key() + "/" + interaction->AsString();
+  double xsec = ctx->Integral(this->Id().Key(), gkey, func, kine_min, kine_max)
+                  * (1E-38 * units::cm2);
 
   LOG("RESXSec", pERROR)  << "Integrator opt / Integrator = " <<  ig.Options().Integrator();
 
@@ -87,7 +94,6 @@ double RESXSec::Integrate(
   //LOG("RESXSec", pINFO)  << "XSec[RES] (Ev = " << Ev << " GeV) = " << xsec;
 
   delete interaction;
-  delete func;
   return xsec;
 }
 //____________________________________________________________________________
@@ -218,5 +218,7 @@ void ReinSehgalRESXSec::LoadConfig(void)
   GetParam( "ResonanceNameList", resonances ) ;
   fResList.DecodeFromNameList(resonances);
 
+  // Digest of the configuration, for the keys of the cached integrals
+  this->SetCacheDigest();
 }
 //____________________________________________________________________________
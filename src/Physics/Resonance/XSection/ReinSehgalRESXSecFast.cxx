@@ -219,5 +219,8 @@ void ReinSehgalRESXSecFast::LoadConfig(void)
   string resonances ;
   GetParam( "ResonanceNameList", resonances ) ;
   fResList.DecodeFromNameList(resonances);
+
+  // Digest of the configuration, for the keys of the cached integrals
+  this->SetCacheDigest();
 }
 //____________________________________________________________________________
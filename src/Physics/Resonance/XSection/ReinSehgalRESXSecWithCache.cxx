@@ -101,10 +101,16 @@ void ReinSehgalRESXSecWithCache::CacheResExcitationXSec(
          // Get a unique cache branch name
          string key = this->CacheBranchName(res, wkcur, nu_code, nuc_code);
 
-         // Make sure the cache branch does not already exists
+         // Skip resonances already cached (eg read from a cache store)
          CacheBranchFx * cache_branch =
              dynamic_cast<CacheBranchFx *> (cache->FindCacheBranch(key));
-         assert(!cache_branch);
+         if(cache_branch) continue;
+
+         if(cache->HasCacheStore()) {
+           LOG("ReinSehgalResC", pWARN)
+             << "Cache branch not found in the cache store: " << key
+             << " - Integrating at runtime";
+         }
 
          // Create the new cache branch
          LOG("ReinSehgalResC", pNOTICE)
@@ -201,7 +207,8 @@ string ReinSehgalRESXSecWithCache::CacheBranchName(
 
   ostringstream intk;
   intk << "ResExcitationXSec/R:" << res_name << ";nu:"  << nupdgc
-           << ";int:" << it_name << nc_nuc;
+           << ";int:" << it_name << nc_nuc
+           << ";cfg:" << this->CacheDigest(fSingleResXSecModel);
 
   string algkey = fSingleResXSecModel->Id().Key();
   string ikey   = intk.str();
@@ -178,5 +178,7 @@ void ReinSehgalSPPXSec::LoadConfig(void)
   GetParam( "ResonanceNameList", resonances ) ;
   fResList.DecodeFromNameList(resonances);
 
+  // Digest of the configuration, for the keys of the cached integrals
+  this->SetCacheDigest();
 }
 //____________________________________________________________________________
@@ -248,7 +248,9 @@ void SPPXSec::LoadConfig(void)
     exit( 78 ) ;
     
   }
-  
+
+  // Digest of the configuration, for the keys of the cached integrals
+  this->SetCacheDigest();
 }
 //____________________________________________________________________________
 
@@ -116,6 +116,12 @@ void SPPXSecWithCache::CacheResExcitationXSec(const Interaction * in) const
     dynamic_cast<CacheBranchFx *> (cache->FindCacheBranch(key));
   assert(!cache_branch);
   
+  if(cache->HasCacheStore()) {
+    LOG("SPPCache", pWARN)
+      << "Cache branch not found in the cache store: " << key
+      << " - Integrating at runtime";
+  }
+
   // Create the new cache branch
   LOG("SPPCache", pNOTICE)
     << "\n ** Creating cache branch - key = " << key;
@@ -204,7 +210,8 @@ string SPPXSecWithCache::CacheBranchName(
   
   ostringstream intk;
   intk << "ResSPPXSec/Ch:" << spp_channel_name << nc_nuc  << nupdgc
-       << ";int:" << it_name;
+       << ";int:" << it_name
+       << ";cfg:" << this->CacheDigest(fSinglePionProductionXSecModel);
 
   string algkey = fSinglePionProductionXSecModel->Id().Key();
   string ikey   = intk.str();
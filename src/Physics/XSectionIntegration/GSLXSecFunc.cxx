@@ -142,8 +142,8 @@ double genie::utils::gsl::dXSec_dEDNu_E::DoEval(double xin) const
   double fDNuMass2 = fDNuMass*fDNuMass;
 
   Kinematics * kinematics = fInteraction->KinePtr();
-  const TLorentzVector * P4_nu = fInteraction->InitStatePtr()->GetProbeP4(kRfLab);
-  double E_nu = P4_nu->E();
+  const TLorentzVector & P4_nu = fInteraction->InitState().ProbeP4Lab();
+  double E_nu = P4_nu.E();
   double M_target = fInteraction->InitState().Tgt().Mass();
 
   double ETimesM = E_nu * M_target;
@@ -157,13 +157,12 @@ double genie::utils::gsl::dXSec_dEDNu_E::DoEval(double xin) const
   TLorentzVector P4_DNu = TLorentzVector(DNu_3vector, DNuEnergy);
   kinematics->SetFSLeptonP4(P4_DNu);
 
-  TVector3 target_3vector = P4_nu->Vect() - DNu_3vector;
+  TVector3 target_3vector = P4_nu.Vect() - DNu_3vector;
   double E_target = E_nu + M_target - DNuEnergy;
   TLorentzVector P4_target = TLorentzVector(target_3vector , E_target);
   kinematics->SetHadSystP4(P4_target);
   kinematics->SetQ2(2.*M_target*(E_target-M_target));
 
-  delete P4_nu;
   double xsec = fModel->XSec(fInteraction, kPSEDNufE);
 #ifdef __GENIE_LOW_LEVEL_MESG_ENABLED__
   LOG("GSLXSecFunc", pDEBUG) << "xsec(DNuEnergy = " << DNuEnergy << ") = " << xsec;
@@ -622,8 +621,8 @@ double genie::utils::gsl::d5XSecAR::DoEval(const double * xin) const
 //
 
   Kinematics * kinematics = fInteraction->KinePtr();
-  const TLorentzVector * P4_nu = fInteraction->InitStatePtr()->GetProbeP4(kRfLab);
-  double E_nu       = P4_nu->E();
+  const TLorentzVector & P4_nu = fInteraction->InitState().ProbeP4Lab();
+  double E_nu       = P4_nu.E();
 
   double E_l       = xin[0];
   double theta_l   = xin[1];
@@ -659,7 +658,7 @@ double genie::utils::gsl::d5XSecAR::DoEval(const double * xin) const
   pion_3vector.SetMagThetaPhi(p_pi,theta_pi,phi_pi);
   TLorentzVector P4_pion   = TLorentzVector(pion_3vector   , E_pi);
 
-  double Q2 = -(*P4_nu-P4_lep).Mag2();
+  double Q2 = -(P4_nu-P4_lep).Mag2();
 
   double x = Q2/(2*E_pi*constants::kNucleonMass);
 
@@ -680,7 +679,6 @@ double genie::utils::gsl::d5XSecAR::DoEval(const double * xin) const
   if (xsec>0 && flip) {
     xsec = xsec*-1.0;
   }
-  delete P4_nu;
   //return xsec/(1E-38 * units::cm2);
   return xsec;
 }
@@ -721,8 +719,8 @@ double genie::utils::gsl::d5Xsec_dEldOmegaldOmegapi::DoEval(const double * xin)
 //   differential cross section [10^-38 cm^2]
 //
   Kinematics * kinematics = fInteraction->KinePtr();
-  const TLorentzVector * P4_nu = fInteraction->InitStatePtr()->GetProbeP4(kRfLab);
-  double E_nu       = P4_nu->E();
+  const TLorentzVector & P4_nu = fInteraction->InitState().ProbeP4Lab();
+  double E_nu       = P4_nu.E();
 
   double E_l       = xin[0];
   double theta_l   = xin[1];
@@ -757,7 +755,7 @@ double genie::utils::gsl::d5Xsec_dEldOmegaldOmegapi::DoEval(const double * xin)
   pion_3vector.SetMagThetaPhi(p_pi,theta_pi,phi_pi);
   TLorentzVector P4_pion   = TLorentzVector(pion_3vector   , E_pi);
 
-  double Q2 = -(*P4_nu-P4_lep).Mag2();
+  double Q2 = -(P4_nu-P4_lep).Mag2();
 
   double x = Q2/(2*E_pi*constants::kNucleonMass);
 
@@ -774,7 +772,6 @@ double genie::utils::gsl::d5Xsec_dEldOmegaldOmegapi::DoEval(const double * xin)
   kinematics->SetFSLeptonP4(P4_lep );
   kinematics->SetHadSystP4 (P4_pion); // use Hadronic System variable to store pion momentum
 
-  delete P4_nu;
 
   double xsec = fModel->XSec(fInteraction)*TMath::Sin(theta_l)*TMath::Sin(theta_pi);
   return xsec/(1E-38 * units::cm2);
@@ -820,8 +817,8 @@ double genie::utils::gsl::d4Xsec_dEldThetaldOmegapi::DoEval(const double * xin)
 //   differential cross section [10^-38 cm^2]
 //
   Kinematics * kinematics = fInteraction->KinePtr();
-  const TLorentzVector * P4_nu = fInteraction->InitStatePtr()->GetProbeP4(kRfLab);
-  double E_nu       = P4_nu->E();
+  const TLorentzVector & P4_nu = fInteraction->InitState().ProbeP4Lab();
+  double E_nu       = P4_nu.E();
 
   double E_l       = xin[0];
   double theta_l   = xin[1];
@@ -859,7 +856,7 @@ double genie::utils::gsl::d4Xsec_dEldThetaldOmegapi::DoEval(const double * xin)
   pion_3vector.SetMagThetaPhi(p_pi,theta_pi,phi_pi);
   TLorentzVector P4_pion   = TLorentzVector(pion_3vector   , E_pi);
 
-  double Q2 = -(*P4_nu-P4_lep).Mag2();
+  double Q2 = -(P4_nu-P4_lep).Mag2();
 
   double x = Q2/(2*E_pi*constants::kNucleonMass);
 
@@ -876,7 +873,6 @@ double genie::utils::gsl::d4Xsec_dEldThetaldOmegapi::DoEval(const double * xin)
   kinematics->SetFSLeptonP4(P4_lep );
   kinematics->SetHadSystP4 (P4_pion); // use Hadronic System variable to store pion momentum
 
-  delete P4_nu;
 
   double xsec = sin_theta_l * sin_theta_pi * fModel->XSec(fInteraction,kPSElOlTpifE);
   return fFactor * xsec/(1E-38 * units::cm2);
@@ -923,8 +919,8 @@ double genie::utils::gsl::d3Xsec_dOmegaldThetapi::DoEval(const double * xin) con
 //   differential cross section [10^-38 cm^2]
 //
   Kinematics * kinematics = fInteraction->KinePtr();
-  const TLorentzVector * P4_nu = fInteraction->InitStatePtr()->GetProbeP4(kRfLab);
-  double E_nu = P4_nu->E();
+  const TLorentzVector & P4_nu = fInteraction->InitState().ProbeP4Lab();
+  double E_nu = P4_nu.E();
 
   double E_l = fElep;
 
@@ -963,7 +959,7 @@ double genie::utils::gsl::d3Xsec_dOmegaldThetapi::DoEval(const double * xin) con
   pion_3vector.SetMagThetaPhi(p_pi,theta_pi,phi_pi);
   TLorentzVector P4_pion   = TLorentzVector(pion_3vector   , E_pi);
 
-  double Q2 = -(*P4_nu-P4_lep).Mag2();
+  double Q2 = -(P4_nu-P4_lep).Mag2();
 
   double x = Q2/(2*E_pi*constants::kNucleonMass);
 
@@ -980,7 +976,6 @@ double genie::utils::gsl::d3Xsec_dOmegaldThetapi::DoEval(const double * xin) con
   kinematics->SetFSLeptonP4(P4_lep );
   kinematics->SetHadSystP4 (P4_pion); // use Hadronic System variable to store pion momentum
 
-  delete P4_nu;
 
   double xsec = (sin_theta_l * sin_theta_pi) * fModel->XSec(fInteraction,kPSElOlTpifE);
   return xsec/(1E-38 * units::cm2);
@@ -1045,7 +1040,8 @@ genie::utils::gsl::dXSec_Log_Wrapper::dXSec_Log_Wrapper(
   fFn(fn),
   fIfLog(ifLog),
   fMins(mins),
-  fMaxes(maxes)
+  fMaxes(maxes),
+  fToEval(fn->NDim())
 {
 }
 genie::utils::gsl::dXSec_Log_Wrapper::~dXSec_Log_Wrapper()
@@ -1061,7 +1057,7 @@ unsigned int genie::utils::gsl::dXSec_Log_Wrapper::NDim   (void) const
 //____________________________________________________________________________
 double genie::utils::gsl::dXSec_Log_Wrapper::DoEval (const double * xin) const
 {
-  double * toEval = new double[this->NDim()];
+  double * toEval = &fToEval[0];
   double a,b,x;
   for (unsigned int i = 0 ; i < this->NDim() ; i++ )
   {
@@ -1075,14 +1071,51 @@ double genie::utils::gsl::dXSec_Log_Wrapper::DoEval (const double * xin) const
       toEval[i] = xin[i];
     }
   }
-  double val = (*fFn)(toEval);
-  delete[] toEval;
-  return val;
+  return (*fFn)(toEval);
 }
 ROOT::Math::IBaseFunctionMultiDim * genie::utils::gsl::dXSec_Log_Wrapper::Clone (void) const
 {
   return new dXSec_Log_Wrapper(fFn,fIfLog,fMins,fMaxes);
 }
+//____________________________________________________________________________
+genie::utils::gsl::dXSec_UnitCube_Wrapper::dXSec_UnitCube_Wrapper(
+      const ROOT::Math::IBaseFunctionMultiDim * fn,
+      const double * mins, const double * maxes) :
+  fFn(fn),
+  fMins(mins, mins + fn->NDim()),
+  fWidths(fn->NDim()),
+  fVolume(1.),
+  fToEval(fn->NDim())
+{
+  for (unsigned int i = 0 ; i < fWidths.size() ; i++ ) {
+    fWidths[i] = maxes[i] - mins[i];
+    fVolume *= fWidths[i];
+  }
+}
+genie::utils::gsl::dXSec_UnitCube_Wrapper::~dXSec_UnitCube_Wrapper()
+{
+}
+//____________________________________________________________________________
+unsigned int genie::utils::gsl::dXSec_UnitCube_Wrapper::NDim (void) const
+{
+  return fFn->NDim();
+}
+//____________________________________________________________________________
+double genie::utils::gsl::dXSec_UnitCube_Wrapper::DoEval (const double * xin) const
+{
+  for (unsigned int i = 0 ; i < fToEval.size() ; i++ ) {
+    fToEval[i] = fMins[i] + xin[i] * fWidths[i];
+  }
+  return fVolume * (*fFn)(&fToEval[0]);
+}
+//____________________________________________________________________________
+ROOT::Math::IBaseFunctionMultiDim *
+   genie::utils::gsl::dXSec_UnitCube_Wrapper::Clone (void) const
+{
+  std::vector<double> maxes(fMins);
+  for (unsigned int i = 0 ; i < maxes.size() ; i++ ) maxes[i] += fWidths[i];
+  return new dXSec_UnitCube_Wrapper(fFn, &fMins[0], &maxes[0]);
+}
 
 //_____________________________________________________________________________
 genie::utils::gsl::d2Xsec_dn1dn2_E::d2Xsec_dn1dn2_E(
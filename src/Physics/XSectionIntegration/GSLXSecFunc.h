@@ -23,6 +23,7 @@
 #include "Framework/Utils/Range1.h"
 
 #include <string>
+#include <vector>
 using std::string;
 
 namespace genie {
@@ -470,6 +471,33 @@ class dXSec_Log_Wrapper: public ROOT::Math::IBaseFunctionMultiDim
     bool * fIfLog;
     double * fMins;
     double * fMaxes;
+    mutable std::vector<double> fToEval; ///< scratch, avoids an allocation per call
+};
+
+///.....................................................................................
+///
+/// dXSec_UnitCube_Wrapper
+/// Maps the unit hypercube onto the integration range [min, max] of the
+/// wrapped function, so that integrals over different ranges can share an
+/// adapted VEGAS grid (defined in the unit hypercube).
+class dXSec_UnitCube_Wrapper: public ROOT::Math::IBaseFunctionMultiDim
+{
+  public:
+    dXSec_UnitCube_Wrapper(const ROOT::Math::IBaseFunctionMultiDim * fn,
+                           const double * mins, const double * maxes);
+   ~dXSec_UnitCube_Wrapper();
+
+    // ROOT::Math::IBaseFunctionMultiDim interface
+    unsigned int                        NDim   (void)               const;
+    double                              DoEval (const double * xin) const;
+    ROOT::Math::IBaseFunctionMultiDim * Clone  (void)               const;
+
+  private:
+    const ROOT::Math::IBaseFunctionMultiDim * fFn;
+    std::vector<double> fMins;
+    std::vector<double> fWidths;
+    double fVolume;
+    mutable std::vector<double> fToEval;
 };
  
 //.....................................................................................
@@ -9,6 +9,7 @@
 #pragma link C++ namespace genie::utils::gsl;
 
 #pragma link C++ class genie::XSecIntegratorI;
+#pragma link C++ class genie::XSecIntegrationContext;
 
 // Wrappers for GSL/MathMore lib
 #pragma link C++ class genie::utils::gsl::dXSec_dQ2_E;
@@ -25,6 +26,7 @@
 #pragma link C++ class genie::utils::gsl::d3Xsec_dOmegaldThetapi;
 #pragma link C++ class genie::utils::gsl::dXSec_dElep_AR;
 #pragma link C++ class genie::utils::gsl::dXSec_Log_Wrapper;
+#pragma link C++ class genie::utils::gsl::dXSec_UnitCube_Wrapper;
 #pragma link C++ class genie::utils::gsl::d2Xsec_dn1dn2_E;
 #pragma link C++ class genie::utils::gsl::d2Xsec_dn1dn2dn3_E;
 
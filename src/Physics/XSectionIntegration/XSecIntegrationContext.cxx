@@ -0,0 +1,166 @@
+//____________________________________________________________________________
+/*
+ Copyright (c) 2003-2023, The GENIE Collaboration
+ For the full text of the license visit http://copyright.genie-mc.org
+
+ The GENIE Collaboration
+*/
+//____________________________________________________________________________
+
+#include <cstdlib>
+#include <iomanip>
+#include <vector>
+
+#include <Math/GSLMCIntegrator.h>
+#include <Math/MCParameters.h>
+
+#include "Framework/Messenger/Messenger.h"
+#include "Physics/XSectionIntegration/GSLXSecFunc.h"
+#include "Physics/XSectionIntegration/XSecIntegrationContext.h"
+
+using std::endl;
+using std::setw;
+
+using namespace genie;
+
+//____________________________________________________________________________
+namespace genie {
+  ostream & operator << (ostream & stream, const XSecIntegrationContext & ctx)
+  {
+    ctx.Print(stream);
+    return stream;
+  }
+}
+//____________________________________________________________________________
+XSecIntegrationContext * XSecIntegrationContext::fInstance = 0;
+//____________________________________________________________________________
+XSecIntegrationContext::XSecIntegrationContext() :
+fWarmStart(true)
+{
+  fInstance =  0;
+}
+//____________________________________________________________________________
+XSecIntegrationContext::~XSecIntegrationContext()
+{
+  this->Clear();
+  fInstance = 0;
+}
+//____________________________________________________________________________
+XSecIntegrationContext * XSecIntegrationContext::Instance()
+{
+  if(fInstance == 0) {
+    static XSecIntegrationContext::Cleaner cleaner;
+    cleaner.DummyMethodAndSilentCompiler();
+    fInstance = new XSecIntegrationContext;
+  }
+  return fInstance;
+}
+//____________________________________________________________________________
+ROOT::Math::IntegratorMultiDim & XSecIntegrationContext::Integrator(
+    const string & key, unsigned int ndim,
+    ROOT::Math::IntegrationMultiDim::Type type,
+    double abstol, double reltol, unsigned int maxcalls)
+{
+  Entry & entry = fEntries[key];
+
+  bool same = (entry.integrator != 0 &&
+               entry.type == type && entry.ndim == ndim &&
+               entry.abstol == abstol && entry.reltol == reltol &&
+               entry.maxcalls == maxcalls);
+  if(same) return *entry.integrator;
+
+  if(entry.integrator) {
+    LOG("XSecIntegrationContext", pINFO)
+      << "Settings changed - Recreating the integrator for: " << key;
+    delete entry.integrator;
+  }
+
+  entry.integrator = new ROOT::Math::IntegratorMultiDim(
+                                       type, abstol, reltol, maxcalls);
+  entry.type       = type;
+  entry.ndim       = ndim;
+  entry.abstol     = abstol;
+  entry.reltol     = reltol;
+  entry.maxcalls   = maxcalls;
+  entry.gridkey    = "";
+  entry.nintegrals = 0;
+  entry.nwarm      = 0;
+
+  return *entry.integrator;
+}
+//____________________________________________________________________________
+double XSecIntegrationContext::Integral(
+    const string & key, const string & grid_key,
+    const ROOT::Math::IBaseFunctionMultiDim & func,
+    const double * xmin, const double * xmax)
+{
+  map<string, Entry>::iterator it = fEntries.find(key);
+  if(it == fEntries.end() || it->second.integrator == 0) {
+    LOG("XSecIntegrationContext", pFATAL)
+      << "No integrator was created for: " << key;
+    exit(1);
+  }
+  Entry & entry = it->second;
+  ROOT::Math::IntegratorMultiDim & ig = *entry.integrator;
+
+  double result = 0.;
+
+  if(entry.type == ROOT::Math::IntegrationMultiDim::kVEGAS) {
+    // The VEGAS grid is defined in the unit hypercube: integrate there, so
+    // that the adapted grid remains meaningful for a different range
+    ROOT::Math::GSLMCIntegrator * vegas =
+      dynamic_cast<ROOT::Math::GSLMCIntegrator *>(ig.GetIntegrator());
+    bool warm = (fWarmStart && vegas != 0 && entry.nintegrals > 0 &&
+                 entry.gridkey == grid_key);
+    if(vegas) {
+      ROOT::Math::VegasParameters par;
+      par.stage = (warm) ? 1 : 0;
+      vegas->SetParameters(par);
+    }
+    if(warm) entry.nwarm++;
+
+    utils::gsl::dXSec_UnitCube_Wrapper unit_func(&func, xmin, xmax);
+    std::vector<double> umin(func.NDim(), 0.);
+    std::vector<double> umax(func.NDim(), 1.);
+    ig.SetFunction(unit_func);
+    result = ig.Integral(&umin[0], &umax[0]);
+  }
+  else {
+    ig.SetFunction(func);
+    result = ig.Integral(xmin, xmax);
+  }
+
+  entry.gridkey = grid_key;
+  entry.nintegrals++;
+
+  return result;
+}
+//____________________________________________________________________________
+void XSecIntegrationContext::Clear(void)
+{
+  map<string, Entry>::iterator it = fEntries.begin();
+  for( ; it != fEntries.end(); ++it) {
+    delete it->second.integrator;
+  }
+  fEntries.clear();
+}
+//____________________________________________________________________________
+void XSecIntegrationContext::Print(ostream & stream) const
+{
+  stream << "\n[-] Cross section integration context (warm start: "
+         << ((fWarmStart) ? "on" : "off") << ")" << endl;
+  stream << setw(50) << "integrator"  << " | "
+         << setw(5)  << "ndim"        << " | "
+         << setw(10) << "integrals"   << " | "
+         << setw(10) << "warm start"  << endl;
+
+  map<string, Entry>::const_iterator it = fEntries.begin();
+  for( ; it != fEntries.end(); ++it) {
+    const Entry & entry = it->second;
+    stream << setw(50) << it->first        << " | "
+           << setw(5)  << entry.ndim       << " | "
+           << setw(10) << entry.nintegrals << " | "
+           << setw(10) << entry.nwarm      << endl;
+  }
+}
+//____________________________________________________________________________
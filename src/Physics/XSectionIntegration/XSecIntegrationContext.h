@@ -0,0 +1,116 @@
+//____________________________________________________________________________
+/*!
+
+\class    genie::XSecIntegrationContext
+
+\brief    Keeps the numerical integrators used by the cross section
+          integrators alive between calls, so that their state is reused
+          when integrating at neighbouring energies and for related channels
+          (CC/NC, neutrino/anti-neutrino) with the same integrator key.
+
+\details  The GSL workspaces are allocated once per key. For the VEGAS
+          integration type, the integrand is mapped onto the unit hypercube
+          and the adapted importance sampling grid is kept (VEGAS stage 1)
+          rather than rebuilt from a uniform grid for the next integral with
+          the same grid key (the same interaction at another energy). The
+          grid is reset whenever the grid key changes, so an adapted grid is
+          never used for another channel or resonance.
+          Warm starting can be switched off, in which case every integral
+          starts from a uniform grid as before. Other integration types
+          only benefit from the reused workspace.
+
+\author   The GENIE Collaboration
+
+\created  October 16, 2026
+
+\cpright  Copyright (c) 2003-2023, The GENIE Collaboration
+          For the full text of the license visit http://copyright.genie-mc.org
+*/
+//____________________________________________________________________________
+
+#ifndef _XSEC_INTEGRATION_CONTEXT_H_
+#define _XSEC_INTEGRATION_CONTEXT_H_
+
+#include <map>
+#include <ostream>
+#include <string>
+
+#include <Math/IFunction.h>
+#include <Math/IntegratorMultiDim.h>
+
+using std::map;
+using std::ostream;
+using std::string;
+
+namespace genie {
+
+class XSecIntegrationContext;
+ostream & operator << (ostream & stream, const XSecIntegrationContext & ctx);
+
+class XSecIntegrationContext
+{
+public:
+  static XSecIntegrationContext * Instance(void);
+
+  //! integrator stored under the input key, (re)created if it does not
+  //! exist or if it was created with different settings
+  ROOT::Math::IntegratorMultiDim & Integrator (
+      const string & key, unsigned int ndim,
+      ROOT::Math::IntegrationMultiDim::Type type,
+      double abstol, double reltol, unsigned int maxcalls);
+
+  //! integrates the input function in [xmin, xmax] using the integrator
+  //! stored under the input key (see Integrator()). The adapted VEGAS grid
+  //! is reused only if the previous integral had the same grid key.
+  double Integral (const string & key, const string & grid_key,
+      const ROOT::Math::IBaseFunctionMultiDim & func,
+      const double * xmin, const double * xmax);
+
+  void SetWarmStart (bool on) { fWarmStart = on;   }
+  bool WarmStart    (void) const { return fWarmStart; }
+
+  //! deletes the stored integrators
+  void Clear (void);
+
+  void Print (ostream & stream) const;
+  friend ostream & operator << (ostream & stream, const XSecIntegrationContext & ctx);
+
+private:
+  XSecIntegrationContext();
+  XSecIntegrationContext(const XSecIntegrationContext & ctx);
+  virtual ~XSecIntegrationContext();
+
+  struct Entry {
+    Entry() : integrator(0), ndim(0), abstol(0.), reltol(0.),
+              maxcalls(0), gridkey(), nintegrals(0), nwarm(0) {}
+    ROOT::Math::IntegratorMultiDim *      integrator;
+    ROOT::Math::IntegrationMultiDim::Type type;
+    unsigned int  ndim;
+    double        abstol;
+    double        reltol;
+    unsigned int  maxcalls;
+    string        gridkey;   // grid key of the last integral
+    unsigned long nintegrals;
+    unsigned long nwarm;     // integrals started from an adapted grid
+  };
+
+  static XSecIntegrationContext * fInstance;
+
+  map<string, Entry> fEntries;
+  bool               fWarmStart;
+
+  struct Cleaner {
+      void DummyMethodAndSilentCompiler() { }
+      ~Cleaner() {
+         if (XSecIntegrationContext::fInstance !=0) {
+            delete XSecIntegrationContext::fInstance;
+            XSecIntegrationContext::fInstance = 0;
+         }
+      }
+  };
+  friend struct Cleaner;
+};
+
+}      // genie namespace
+
+#endif // _XSEC_INTEGRATION_CONTEXT_H_
@@ -8,25 +8,33 @@
 */
 //____________________________________________________________________________
 
+#include <TMD5.h>
+
 #include "Physics/XSectionIntegration/XSecIntegratorI.h"
 
 using namespace genie;
 
 //___________________________________________________________________________
 XSecIntegratorI::XSecIntegratorI() :
-Algorithm()
+Algorithm(),
+fCacheDigestModel(0),
+fCacheDigestGeneration(0)
 {
 
 }
 //___________________________________________________________________________
 XSecIntegratorI::XSecIntegratorI(string name) :
-Algorithm(name)
+Algorithm(name),
+fCacheDigestModel(0),
+fCacheDigestGeneration(0)
 {
 
 }
 //___________________________________________________________________________
 XSecIntegratorI::XSecIntegratorI(string name, string config) :
-Algorithm(name, config)
+Algorithm(name, config),
+fCacheDigestModel(0),
+fCacheDigestGeneration(0)
 {
 
 }
@@ -36,3 +44,46 @@ XSecIntegratorI::~XSecIntegratorI()
 
 }
 //___________________________________________________________________________
+void XSecIntegratorI::IntegrateBatch(
+   const XSecAlgorithmI * model, const Interaction * in,
+   const std::vector<double> & energies, std::vector<double> & xsec) const
+{
+  xsec.assign(energies.size(), 0.);
+
+  Interaction interaction(*in);
+  for(unsigned int i = 0; i < energies.size(); i++) {
+    interaction.InitStatePtr()->SetProbeOnShellE(energies[i]);
+    xsec[i] = this->Integrate(model, &interaction);
+  }
+}
+//___________________________________________________________________________
+void XSecIntegratorI::SetCacheDigest(void)
+{
+  fConfigDigest     = this->ConfigDigest();
+  fCacheDigestModel = 0;
+  fCacheDigest      = "";
+}
+//___________________________________________________________________________
+string XSecIntegratorI::CacheDigest(const XSecAlgorithmI * model) const
+{
+// The digest is recomputed whenever the model changes or any algorithm has
+// been reconfigured since the last call (the model or its sub-algorithms may
+// have a new configuration)
+
+  if(model == fCacheDigestModel && fCacheDigest.size() > 0 &&
+     fCacheDigestGeneration == Algorithm::ConfigGeneration()) {
+    return fCacheDigest;
+  }
+
+  string cfg = fConfigDigest + model->ConfigDigest();
+
+  TMD5 md5;
+  md5.Update( (const UChar_t *) cfg.c_str(), cfg.size() );
+  md5.Final();
+
+  fCacheDigestModel      = model;
+  fCacheDigestGeneration = Algorithm::ConfigGeneration();
+  fCacheDigest           = string(md5.AsString()).substr(0,16);
+  return fCacheDigest;
+}
+//___________________________________________________________________________
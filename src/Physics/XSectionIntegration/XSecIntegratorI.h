@@ -18,6 +18,8 @@
 #ifndef _XSEC_INTEGRATOR_I_H_
 #define _XSEC_INTEGRATOR_I_H_
 
+#include <vector>
+
 #include "Framework/Algorithm/Algorithm.h"
 #include "Framework/EventGen/XSecAlgorithmI.h"
 #include "Framework/Interaction/Interaction.h"
@@ -34,11 +36,28 @@ public:
   virtual double Integrate(const XSecAlgorithmI * model,
                            const Interaction * interaction
                        /*, const KPhaseSpaceCut * cut=0*/) const= 0;
+
+  // Integrate the model at each of the input (lab frame) probe energies.
+  // The default implementation calls Integrate() for each energy. Integrators
+  // can override it to share their setup and integrand across energies.
+  virtual void IntegrateBatch(const XSecAlgorithmI * model,
+                              const Interaction * interaction,
+                              const std::vector<double> & energies,
+                              std::vector<double> & xsec) const;
 protected:
   XSecIntegratorI();
   XSecIntegratorI(string name);
   XSecIntegratorI(string name, string config);
 
+  // Short digest of the configuration of this integrator and of the input
+  // model, to be included in the keys of cached integrals so that cached
+  // integrals read from a cache store are only used with the configuration
+  // they were computed with. The integrator part is computed by
+  // SetCacheDigest(), to be called from LoadConfig(), and the model part once
+  // per model until an algorithm is reconfigured.
+  void   SetCacheDigest (void);
+  string CacheDigest    (const XSecAlgorithmI * model) const;
+
   const IntegratorI * fIntegrator; ///< GENIE numerical integrator
 
   string fGSLIntgType;                     ///< name of GSL numerical integrator
@@ -48,6 +67,12 @@ protected:
   unsigned int fGSLMaxSizeOfSubintervals;  ///< GSL maximum number of sub-intervals for 1D integrator
   unsigned int fGSLRule;                   ///< GSL Gauss-Kronrod integration rule (only for GSL 1D adaptive type)
 
+private:
+  string                         fConfigDigest;      ///< digest of this integrator's configuration
+  mutable const XSecAlgorithmI * fCacheDigestModel;  ///< model of the last CacheDigest() call
+  mutable unsigned long          fCacheDigestGeneration; ///< Algorithm::ConfigGeneration() at that call
+  mutable string                 fCacheDigest;       ///< and its result
+
 };
 
 }       // genie namespace
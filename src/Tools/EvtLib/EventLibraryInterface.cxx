@@ -17,6 +17,7 @@
 #include "Framework/Interaction/Interaction.h"
 #include "Tools/EvtLib/EventLibraryInterface.h"
 #include "Tools/EvtLib/EvtLibRecordList.h"
+#include "Tools/EvtLib/EvtLibBinaryFile.h"
 #include "Tools/EvtLib/Utils.h"
 #include "Framework/Conventions/Constants.h"
 
@@ -28,7 +29,8 @@ using namespace genie::evtlib;
 //____________________________________________________________________________
 EventLibraryInterface::EventLibraryInterface() :
   EventRecordVisitorI("genie::evtlib::EventLibraryInterface"),
-  fRecordFile(0)
+  fRecordFile(0),
+  fBinaryLib(0)
 {
 
 }
@@ -36,7 +38,8 @@ EventLibraryInterface::EventLibraryInterface() :
 //____________________________________________________________________________
 EventLibraryInterface::EventLibraryInterface(string config) :
   EventRecordVisitorI("genie::evtlib::EventLibraryInterface", config),
-  fRecordFile(0)
+  fRecordFile(0),
+  fBinaryLib(0)
 {
 
 }
@@ -222,6 +225,8 @@ void EventLibraryInterface::Cleanup()
   fRecords.clear();
   delete fRecordFile;
   fRecordFile = 0;
+  delete fBinaryLib;
+  fBinaryLib = 0;
 }
 
 //___________________________________________________________________________
@@ -233,6 +238,13 @@ void EventLibraryInterface::LoadRecords()
   GetParam("EventLibraryPath", libPath);
   Expand(libPath);
 
+  // Libraries converted to the binary format (single files or shard indices)
+  // are memory-mapped rather than read from ROOT trees
+  if(BinaryLibrary::IsBinaryLibrary(libPath)){
+    LoadBinaryRecords(libPath);
+    return;
+  }
+
   bool onDemand;
   GetParam("OnDemand", onDemand);
 
@@ -292,6 +304,23 @@ void EventLibraryInterface::LoadRecords()
   if(!onDemand){delete fRecordFile; fRecordFile = 0;}
 }
 
+//___________________________________________________________________________
+void EventLibraryInterface::LoadBinaryRecords(const std::string& libPath)
+{
+  fBinaryLib = new BinaryLibrary(libPath);
+
+  for(const Key& key: fBinaryLib->Keys()){
+    const std::vector<BinaryLibrary::Shard>& shards = fBinaryLib->Shards(key);
+    uint64_t nrecs = 0;
+    for(const BinaryLibrary::Shard& shard: shards){
+      nrecs += shard.file->KeyEntry(shard.ikey).nrecs;
+    }
+    LOG("ELI", pINFO) << "Mapped " << nrecs << " records in " << shards.size()
+                      << " shard(s) for " << key << " from " << libPath;
+    fRecords[key] = new BinaryRecordList(shards);
+  }
+}
+
 //___________________________________________________________________________
 void EventLibraryInterface::FillKinematics( const GHepRecord & event,
 					    Kinematics& kine, 
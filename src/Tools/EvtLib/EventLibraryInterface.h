@@ -39,6 +39,7 @@ namespace evtlib {
 
 class IEvtLibRecordList;
 class EvtLibRecord;
+class BinaryLibrary;
 
 class EventLibraryInterface: public EventRecordVisitorI {
 
@@ -60,6 +61,7 @@ public:
   const EvtLibRecord* GetRecord(const Interaction* interaction) const;
 
   void LoadRecords();
+  void LoadBinaryRecords(const std::string& libPath);
   void Cleanup();
 
   void FillKinematics( const GHepRecord &,
@@ -70,6 +72,7 @@ private:
 
   std::map<Key, const IEvtLibRecordList*> fRecords;
   TFile* fRecordFile;
+  BinaryLibrary* fBinaryLib;
 };
 
 } // evtlib namespace
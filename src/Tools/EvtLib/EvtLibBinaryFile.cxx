@@ -0,0 +1,524 @@
+//____________________________________________________________________________
+/*
+ Copyright (c) 2003-2023, The GENIE Collaboration
+ For the full text of the license visit http://copyright.genie-mc.org
+
+ The GENIE Collaboration
+*/
+//____________________________________________________________________________
+
+#include "Tools/EvtLib/EvtLibBinaryFile.h"
+#include "Tools/EvtLib/EvtLibRecordList.h"
+
+#include "Framework/Messenger/Messenger.h"
+
+#include <algorithm>
+#include <cstring>
+#include <fstream>
+#include <iomanip>
+#include <sstream>
+
+#include <fcntl.h>
+#include <unistd.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+
+namespace genie{
+namespace evtlib{
+
+  //---------------------------------------------------------------------------
+  BinaryRecordFile::BinaryRecordFile(const std::string& fname)
+    : fFilename(fname), fData(0), fSize(0), fHeader(0), fKeys(0), fPdgs(0)
+  {
+    const int fd = open(fname.c_str(), O_RDONLY);
+    if(fd < 0){
+      LOG("ELI", pFATAL) << "Can not open event library " << fname;
+      exit(1);
+    }
+
+    struct stat st;
+    if(fstat(fd, &st) != 0 || size_t(st.st_size) < sizeof(binfmt::Header)){
+      LOG("ELI", pFATAL) << fname << " is not a binary event library";
+      exit(1);
+    }
+    fSize = st.st_size;
+
+    // Shared, read-only mapping: the pages are loaded on first use and shared
+    // by all processes reading the same library
+    void* data = mmap(0, fSize, PROT_READ, MAP_SHARED, fd, 0);
+    close(fd);
+    if(data == MAP_FAILED){
+      LOG("ELI", pFATAL) << "Can not map event library " << fname;
+      exit(1);
+    }
+    fData = static_cast<const char*>(data);
+
+    fHeader = At<binfmt::Header>(0);
+    Validate();
+    fKeys = At<binfmt::KeyEntry>(fHeader->key_offset);
+    fPdgs = At<int32_t>(fHeader->pdg_offset);
+  }
+
+  //---------------------------------------------------------------------------
+  BinaryRecordFile::~BinaryRecordFile()
+  {
+    if(fData) munmap(const_cast<char*>(fData), fSize);
+  }
+
+  //---------------------------------------------------------------------------
+  bool BinaryRecordFile::IsBinaryRecordFile(const std::string& fname)
+  {
+    FILE* f = fopen(fname.c_str(), "rb");
+    if(!f) return false;
+
+    char magic[sizeof(binfmt::kMagic)];
+    const bool ok = (fread(magic, sizeof(magic), 1, f) == 1 &&
+                     memcmp(magic, binfmt::kMagic, sizeof(magic)) == 0);
+    fclose(f);
+    return ok;
+  }
+
+  //---------------------------------------------------------------------------
+  void BinaryRecordFile::Validate() const
+  {
+    // Is the array [offset, offset + n*size) within the file?
+    auto inside = [this](uint64_t offset, uint64_t n, uint64_t size){
+      return offset <= fSize && n <= (fSize - offset) / size;
+    };
+
+    if(memcmp(fHeader->magic, binfmt::kMagic, sizeof(binfmt::kMagic)) != 0){
+      LOG("ELI", pFATAL) << fFilename << " is not a binary event library";
+      exit(1);
+    }
+    if(fHeader->byte_order != binfmt::kByteOrder){
+      LOG("ELI", pFATAL) << fFilename << " was written on a machine with different byte order";
+      exit(1);
+    }
+    if(fHeader->version != binfmt::kVersion){
+      LOG("ELI", pFATAL) << fFilename << " has format version " << fHeader->version
+                         << " (expected " << binfmt::kVersion << ")";
+      exit(1);
+    }
+
+    bool ok = inside(fHeader->key_offset, fHeader->nkeys, sizeof(binfmt::KeyEntry)) &&
+              inside(fHeader->pdg_offset, fHeader->npdgs, sizeof(int32_t));
+
+    for(uint32_t i = 0; ok && i < fHeader->nkeys; ++i){
+      const binfmt::KeyEntry& k = At<binfmt::KeyEntry>(fHeader->key_offset)[i];
+      ok = inside(k.energy_offset, k.nrecs,  sizeof(float))          &&
+           inside(k.record_offset, k.nrecs,  sizeof(binfmt::Record)) &&
+           inside(k.p4_offset,     k.nparts, 4*sizeof(float))        &&
+           inside(k.ipdg_offset,   k.nparts, sizeof(uint16_t))       &&
+           inside(k.xsec_offset,   k.nxsec,  2*sizeof(double));
+    }
+
+    if(!ok){
+      LOG("ELI", pFATAL) << fFilename << " is truncated or corrupted";
+      exit(1);
+    }
+  }
+
+  //---------------------------------------------------------------------------
+  Key BinaryRecordFile::GetKey(int ikey) const
+  {
+    const binfmt::KeyEntry& k = fKeys[ikey];
+    return Key(k.nucl_pdg, k.nu_pdg, k.iscc != 0);
+  }
+
+  //---------------------------------------------------------------------------
+  int BinaryRecordFile::FindKey(const Key& key) const
+  {
+    for(int i = 0; i < NKeys(); ++i){
+      const Key k = GetKey(i);
+      if(!(k < key) && !(key < k)) return i;
+    }
+    return -1;
+  }
+
+  //---------------------------------------------------------------------------
+  const float* BinaryRecordFile::Energies(int ikey) const
+  {
+    return At<float>(fKeys[ikey].energy_offset);
+  }
+
+  //---------------------------------------------------------------------------
+  const double* BinaryRecordFile::XSec(int ikey) const
+  {
+    return At<double>(fKeys[ikey].xsec_offset);
+  }
+
+  //---------------------------------------------------------------------------
+  void BinaryRecordFile::FillRecord(int ikey, uint64_t irec, EvtLibRecord& rec) const
+  {
+    const binfmt::KeyEntry& k = fKeys[ikey];
+    const binfmt::Record& r = At<binfmt::Record>(k.record_offset)[irec];
+
+    if(r.first_part + r.nparts > k.nparts){
+      LOG("ELI", pFATAL) << "Corrupted record " << irec << " for " << GetKey(ikey)
+                         << " in " << fFilename;
+      exit(1);
+    }
+
+    const float* p4 = At<float>(k.p4_offset) + 4*r.first_part;
+    const uint16_t* ipdg = At<uint16_t>(k.ipdg_offset) + r.first_part;
+
+    rec.E = Energies(ikey)[irec];
+    rec.prod_id = r.prod_id;
+    rec.parts.resize(r.nparts);
+    for(uint32_t j = 0; j < r.nparts; ++j){
+      EvtLibParticle& part = rec.parts[j];
+      part.pdg = (ipdg[j] < fHeader->npdgs) ? fPdgs[ipdg[j]] : 0;
+      part.E  = p4[4*j  ];
+      part.px = p4[4*j+1];
+      part.py = p4[4*j+2];
+      part.pz = p4[4*j+3];
+    } // end for j
+  }
+
+  //---------------------------------------------------------------------------
+  BinaryLibrary::BinaryLibrary(const std::string& path)
+  {
+    if(IsBinaryLibraryIndex(path)){
+      LoadIndex(path);
+    }
+    else{
+      BinaryRecordFile* file = new BinaryRecordFile(path);
+      fFiles.push_back(file);
+      for(int ikey = 0; ikey < file->NKeys(); ++ikey){
+        AddShard(file->GetKey(ikey), file, ikey);
+      }
+    }
+
+    CheckShards();
+  }
+
+  //---------------------------------------------------------------------------
+  BinaryLibrary::~BinaryLibrary()
+  {
+    for(BinaryRecordFile* file: fFiles) delete file;
+  }
+
+  //---------------------------------------------------------------------------
+  bool BinaryLibrary::IsBinaryLibrary(const std::string& path)
+  {
+    return BinaryRecordFile::IsBinaryRecordFile(path) || IsBinaryLibraryIndex(path);
+  }
+
+  //---------------------------------------------------------------------------
+  bool BinaryLibrary::IsBinaryLibraryIndex(const std::string& path)
+  {
+    std::ifstream fin(path.c_str());
+    std::string magic;
+    return (fin >> magic) && magic == binfmt::kIndexMagic;
+  }
+
+  //---------------------------------------------------------------------------
+  void BinaryLibrary::WriteIndex(const std::string& path,
+                                 const std::vector<ShardInfo>& shards)
+  {
+    std::ofstream fout(path.c_str());
+    fout << binfmt::kIndexMagic << " " << binfmt::kIndexVersion << "\n"
+         << "# nucl_pdg nu_pdg iscc nrecs Emin Emax file\n"
+         << std::setprecision(9);
+    for(const ShardInfo& s: shards){
+      fout << s.key.nucl_pdg << " " << s.key.nu_pdg << " " << s.key.iscc << " "
+           << s.nrecs << " " << s.Emin << " " << s.Emax << " " << s.file << "\n";
+    }
+
+    fout.close();
+    if(fout.fail()){
+      LOG("ELI", pFATAL) << "Failed writing event library index " << path;
+      exit(1);
+    }
+  }
+
+  //---------------------------------------------------------------------------
+  void BinaryLibrary::LoadIndex(const std::string& path)
+  {
+    std::ifstream fin(path.c_str());
+
+    std::string magic;
+    uint32_t version = 0;
+    fin >> magic >> version;
+    if(version != binfmt::kIndexVersion){
+      LOG("ELI", pFATAL) << path << " has index version " << version
+                         << " (expected " << binfmt::kIndexVersion << ")";
+      exit(1);
+    }
+
+    // Shard file names are relative to the directory of the index
+    const size_t slash = path.rfind('/');
+    const std::string dir = (slash == std::string::npos) ? "" : path.substr(0, slash+1);
+
+    std::map<std::string, BinaryRecordFile*> files;
+
+    std::string line;
+    while(std::getline(fin, line)){
+      if(line.find_first_not_of(" \t") == std::string::npos || line[0] == '#') continue;
+
+      std::istringstream is(line);
+      int nucl_pdg, nu_pdg, iscc;
+      uint64_t nrecs;
+      double Emin, Emax;
+      std::string fname;
+      if(!(is >> nucl_pdg >> nu_pdg >> iscc >> nrecs >> Emin >> Emax >> fname)){
+        LOG("ELI", pFATAL) << "Malformed line in event library index " << path
+                           << ": " << line;
+        exit(1);
+      }
+      if(fname[0] != '/') fname = dir + fname;
+
+      BinaryRecordFile*& file = files[fname];
+      if(!file){
+        file = new BinaryRecordFile(fname);
+        fFiles.push_back(file);
+      }
+
+      const Key key(nucl_pdg, nu_pdg, iscc != 0);
+      const int ikey = file->FindKey(key);
+      if(ikey < 0 || file->KeyEntry(ikey).nrecs != nrecs){
+        LOG("ELI", pFATAL) << "Event library shard " << fname << " does not match "
+                           << "the index " << path << " for " << key;
+        exit(1);
+      }
+
+      AddShard(key, file, ikey);
+    } // end while getline
+  }
+
+  //---------------------------------------------------------------------------
+  void BinaryLibrary::AddShard(const Key& key, const BinaryRecordFile* file, int ikey)
+  {
+    // Empty shards would only get in the way of the lookups
+    if(file->KeyEntry(ikey).nrecs == 0) return;
+
+    std::vector<Shard>& shards = fShards[key];
+    shards.push_back(Shard{file, ikey});
+    std::stable_sort(shards.begin(), shards.end(),
+                     [](const Shard& a, const Shard& b){
+                       return a.file->KeyEntry(a.ikey).Emin < b.file->KeyEntry(b.ikey).Emin;
+                     });
+  }
+
+  //---------------------------------------------------------------------------
+  void BinaryLibrary::CheckShards() const
+  {
+    // The energy ranges of the shards of a key may only touch at their ends,
+    // so that the first record above a given energy is in the first shard
+    // whose range reaches it
+    for(const auto& it: fShards){
+      const std::vector<Shard>& shards = it.second;
+      for(unsigned int i = 1; i < shards.size(); ++i){
+        const binfmt::KeyEntry& prev = shards[i-1].file->KeyEntry(shards[i-1].ikey);
+        const binfmt::KeyEntry& next = shards[i  ].file->KeyEntry(shards[i  ].ikey);
+        if(next.Emin < prev.Emax){
+          LOG("ELI", pFATAL) << "Overlapping energy ranges for " << it.first
+                             << " in " << shards[i-1].file->Filename()
+                             << " and " << shards[i].file->Filename();
+          exit(1);
+        }
+      }
+    }
+  }
+
+  //---------------------------------------------------------------------------
+  std::vector<Key> BinaryLibrary::Keys() const
+  {
+    std::vector<Key> keys;
+    for(const auto& it: fShards) keys.push_back(it.first);
+    return keys;
+  }
+
+  //---------------------------------------------------------------------------
+  const std::vector<BinaryLibrary::Shard>& BinaryLibrary::Shards(const Key& key) const
+  {
+    static const std::vector<Shard> kNoShards;
+    auto it = fShards.find(key);
+    return (it == fShards.end()) ? kNoShards : it->second;
+  }
+
+  //---------------------------------------------------------------------------
+  BinaryRecordWriter::BinaryRecordWriter(const std::string& fname)
+    : fFilename(fname), fFile(0), fPos(0), fInKey(false), fNRecsTotal(0)
+  {
+    fFile = fopen(fname.c_str(), "wb");
+    if(!fFile){
+      LOG("ELI", pFATAL) << "Can not create event library " << fname;
+      exit(1);
+    }
+
+    // Placeholder for the header, written once the tables are known
+    const binfmt::Header hdr = binfmt::Header();
+    Write(&hdr, sizeof(hdr));
+  }
+
+  //---------------------------------------------------------------------------
+  BinaryRecordWriter::~BinaryRecordWriter()
+  {
+    if(fFile) Close();
+  }
+
+  //---------------------------------------------------------------------------
+  void BinaryRecordWriter::Write(const void* buf, size_t size)
+  {
+    if(size == 0) return;
+    if(fwrite(buf, size, 1, fFile) != 1){
+      LOG("ELI", pFATAL) << "Failed writing event library " << fFilename;
+      exit(1);
+    }
+    fPos += size;
+  }
+
+  //---------------------------------------------------------------------------
+  void BinaryRecordWriter::Align()
+  {
+    const char zeros[8] = {0};
+    if(fPos % 8) Write(zeros, 8 - fPos % 8);
+  }
+
+  //---------------------------------------------------------------------------
+  void BinaryRecordWriter::BeginKey(const Key& key)
+  {
+    if(fInKey) EndKey();
+
+    for(const binfmt::KeyEntry& k: fKeys){
+      if(k.nucl_pdg == key.nucl_pdg && k.nu_pdg == key.nu_pdg &&
+         (k.iscc != 0) == key.iscc){
+        LOG("ELI", pFATAL) << key << " already written to " << fFilename;
+        exit(1);
+      }
+    }
+
+    fCurrentKey = binfmt::KeyEntry();
+    fCurrentKey.nucl_pdg = key.nucl_pdg;
+    fCurrentKey.nu_pdg = key.nu_pdg;
+    fCurrentKey.iscc = key.iscc;
+
+    fEnergies.clear();
+    fRecords.clear();
+    fIPdgs.clear();
+    fXSec.clear();
+
+    Align();
+    fCurrentKey.p4_offset = fPos;
+    fInKey = true;
+  }
+
+  //---------------------------------------------------------------------------
+  void BinaryRecordWriter::AddRecord(const EvtLibRecord& rec)
+  {
+    if(!fInKey){
+      LOG("ELI", pFATAL) << "BinaryRecordWriter::AddRecord() called outside of a key";
+      exit(1);
+    }
+    if(!fEnergies.empty() && rec.E < fEnergies.back()){
+      LOG("ELI", pFATAL) << "Records must be added in order of increasing energy ("
+                         << rec.E << " GeV after " << fEnergies.back() << " GeV)";
+      exit(1);
+    }
+
+    binfmt::Record r;
+    r.first_part = fIPdgs.size();
+    r.nparts = rec.parts.size();
+    r.prod_id = rec.prod_id;
+
+    std::vector<float> p4(4*rec.parts.size());
+    for(unsigned int j = 0; j < rec.parts.size(); ++j){
+      const EvtLibParticle& part = rec.parts[j];
+      p4[4*j  ] = part.E;
+      p4[4*j+1] = part.px;
+      p4[4*j+2] = part.py;
+      p4[4*j+3] = part.pz;
+
+      auto it = fPdgIndex.find(part.pdg);
+      if(it == fPdgIndex.end()){
+        if(fPdgs.size() >= binfmt::kMaxPdgCodes){
+          LOG("ELI", pFATAL) << "Too many distinct particle codes (limit "
+                             << binfmt::kMaxPdgCodes << ")";
+          exit(1);
+        }
+        it = fPdgIndex.insert(std::make_pair(part.pdg, uint16_t(fPdgs.size()))).first;
+        fPdgs.push_back(part.pdg);
+      }
+      fIPdgs.push_back(it->second);
+    } // end for j
+    Write(p4.data(), p4.size()*sizeof(float));
+
+    fEnergies.push_back(rec.E);
+    fRecords.push_back(r);
+    ++fNRecsTotal;
+  }
+
+  //---------------------------------------------------------------------------
+  void BinaryRecordWriter::SetXSec(const std::vector<std::pair<double, double>>& xsec)
+  {
+    fXSec = xsec;
+    std::sort(fXSec.begin(), fXSec.end());
+  }
+
+  //---------------------------------------------------------------------------
+  void BinaryRecordWriter::EndKey()
+  {
+    if(!fInKey) return;
+
+    fCurrentKey.nrecs  = fRecords.size();
+    fCurrentKey.nparts = fIPdgs.size();
+    fCurrentKey.nxsec  = fXSec.size();
+    fCurrentKey.Emin   = fEnergies.empty() ? 0 : fEnergies.front();
+    fCurrentKey.Emax   = fEnergies.empty() ? 0 : fEnergies.back();
+
+    Align();
+    fCurrentKey.ipdg_offset = fPos;
+    Write(fIPdgs.data(), fIPdgs.size()*sizeof(uint16_t));
+
+    Align();
+    fCurrentKey.energy_offset = fPos;
+    Write(fEnergies.data(), fEnergies.size()*sizeof(float));
+
+    Align();
+    fCurrentKey.record_offset = fPos;
+    Write(fRecords.data(), fRecords.size()*sizeof(binfmt::Record));
+
+    Align();
+    fCurrentKey.xsec_offset = fPos;
+    std::vector<double> xsec;
+    xsec.reserve(2*fXSec.size());
+    for(const auto& p: fXSec){xsec.push_back(p.first); xsec.push_back(p.second);}
+    Write(xsec.data(), xsec.size()*sizeof(double));
+
+    fKeys.push_back(fCurrentKey);
+    fInKey = false;
+  }
+
+  //---------------------------------------------------------------------------
+  void BinaryRecordWriter::Close()
+  {
+    if(!fFile) return;
+    EndKey();
+
+    binfmt::Header hdr = binfmt::Header();
+    memcpy(hdr.magic, binfmt::kMagic, sizeof(binfmt::kMagic));
+    hdr.version    = binfmt::kVersion;
+    hdr.byte_order = binfmt::kByteOrder;
+    hdr.nkeys      = fKeys.size();
+    hdr.npdgs      = fPdgs.size();
+
+    Align();
+    hdr.key_offset = fPos;
+    Write(fKeys.data(), fKeys.size()*sizeof(binfmt::KeyEntry));
+
+    Align();
+    hdr.pdg_offset = fPos;
+    Write(fPdgs.data(), fPdgs.size()*sizeof(int32_t));
+
+    // Now that the file is complete, fill in the header
+    if(fseek(fFile, 0, SEEK_SET) != 0 ||
+       fwrite(&hdr, sizeof(hdr), 1, fFile) != 1 ||
+       fclose(fFile) != 0){
+      LOG("ELI", pFATAL) << "Failed writing event library " << fFilename;
+      exit(1);
+    }
+    fFile = 0;
+  }
+
+}} // namespaces
@@ -0,0 +1,246 @@
+//____________________________________________________________________________
+/*!
+
+\class    genie::evtlib::BinaryRecordFile
+
+\brief    Read-only, memory-mapped event library in the GENIE binary format.
+
+          For each Key (target, neutrino, CC/NC) the file holds the library
+          records sorted by neutrino energy, with the record energies in a
+          contiguous array (so that a lookup is a binary search touching a
+          few cache lines), the particles of all records in contiguous
+          arrays and the cross section table of the key. Particle PDG codes
+          are stored as 16-bit indices into a per-file code table.
+
+          The file is mapped with mmap(MAP_SHARED) and never copied, so
+          opening it costs nothing up-front and its pages are shared by all
+          the processes using the same library. Binary libraries are written
+          by BinaryRecordWriter (see the gevlib_build app).
+
+          Large libraries can be split in several shard files, each holding
+          an energy range of one or more keys, and listed in a text index
+          file (see BinaryLibrary).
+
+\author   The GENIE Collaboration
+
+\created  October 16, 2026
+
+\cpright  Copyright (c) 2003-2023, The GENIE Collaboration
+          For the full text of the license visit http://copyright.genie-mc.org
+*/
+//____________________________________________________________________________
+
+#ifndef _EVTLIB_BINARY_FILE_H_
+#define _EVTLIB_BINARY_FILE_H_
+
+#include <cstdio>
+#include <map>
+#include <string>
+#include <vector>
+
+#include <stdint.h>
+
+#include "Tools/EvtLib/Key.h"
+
+namespace genie{
+namespace evtlib{
+
+  struct EvtLibRecord;
+
+  //---------------------------------------------------------------------------
+  /// On-disk layout of the binary event library (all offsets in bytes from
+  /// the start of the file, all sections 8-byte aligned, host byte order)
+  namespace binfmt{
+
+    const char     kMagic[8]    = {'G','E','V','T','L','I','B','\0'};
+    const uint32_t kVersion     = 1;
+    const uint32_t kByteOrder   = 0x01020304; ///< detects byte order mismatches
+    const uint32_t kMaxPdgCodes = 65535;      ///< particle PDG code indices are 16-bit
+
+    /// First line of a shard index file, followed by one line per shard:
+    /// nucl_pdg nu_pdg iscc nrecs Emin Emax file (relative to the index)
+    const char     kIndexMagic[] = "GEVTLIB-INDEX";
+    const uint32_t kIndexVersion = 1;
+
+    struct Header
+    {
+      char     magic[8];
+      uint32_t version;
+      uint32_t byte_order;
+      uint32_t nkeys;
+      uint32_t npdgs;
+      uint64_t key_offset;    ///< KeyEntry   keys[nkeys]
+      uint64_t pdg_offset;    ///< int32_t    pdgs[npdgs]
+    };
+
+    struct KeyEntry
+    {
+      int32_t  nucl_pdg;
+      int32_t  nu_pdg;
+      int32_t  iscc;
+      int32_t  pad;
+      uint64_t nrecs;
+      uint64_t nparts;
+      uint64_t nxsec;
+      uint64_t energy_offset; ///< float      E[nrecs], in increasing order
+      uint64_t record_offset; ///< Record     recs[nrecs]
+      uint64_t p4_offset;     ///< float      p4[nparts][4] (E, px, py, pz)
+      uint64_t ipdg_offset;   ///< uint16_t   ipdg[nparts], indices into pdgs
+      uint64_t xsec_offset;   ///< double     xsec[nxsec][2] (E, 1E-38 cm^2 / nucleus)
+      double   Emin;          ///< energy of the first record
+      double   Emax;          ///< energy of the last record
+    };
+
+    struct Record
+    {
+      uint64_t first_part;    ///< index of the first particle of the record
+      uint32_t nparts;
+      int32_t  prod_id;
+    };
+
+  } // binfmt namespace
+
+  //---------------------------------------------------------------------------
+  class BinaryRecordFile
+  {
+  public:
+    BinaryRecordFile(const std::string& fname);
+    ~BinaryRecordFile();
+
+    /// Does \a fname start with the binary event library magic number?
+    static bool IsBinaryRecordFile(const std::string& fname);
+
+    const std::string& Filename() const {return fFilename;}
+
+    int NKeys() const {return fHeader->nkeys;}
+    const binfmt::KeyEntry& KeyEntry(int ikey) const {return fKeys[ikey];}
+    Key GetKey(int ikey) const;
+
+    /// Index of the section holding \a key, or -1
+    int FindKey(const Key& key) const;
+
+    /// Energy-sorted record energies of the given key
+    const float* Energies(int ikey) const;
+
+    /// Fill \a rec with the \a irec-th record of the given key
+    void FillRecord(int ikey, uint64_t irec, EvtLibRecord& rec) const;
+
+    /// Cross section table of the given key, as (E, xsec) pairs
+    const double* XSec(int ikey) const;
+
+  protected:
+    template<class T> const T* At(uint64_t offset) const
+    {
+      return reinterpret_cast<const T*>(fData + offset);
+    }
+
+    void Validate() const;
+
+    std::string fFilename;
+    const char* fData;
+    size_t fSize;
+
+    const binfmt::Header* fHeader;
+    const binfmt::KeyEntry* fKeys;
+    const int32_t* fPdgs;
+  };
+
+  //---------------------------------------------------------------------------
+  /// A binary event library: either a single BinaryRecordFile or a shard
+  /// index listing, for each key, the files holding consecutive energy
+  /// ranges of its records. All shard files are mapped on construction.
+  class BinaryLibrary
+  {
+  public:
+    struct Shard
+    {
+      const BinaryRecordFile* file;
+      int ikey;
+    };
+
+    /// One line of a shard index file
+    struct ShardInfo
+    {
+      ShardInfo(const Key& _key, uint64_t _nrecs, double _Emin, double _Emax,
+                const std::string& _file)
+        : key(_key), nrecs(_nrecs), Emin(_Emin), Emax(_Emax), file(_file) {}
+
+      Key key;
+      uint64_t nrecs;
+      double Emin, Emax;
+      std::string file;
+    };
+
+    BinaryLibrary(const std::string& path);
+    ~BinaryLibrary();
+
+    /// Is \a path a binary event library file or a shard index?
+    static bool IsBinaryLibrary(const std::string& path);
+    static bool IsBinaryLibraryIndex(const std::string& path);
+
+    static void WriteIndex(const std::string& path,
+                           const std::vector<ShardInfo>& shards);
+
+    std::vector<Key> Keys() const;
+
+    /// Shards of \a key in order of increasing energy (empty if not found)
+    const std::vector<Shard>& Shards(const Key& key) const;
+
+  protected:
+    void LoadIndex(const std::string& path);
+    void AddShard(const Key& key, const BinaryRecordFile* file, int ikey);
+    void CheckShards() const;
+
+    std::vector<BinaryRecordFile*> fFiles;
+    std::map<Key, std::vector<Shard>> fShards;
+  };
+
+  //---------------------------------------------------------------------------
+  /// Writes binary event library files. Keys are written one at a time and
+  /// records must be added in order of increasing energy. The particle
+  /// momenta are streamed to disk as the records are added; only the record
+  /// index (20 bytes per record) and the particle PDG code indices (2 bytes
+  /// per particle) of the current key are kept in memory.
+  class BinaryRecordWriter
+  {
+  public:
+    BinaryRecordWriter(const std::string& fname);
+    ~BinaryRecordWriter();
+
+    void BeginKey(const Key& key);
+    void AddRecord(const EvtLibRecord& rec);
+    /// Cross section table of the current key, as (E, xsec) pairs
+    void SetXSec(const std::vector<std::pair<double, double>>& xsec);
+    void EndKey();
+
+    /// Write the key and PDG code tables and close the file
+    void Close();
+
+    uint64_t NRecords() const {return fNRecsTotal;}
+    uint64_t NBytes() const {return fPos;}
+
+  protected:
+    void Write(const void* buf, size_t size);
+    void Align();
+
+    std::string fFilename;
+    FILE* fFile;
+    uint64_t fPos; ///< current write position (bytes written so far)
+
+    bool fInKey;
+    binfmt::KeyEntry fCurrentKey;
+    std::vector<float> fEnergies;
+    std::vector<binfmt::Record> fRecords;
+    std::vector<uint16_t> fIPdgs;
+    std::vector<std::pair<double, double>> fXSec;
+
+    std::vector<binfmt::KeyEntry> fKeys;
+    std::map<int, uint16_t> fPdgIndex;
+    std::vector<int32_t> fPdgs;
+
+    uint64_t fNRecsTotal;
+  };
+
+}} // namespaces
+
+#endif
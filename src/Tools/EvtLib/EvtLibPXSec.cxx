@@ -1,4 +1,5 @@
 #include "Tools/EvtLib/EvtLibPXSec.h"
+#include "Tools/EvtLib/EvtLibBinaryFile.h"
 #include "Tools/EvtLib/Utils.h"
 
 #include "Framework/Conventions/Units.h"
@@ -10,9 +11,28 @@
 #include "TFile.h"
 #include "TGraph.h"
 
+#include <algorithm>
+#include <numeric>
+
 using namespace genie;
 using namespace genie::evtlib;
 
+//____________________________________________________________________________
+double EvtLibXSecTable::Eval(double E) const
+{
+  const int n = fE.size();
+  if(n == 0) return 0;
+  if(n == 1) return fXSec[0];
+
+  // Segment [lo, lo+1] containing E, or the first / last one outside the table
+  int lo = std::upper_bound(fE.begin(), fE.end(), E) - fE.begin() - 1;
+  lo = std::max(0, std::min(lo, n-2));
+
+  const double dE = fE[lo+1] - fE[lo];
+  if(dE == 0) return fXSec[lo];
+  return fXSec[lo] + (E - fE[lo]) * (fXSec[lo+1] - fXSec[lo]) / dE;
+}
+
 //____________________________________________________________________________
 EvtLibPXSec::EvtLibPXSec() :
 XSecAlgorithmI("genie::evtlib::EvtLibPXSec")
@@ -44,14 +64,14 @@ double EvtLibPXSec::XSec(const Interaction* /*in*/,
 //____________________________________________________________________________
 double EvtLibPXSec::Integral(const Interaction* in) const
 {
-  TGraph* g = GetXSec(in);
-  if(!g) return 0; // Reason already printed
+  const EvtLibXSecTable* xsec = GetXSec(in);
+  if(!xsec) return 0; // Reason already printed
 
   const InitialState& init_state = in->InitState();
   const double E  = init_state.ProbeE(kRfLab);
 
   // Units of the cross-section graph are expected to be 10^-38 cm^2 / nucleus
-  return g->Eval(E) * 1e-38 * genie::units::cm2;
+  return xsec->Eval(E) * 1e-38 * genie::units::cm2;
 }
 
 //____________________________________________________________________________
@@ -77,7 +97,6 @@ void EvtLibPXSec::Configure(string config)
 //____________________________________________________________________________
 void EvtLibPXSec::ClearXSecs()
 {
-  for(auto it: fXSecs) delete it.second;
   fXSecs.clear();
 }
 
@@ -90,6 +109,11 @@ void EvtLibPXSec::LoadXSecs()
   GetParam("EventLibraryPath", libPath);
   Expand(libPath);
 
+  if(BinaryLibrary::IsBinaryLibrary(libPath)){
+    LoadBinaryXSecs(libPath);
+    return;
+  }
+
   PDGLibrary* pdglib = PDGLibrary::Instance();
 
   TFile fin(libPath.c_str());
@@ -133,14 +157,50 @@ void EvtLibPXSec::LoadXSecs()
           continue;
         }
 
-        fXSecs[key] = new TGraph(*g);
+        // Copy the graph into an energy-sorted table
+        std::vector<int> idx(g->GetN());
+        std::iota(idx.begin(), idx.end(), 0);
+        const double* gx = g->GetX();
+        const double* gy = g->GetY();
+        std::sort(idx.begin(), idx.end(),
+                  [gx](int a, int b){return gx[a] < gx[b];});
+
+        EvtLibXSecTable& xsec = fXSecs[key];
+        for(int i: idx){
+          xsec.fE.push_back(gx[i]);
+          xsec.fXSec.push_back(gy[i]);
+        }
       } // end for iscc
     } // end for pdg
   } // end for dir
 }
 
 //____________________________________________________________________________
-TGraph* EvtLibPXSec::GetXSec(const Interaction* in) const
+void EvtLibPXSec::LoadBinaryXSecs(const std::string& libPath)
+{
+  const BinaryLibrary lib(libPath);
+
+  for(const Key& key: lib.Keys()){
+    // Every shard of a key carries the full cross section table
+    const BinaryLibrary::Shard& shard = lib.Shards(key).front();
+    const uint64_t n = shard.file->KeyEntry(shard.ikey).nxsec;
+    if(n == 0){
+      LOG("ELI", pINFO) << "No xsec for " << key << " in "
+                        << libPath << " -- skipping";
+      continue;
+    }
+
+    const double* table = shard.file->XSec(shard.ikey);
+    EvtLibXSecTable& xsec = fXSecs[key];
+    for(uint64_t i = 0; i < n; ++i){
+      xsec.fE.push_back(table[2*i]);
+      xsec.fXSec.push_back(table[2*i+1]);
+    }
+  }
+}
+
+//____________________________________________________________________________
+const EvtLibXSecTable* EvtLibPXSec::GetXSec(const Interaction* in) const
 {
   const InitialState& init_state = in->InitState();
 
@@ -165,5 +225,5 @@ TGraph* EvtLibPXSec::GetXSec(const Interaction* in) const
     return 0;
   }
 
-  return it->second;
+  return &it->second;
 }
@@ -1,15 +1,26 @@
 #ifndef _LLEWELLYN_SMITH_QELCC_CROSS_SECTION_H_
 #define _LLEWELLYN_SMITH_QELCC_CROSS_SECTION_H_
 
+#include <map>
+#include <vector>
+
 #include "Framework/EventGen/XSecAlgorithmI.h"
 
 #include "Tools/EvtLib/Key.h"
 
-class TGraph;
-
 namespace genie {
 namespace evtlib {
 
+/// Energy-sorted cross section table, evaluated by linear interpolation (and
+/// extrapolation from the first or last two points, as TGraph::Eval)
+struct EvtLibXSecTable
+{
+  double Eval(double E) const;
+
+  std::vector<double> fE;
+  std::vector<double> fXSec;
+};
+
 class EvtLibPXSec : public XSecAlgorithmI {
 
 public:
@@ -28,11 +39,12 @@ public:
   void Configure (string param_set);
 
 protected:
-  TGraph* GetXSec(const Interaction* in) const;
+  const EvtLibXSecTable* GetXSec(const Interaction* in) const;
   void LoadXSecs();
+  void LoadBinaryXSecs(const std::string& libPath);
   void ClearXSecs();
 
-  std::map<Key, TGraph*> fXSecs;
+  std::map<Key, EvtLibXSecTable> fXSecs;
 };
 
 } // evtlib namespace
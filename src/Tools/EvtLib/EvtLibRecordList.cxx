@@ -3,6 +3,7 @@
 ////////////////////////////////////////////////////////////////////////
 
 #include "Tools/EvtLib/EvtLibRecordList.h"
+#include "Tools/EvtLib/EvtLibBinaryFile.h"
 
 #include "Framework/Messenger/Messenger.h"
 
@@ -161,4 +162,36 @@ namespace evtlib{
 
     return &fRecord;
   }
+
+  //---------------------------------------------------------------------------
+  BinaryRecordList::BinaryRecordList(const std::vector<BinaryLibrary::Shard>& shards)
+  {
+    for(const BinaryLibrary::Shard& shard: shards) AddShard(shard.file, shard.ikey);
+  }
+
+  //---------------------------------------------------------------------------
+  void BinaryRecordList::AddShard(const BinaryRecordFile* file, int ikey)
+  {
+    const uint64_t nrecs = file->KeyEntry(ikey).nrecs;
+    if(nrecs == 0) return;
+
+    const float* energies = file->Energies(ikey);
+    fShards.push_back(Shard{file, ikey, energies, nrecs});
+    fShardEmax.push_back(energies[nrecs-1]);
+  }
+
+  //---------------------------------------------------------------------------
+  const EvtLibRecord* BinaryRecordList::GetRecord(float E) const
+  {
+    // First shard reaching E, then first record at or above E within it
+    auto sit = std::lower_bound(fShardEmax.begin(), fShardEmax.end(), E);
+    if(sit == fShardEmax.end()) return 0;
+
+    const Shard& shard = fShards[sit - fShardEmax.begin()];
+    const float* it = std::lower_bound(shard.energies, shard.energies + shard.nrecs, E);
+
+    shard.file->FillRecord(shard.ikey, it - shard.energies, fRecord);
+
+    return &fRecord;
+  }
 }} // namespaces
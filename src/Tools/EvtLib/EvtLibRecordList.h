@@ -8,6 +8,10 @@
 #include <vector>
 #include <string>
 
+#include <stdint.h>
+
+#include "Tools/EvtLib/EvtLibBinaryFile.h"
+
 class TFile;
 class TTree;
 
@@ -100,6 +104,37 @@ namespace evtlib{
     mutable EvtLibRecord fRecord;
   };
 
+  //---------------------------------------------------------------------------
+  /// Records of one key of a memory-mapped binary event library, possibly
+  /// split in several shards covering consecutive energy ranges. Lookups are
+  /// a binary search over the shard energy ranges, then in the contiguous,
+  /// energy-sorted array of record energies of the shard; only the selected
+  /// record is unpacked.
+  class BinaryRecordList: public IEvtLibRecordList
+  {
+  public:
+    /// \a shards in order of increasing energy, see BinaryLibrary::Shards()
+    BinaryRecordList(const std::vector<BinaryLibrary::Shard>& shards);
+    virtual ~BinaryRecordList(){}
+
+    const EvtLibRecord* GetRecord(float E) const override;
+  protected:
+    void AddShard(const BinaryRecordFile* file, int ikey);
+
+    struct Shard
+    {
+      const BinaryRecordFile* file;
+      int ikey;
+      const float* energies;
+      uint64_t nrecs;
+    };
+
+    std::vector<Shard> fShards;
+    std::vector<float> fShardEmax; ///< energy of the last record of each shard
+
+    mutable EvtLibRecord fRecord;
+  };
+
 }} // namespaces
 
 #endif
@@ -16,5 +16,14 @@ namespace flux {
   GFlavorMixerI::GFlavorMixerI() { ; }
   GFlavorMixerI::~GFlavorMixerI() { ; }
 
+  void GFlavorMixerI::Probabilities(int pdg_initial,
+                                    const std::vector<int> & pdg_final,
+                                    double energy, double dist,
+                                    double * prob)
+  {
+    for (size_t indx = 0; indx < pdg_final.size(); ++indx )
+      prob[indx] = Probability(pdg_initial,pdg_final[indx],energy,dist);
+  }
+
 } // namespace flux
 } // namespace genie
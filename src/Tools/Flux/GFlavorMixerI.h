@@ -35,6 +35,7 @@
 #define GENIE_FLUX_GFLAVORMIXERI_H
 
 #include <string>
+#include <vector>
 
 namespace genie {
 namespace flux {
@@ -62,6 +63,15 @@ namespace flux {
     virtual double    Probability(int pdg_initial, int pdg_final,
                                   double energy, double dist) = 0;
 
+    /// transition probabilities to each of a list of PDG codes, written
+    /// in prob (sized to the list).  By default this calls Probability()
+    /// for each entry; models that can share work between the final
+    /// flavors (e.g. GFlavorMixerTable) override it.
+    virtual void      Probabilities(int pdg_initial,
+                                    const std::vector<int> & pdg_final,
+                                    double energy, double dist,
+                                    double * prob);
+
     /// provide a means of printing the configuration
     virtual void     PrintConfig(bool verbose=true) = 0;
 
@@ -0,0 +1,451 @@
+//____________________________________________________________________________
+/*!
+ Copyright (c) 2003-2023, The GENIE Collaboration
+ For the full text of the license visit http://copyright.genie-mc.org
+
+ The GENIE Collaboration
+*/
+//____________________________________________________________________________
+
+#include <cmath>
+#include <cstdlib>
+#include <algorithm>
+#include <typeinfo>
+
+#include "Tools/Flux/GFlavorMixerTable.h"
+#include "Tools/Flux/GFlavorMixerFactory.h"
+// self register with the factory
+FLAVORMIXREG4(genie,flux,GFlavorMixerTable,genie::flux::GFlavorMixerTable)
+
+#include "Framework/Messenger/Messenger.h"
+#define  LOG_BEGIN(a,b)   LOG(a,b)
+#define  LOG_END ""
+
+// GENIE includes
+#include "Framework/Utils/StringUtils.h"
+
+namespace genie {
+namespace flux {
+//____________________________________________________________________________
+GFlavorMixerTable::GFlavorMixerTable() :
+  fMixer(0),
+  fEMin(0.1),
+  fEMax(100.),
+  fNE(200),
+  fLMin(0.),
+  fLMax(0.),
+  fNL(1),
+  fTolerance(0.),
+  fMaxNodes(1000000),
+  fNLookups(0),
+  fNDirect(0)
+{ ; }
+
+GFlavorMixerTable::~GFlavorMixerTable()
+{
+  if ( fMixer ) { delete fMixer; fMixer = 0; }
+}
+
+//____________________________________________________________________________
+void GFlavorMixerTable::Config(std::string configIn)
+{
+  std::string config = genie::utils::str::TrimSpaces(configIn);
+  LOG_BEGIN("FluxBlender", pINFO)
+    << "GFlavorMixerTable::Config \"" << config << "\"" << LOG_END;
+
+  // table parameters before the "|", wrapped mixer config after it
+  std::string table_config = config;
+  std::string mixer_config = "";
+  size_t bar = config.find("|");
+  if ( bar != std::string::npos ) {
+    table_config = config.substr(0,bar);
+    mixer_config = genie::utils::str::TrimSpaces(config.substr(bar+1));
+  }
+
+  vector<string> tokens = genie::utils::str::Split(table_config," ");
+  for (unsigned int jtok = 0; jtok < tokens.size(); ++jtok ) {
+    string tok1 = tokens[jtok];
+    if ( tok1 == "" ) continue;
+    if ( tok1 == "tabulate" ) continue;
+    if ( tok1 == "genie::flux::GFlavorMixerTable" ) continue;
+    // should have the form <key>=<value>
+    vector<string> pair = genie::utils::str::Split(tok1,"=");
+    if ( pair.size() != 2 ) {
+      LOG_BEGIN("FluxBlender", pWARN)
+        << "could not parse " << tok1 << " split size=" << pair.size()
+        << LOG_END;
+      continue;
+    }
+    string key = pair[0];
+    vector<string> vals = genie::utils::str::Split(pair[1],":");
+    if ( key == "mixer" ) {
+      GFlavorMixerI* mixer =
+        GFlavorMixerFactory::Instance().GetFlavorMixer(pair[1]);
+      if ( mixer ) {
+        mixer->Config(mixer_config);
+        GFlavorMixerI* old = AdoptFlavorMixer(mixer);
+        if ( old ) delete old;
+      }
+    } else if ( key == "energy" && vals.size() == 3 ) {
+      SetEnergyRange(strtod(vals[0].c_str(),NULL),
+                     strtod(vals[1].c_str(),NULL),
+                     strtol(vals[2].c_str(),NULL,0));
+    } else if ( key == "baseline" && vals.size() == 1 ) {
+      double dist = strtod(vals[0].c_str(),NULL);
+      SetBaselineRange(dist,dist,1);
+    } else if ( key == "baseline" && vals.size() == 3 ) {
+      SetBaselineRange(strtod(vals[0].c_str(),NULL),
+                       strtod(vals[1].c_str(),NULL),
+                       strtol(vals[2].c_str(),NULL,0));
+    } else if ( key == "tol" ) {
+      SetTolerance(strtod(pair[1].c_str(),NULL),fMaxNodes);
+    } else if ( key == "maxnodes" ) {
+      SetTolerance(fTolerance,strtol(pair[1].c_str(),NULL,0));
+    } else {
+      LOG_BEGIN("FluxBlender", pWARN)
+        << "GFlavorMixerTable::Config don't know how to parse \""
+        << tok1 << "\"" << LOG_END;
+    }
+  }
+
+  if ( ! fMixer ) {
+    LOG_BEGIN("FluxBlender", pWARN)
+      << "GFlavorMixerTable::Config no mixer to tabulate" << LOG_END;
+  }
+}
+
+//____________________________________________________________________________
+GFlavorMixerI* GFlavorMixerTable::AdoptFlavorMixer(GFlavorMixerI* mixer)
+{
+  GFlavorMixerI* oldmix = fMixer;
+  fMixer = mixer;
+  ClearTables();
+  return oldmix;
+}
+
+//____________________________________________________________________________
+void GFlavorMixerTable::SetEnergyRange(double emin, double emax, int npoints)
+{
+  if ( emin <= 0 || emax <= emin ) {
+    LOG_BEGIN("FluxBlender", pWARN)
+      << "GFlavorMixerTable: invalid energy range [" << emin << ", "
+      << emax << "] GeV - ignored" << LOG_END;
+    return;
+  }
+  fEMin = emin;
+  fEMax = emax;
+  fNE   = std::max(npoints,2);
+  ClearTables();
+}
+
+//____________________________________________________________________________
+void GFlavorMixerTable::SetBaselineRange(double lmin, double lmax, int npoints)
+{
+  if ( lmin < 0 || lmax < lmin ) {
+    LOG_BEGIN("FluxBlender", pWARN)
+      << "GFlavorMixerTable: invalid baseline range [" << lmin << ", "
+      << lmax << "] m - ignored" << LOG_END;
+    return;
+  }
+  fLMin = lmin;
+  fLMax = lmax;
+  fNL   = ( lmax > lmin ) ? std::max(npoints,2) : 1;
+  ClearTables();
+}
+
+//____________________________________________________________________________
+void GFlavorMixerTable::SetTolerance(double tol, int maxnodes)
+{
+  fTolerance = tol;
+  fMaxNodes  = maxnodes;
+  ClearTables();
+}
+
+//____________________________________________________________________________
+void GFlavorMixerTable::ClearTables(void)
+{
+  for (int indx = 0; indx < 7; ++indx ) {
+    fTable[indx] = Table();
+  }
+}
+
+//____________________________________________________________________________
+double GFlavorMixerTable::NodeE(int iE, int nE) const
+{
+  // nodes are uniform in 1/E, starting at emax
+  double umin = 1./fEMax;
+  double umax = 1./fEMin;
+  return 1./( umin + iE*(umax-umin)/(nE-1) );
+}
+
+//____________________________________________________________________________
+double GFlavorMixerTable::NodeL(int iL, int nL) const
+{
+  if ( nL < 2 ) return fLMin;
+  return fLMin + iL*(fLMax-fLMin)/(nL-1);
+}
+
+//____________________________________________________________________________
+void GFlavorMixerTable::Direct(int pdg_in, double energy, double dist,
+                               double * p7)
+{
+  for (int jout = 0; jout < 7; ++jout )
+    p7[jout] = fMixer->Probability(pdg_in,Indx2PDG(jout),energy,dist);
+}
+
+//____________________________________________________________________________
+void GFlavorMixerTable::Fill(int indx_in, int nE, int nL)
+{
+  Table & table = fTable[indx_in];
+  table.nE = nE;
+  table.nL = nL;
+  table.prob.assign(size_t(nE)*nL*7, 0.);
+
+  int    pdg_in = Indx2PDG(indx_in);
+  double p7[7];
+  for (int iL = 0; iL < nL; ++iL ) {
+    double dist = NodeL(iL,nL);
+    for (int iE = 0; iE < nE; ++iE ) {
+      Direct(pdg_in,NodeE(iE,nE),dist,p7);
+      float * node = &table.prob[ (size_t(iL)*nE + iE)*7 ];
+      for (int jout = 0; jout < 7; ++jout ) node[jout] = p7[jout];
+    }
+  }
+}
+
+//____________________________________________________________________________
+double GFlavorMixerTable::MaxErrorE(int indx_in)
+{
+  // interpolation error at the mid-points between energy nodes
+  const Table & table = fTable[indx_in];
+  int    nE = table.nE;
+  int    nL = table.nL;
+  int    pdg_in = Indx2PDG(indx_in);
+  double umin = 1./fEMax;
+  double du   = (1./fEMin - umin)/(nE-1);
+  double p7[7];
+  double maxerr = 0;
+  for (int iL = 0; iL < nL; ++iL ) {
+    double dist = NodeL(iL,nL);
+    for (int iE = 0; iE < nE-1; ++iE ) {
+      Direct(pdg_in,1./(umin+(iE+0.5)*du),dist,p7);
+      const float * node = &table.prob[ (size_t(iL)*nE + iE)*7 ];
+      for (int jout = 0; jout < 7; ++jout ) {
+        double interp = 0.5*(node[jout]+node[jout+7]);
+        maxerr = std::max(maxerr,std::fabs(interp-p7[jout]));
+      }
+    }
+  }
+  return maxerr;
+}
+
+//____________________________________________________________________________
+double GFlavorMixerTable::MaxErrorL(int indx_in)
+{
+  // interpolation error at the mid-points between baseline nodes
+  const Table & table = fTable[indx_in];
+  int    nE = table.nE;
+  int    nL = table.nL;
+  int    pdg_in = Indx2PDG(indx_in);
+  double dL = (fLMax-fLMin)/(nL-1);
+  double p7[7];
+  double maxerr = 0;
+  for (int iL = 0; iL < nL-1; ++iL ) {
+    double dist = fLMin + (iL+0.5)*dL;
+    for (int iE = 0; iE < nE; ++iE ) {
+      Direct(pdg_in,NodeE(iE,nE),dist,p7);
+      const float * node = &table.prob[ (size_t(iL)*nE + iE)*7 ];
+      for (int jout = 0; jout < 7; ++jout ) {
+        double interp = 0.5*(node[jout]+node[jout+7*nE]);
+        maxerr = std::max(maxerr,std::fabs(interp-p7[jout]));
+      }
+    }
+  }
+  return maxerr;
+}
+
+//____________________________________________________________________________
+void GFlavorMixerTable::BuildTable(int pdg_initial)
+{
+  int indx_in = PDG2Indx(pdg_initial);
+  if ( indx_in == 0 || ! fMixer ) return;
+
+  Table & table = fTable[indx_in];
+  int nE = fNE;
+  int nL = fNL;
+  while ( true ) {
+    Fill(indx_in,nE,nL);
+    if ( fTolerance <= 0 ) break;
+
+    double errE = MaxErrorE(indx_in);
+    double errL = ( nL > 1 ) ? MaxErrorL(indx_in) : 0;
+    table.maxerr = std::max(errE,errL);
+    if ( table.maxerr <= fTolerance ) break;
+
+    // halve the intervals along the axis (or axes) failing the tolerance
+    int nE2 = ( errE > fTolerance ) ? 2*nE-1 : nE;
+    int nL2 = ( errL > fTolerance ) ? 2*nL-1 : nL;
+    if ( double(nE2)*nL2 > fMaxNodes ) {
+      LOG_BEGIN("FluxBlender", pWARN)
+        << "GFlavorMixerTable: tolerance " << fTolerance
+        << " not reached for initial flavor " << pdg_initial
+        << " with " << nE << " x " << nL << " nodes (max error "
+        << table.maxerr << ")" << LOG_END;
+      break;
+    }
+    nE = nE2;
+    nL = nL2;
+  }
+  table.built = true;
+
+  LOG_BEGIN("FluxBlender", pINFO)
+    << "GFlavorMixerTable: tabulated " << pdg_initial << " => * on "
+    << table.nE << " (E) x " << table.nL << " (L) nodes"
+    << ( ( fTolerance > 0 ) ? ", max interpolation error " : "" )
+    << ( ( fTolerance > 0 ) ? table.maxerr : 0 ) << LOG_END;
+}
+
+//____________________________________________________________________________
+bool GFlavorMixerTable::Interpolate(int indx_in, double energy, double dist,
+                                    double * p7)
+{
+  if ( indx_in == 0 ) return false;
+  if ( energy < fEMin || energy > fEMax ) return false;
+
+  Table & table = fTable[indx_in];
+  if ( ! table.built ) BuildTable(Indx2PDG(indx_in));
+
+  int nE = table.nE;
+  int nL = table.nL;
+
+  // uniform grids: the cell is found without searching
+  double umin = 1./fEMax;
+  double x    = (1./energy - umin)/(1./fEMin - umin)*(nE-1);
+  int    iE   = std::min(std::max(int(x),0),nE-2);
+  double fE   = x - iE;
+
+  int    iL = 0;
+  double fL = 0;
+  if ( nL > 1 ) {
+    if ( dist < fLMin || dist > fLMax ) return false;
+    double y = (dist - fLMin)/(fLMax - fLMin)*(nL-1);
+    iL = std::min(std::max(int(y),0),nL-2);
+    fL = y - iL;
+  } else if ( std::fabs(dist - fLMin) > 1.e-6*std::max(1.,fLMin) ) {
+    return false;
+  }
+
+  const float * p00 = &table.prob[ (size_t(iL)*nE + iE)*7 ];
+  const float * p01 = p00 + 7;
+  if ( nL > 1 ) {
+    const float * p10 = p00 + 7*nE;
+    const float * p11 = p10 + 7;
+    double w00 = (1-fE)*(1-fL), w01 = fE*(1-fL);
+    double w10 = (1-fE)*fL,     w11 = fE*fL;
+    for (int jout = 0; jout < 7; ++jout )
+      p7[jout] = w00*p00[jout] + w01*p01[jout] + w10*p10[jout] + w11*p11[jout];
+  } else {
+    for (int jout = 0; jout < 7; ++jout )
+      p7[jout] = (1-fE)*p00[jout] + fE*p01[jout];
+  }
+  fNLookups++;
+  return true;
+}
+
+//____________________________________________________________________________
+double GFlavorMixerTable::Probability(int pdg_initial, int pdg_final,
+                                      double energy, double dist)
+{
+  if ( ! fMixer ) return ( ( pdg_initial == pdg_final ) ? 1. : 0. );
+
+  double p7[7];
+  if ( Interpolate(PDG2Indx(pdg_initial),energy,dist,p7) )
+    return p7[PDG2Indx(pdg_final)];
+
+  fNDirect++;
+  return fMixer->Probability(pdg_initial,pdg_final,energy,dist);
+}
+
+//____________________________________________________________________________
+void GFlavorMixerTable::Probabilities(int pdg_initial,
+                                      const std::vector<int> & pdg_final,
+                                      double energy, double dist,
+                                      double * prob)
+{
+  double p7[7];
+  if ( fMixer && Interpolate(PDG2Indx(pdg_initial),energy,dist,p7) ) {
+    for (size_t indx = 0; indx < pdg_final.size(); ++indx )
+      prob[indx] = p7[PDG2Indx(pdg_final[indx])];
+    return;
+  }
+  GFlavorMixerI::Probabilities(pdg_initial,pdg_final,energy,dist,prob);
+}
+
+//____________________________________________________________________________
+void GFlavorMixerTable::PrintConfig(bool verbose)
+{
+  LOG_BEGIN("FluxBlender", pINFO)
+    << "GFlavorMixerTable::PrintConfig():" << LOG_END;
+  LOG_BEGIN("FluxBlender", pINFO)
+    << "   E = [" << fEMin << ", " << fEMax << "] GeV, " << fNE
+    << " nodes (uniform in 1/E)" << LOG_END;
+  LOG_BEGIN("FluxBlender", pINFO)
+    << "   L = [" << fLMin << ", " << fLMax << "] m, " << fNL
+    << " nodes" << LOG_END;
+  LOG_BEGIN("FluxBlender", pINFO)
+    << "   tolerance " << fTolerance << ", max nodes " << fMaxNodes
+    << LOG_END;
+  for (int indx = 1; indx < 7; ++indx ) {
+    const Table & table = fTable[indx];
+    if ( ! table.built ) continue;
+    LOG_BEGIN("FluxBlender", pINFO)
+      << "   table for " << Indx2PDG(indx) << ": " << table.nE << " x "
+      << table.nL << " nodes, max error " << table.maxerr << LOG_END;
+  }
+  LOG_BEGIN("FluxBlender", pINFO)
+    << "   " << fNLookups << " table lookups, " << fNDirect
+    << " direct calls" << LOG_END;
+
+  if ( fMixer ) {
+    LOG_BEGIN("FluxBlender", pINFO)
+      << "   wrapped mixer is a \"" << typeid(*fMixer).name() << "\""
+      << LOG_END;
+    fMixer->PrintConfig(verbose);
+  } else {
+    LOG_BEGIN("FluxBlender", pINFO)
+      << "   wrapped mixer is not initialized" << LOG_END;
+  }
+}
+
+//____________________________________________________________________________
+int GFlavorMixerTable::PDG2Indx(int pdg)
+{
+  // same ordering as GFlavorMap
+  switch ( pdg ) {
+  case  12: return 1; break;
+  case  14: return 2; break;
+  case  16: return 3; break;
+  case -12: return 4; break;
+  case -14: return 5; break;
+  case -16: return 6; break;
+  default:  return 0; break;
+  }
+  return 0;
+}
+int GFlavorMixerTable::Indx2PDG(int indx)
+{
+  switch ( indx ) {
+  case  1: return  12; break;
+  case  2: return  14; break;
+  case  3: return  16; break;
+  case  4: return -12; break;
+  case  5: return -14; break;
+  case  6: return -16; break;
+  default: return   0; break;
+  }
+  return 0;
+}
+
+//____________________________________________________________________________
+} // namespace flux
+} // namespace genie
@@ -0,0 +1,142 @@
+//____________________________________________________________________________
+/*!
+
+\class   genie::flux::GFlavorMixerTable
+
+\brief   GENIE interface for flavor modification
+
+         Concrete instance of GFlavorMixerI that wraps another
+         GFlavorMixerI (e.g. a PMNS / matter oscillation calculation)
+         and tabulates its transition probabilities on a grid in
+         energy and baseline.  The grid is uniform in 1/E, so that
+         oscillations in L/E are sampled evenly, and uniform in L.
+         The tables for an initial flavor are filled the first time
+         it is requested (or by BuildTable()) and probabilities are
+         then bilinearly interpolated, which needs a fixed number of
+         operations per neutrino.  Interpolation preserves the
+         normalization of the probabilities.
+
+         If a tolerance is given the grid is refined (the number of
+         intervals doubled along the axis that fails) until the
+         interpolation at the mid-points between nodes agrees with
+         the wrapped mixer to within the tolerance, or the maximum
+         number of nodes is reached.
+
+         Neutrinos outside the tabulated range (or at a distance
+         different from the baseline, for a fixed baseline table)
+         are passed on to the wrapped mixer.
+
+         Supported config string format:
+           " tabulate mixer=name energy=emin:emax:n baseline=lmin:lmax:n
+                      tol=t maxnodes=m | mixer config string "
+         "mixer" is the name of the wrapped mixer, as known to the
+         GFlavorMixerFactory, configured with the string after the "|".
+         Energies are in GeV, distances in meters.  A single baseline
+         (e.g. "baseline=1300000") gives a fixed baseline table.
+
+         The wrapped mixer can also be set directly:
+           GFlavorMixerTable * table = new GFlavorMixerTable;
+           table->AdoptFlavorMixer(mixer);
+           table->SetEnergyRange(0.1,100.,200);
+           table->SetBaselineRange(1300.e3,1300.e3,1);
+           blender->AdoptFlavorMixer(table);
+
+\author  The GENIE Collaboration
+
+\created October 16, 2026
+
+\cpright Copyright (c) 2003-2023, The GENIE Collaboration
+         for the full text of the license visit http://copyright.genie-mc.org
+*/
+//____________________________________________________________________________
+
+#ifndef GENIE_FLUX_GFLAVORMIXERTABLE_H
+#define GENIE_FLUX_GFLAVORMIXERTABLE_H
+
+#include <string>
+#include <vector>
+#include "Tools/Flux/GFlavorMixerI.h"
+
+namespace genie {
+namespace flux {
+
+  class GFlavorMixerTable : public GFlavorMixerI {
+
+  public:
+
+    GFlavorMixerTable();
+    ~GFlavorMixerTable();
+
+    //
+    // implement the GFlavorMixerI interface:
+    //
+    void      Config(std::string config);
+    double    Probability(int pdg_initial, int pdg_final,
+                          double energy, double dist);
+    void      Probabilities(int pdg_initial,
+                            const std::vector<int> & pdg_final,
+                            double energy, double dist, double * prob);
+    void      PrintConfig(bool verbose=true);
+
+    //
+    // Configuration (any change drops the tables filled so far):
+    //
+    GFlavorMixerI*  AdoptFlavorMixer(GFlavorMixerI* mixer);  ///< return previous
+    GFlavorMixerI*  GetFlavorMixer() { return fMixer; }      ///< access, not ownership
+
+    void   SetEnergyRange   (double emin, double emax, int npoints);
+    void   SetBaselineRange (double lmin, double lmax, int npoints);
+    void   SetTolerance     (double tol, int maxnodes = 1000000);
+
+    /// fill the table for an initial flavor (otherwise done on first use)
+    void   BuildTable       (int pdg_initial);
+    void   ClearTables      (void);
+
+    long   NTableLookups    (void) const { return fNLookups; }
+    long   NDirectCalls     (void) const { return fNDirect;  }
+
+  private:
+
+    /// probabilities to each of the 7 final states at each node,
+    /// final state running fastest, then energy, then baseline
+    struct Table {
+      Table() : built(false), nE(0), nL(0), maxerr(0) {}
+      bool               built;
+      int                nE;
+      int                nL;
+      double             maxerr;
+      std::vector<float> prob;
+    };
+
+    void    Fill        (int indx_in, int nE, int nL);
+    double  MaxErrorE   (int indx_in);
+    double  MaxErrorL   (int indx_in);
+    void    Direct      (int pdg_in, double energy, double dist, double * p7);
+    bool    Interpolate (int indx_in, double energy, double dist, double * p7);
+    double  NodeE       (int iE, int nE) const;
+    double  NodeL       (int iL, int nL) const;
+
+    int          PDG2Indx(int pdg);
+    int          Indx2PDG(int indx);
+
+    GFlavorMixerI*  fMixer;        ///< wrapped flavor modification schema
+
+    double   fEMin;                ///< tabulated energy range (GeV)
+    double   fEMax;
+    int      fNE;                  ///< initial number of energy nodes
+    double   fLMin;                ///< tabulated baseline range (m)
+    double   fLMax;
+    int      fNL;                  ///< initial number of baseline nodes
+    double   fTolerance;           ///< max abs. interpolation error (<=0: no check)
+    int      fMaxNodes;            ///< max number of nodes per table
+
+    Table    fTable[7];            ///< tables for each initial flavor
+
+    long     fNLookups;            ///< # of interpolated probabilities
+    long     fNDirect;             ///< # of calls passed to the wrapped mixer
+  };
+
+} // namespace flux
+} // namespace genie
+
+#endif //GENIE_FLUX_GFLAVORMIXERTABLE_H
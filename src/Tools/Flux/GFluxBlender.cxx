@@ -161,10 +161,11 @@ int GFluxBlender::ChooseFlavor(int pdg_init, double energy, double dist)
   double sumprob = 0;
 
   fRndm = RandomGen::Instance()->RndFlux().Rndm();
+  // all transition probabilities in one call (a single table lookup
+  // for tabulating mixers)
+  fFlavorMixer->Probabilities(pdg_init,fPDGListMixed,energy,dist,&fProb[0]);
   for (size_t indx = 0; indx < fNPDGOut; ++indx ) {
     int pdg_test = fPDGListMixed[indx];
-    double prob = fFlavorMixer->Probability(pdg_init,pdg_test,energy,dist);
-    fProb[indx] = prob;
     sumprob += fProb[indx];
     fSumProb[indx] = sumprob;
     if ( ! isset && fRndm < sumprob ) {
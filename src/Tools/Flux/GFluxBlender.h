@@ -19,6 +19,10 @@
          In such cases one would have to generate with a fixed flavor
          (energy/distance independent) swap and reweight after the fact.
 
+         For oscillation models that are expensive to evaluate, wrap
+         the mixer in a genie::flux::GFlavorMixerTable, which tabulates
+         the probabilities on an energy x baseline grid at initialization.
+
          Do not use this as a means of selecting only certain flavor
          from flux generators that support other means (e.g. GNuMIFlux,
          GSimpleNtpFlux which have SetFluxParticles(PDGCodeList)) as
@@ -46,6 +46,7 @@
 #pragma link C++ class genie::flux::GFlavorMixerI;
 #pragma link C++ class genie::flux::GFlavorMixerFactory;
 #pragma link C++ class genie::flux::GFlavorMap;
+#pragma link C++ class genie::flux::GFlavorMixerTable;
 
 #pragma link C++ class genie::flux::GFluxDriverFactory;
 
@@ -0,0 +1,226 @@
+//____________________________________________________________________________
+/*!
+
+\program gtestGHepRecord
+
+\brief   Benchmarks the GHEP event record storage.
+         The events of an input GHEP file (eg a CC-inclusive numu+Ar40
+         sample produced with gevgen) are replayed into event records the
+         way the event generation threads build them (AddParticle() calls,
+         daughter-list bookkeeping and the most common look-ups), either
+          a) allocating a new record for each event, or
+          b) re-using a single record, reset in place between events.
+         The time and the number of heap allocations per event are reported
+         for both.
+
+         Syntax :
+           gtestGHepRecord -f filename [-n nev] [-r nrep]
+
+         Options :
+           [] Denotes an optional argument
+           -f Specifies a GENIE GHEP event file
+           -n Number of events to replay (default: all)
+           -r Number of times to replay the event sample (default: 10)
+
+\author  The GENIE Collaboration
+
+\created October 16, 2026
+
+\cpright Copyright (c) 2003-2023, The GENIE Collaboration
+         For the full text of the license visit http://copyright.genie-mc.org
+
+*/
+//____________________________________________________________________________
+
+#include <cstdlib>
+#include <new>
+#include <string>
+#include <vector>
+
+#include <TFile.h>
+#include <TTree.h>
+#include <TMath.h>
+#include <TStopwatch.h>
+#include <TLorentzVector.h>
+
+#include "Framework/EventGen/EventRecord.h"
+#include "Framework/GHEP/GHepParticle.h"
+#include "Framework/Ntuple/NtpMCEventRecord.h"
+#include "Framework/Messenger/Messenger.h"
+#include "Framework/ParticleData/PDGCodes.h"
+#include "Framework/Utils/CmdLnArgParser.h"
+
+using std::string;
+using std::vector;
+using namespace genie;
+
+// count heap allocations made while replaying events
+static long gNAlloc   = 0;
+static bool gCountNew = false;
+
+void * operator new (size_t size)
+{
+  if(gCountNew) gNAlloc++;
+  void * ptr = malloc(size ? size : 1);
+  if(!ptr) throw std::bad_alloc();
+  return ptr;
+}
+void operator delete (void * ptr) throw()
+{
+  free(ptr);
+}
+
+// a GHEP entry, as needed for replaying it
+struct Entry_t {
+  int            pdg;
+  GHepStatus_t   ist;
+  int            mom1;
+  int            mom2;
+  TLorentzVector p4;
+  TLorentzVector x4;
+};
+
+void   GetCommandLineArgs (int argc, char ** argv);
+void   Replay             (EventRecord & event, const vector<Entry_t> & entries);
+double Benchmark          (bool reuse, const vector< vector<Entry_t> > & sample,
+                           long & nalloc);
+
+int    gOptNEvt;
+int    gOptNRep;
+string gOptInpFilename;
+
+//___________________________________________________________________
+int main(int argc, char ** argv)
+{
+  GetCommandLineArgs (argc, argv);
+
+  TFile file(gOptInpFilename.c_str(),"READ");
+  TTree * tree = dynamic_cast <TTree *> ( file.Get("gtree") );
+  if(!tree) {
+    LOG("test", pFATAL) << "No GHEP event tree in: " << gOptInpFilename;
+    exit(1);
+  }
+
+  NtpMCEventRecord * mcrec = 0;
+  tree->SetBranchAddress("gmcrec", &mcrec);
+
+  int nev = (gOptNEvt > 0) ?
+        TMath::Min(gOptNEvt, (int)tree->GetEntries()) :
+        (int) tree->GetEntries();
+
+  // read the event sample in memory
+  vector< vector<Entry_t> > sample(nev);
+  int npart = 0;
+  for(int i = 0; i < nev; i++) {
+    tree->GetEntry(i);
+    EventRecord & event = *(mcrec->event);
+    int n = event.GetEntries();
+    for(int ip = 0; ip < n; ip++) {
+      GHepParticle * p = event.Particle(ip);
+      Entry_t entry;
+      entry.pdg  = p->Pdg();
+      entry.ist  = p->Status();
+      entry.mom1 = p->FirstMother();
+      entry.mom2 = p->LastMother();
+      entry.p4   = *p->P4();
+      entry.x4   = *p->X4();
+      sample[i].push_back(entry);
+    }
+    npart += n;
+    mcrec->Clear();
+  }
+  file.Close();
+
+  LOG("test", pNOTICE)
+     << "Replaying " << nev << " events (" << npart/TMath::Max(nev,1)
+     << " GHEP entries per event on average) x " << gOptNRep << " times";
+
+  long   nalloc_new   = 0;
+  long   nalloc_reuse = 0;
+  double t_new   = Benchmark(false, sample, nalloc_new);
+  double t_reuse = Benchmark(true,  sample, nalloc_reuse);
+
+  double nrec = TMath::Max(1., double(nev) * gOptNRep);
+
+  LOG("test", pNOTICE)
+     << "\n New record per event  : "
+     << 1e6 * t_new / nrec << " us/event, "
+     << nalloc_new / nrec  << " allocations/event"
+     << "\n Record reset in place : "
+     << 1e6 * t_reuse / nrec << " us/event, "
+     << nalloc_reuse / nrec  << " allocations/event";
+
+  return 0;
+}
+//___________________________________________________________________
+void Replay(EventRecord & event, const vector<Entry_t> & entries)
+{
+  // insert the entries as the event generation modules do, leaving the
+  // daughter lists to be built by the record
+  vector<Entry_t>::const_iterator it = entries.begin();
+  for( ; it != entries.end(); ++it) {
+    event.AddParticle(it->pdg, it->ist, it->mom1, it->mom2, -1, -1,
+                      it->p4, it->x4);
+  }
+  event.SetVertex(0,0,0,0);
+
+  // typical look-ups
+  event.Probe();
+  event.HitNucleon();
+  event.FinalStatePrimaryLepton();
+  event.RemnantNucleus();
+  event.NEntries(kPdgPiP, kIStStableFinalState);
+  event.NEntries(kPdgPiM, kIStStableFinalState);
+  event.NEntries(kPdgPi0, kIStStableFinalState);
+  event.FindParticle(kPdgProton, kIStStableFinalState, 0);
+}
+//___________________________________________________________________
+double Benchmark(
+  bool reuse, const vector< vector<Entry_t> > & sample, long & nalloc)
+{
+  TStopwatch timer;
+
+  EventRecord * event = (reuse) ? new EventRecord : 0;
+
+  gNAlloc   = 0;
+  gCountNew = true;
+  timer.Start();
+
+  for(int irep = 0; irep < gOptNRep; irep++) {
+    for(unsigned int i = 0; i < sample.size(); i++) {
+      if(reuse) {
+        event->ResetRecord();
+        Replay(*event, sample[i]);
+      } else {
+        event = new EventRecord;
+        Replay(*event, sample[i]);
+        delete event;
+        event = 0;
+      }
+    }
+  }
+
+  timer.Stop();
+  gCountNew = false;
+  nalloc = gNAlloc;
+
+  if(event) delete event;
+
+  return timer.RealTime();
+}
+//___________________________________________________________________
+void GetCommandLineArgs(int argc, char ** argv)
+{
+  CmdLnArgParser parser(argc,argv);
+
+  if( parser.OptionExists('f') ) {
+    gOptInpFilename = parser.ArgAsString('f');
+  } else {
+    LOG("test", pFATAL) << "Unspecified input filename - Exiting";
+    exit(1);
+  }
+  gOptNEvt = (parser.OptionExists('n')) ? parser.ArgAsInt('n') : -1;
+  gOptNRep = (parser.OptionExists('r')) ? parser.ArgAsInt('r') : 10;
+  gOptNRep = TMath::Max(gOptNRep, 1);
+}
+//___________________________________________________________________
@@ -40,8 +40,22 @@ int main(int /*argc*/, char ** /*argv*/)
      r += dr;
   }
 
+  // column depth vs cos(zenith), for a detector at the surface
+  // (tabulated and integrated)
+  TNtuple * column_depth = new TNtuple("column_depth","","costheta:L:X:Xint");
+  utils::prem::ColumnDepthTable table(0.);
+  for(int i = 0; i <= 200; i++) {
+     double costheta = -1. + 0.01*i;
+     double L    = table.PathLength(costheta);
+     double X    = table.ColumnDepth(costheta);
+     double Xint = utils::prem::ColumnDepthTable::Integrate(costheta, 0.);
+     column_depth->Fill(costheta, L/units::km,
+        X/(units::g/units::cm2), Xint/(units::g/units::cm2));
+  }
+
   TFile f("./prem.root","recreate");
   earth_density->Write();
+  column_depth->Write();
   f.Close();
 
   return 0;
@@ -0,0 +1,239 @@
+//____________________________________________________________________________
+/*!
+
+\program gtestXSecIntegration
+
+\brief   Benchmarks the reuse of the integration state (GSL workspaces and
+         adapted VEGAS grids, see XSecIntegrationContext) when computing the
+         spline knots the way gmkspl does.
+         For every interaction that the event generators of the input tune
+         can generate for the input initial states, the total cross section
+         is integrated at the spline knot energies
+          a) with every integral starting from a uniform grid (as gmkspl
+             --no-warm-start), and
+          b) with the adapted grids carried over between the energies of
+             each interaction (the gmkspl default).
+         The time taken and the largest relative difference between the two
+         sets of cross sections are reported.
+
+         Syntax :
+           gtestXSecIntegration -p nupdg -t tgtpdg --tune tune
+                               [-n nknots] [-e emax] [--event-generator-list list]
+
+         Options :
+           [] Denotes an optional argument
+           -p Comma separated list of neutrino PDG codes
+           -t Comma separated list of target PDG codes
+           -n Number of knots per spline (default: as in gmkspl)
+           -e Maximum energy (default: the validity range of each generator)
+           --tune, --event-generator-list : as in all GENIE apps
+
+\author  The GENIE Collaboration
+
+\created October 16, 2026
+
+\cpright Copyright (c) 2003-2023, The GENIE Collaboration
+         For the full text of the license visit http://copyright.genie-mc.org
+
+*/
+//____________________________________________________________________________
+
+#include <cstdlib>
+#include <string>
+#include <vector>
+
+#include <TMath.h>
+#include <TStopwatch.h>
+
+#include "Framework/EventGen/EventGeneratorI.h"
+#include "Framework/EventGen/EventGeneratorList.h"
+#include "Framework/EventGen/GEVGDriver.h"
+#include "Framework/EventGen/InteractionListGeneratorI.h"
+#include "Framework/EventGen/InteractionList.h"
+#include "Framework/EventGen/XSecAlgorithmI.h"
+#include "Framework/Interaction/Interaction.h"
+#include "Framework/Messenger/Messenger.h"
+#include "Framework/ParticleData/PDGCodeList.h"
+#include "Framework/Utils/AppInit.h"
+#include "Framework/Utils/Cache.h"
+#include "Framework/Utils/CmdLnArgParser.h"
+#include "Framework/Utils/RunOpt.h"
+#include "Framework/Utils/StringUtils.h"
+#include "Physics/XSectionIntegration/XSecIntegrationContext.h"
+
+using std::string;
+using std::vector;
+using namespace genie;
+
+// the interactions to integrate and their knot energies
+struct Job_t {
+  const XSecAlgorithmI * alg;
+  Interaction *          interaction;
+  vector<double>         E;
+};
+
+void   GetCommandLineArgs (int argc, char ** argv);
+void   BuildJobs          (vector<GEVGDriver *> & drivers, vector<Job_t> & jobs);
+double Benchmark          (bool warm, const vector<Job_t> & jobs,
+                           vector< vector<double> > & xsec);
+
+string gOptNuPdgCodeList;
+string gOptTgtPdgCodeList;
+int    gOptNKnots;
+double gOptMaxE;
+
+//___________________________________________________________________
+int main(int argc, char ** argv)
+{
+  GetCommandLineArgs (argc, argv);
+
+  if ( ! RunOpt::Instance()->Tune() ) {
+    LOG("test", pFATAL) << "No TuneId in RunOption";
+    exit(1);
+  }
+  RunOpt::Instance()->BuildTune();
+
+  utils::app_init::MesgThresholds(RunOpt::Instance()->MesgThresholdFiles());
+
+  vector<GEVGDriver *> drivers;
+  vector<Job_t>        jobs;
+  BuildJobs(drivers, jobs);
+
+  int nintegrals = 0;
+  for(unsigned int i = 0; i < jobs.size(); i++) nintegrals += jobs[i].E.size();
+
+  LOG("test", pNOTICE)
+     << "Integrating " << jobs.size() << " interactions at "
+     << nintegrals << " energies in total";
+
+  vector< vector<double> > xsec_cold, xsec_warm;
+  double t_cold = Benchmark(false, jobs, xsec_cold);
+  LOG("test", pNOTICE) << *XSecIntegrationContext::Instance();
+  double t_warm = Benchmark(true,  jobs, xsec_warm);
+  LOG("test", pNOTICE) << *XSecIntegrationContext::Instance();
+
+  // largest relative difference between the two sets of knots
+  double maxdiff = 0.;
+  string maxdiff_code = "";
+  for(unsigned int i = 0; i < jobs.size(); i++) {
+    for(unsigned int ie = 0; ie < jobs[i].E.size(); ie++) {
+      double x0 = xsec_cold[i][ie];
+      double x1 = xsec_warm[i][ie];
+      if(x0 <= 0.) continue;
+      double diff = TMath::Abs(x1-x0)/x0;
+      if(diff > maxdiff) {
+        maxdiff = diff;
+        maxdiff_code = jobs[i].interaction->AsString();
+      }
+    }
+  }
+
+  LOG("test", pNOTICE)
+     << "\n Uniform grid per integral : " << t_cold << " s"
+     << "\n Adapted grids carried over: " << t_warm << " s"
+     << "\n Speed-up                  : " << t_cold/TMath::Max(t_warm,1e-9)
+     << "\n Max relative xsec diff    : " << maxdiff
+     << (maxdiff_code.size() ? " (" + maxdiff_code + ")" : string(""));
+
+  for(unsigned int i = 0; i < jobs.size(); i++) delete jobs[i].interaction;
+  for(unsigned int i = 0; i < drivers.size(); i++) delete drivers[i];
+
+  return 0;
+}
+//___________________________________________________________________
+void BuildJobs(vector<GEVGDriver *> & drivers, vector<Job_t> & jobs)
+{
+  vector<string> nus  = utils::str::Split(gOptNuPdgCodeList,  ",");
+  vector<string> tgts = utils::str::Split(gOptTgtPdgCodeList, ",");
+
+  for(unsigned int inu = 0; inu < nus.size(); inu++) {
+    for(unsigned int itgt = 0; itgt < tgts.size(); itgt++) {
+      InitialState init_state(atoi(tgts[itgt].c_str()), atoi(nus[inu].c_str()));
+      GEVGDriver * driver = new GEVGDriver;
+      driver->SetEventGeneratorList(RunOpt::Instance()->EventGeneratorList());
+      driver->Configure(init_state);
+      drivers.push_back(driver);
+
+      // same interactions and knot energies as GEVGDriver::CreateSplines
+      const EventGeneratorList * evgl = driver->EventGenerators();
+      EventGeneratorList::const_iterator evgiter = evgl->begin();
+      for( ; evgiter != evgl->end(); ++evgiter) {
+        const EventGeneratorI * evgen = *evgiter;
+        InteractionList * ilst =
+           evgen->IntListGenerator()->CreateInteractionList(init_state);
+        if(!ilst) continue;
+
+        double Emin = evgen->ValidityContext().Emin();
+        double Emax = evgen->ValidityContext().Emax();
+        if(gOptMaxE > 0) Emax = TMath::Min(gOptMaxE, Emax);
+        int nknots = gOptNKnots;
+        if(nknots < 0) nknots = (int) (15 * TMath::Log10(Emax-Emin));
+        nknots = TMath::Max(nknots,30);
+
+        vector<double> E(nknots);
+        double dlogE = (TMath::Log10(Emax) - TMath::Log10(Emin)) / (nknots-1);
+        for(int i = 0; i < nknots; i++) {
+          E[i] = TMath::Power(10., TMath::Log10(Emin) + i * dlogE);
+        }
+
+        InteractionList::iterator intiter = ilst->begin();
+        for( ; intiter != ilst->end(); ++intiter) {
+          Job_t job;
+          job.alg         = evgen->CrossSectionAlg();
+          job.interaction = *intiter;
+          job.E           = E;
+          jobs.push_back(job);
+        }
+        // the interactions are now owned by the job list
+        ilst->clear();
+        delete ilst;
+      }
+    }
+  }
+}
+//___________________________________________________________________
+double Benchmark(
+  bool warm, const vector<Job_t> & jobs, vector< vector<double> > & xsec)
+{
+  // start from the same state in both modes
+  Cache::Instance()->RmAllCacheBranches();
+  XSecIntegrationContext::Instance()->Clear();
+  XSecIntegrationContext::Instance()->SetWarmStart(warm);
+
+  xsec.assign(jobs.size(), vector<double>());
+
+  TStopwatch timer;
+  timer.Start();
+
+  for(unsigned int i = 0; i < jobs.size(); i++) {
+    jobs[i].alg->IntegralBatch(jobs[i].interaction, jobs[i].E, xsec[i]);
+  }
+
+  timer.Stop();
+
+  return timer.RealTime();
+}
+//___________________________________________________________________
+void GetCommandLineArgs(int argc, char ** argv)
+{
+  RunOpt::Instance()->EnableBareXSecPreCalc(true);
+  RunOpt::Instance()->ReadFromCommandLine(argc,argv);
+
+  CmdLnArgParser parser(argc,argv);
+
+  if( parser.OptionExists('p') ) {
+    gOptNuPdgCodeList = parser.ArgAsString('p');
+  } else {
+    LOG("test", pFATAL) << "Unspecified neutrino PDG code list - Exiting";
+    exit(1);
+  }
+  if( parser.OptionExists('t') ) {
+    gOptTgtPdgCodeList = parser.ArgAsString('t');
+  } else {
+    LOG("test", pFATAL) << "Unspecified target PDG code list - Exiting";
+    exit(1);
+  }
+  gOptNKnots = (parser.OptionExists('n')) ? parser.ArgAsInt('n')    : -1;
+  gOptMaxE   = (parser.OptionExists('e')) ? parser.ArgAsDouble('e') : -1.;
+}
+//___________________________________________________________________